@@ -16,4 +16,87 @@ namespace common {
         static constexpr std::size_t MAX_THREADS = 32;
     };
 
+    struct SymbolConfig {
+        static constexpr std::size_t MAX_SYMBOLS = 4096;         // 심볼 id 상한 (배열 인덱스로 사용)
+        static constexpr std::size_t MAX_SYMBOL_LENGTH = 20;     // market_data.symbol VARCHAR(20)
+        static constexpr std::size_t PRELOAD_WINDOW_DAYS = 7;    // 시작 시 활성 심볼 조회 범위
+    };
+
+    struct BatchConfig {
+        static constexpr std::size_t MAX_ROWS_PER_STATEMENT = 5000;          // unnest 배치 1회당 최대 행 수
+        static constexpr std::size_t MAX_BYTES_PER_STATEMENT = 8 * 1024 * 1024;   // 배열 파라미터 총 크기 상한
+    };
+
+    struct PaginationConfig {
+        static constexpr std::size_t MAX_PAGE_SIZE = 1000;
+        static constexpr std::size_t EXACT_COUNT_THRESHOLD = 100000;   // 통계 추정치가 이보다 작으면 COUNT(*)로 정확히 계산
+        static constexpr std::size_t STREAM_FETCH_SIZE = 1000;         // forEachInRange 청크당 행 수 (메모리 상한)
+    };
+
+    struct WriteBehindConfig {
+        static constexpr std::size_t QUEUE_CAPACITY = 100000;     // 미기록 틱 상한 (초과 시 OverflowPolicy 적용)
+        static constexpr std::size_t BATCH_SIZE = 2000;           // 이 수만큼 쌓이면 즉시 flush
+        static constexpr std::size_t FLUSH_INTERVAL_MS = 200;     // 배치가 덜 찼어도 이 주기마다 flush
+        static constexpr std::size_t MAX_FLUSH_ATTEMPTS = 3;      // 배치 저장 실패 시 재시도 포함 최대 시도 횟수
+    };
+
+    struct MarketDataCacheConfig {
+        static constexpr std::size_t RECENT_TICKS = 512;          // 심볼별 최근 틱 링 크기
+        static constexpr std::size_t MAX_READ_RETRIES = 16;       // seqlock 읽기 재시도 상한 (초과 시 미스)
+    };
+
+    struct ReplicaConfig {
+        static constexpr const char* CLIENT_NAME = "replica";     // drogon db_clients 항목 이름
+        static constexpr std::size_t MAX_LAG_MS = 500;            // 이보다 뒤처지면 읽기를 primary로 전환
+        static constexpr std::size_t LAG_CHECK_INTERVAL_MS = 1000;
+    };
+
+    struct SettingsCacheConfig {
+        static constexpr std::size_t TTL_SECONDS = 60;            // 복호화된 설정 보관 시간
+        static constexpr std::size_t MAX_ENTRIES = 1024;          // 항목 수 상한 (항목당 잠금 메모리 슬롯 2개)
+    };
+
+    struct PartitionConfig {
+        static constexpr std::size_t MAINTENANCE_INTERVAL_MS = 60 * 60 * 1000;
+        static constexpr std::size_t MARKET_DATA_PREMAKE_DAYS = 7;     // 오늘 이후 미리 만들어 둘 일 단위 파티션 수
+        static constexpr std::size_t MARKET_DATA_RETAIN_DAYS = 90;     // 오늘 포함 보존 일수 (지나면 DETACH)
+        static constexpr std::size_t ORDER_PREMAKE_MONTHS = 2;
+        static constexpr std::size_t ORDER_RETAIN_MONTHS = 0;          // 0: 분리하지 않음 (주문/체결 이력은 보존)
+        static constexpr std::size_t TRADE_PREMAKE_MONTHS = 2;
+        static constexpr std::size_t TRADE_RETAIN_MONTHS = 0;
+        static constexpr bool DROP_DETACHED = false;                   // false면 분리한 테이블은 아카이브용으로 남김
+    };
+
+    struct CandleConfig {
+        static constexpr std::size_t RECENT_BARS = 512;           // 해상도별 메모리에 유지할 마감 봉 수
+        static constexpr std::size_t FLUSH_INTERVAL_MS = 1000;    // 마감된 봉 델타 기록 주기
+        static constexpr std::size_t CLOSE_GRACE_MS = 2000;       // 구간 종료 후 늦은 틱을 기다리는 시간
+        static constexpr std::size_t MAX_DELTA_AGE_MS = 60000;    // 진행 중인 봉(1h/1d 등)도 이 시간이 지나면 부분 기록
+        static constexpr std::size_t MAX_FLUSH_ATTEMPTS = 3;      // 봉 배치 저장 실패 시 재시도 포함 최대 시도 횟수
+    };
+
+    struct TradeAggregateConfig {
+        static constexpr std::size_t BUCKET_SECONDS = 60;         // 누적 합 버킷 폭 (경계 밖 부분은 원본 행으로 보정)
+        static constexpr std::size_t HISTORY_DAYS = 30;           // 로드 시점 기준 인덱스에 담는 과거 구간
+        static constexpr std::size_t SPAN_DAYS = 60;              // 인덱스 전체 구간 (HISTORY_DAYS 이후는 새 체결용)
+        static constexpr std::size_t REFRESH_MARGIN_HOURS = 24;   // 구간 끝까지 이만큼 남으면 다시 로드
+        static constexpr std::size_t MAX_LOAD_ATTEMPTS = 3;       // 로드 중 쓰기가 겹치면 재시도 (초과 시 SQL 집계)
+    };
+
+    struct GroupCommitConfig {
+        static constexpr std::size_t MAX_LATENCY_US = 1000;       // 첫 쓰기 도착 후 다른 쓰기를 기다리는 최대 시간
+        static constexpr std::size_t MAX_BATCH = 128;             // 한 트랜잭션에 묶는 최대 쓰기 수 (차면 즉시 커밋)
+    };
+
+    struct PipelineConfig {
+        static constexpr std::size_t MAX_STATEMENTS = 64;         // 파이프라인 하나에 넣을 수 있는 최대 문장 수
+        static constexpr std::size_t MAX_IDLE_CONNECTIONS = 4;    // 재사용을 위해 보관하는 전용 libpq 연결 수
+        static constexpr std::size_t TIMEOUT_MS = 5000;           // 결과 수집 대기 상한 (초과 시 연결 폐기)
+    };
+
+    struct FindByIdConfig {
+        static constexpr std::size_t COALESCE_WINDOW_US = 200;    // 진행 중인 조회가 있을 때 다음 배치가 id를 더 모으는 최대 시간
+        static constexpr std::size_t MAX_BATCH = 256;             // 한 쿼리로 묶는 최대 id 수 (차면 즉시 조회)
+    };
+
 } // namespace common
\ No newline at end of file
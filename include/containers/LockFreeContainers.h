@@ -22,7 +22,7 @@ namespace containers {
         struct queue_traits : public cds::container::msqueue::traits {
             using backoff_strategy = typename traits_type::BackoffStrategy::type;
             static constexpr size_t allocation_size = traits_type::default_block_size;
-        }
+        };
 
         using queue_type = cds::container::MSQueue<cds::gc::HP, T, queue_traits>;
 
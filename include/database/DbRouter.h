@@ -0,0 +1,125 @@
+#pragma once
+
+#include "common/Config.h"
+#include <drogon/drogon.h>
+#include <drogon/HttpRequest.h>
+#include <drogon/HttpResponse.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace database {
+
+    // 읽기/쓰기 DB 클라이언트 라우팅
+    // - 쓰기와 트랜잭션 안의 읽기는 항상 primary(drogon 기본 클라이언트)
+    // - 저장소/매퍼의 단순 조회는 이름 있는 replica 클라이언트로 보냄
+    // - 모니터 스레드가 replica의 pg_last_xact_replay_timestamp() 기준 지연을 주기적으로 측정하고
+    //   maxLag를 넘거나 측정에 실패하면 replica가 따라잡을 때까지 읽기도 primary로 보냄
+    // - 요청 범위(installRequestScope) 안에서 쓰기가 한 번이라도 일어나면 그 요청의 이후 읽기는 primary
+    // replica가 설정되지 않았거나 start() 전이면 모든 요청이 primary로 감
+    class DbRouter {
+    public:
+        struct Options {
+            std::string replicaClientName = common::ReplicaConfig::CLIENT_NAME;
+            std::chrono::milliseconds maxLag{common::ReplicaConfig::MAX_LAG_MS};
+            std::chrono::milliseconds checkInterval{common::ReplicaConfig::LAG_CHECK_INTERVAL_MS};
+        };
+
+        struct Stats {
+            uint64_t replicaReads;
+            uint64_t primaryReads;      // replica 미설정/지연 초과/쓰기 고정으로 primary에서 처리한 읽기
+            uint64_t pinnedReads;       // 그중 read-your-writes 고정으로 인한 것
+            int64_t lastLagMillis;      // 마지막 측정값. 측정 실패 시 -1
+            bool replicaHealthy;
+        };
+
+        // 요청 하나의 read-your-writes 상태
+        // HTTP 요청 속성에 보관되므로 요청을 처리하는 스레드(코루틴 재개 스레드 포함)가 모두 같은 상태를 공유
+        struct ReadYourWrites {
+            std::atomic<bool> wrote{false};
+        };
+        using ReadYourWritesPtr = std::shared_ptr<ReadYourWrites>;
+
+        // 현재 스레드에 read-your-writes 상태를 활성화하는 범위
+        // 범위 안에서 writer()가 호출되면 같은 상태를 쓰는 이후 reader()는 primary 반환
+        // - 기본 생성: 이미 활성화된 상태(요청 범위)가 있으면 공유, 없으면 이 범위 전용 상태 생성
+        // - 상태 지정: 코루틴이 co_await 뒤 다른 스레드에서 재개되면 requestState(req)로 다시 열어야 함
+        //   (범위는 스레드 단위이므로 co_await를 가로질러 유지하지 않음)
+        class ReadYourWritesScope {
+        public:
+            ReadYourWritesScope();
+            explicit ReadYourWritesScope(ReadYourWritesPtr state);
+            ~ReadYourWritesScope();
+            ReadYourWritesScope(const ReadYourWritesScope&) = delete;
+            ReadYourWritesScope& operator=(const ReadYourWritesScope&) = delete;
+
+            bool hasWritten() const { return state_->wrote.load(std::memory_order_acquire); }
+
+        private:
+            ReadYourWritesPtr state_;
+            ReadYourWritesPtr previous_;
+        };
+
+        static DbRouter& getInstance();
+
+        // replica 클라이언트가 drogon 앱에 등록돼 있어야 함 (main이 loadConfigJson으로 적용). 없으면 라우팅 없이 primary만 사용
+        // drogon은 app().run() 안에서 DB 클라이언트를 만들므로 beginning advice에서 호출
+        // 이미 실행 중이면 std::logic_error
+        void start(const Options& options);
+        void start() { start(Options{}); }
+        void stop();
+
+        // 쓰기/트랜잭션용. 현재 ReadYourWritesScope를 쓰기 상태로 표시
+        drogon::orm::DbClientPtr writer();
+
+        // 조회용. replica가 건강하고 현재 범위에서 쓰기가 없었으면 replica
+        drogon::orm::DbClientPtr reader();
+
+        // 쓰기 표시 없이 primary. 최신성이 필요한 조회용
+        static drogon::orm::DbClientPtr primary() { return drogon::app().getDbClient(); }
+
+        // 요청 속성에 보관된 read-your-writes 상태 (없으면 만들어 저장)
+        static ReadYourWritesPtr requestState(const drogon::HttpRequestPtr& req);
+
+        // 모든 HTTP 요청에 read-your-writes 범위 적용 (app().run() 전에 한 번)
+        // 핸들러 직전에 요청 상태를 처리 스레드에 활성화하고 응답 후 해제
+        // 동기 핸들러는 그대로 보장되고, 코루틴 핸들러는 재개 후 ReadYourWritesScope(requestState(req))로 다시 엶
+        static void installRequestScope();
+
+        bool isReplicaHealthy() const { return replicaHealthy_.load(std::memory_order_acquire); }
+        Stats getStats() const;
+
+    private:
+        DbRouter() = default;
+        ~DbRouter();
+        DbRouter(const DbRouter&) = delete;
+        DbRouter& operator=(const DbRouter&) = delete;
+
+        void monitor();
+        // 지연(ms) 측정. 측정 실패 시 -1
+        int64_t measureLag();
+
+        Options options_;
+        std::mutex lifecycleMutex_;
+        std::thread monitor_;
+        std::atomic<bool> running_{false};
+        std::atomic<bool> replicaHealthy_{false};
+        std::atomic<int64_t> lastLagMillis_{-1};
+
+        std::mutex stopMutex_;
+        std::condition_variable stopCv_;
+        bool stopRequested_{false};
+
+        std::atomic<uint64_t> replicaReads_{0};
+        std::atomic<uint64_t> primaryReads_{0};
+        std::atomic<uint64_t> pinnedReads_{0};
+
+        static thread_local ReadYourWritesPtr currentState_;
+    };
+
+} // namespace database
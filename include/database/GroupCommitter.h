@@ -0,0 +1,416 @@
+#pragma once
+
+#include "common/Config.h"
+#include "utils/Logger.h"
+#include <drogon/orm/DbClient.h>
+#include <drogon/utils/coroutine.h>
+#include <trantor/net/EventLoop.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace database {
+
+    // 그룹 커밋: 여러 스레드의 작은 쓰기를 한 트랜잭션으로 묶어 COMMIT 왕복/fsync를 나눠 씀
+    // - 작성자는 submit(콜백) 또는 submitCoro(코루틴)로 op(트랜잭션을 받아 실행)를 넣음. 호출자는 블로킹하지 않음
+    // - committer 스레드는 첫 op가 도착한 뒤 maxLatency 동안(또는 maxBatch개가 찰 때까지) 모은 op를
+    //   한 트랜잭션에서 차례로 실행하고, COMMIT이 성공하면 모든 op를 함께 완료
+    // - op 하나가 실패하면 트랜잭션을 롤백하고 그 op만 예외로 완료한 뒤 나머지를 다시 실행
+    //   따라서 op는 트랜잭션 밖 부수 효과 없이 여러 번 실행해도 안전해야 함
+    // - COMMIT 실패 시 묶인 op 모두 예외로 완료
+    // - maxLatency는 쓰기 하나가 추가로 기다리는 시간의 상한 (처리량과 지연의 교환점)
+    // - 트랜잭션은 TransactionRunner가 열고 커밋 (운영은 GroupCommitter의 primary 실행기, 테스트는 가짜 실행기)
+    template <typename Transaction>
+    class BasicGroupCommitter {
+    public:
+        // body(트랜잭션)를 새 트랜잭션에서 실행하고 COMMIT 성공 여부 반환
+        // body가 예외를 던지면 롤백하고 그 예외를 그대로 전파
+        using TransactionRunner = std::function<bool(const std::function<void(Transaction&)>& body)>;
+
+        template <typename Op>
+        using ResultOf = std::invoke_result_t<std::decay_t<Op>&, Transaction&>;
+
+        struct Options {
+            std::chrono::microseconds maxLatency{common::GroupCommitConfig::MAX_LATENCY_US};
+            size_t maxBatch = common::GroupCommitConfig::MAX_BATCH;
+        };
+
+        struct Stats {
+            uint64_t submitted;
+            uint64_t committed;     // COMMIT까지 완료된 op 수
+            uint64_t failed;        // 예외로 완료된 op 수
+            uint64_t batches;       // COMMIT한 트랜잭션 수
+            uint64_t reruns;        // 이웃 op 실패로 다시 실행한 횟수
+        };
+
+        struct NoCommitHook {
+            template <typename Result>
+            void operator()(const Result&) const {}
+            void operator()() const {}
+        };
+
+        explicit BasicGroupCommitter(TransactionRunner runner) : runner_(std::move(runner)) {}
+        virtual ~BasicGroupCommitter() { stop(); }
+
+        BasicGroupCommitter(const BasicGroupCommitter&) = delete;
+        BasicGroupCommitter& operator=(const BasicGroupCommitter&) = delete;
+
+        // committer 스레드 시작. 이미 실행 중이면 std::logic_error
+        void start(const Options& options);
+        void start() { start(Options{}); }
+
+        // 새 op 수신을 막고 대기 중인 op를 모두 커밋한 뒤 종료
+        void stop();
+
+        bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+        // op(Transaction&)를 다음 그룹 트랜잭션에 넣음
+        // COMMIT 성공 시 onCommitted(op 결과), 실패 시 onFailed(exception_ptr)
+        // 콜백은 committer 스레드에서 호출되므로 짧게 (다음 배치 커밋을 늦춤)
+        // 실행 중이 아니면 호출 스레드에서 단독 트랜잭션으로 처리하고 반환 전에 콜백 호출
+        template <typename Op, typename OnCommitted, typename OnFailed>
+        void submit(Op&& op, OnCommitted&& onCommitted, OnFailed&& onFailed);
+
+        // 코루틴 버전: COMMIT 후 op 결과로 완료
+        // onCommit(결과)은 COMMIT 직후 committer 스레드에서 호출 (인메모리 인덱스 반영용, 실패해도 결과는 전달)
+        // 코루틴은 co_await한 이벤트 루프에서 재개 (루프 밖에서 기다리면 완료한 스레드에서 재개)
+        template <typename Op, typename OnCommit = NoCommitHook>
+        drogon::Task<ResultOf<Op>> submitCoro(Op op, OnCommit onCommit = OnCommit{});
+
+        Stats getStats() const;
+
+    private:
+        struct Entry {
+            std::function<void(Transaction&)> run;          // op 실행 (결과는 보관)
+            std::function<void()> complete;                 // COMMIT 후 결과로 완료
+            std::function<void(std::exception_ptr)> fail;
+            std::chrono::steady_clock::time_point enqueuedAt;
+        };
+
+        template <typename Result>
+        using Stored = std::optional<std::conditional_t<std::is_void_v<Result>, bool, Result>>;
+
+        template <typename Op, typename OnCommit>
+        class CommitAwaiter;
+
+        static void reportCallbackFailure(std::exception_ptr error) noexcept;
+
+        // 실행 중이 아니면 false (호출자가 직접 커밋)
+        bool enqueue(Entry& entry);
+        void run();
+        void commitBatch(std::vector<Entry>& batch);
+
+        TransactionRunner runner_;
+        Options options_;
+        std::mutex lifecycleMutex_;     // start/stop 직렬화
+        std::thread committer_;
+        std::atomic<bool> running_{false};
+
+        std::mutex queueMutex_;
+        std::condition_variable queueCv_;
+        std::deque<Entry> queue_;
+        bool accepting_{false};
+
+        std::atomic<uint64_t> submitted_{0};
+        std::atomic<uint64_t> committed_{0};
+        std::atomic<uint64_t> failed_{0};
+        std::atomic<uint64_t> batches_{0};
+        std::atomic<uint64_t> reruns_{0};
+    };
+
+    // primary 클라이언트로 커밋하는 프로세스 전역 그룹 커밋 (saveGrouped 경로)
+    class GroupCommitter : public BasicGroupCommitter<drogon::orm::Transaction> {
+    public:
+        using Transaction = drogon::orm::Transaction;
+
+        static GroupCommitter& getInstance();
+
+    private:
+        GroupCommitter();
+        ~GroupCommitter() override = default;
+    };
+
+    // submitCoro의 대기 객체: op를 넣고 완료 콜백에서 결과를 채운 뒤 코루틴 재개
+    template <typename Transaction>
+    template <typename Op, typename OnCommit>
+    class BasicGroupCommitter<Transaction>::CommitAwaiter : public drogon::CallbackAwaiter<ResultOf<Op>> {
+    public:
+        CommitAwaiter(BasicGroupCommitter& committer, Op op, OnCommit onCommit)
+            : committer_(committer), op_(std::move(op)), onCommit_(std::move(onCommit)) {}
+
+        void await_suspend(std::coroutine_handle<> handle) {
+            trantor::EventLoop* loop = trantor::EventLoop::getEventLoopOfCurrentThread();
+            committer_.submit(
+                std::move(op_),
+                [this, handle, loop, onCommit = std::move(onCommit_)](auto&&... result) mutable {
+                    try {
+                        onCommit(static_cast<const std::decay_t<decltype(result)>&>(result)...);
+                    } catch (...) {
+                        // 커밋은 끝났으므로 결과는 그대로 전달 (훅 실패는 op 실패가 아님)
+                        reportCallbackFailure(std::current_exception());
+                    }
+                    if constexpr (sizeof...(result) > 0) {
+                        this->setValue(std::move(result)...);
+                    }
+                    resume(loop, handle);
+                },
+                [this, handle, loop](std::exception_ptr error) {
+                    this->setException(error);
+                    resume(loop, handle);
+                });
+        }
+
+    private:
+        static void resume(trantor::EventLoop* loop, std::coroutine_handle<> handle) {
+            if (loop != nullptr) {
+                loop->queueInLoop([handle] { handle.resume(); });
+            } else {
+                handle.resume();
+            }
+        }
+
+        BasicGroupCommitter& committer_;
+        Op op_;
+        OnCommit onCommit_;
+    };
+
+    template <typename Transaction>
+    void BasicGroupCommitter<Transaction>::start(const Options& options) {
+        if (options.maxBatch == 0 || options.maxLatency.count() < 0) {
+            throw std::invalid_argument("Group commit batch size must be positive and latency non-negative");
+        }
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (running_.load(std::memory_order_acquire)) {
+            throw std::logic_error("Group committer is already running");
+        }
+
+        options_ = options;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            accepting_ = true;
+        }
+        running_.store(true, std::memory_order_release);
+        committer_ = std::thread([this] { run(); });
+
+        TRADING_LOG_INFO("Group committer started (max latency={}us, max batch={})",
+                         options_.maxLatency.count(), options_.maxBatch);
+    }
+
+    template <typename Transaction>
+    void BasicGroupCommitter<Transaction>::stop() {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            accepting_ = false;
+        }
+        queueCv_.notify_one();
+        if (committer_.joinable()) {
+            committer_.join();
+        }
+        running_.store(false, std::memory_order_release);
+
+        const auto stats = getStats();
+        TRADING_LOG_INFO("Group committer stopped (committed={}, failed={}, batches={})",
+                         stats.committed, stats.failed, stats.batches);
+    }
+
+    template <typename Transaction>
+    typename BasicGroupCommitter<Transaction>::Stats BasicGroupCommitter<Transaction>::getStats() const {
+        return Stats{
+            submitted_.load(std::memory_order_relaxed),
+            committed_.load(std::memory_order_relaxed),
+            failed_.load(std::memory_order_relaxed),
+            batches_.load(std::memory_order_relaxed),
+            reruns_.load(std::memory_order_relaxed)
+        };
+    }
+
+    template <typename Transaction>
+    void BasicGroupCommitter<Transaction>::reportCallbackFailure(std::exception_ptr error) noexcept {
+        try {
+            std::rethrow_exception(error);
+        } catch (const std::exception& e) {
+            TRADING_LOG_ERROR("Group commit callback failed: {}", e.what());
+        } catch (...) {
+            TRADING_LOG_ERROR("Group commit callback failed");
+        }
+    }
+
+    template <typename Transaction>
+    template <typename Op, typename OnCommitted, typename OnFailed>
+    void BasicGroupCommitter<Transaction>::submit(Op&& op, OnCommitted&& onCommitted, OnFailed&& onFailed) {
+        using Result = ResultOf<Op>;
+
+        auto value = std::make_shared<Stored<Result>>();
+
+        Entry entry;
+        entry.run = [value, op = std::forward<Op>(op)](Transaction& transaction) mutable {
+            if constexpr (std::is_void_v<Result>) {
+                op(transaction);
+                value->emplace(true);
+            } else {
+                value->emplace(op(transaction));
+            }
+        };
+        entry.complete = [value, onCommitted = std::forward<OnCommitted>(onCommitted)]() mutable {
+            try {
+                if constexpr (std::is_void_v<Result>) {
+                    onCommitted();
+                } else {
+                    onCommitted(std::move(**value));
+                }
+            } catch (...) {
+                reportCallbackFailure(std::current_exception());
+            }
+        };
+        entry.fail = [onFailed = std::forward<OnFailed>(onFailed)](std::exception_ptr error) mutable {
+            try {
+                onFailed(error);
+            } catch (...) {
+                reportCallbackFailure(std::current_exception());
+            }
+        };
+
+        submitted_.fetch_add(1, std::memory_order_relaxed);
+        if (!enqueue(entry)) {
+            std::vector<Entry> single;
+            single.push_back(std::move(entry));
+            commitBatch(single);
+        }
+    }
+
+    template <typename Transaction>
+    template <typename Op, typename OnCommit>
+    drogon::Task<typename BasicGroupCommitter<Transaction>::template ResultOf<Op>>
+    BasicGroupCommitter<Transaction>::submitCoro(Op op, OnCommit onCommit) {
+        if constexpr (std::is_void_v<ResultOf<Op>>) {
+            co_await CommitAwaiter<Op, OnCommit>(*this, std::move(op), std::move(onCommit));
+        } else {
+            co_return co_await CommitAwaiter<Op, OnCommit>(*this, std::move(op), std::move(onCommit));
+        }
+    }
+
+    template <typename Transaction>
+    bool BasicGroupCommitter<Transaction>::enqueue(Entry& entry) {
+        size_t queued;
+        {
+            std::lock_guard<std::mutex> lock(queueMutex_);
+            if (!accepting_) {
+                return false;
+            }
+            entry.enqueuedAt = std::chrono::steady_clock::now();
+            queue_.push_back(std::move(entry));
+            queued = queue_.size();
+        }
+        // 첫 op(지연 타이머 시작)와 배치가 찬 순간에만 깨움
+        if (queued == 1 || queued >= options_.maxBatch) {
+            queueCv_.notify_one();
+        }
+        return true;
+    }
+
+    template <typename Transaction>
+    void BasicGroupCommitter<Transaction>::run() {
+        std::vector<Entry> batch;
+        batch.reserve(options_.maxBatch);
+
+        std::unique_lock<std::mutex> lock(queueMutex_);
+        for (;;) {
+            queueCv_.wait(lock, [this] { return !accepting_ || !queue_.empty(); });
+            if (queue_.empty()) {
+                break;  // 종료 요청 + 대기 op 없음
+            }
+
+            // 가장 오래 기다린 op 기준으로 지연 예산이 남아 있으면 더 모음
+            // (이전 배치를 커밋하는 동안 쌓인 op는 이미 예산을 넘겼으므로 바로 커밋)
+            const auto deadline = queue_.front().enqueuedAt + options_.maxLatency;
+            queueCv_.wait_until(lock, deadline, [this] {
+                return !accepting_ || queue_.size() >= options_.maxBatch;
+            });
+
+            const size_t count = std::min(queue_.size(), options_.maxBatch);
+            for (size_t i = 0; i < count; ++i) {
+                batch.push_back(std::move(queue_.front()));
+                queue_.pop_front();
+            }
+
+            lock.unlock();
+            commitBatch(batch);
+            batch.clear();
+            lock.lock();
+        }
+    }
+
+    template <typename Transaction>
+    void BasicGroupCommitter<Transaction>::commitBatch(std::vector<Entry>& batch) {
+        while (!batch.empty()) {
+            size_t failedIndex = batch.size();
+            std::exception_ptr failure;
+            bool committed = false;
+
+            try {
+                committed = runner_([&batch, &failedIndex](Transaction& transaction) {
+                    for (size_t i = 0; i < batch.size(); ++i) {
+                        failedIndex = i;
+                        batch[i].run(transaction);
+                    }
+                    failedIndex = batch.size();
+                });
+                if (!committed) {
+                    failure = std::make_exception_ptr(std::runtime_error("Group commit failed"));
+                }
+            } catch (...) {
+                failure = std::current_exception();
+            }
+
+            if (failedIndex < batch.size()) {
+                // 실패한 op만 예외로 완료하고 나머지는 새 트랜잭션에서 다시 실행
+                batch[failedIndex].fail(failure);
+                failed_.fetch_add(1, std::memory_order_relaxed);
+                batch.erase(batch.begin() + static_cast<std::ptrdiff_t>(failedIndex));
+                reruns_.fetch_add(batch.size(), std::memory_order_relaxed);
+                continue;
+            }
+
+            if (!committed) {
+                try {
+                    std::rethrow_exception(failure);
+                } catch (const std::exception& e) {
+                    TRADING_LOG_ERROR("Group commit of {} operations failed: {}", batch.size(), e.what());
+                } catch (...) {
+                    TRADING_LOG_ERROR("Group commit of {} operations failed", batch.size());
+                }
+                for (auto& entry : batch) {
+                    entry.fail(failure);
+                }
+                failed_.fetch_add(batch.size(), std::memory_order_relaxed);
+                return;
+            }
+
+            for (auto& entry : batch) {
+                entry.complete();
+            }
+            committed_.fetch_add(batch.size(), std::memory_order_relaxed);
+            batches_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+    }
+
+} // namespace database
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "common/Config.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace database {
+
+    // 시간 범위 파티션 유지 관리 (market_data / orders / trades, V4__time_partitioning.sql)
+    // - 주기적으로 현재 구간부터 premake 구간 뒤까지 파티션을 미리 만들어 둠 (ensure_time_partition)
+    // - 보존 구간을 벗어난 파티션은 DETACH PARTITION ... CONCURRENTLY로 분리 (행 삭제 없는 메타데이터 작업)
+    //   dropDetached면 분리한 테이블을 DROP, 아니면 아카이브용으로 남김
+    // - 파티션 이름 규칙은 마이그레이션과 같음: <table>_pYYYYMMDD (일) / <table>_pYYYYMM (월), 경계는 UTC 자정
+    class PartitionManager {
+    public:
+        enum class Granularity { DAILY, MONTHLY };
+
+        struct Policy {
+            std::string table;
+            Granularity granularity;
+            size_t premake;     // 현재 구간 이후 미리 만들 구간 수
+            size_t retain;      // 현재 구간 포함 보존 구간 수. 0이면 분리하지 않음
+        };
+
+        struct Options {
+            std::vector<Policy> policies = defaultPolicies();
+            std::chrono::milliseconds interval{common::PartitionConfig::MAINTENANCE_INTERVAL_MS};
+            bool dropDetached = common::PartitionConfig::DROP_DETACHED;
+        };
+
+        struct Period {
+            std::string name;
+            std::chrono::sys_days from;     // 포함
+            std::chrono::sys_days to;       // 미포함
+        };
+
+        struct Plan {
+            std::vector<Period> create;
+            std::vector<std::string> detach;
+        };
+
+        static std::vector<Policy> defaultPolicies();
+
+        // 구간 계산 (DB 없이 결정되는 부분)
+        static std::chrono::sys_days periodStart(Granularity granularity, std::chrono::sys_days day);
+        static std::chrono::sys_days advance(Granularity granularity, std::chrono::sys_days start, int periods);
+        static std::string partitionName(const Policy& policy, std::chrono::sys_days start);
+        // 규칙에 맞지 않는 이름이면 nullopt
+        static std::optional<std::chrono::sys_days> parsePartitionStart(const Policy& policy, const std::string& name);
+        // existing: 현재 부착된 파티션 이름
+        static Plan plan(const Policy& policy, std::chrono::sys_days today, const std::vector<std::string>& existing);
+
+        static PartitionManager& getInstance();
+
+        // 첫 유지 관리를 호출 스레드에서 끝낸 뒤 주기 스레드 시작 (쓰기 시작 전에 현재 구간 파티션 보장)
+        // 이미 실행 중이면 std::logic_error
+        void start(const Options& options);
+        void start() { start(Options{}); }
+        void stop();
+
+        // 모든 정책을 한 번 적용. 정책별 실패는 로그만 남기고 다음 정책 진행
+        void runOnce();
+
+    private:
+        PartitionManager() = default;
+        ~PartitionManager();
+        PartitionManager(const PartitionManager&) = delete;
+        PartitionManager& operator=(const PartitionManager&) = delete;
+
+        void loop();
+        void maintain(const Policy& policy, std::chrono::sys_days today, bool dropDetached);
+
+        Options options_;
+        std::mutex lifecycleMutex_;
+        std::mutex runMutex_;
+        std::thread worker_;
+        std::atomic<bool> running_{false};
+
+        std::mutex stopMutex_;
+        std::condition_variable stopCv_;
+        bool stopRequested_{false};
+    };
+
+} // namespace database
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <libpq-fe.h>
+#include <memory>
+#include <string>
+
+namespace database {
+
+    // drogon DbClient가 노출하지 않는 libpq 기능(COPY 등)용 전용 연결
+    // 스레드 안전하지 않음: 한 번에 한 스레드만 사용
+    class PgConnection {
+    public:
+        // utils::Config의 DB 설정으로 연결 문자열 생성
+        static std::string connectionStringFromConfig();
+
+        // 연결 실패 시 std::runtime_error
+        explicit PgConnection(const std::string& connectionString);
+        ~PgConnection() = default;
+
+        PgConnection(const PgConnection&) = delete;
+        PgConnection& operator=(const PgConnection&) = delete;
+        PgConnection(PgConnection&&) noexcept = default;
+        PgConnection& operator=(PgConnection&&) noexcept = default;
+
+        // 결과가 필요 없는 명령 실행. 실패 시 std::runtime_error
+        void exec(const std::string& sql);
+
+        // 연결이 끊겼으면 재연결
+        bool ensureConnected();
+
+        PGconn* raw() const { return conn_.get(); }
+        std::string lastError() const;
+
+    private:
+        struct Deleter {
+            void operator()(PGconn* conn) const { PQfinish(conn); }
+        };
+
+        std::string connectionString_;
+        std::unique_ptr<PGconn, Deleter> conn_;
+    };
+
+} // namespace database
@@ -0,0 +1,164 @@
+#pragma once
+
+#include "common/Config.h"
+#include "database/PgConnection.h"
+#include <charconv>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace database {
+
+    // 파이프라인 문장 하나의 결과 (PGresult 소유, 텍스트 형식 값)
+    class PipelineResult {
+    public:
+        explicit PipelineResult(PGresult* result) : result_(result) {}
+
+        // 문장이 성공했는지 (실패, 또는 앞 문장 실패로 중단된 경우 false)
+        bool succeeded() const {
+            const auto status = PQresultStatus(result_.get());
+            return status == PGRES_COMMAND_OK || status == PGRES_TUPLES_OK;
+        }
+        std::string errorMessage() const;
+
+        size_t rows() const { return static_cast<size_t>(PQntuples(result_.get())); }
+        size_t columns() const { return static_cast<size_t>(PQnfields(result_.get())); }
+        size_t affectedRows() const;
+
+        // 컬럼 이름으로 인덱스 조회. 없으면 std::out_of_range
+        size_t column(const char* name) const;
+
+        bool isNull(size_t row, size_t column) const {
+            return PQgetisnull(result_.get(), static_cast<int>(row), static_cast<int>(column)) != 0;
+        }
+        std::string_view value(size_t row, size_t column) const {
+            return std::string_view(
+                PQgetvalue(result_.get(), static_cast<int>(row), static_cast<int>(column)),
+                static_cast<size_t>(PQgetlength(result_.get(), static_cast<int>(row), static_cast<int>(column))));
+        }
+
+        // NULL이거나 해석할 수 없는 값이면 std::runtime_error (NULL 허용 컬럼은 isNull 먼저 확인)
+        int64_t readInt64(size_t row, size_t column) const;
+        double readDouble(size_t row, size_t column) const;
+        bool readBool(size_t row, size_t column) const { return value(row, column) == "t"; }
+
+    private:
+        struct Deleter {
+            void operator()(PGresult* result) const { PQclear(result); }
+        };
+
+        std::unique_ptr<PGresult, Deleter> result_;
+    };
+
+    // 서로 독립적인 문장 묶음. 파라미터는 텍스트 형식으로 보관 (std::nullopt는 NULL)
+    //
+    // 사용 예:
+    //   Pipeline pipeline;
+    //   const size_t count = pipeline.add("SELECT COUNT(*) FROM t WHERE a = $1", userId);
+    //   const size_t known = pipeline.add("SELECT EXISTS (SELECT 1 FROM u WHERE b = $1)", ip);
+    //   auto results = PipelineExecutor::getInstance().execute(pipeline);
+    //   results[count].readInt64(0, 0);
+    class Pipeline {
+    public:
+        // 문장 추가. execute 결과에서의 인덱스 반환
+        template <typename... Args>
+        size_t add(std::string sql, const Args&... args) {
+            Statement statement{std::move(sql), {}};
+            statement.params.reserve(sizeof...(Args));
+            (statement.params.push_back(toParam(args)), ...);
+            statements_.push_back(std::move(statement));
+            return statements_.size() - 1;
+        }
+
+        size_t size() const { return statements_.size(); }
+        bool empty() const { return statements_.empty(); }
+
+        // 값의 텍스트 형식 파라미터 (std::nullopt와 빈 std::optional은 NULL)
+        template <typename T>
+        static std::optional<std::string> toParam(const T& value) {
+            if constexpr (std::is_same_v<T, std::nullopt_t>) {
+                return std::nullopt;
+            } else if constexpr (std::is_same_v<T, bool>) {
+                return std::string(value ? "t" : "f");
+            } else if constexpr (std::is_arithmetic_v<T>) {
+                // 부동소수점도 왕복 가능한 최단 표현
+                char buffer[32];
+                const auto end = std::to_chars(buffer, buffer + sizeof(buffer), value).ptr;
+                return std::string(buffer, end);
+            } else if constexpr (std::is_convertible_v<const T&, std::string_view>) {
+                return std::string(std::string_view(value));
+            } else {
+                return value ? toParam(*value) : std::nullopt;     // std::optional<U>
+            }
+        }
+
+    private:
+        friend class PipelineExecutor;
+
+        struct Statement {
+            std::string sql;
+            std::vector<std::optional<std::string>> params;
+        };
+
+        std::vector<Statement> statements_;
+    };
+
+    // libpq 파이프라인 모드(libpq 14+)로 독립 문장들을 결과를 기다리지 않고 연달아 보낸 뒤 결과를 모아 받음
+    // - 문장 N개가 N번의 왕복 대신 약 1번의 왕복으로 끝남 (서버 버전과 무관, 클라이언트 기능)
+    // - 한 번의 Sync로 묶이므로 명시적 BEGIN이 없으면 전체가 암묵적 한 트랜잭션:
+    //   문장 하나가 실패하면 뒤 문장은 서버가 건너뛰고 앞의 쓰기도 롤백됨
+    // - drogon 풀이 아닌 primary 전용 libpq 연결(PgConnection)을 사용하며, 유휴 연결을 재사용
+    // - LIBPQ_HAS_PIPELINING이 없는 libpq로 빌드하면 같은 연결에서 차례로 실행 (결과 동일, 트랜잭션 없음)
+    class PipelineExecutor {
+    public:
+        static PipelineExecutor& getInstance();
+
+        // 컴파일에 사용한 libpq가 파이프라인 모드를 지원하는지
+        static constexpr bool pipeliningSupported() {
+#ifdef LIBPQ_HAS_PIPELINING
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        // 결과는 문장 순서대로 반환
+        // 문장 수가 0이거나 MAX_STATEMENTS를 넘으면 std::invalid_argument
+        // 문장 실패, 연결 오류, TIMEOUT_MS 초과 시 std::runtime_error
+        std::vector<PipelineResult> execute(const Pipeline& pipeline);
+
+        // 문장마다 별도 트랜잭션으로 실행: 한 문장이 실패해도 나머지는 실행됨
+        // 문장 실패는 예외 대신 해당 결과의 succeeded() == false로 알림 (호출자가 결과마다 확인)
+        // 문장 수 오류는 std::invalid_argument, 연결 오류와 TIMEOUT_MS 초과는 std::runtime_error
+        std::vector<PipelineResult> executeIndependent(const Pipeline& pipeline);
+
+    private:
+        PipelineExecutor() = default;
+        ~PipelineExecutor() = default;
+        PipelineExecutor(const PipelineExecutor&) = delete;
+        PipelineExecutor& operator=(const PipelineExecutor&) = delete;
+
+        std::unique_ptr<PgConnection> acquire();
+        void release(std::unique_ptr<PgConnection> connection);
+
+        std::vector<PipelineResult> run(const Pipeline& pipeline, bool independent, std::string& error);
+
+        // 문장 실패는 error에 기록하고 반환 (연결은 재사용 가능)
+        // 전송/수신 오류는 예외 (연결 상태를 알 수 없으므로 폐기)
+        // independent: 문장마다 Sync를 보내 각자 트랜잭션으로 실행 (실패가 뒤 문장을 중단시키지 않음)
+        static std::vector<PipelineResult> runPipelined(
+            PgConnection& connection, const Pipeline& pipeline, bool independent, std::string& error);
+        static std::vector<PipelineResult> runSequential(
+            PgConnection& connection, const Pipeline& pipeline, bool independent, std::string& error);
+
+        std::mutex mutex_;
+        std::vector<std::unique_ptr<PgConnection>> idle_;
+    };
+
+} // namespace database
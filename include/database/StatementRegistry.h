@@ -0,0 +1,135 @@
+#pragma once
+
+#include <drogon/drogon.h>
+#include <drogon/utils/coroutine.h>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace database {
+
+    // 이름 있는 SQL 문장 레지스트리
+    // - 매퍼는 반복 실행하는 SQL을 이름과 함께 등록하고 반환된 Statement로 실행
+    // - drogon은 파라미터가 있는 SQL을 연결마다 최초 실행 시 PQprepare하고 SQL 문자열로 재사용하므로
+    //   warmup()이 시작 시 풀의 모든 연결에서 한 번씩 실행해 두면 요청 경로에서는 준비 단계가 사라짐
+    // - 문장별 호출 수/왕복 시간은 클라이언트에서, 계획/실행 시간은 pg_stat_statements에서 수집
+    class StatementRegistry {
+    public:
+        // 등록된 문장. 레지스트리 수명 동안 주소가 유지되므로 매퍼가 포인터로 보관
+        struct Statement {
+            std::string name;
+            std::string sql;
+            std::function<void(drogon::orm::DbClient&)> warmup;   // 무해한 파라미터로 한 번 실행. 비어 있으면 warmup 제외
+
+            std::atomic<uint64_t> calls{0};
+            std::atomic<uint64_t> errors{0};
+            std::atomic<uint64_t> totalMicros{0};
+            std::atomic<uint64_t> maxMicros{0};
+
+            void record(std::chrono::steady_clock::time_point started);
+        };
+
+        struct StatementStats {
+            std::string name;
+            std::string sql;
+            uint64_t calls;
+            uint64_t errors;
+            uint64_t totalMicros;       // 클라이언트 측 왕복 시간 합
+            uint64_t maxMicros;
+            // pg_stat_statements 기준 (refreshServerStats 이후 채워짐)
+            uint64_t serverCalls;
+            double totalPlanMillis;
+            double totalExecMillis;
+        };
+
+        static StatementRegistry& getInstance();
+
+        // 같은 이름이 이미 있으면 기존 문장 반환 (SQL이 다르면 std::logic_error)
+        // warmupParams는 warmup()에서 연결마다 한 번 실행할 때 쓰는 파라미터
+        template <typename... Params>
+        Statement& registerStatement(const std::string& name, const std::string& sql, Params... warmupParams) {
+            auto warmup = [sql, params = std::make_tuple(warmupParams...)](drogon::orm::DbClient& client) {
+                std::apply([&](const auto&... values) { client.execSqlSync(sql, values...); }, params);
+            };
+            return add(name, sql, std::move(warmup));
+        }
+
+        // warmup에서 실행하지 않는 문장 등록 (이름/통계만 관리, 준비는 연결별 첫 실행 시)
+        // 무해한 파라미터를 만들 수 없는 INSERT/UPDATE나 미리 돌릴 이유가 없는 전체 스캔용
+        Statement& registerWithoutWarmup(const std::string& name, const std::string& sql) {
+            return add(name, sql, nullptr);
+        }
+
+        // 실행 + 통계 기록. Executor는 DbClient 또는 Transaction
+        // warmup 전이거나 준비되지 않은 연결이어도 drogon이 첫 실행에서 PQprepare하므로 그대로 실행됨
+        template <typename Executor, typename... Params>
+        static auto execute(Executor& executor, Statement& statement, Params&&... params) {
+            const auto started = std::chrono::steady_clock::now();
+            try {
+                auto result = executor.execSqlSync(statement.sql, std::forward<Params>(params)...);
+                statement.record(started);
+                return result;
+            } catch (...) {
+                statement.errors.fetch_add(1, std::memory_order_relaxed);
+                throw;
+            }
+        }
+
+        // execute의 코루틴 버전. ClientPtr은 DbClientPtr (execSqlCoro를 가진 클라이언트 포인터)
+        template <typename ClientPtr, typename... Params>
+        static drogon::Task<drogon::orm::Result> executeCoro(
+            ClientPtr client,
+            Statement& statement,
+            Params... params
+        ) {
+            const auto started = std::chrono::steady_clock::now();
+            try {
+                auto result = co_await client->execSqlCoro(statement.sql, params...);
+                statement.record(started);
+                co_return result;
+            } catch (...) {
+                statement.errors.fetch_add(1, std::memory_order_relaxed);
+                throw;
+            }
+        }
+
+        // 풀의 연결 connectionCount개를 트랜잭션으로 동시에 점유한 뒤 각 연결에서 warmup이 있는 문장을 한 번씩 실행
+        // connectionCount는 실제 풀 크기 이하여야 함 (초과 시 빈 연결을 기다리며 블로킹)
+        // 준비에 성공한 (연결, 문장) 쌍의 수 반환
+        size_t warmup(const drogon::orm::DbClientPtr& client, size_t connectionCount);
+
+        // pg_stat_statements에서 문장별 계획/실행 시간 조회 (track_planning이 꺼져 있으면 계획 시간은 0)
+        // 확장이 설치되지 않았으면 false
+        bool refreshServerStats(drogon::orm::DbClient& client);
+
+        std::vector<StatementStats> getStats() const;
+        void resetStats();
+
+    private:
+        StatementRegistry() = default;
+        ~StatementRegistry() = default;
+        StatementRegistry(const StatementRegistry&) = delete;
+        StatementRegistry& operator=(const StatementRegistry&) = delete;
+
+        struct ServerStats {
+            uint64_t calls{0};
+            double totalPlanMillis{0.0};
+            double totalExecMillis{0.0};
+        };
+
+        Statement& add(const std::string& name, const std::string& sql,
+                       std::function<void(drogon::orm::DbClient&)> warmup);
+
+        mutable std::mutex mutex_;
+        std::deque<Statement> statements_;      // deque: 추가해도 기존 원소 주소 유지
+        std::unordered_map<std::string, Statement*> byName_;
+        std::unordered_map<std::string, ServerStats> serverStats_;   // 이름별
+    };
+
+} // namespace database
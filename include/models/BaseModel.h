@@ -6,6 +6,7 @@
 #include <drogon/orm/SqlBinder.h>
 #include <drogon/orm/Mapper.h>
 #include <json/json.h>
+#include "utils/JsonWriter.h"
 #include <memory>
 
 namespace models {
@@ -15,6 +16,15 @@ namespace models {
         virtual ~BaseModel() = default;
         virtual Json::Value toJson() const = 0;
         virtual void fromJson(const Json::Value& json) = 0;
+
+        // DOM 없이 writer에 바로 직렬화 (toJson과 같은 필드/형식)
+        virtual void writeJson(utils::JsonWriter& writer) const = 0;
+
+        std::string toJsonString() const {
+            auto& writer = utils::JsonWriter::threadLocal();
+            writeJson(writer);
+            return std::string(writer.view());
+        }
     };
 
 }
\ No newline at end of file
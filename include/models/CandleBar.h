@@ -0,0 +1,129 @@
+#pragma once
+
+#include "models/SymbolRegistry.h"
+#include <drogon/orm/Row.h>
+#include <json/json.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace models {
+
+    // 봉 해상도 (market_bars.resolution)
+    enum class BarResolution : uint8_t { S1, M1, M5, H1, D1 };
+
+    inline constexpr std::array<BarResolution, 5> BAR_RESOLUTIONS{
+        BarResolution::S1, BarResolution::M1, BarResolution::M5, BarResolution::H1, BarResolution::D1
+    };
+
+    constexpr int64_t barDurationMicros(BarResolution resolution) {
+        constexpr int64_t SECOND = 1000000;
+        switch (resolution) {
+            case BarResolution::S1: return SECOND;
+            case BarResolution::M1: return 60 * SECOND;
+            case BarResolution::M5: return 5 * 60 * SECOND;
+            case BarResolution::H1: return 60 * 60 * SECOND;
+            case BarResolution::D1: return 24 * 60 * 60 * SECOND;
+        }
+        return SECOND;
+    }
+
+    constexpr std::string_view toString(BarResolution resolution) {
+        switch (resolution) {
+            case BarResolution::S1: return "1s";
+            case BarResolution::M1: return "1m";
+            case BarResolution::M5: return "5m";
+            case BarResolution::H1: return "1h";
+            case BarResolution::D1: return "1d";
+        }
+        return "1s";
+    }
+
+    // "1s" / "1m" / "5m" / "1h" / "1d", 그 외는 nullopt
+    std::optional<BarResolution> parseBarResolution(std::string_view text);
+
+    // 구간 시작 시각 (UTC epoch 기준 내림, 음수 timestamp도 아래로 내림)
+    constexpr int64_t barOpenTime(BarResolution resolution, int64_t timestampMicros) {
+        const int64_t duration = barDurationMicros(resolution);
+        int64_t bucket = timestampMicros / duration;
+        if (timestampMicros % duration < 0) {
+            --bucket;
+        }
+        return bucket * duration;
+    }
+
+    // OHLCV 봉
+    // - open/close는 구간 안에서 timestamp가 가장 이른/늦은 틱 (도착 순서와 무관, 같으면 먼저/나중 도착)
+    // - firstTick/lastTick은 open/close를 정한 틱의 시각. 같은 구간의 부분 봉을 합칠 때 사용
+    struct CandleBar {
+        SymbolId symbolId{SymbolRegistry::INVALID_ID};
+        BarResolution resolution{BarResolution::S1};
+        int64_t openTimeMicros{0};
+        double open{0.0};
+        double high{0.0};
+        double low{0.0};
+        double close{0.0};
+        double volume{0.0};
+        uint64_t tickCount{0};
+        int64_t firstTickMicros{0};
+        int64_t lastTickMicros{0};
+
+        static CandleBar fromTick(
+            SymbolId symbolId,
+            BarResolution resolution,
+            int64_t timestampMicros,
+            double price,
+            double volume
+        ) {
+            return CandleBar{symbolId, resolution, barOpenTime(resolution, timestampMicros),
+                             price, price, price, price, volume, 1, timestampMicros, timestampMicros};
+        }
+
+        int64_t closeTimeMicros() const { return openTimeMicros + barDurationMicros(resolution); }
+
+        void apply(int64_t timestampMicros, double price, double tickVolume) {
+            if (timestampMicros < firstTickMicros) {
+                firstTickMicros = timestampMicros;
+                open = price;
+            }
+            if (timestampMicros >= lastTickMicros) {
+                lastTickMicros = timestampMicros;
+                close = price;
+            }
+            high = std::max(high, price);
+            low = std::min(low, price);
+            volume += tickVolume;
+            ++tickCount;
+        }
+
+        // 같은 구간의 다른 부분 봉 합치기 (DB upsert의 병합 규칙과 동일)
+        void merge(const CandleBar& other) {
+            if (other.tickCount == 0) {
+                return;
+            }
+            if (tickCount == 0) {
+                *this = other;
+                return;
+            }
+            if (other.firstTickMicros < firstTickMicros) {
+                firstTickMicros = other.firstTickMicros;
+                open = other.open;
+            }
+            if (other.lastTickMicros >= lastTickMicros) {
+                lastTickMicros = other.lastTickMicros;
+                close = other.close;
+            }
+            high = std::max(high, other.high);
+            low = std::min(low, other.low);
+            volume += other.volume;
+            tickCount += other.tickCount;
+        }
+
+        // market_bars 행
+        static CandleBar fromDbRow(const drogon::orm::Row& row);
+        Json::Value toJson() const;
+    };
+
+} // namespace models
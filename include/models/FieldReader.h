@@ -0,0 +1,61 @@
+#pragma once
+
+#include "utils/TimestampParser.h"
+#include <drogon/orm/Field.h>
+#include <trantor/utils/Date.h>
+#include <charconv>
+#include <cstdint>
+#include <string_view>
+
+namespace models {
+
+    // drogon 텍스트 결과 필드를 std::string 임시 객체 없이 읽는 헬퍼
+    // 빠른 경로로 해석할 수 없는 값(NaN, Infinity 등)은 Field::as<T>()로 폴백
+    class FieldReader {
+    public:
+        static std::string_view view(const drogon::orm::Field& field) {
+            return std::string_view(field.c_str(), field.length());
+        }
+
+        static int64_t readInt64(const drogon::orm::Field& field) {
+            return readNumber<int64_t>(field);
+        }
+
+        static double readDouble(const drogon::orm::Field& field) {
+            return readNumber<double>(field);
+        }
+
+        // PostgreSQL bool 텍스트 표현: "t" / "f"
+        static bool readBool(const drogon::orm::Field& field) {
+            auto text = view(field);
+            if (text.size() == 1) {
+                return text[0] == 't';
+            }
+            return field.as<bool>();
+        }
+
+        static int64_t readTimestampMicros(const drogon::orm::Field& field) {
+            if (auto micros = utils::TimestampParser::parseMicros(view(field))) {
+                return *micros;
+            }
+            return utils::TimestampParser::parse(view(field)).microSecondsSinceEpoch();
+        }
+
+        static trantor::Date readTimestamp(const drogon::orm::Field& field) {
+            return utils::TimestampParser::parse(view(field));
+        }
+
+    private:
+        template <typename T>
+        static T readNumber(const drogon::orm::Field& field) {
+            auto text = view(field);
+            T value{};
+            auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), value);
+            if (ec == std::errc() && ptr == text.data() + text.size()) {
+                return value;
+            }
+            return field.as<T>();
+        }
+    };
+
+} // namespace models
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "models/BaseModel.h"
+#include "models/ModelSchema.h"
+#include "models/SymbolRegistry.h"
 #include <drogon/drogon.h>
 #include <drogon/orm/Field.h>
 #include <drogon/orm/Result.h>
@@ -17,6 +19,7 @@ namespace models {
     public:
         MarketData() = default;
         MarketData(const MarketData& other); // 복사 생성자 추가
+        MarketData& operator=(const MarketData& other);  // 비동기 매퍼가 Task<MarketData>로 값 반환
 
         // 메모리 풀에서 객체 생성을 위한 팩토리 메서드
         static std::shared_ptr<MarketData> create(
@@ -29,6 +32,7 @@ namespace models {
         // Getters
         int64_t getId() const { return id_.load(std::memory_order_relaxed); }
         std::string_view getSymbol() const { return symbol_; }
+        SymbolId getSymbolId() const { return symbol_id_; }
         double getPrice() const { return price_.load(std::memory_order_relaxed); }
         double getVolume() const { return volume_.load(std::memory_order_relaxed); }
         const trantor::Date& getTimestamp() const { return timestamp_; }
@@ -37,9 +41,11 @@ namespace models {
 
         // Setters with atomic operations
         void setId(int64_t id) { id_.store(id, std::memory_order_relaxed); }
-        void setSymbol(const std::string& symbol) { 
+        // 검증은 경계(fromJson, create)에서. 검증을 거치지 않은 긴 심볼은 잘리고 id는 INVALID_ID
+        void setSymbol(const std::string& symbol) {
             strncpy(symbol_, symbol.c_str(), sizeof(symbol_) - 1);
             symbol_[sizeof(symbol_) - 1] = '\0';
+            symbol_id_ = SymbolRegistry::getInstance().tryIntern(symbol);
         }
         void setPrice(double price) { price_.store(price, std::memory_order_relaxed); }
         void setVolume(double volume) { volume_.store(volume, std::memory_order_relaxed); }
@@ -53,9 +59,14 @@ namespace models {
         // JSON conversion
         Json::Value toJson() const override;
         void fromJson(const Json::Value& json) override;
+        void writeJson(utils::JsonWriter& writer) const override;
 
         // Static factory methods for database operations
         static std::shared_ptr<MarketData> fromDbRow(const drogon::orm::Row& row);
+        static std::shared_ptr<MarketData> fromDbRow(
+            const drogon::orm::Row& row,
+            const schema::RowDecoder<MarketData>& decoder
+        );
         static std::vector<std::shared_ptr<MarketData>> fromDbResult(const drogon::orm::Result& result);
 
         // 증분 업데이트를 위한 메서드
@@ -71,13 +82,14 @@ namespace models {
                                                 std::memory_order_relaxed);
         }
 
-        // 벌크 처리를 위한 배치 메서드(Repository 레이어로 이동 예정.)
-        //static void process_updates(size_t batch_size = 100);
-        //static void process_batch(const std::vector<std::shared_ptr<MarketData>>& batch);
+        // 쓰기 지연(write-behind) 큐. 생산자는 repositories::MarketDataWriteBehind::enqueue로 넣고
+        // 전용 flush 스레드가 배치로 꺼내 MarketDataRepository::persistBatch에 기록
+        static containers::LockFreeQueue<std::shared_ptr<MarketData>>& update_queue();
 
     private:
         std::atomic<int64_t> id_{0};
-        char symbol_[16];  // 고정 크기 배열로 변경
+        char symbol_[SymbolRegistry::MAX_SYMBOL_LENGTH + 1]{};   // market_data.symbol VARCHAR(20) + NUL
+        SymbolId symbol_id_{SymbolRegistry::INVALID_ID};
         std::atomic<double> price_{0.0};
         std::atomic<double> volume_{0.0};
         trantor::Date timestamp_;
@@ -86,7 +98,22 @@ namespace models {
 
         // 메모리 풀 싱글톤
         static memory::MemoryPool<MarketData>& memory_pool();
-        // Queue 관련 멤버
-        static containers::LockFreeQueue<std::shared_ptr<MarketData>>& update_queue();
     };
+
+    namespace schema {
+        template <>
+        struct ModelSchema<MarketData> {
+            static constexpr std::string_view TABLE = "market_data";
+            static constexpr auto FIELDS = std::make_tuple(
+                field<int64_t>("id", &MarketData::getId, &MarketData::setId, KEY | JSON),
+                field<std::string>("symbol", &MarketData::getSymbol, &MarketData::setSymbol, COLUMN),
+                field<double>("price", &MarketData::getPrice, &MarketData::setPrice, COLUMN),
+                field<double>("volume", &MarketData::getVolume, &MarketData::setVolume, COLUMN),
+                field<trantor::Date>("timestamp", &MarketData::getTimestamp, &MarketData::setTimestamp, COLUMN),
+                field<std::string>("source", &MarketData::getSource, &MarketData::setSource, COLUMN),
+                field<trantor::Date>("created_at", &MarketData::getCreatedAt, &MarketData::setCreatedAt, GENERATED)
+            );
+        };
+    } // namespace schema
+
 }
\ No newline at end of file
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "models/MarketData.h"
+#include "models/MarketDataKernels.h"
+#include "models/SymbolRegistry.h"
+#include <drogon/orm/Result.h>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace models {
+
+    // 단일 심볼 시계열의 컬럼(SoA) 표현
+    // - price/volume/timestamp를 각각 연속 배열로 보관하여 윈도우 분석을 SIMD 커널로 처리
+    // - 행은 timestamp 오름차순으로 적재되는 것을 전제로 함
+    class MarketDataBatch {
+    public:
+        MarketDataBatch() = default;
+        explicit MarketDataBatch(SymbolId symbolId) : symbol_id_(symbolId) {}
+
+        // 적재
+        void reserve(size_t capacity);
+        void clear();
+        void append(double price, double volume, int64_t timestampMicros);
+        void append(const MarketData& data);
+
+        // DB 결과에서 직접 컬럼 채우기 (price, volume, timestamp 컬럼 필요, 심볼 id는 호출자가 지정)
+        static MarketDataBatch fromDbResult(const drogon::orm::Result& result);
+
+        // Getters
+        SymbolId getSymbolId() const { return symbol_id_; }
+        void setSymbolId(SymbolId symbolId) { symbol_id_ = symbolId; }
+        size_t size() const { return prices_.size(); }
+        bool empty() const { return prices_.empty(); }
+        const double* prices() const { return prices_.data(); }
+        const double* volumes() const { return volumes_.data(); }
+        const int64_t* timestamps() const { return timestamps_.data(); }
+
+        // 윈도우 분석
+        double totalVolume() const;
+        double vwap() const;                       // 거래량 합이 0이면 0
+        kernels::MinMax priceRange() const;
+        std::vector<double> returns() const;       // 크기 size() - 1
+        double priceChangePercent() const;         // 첫 행 대비 마지막 행 변동률(%), 2행 미만이면 0
+        size_t countPricesAbove(double threshold) const;
+        std::optional<size_t> findFirstPriceOutside(double lower, double upper) const;
+
+    private:
+        SymbolId symbol_id_{SymbolRegistry::INVALID_ID};
+        std::vector<double> prices_;
+        std::vector<double> volumes_;
+        std::vector<int64_t> timestamps_;   // epoch 기준 마이크로초
+    };
+
+} // namespace models
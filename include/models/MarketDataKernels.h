@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+namespace models {
+    namespace kernels {
+
+        // 실행 시 CPU 기능 감지 결과에 따라 선택되는 구현
+        enum class SimdLevel {
+            Scalar,
+            SSE2,
+            AVX2
+        };
+
+        struct MinMax {
+            double min;
+            double max;
+        };
+
+        // 현재 활성화된 구현 (최초 호출 시 CPU 감지)
+        SimdLevel activeSimdLevel();
+
+        // 테스트/벤치마크용 강제 지정. CPU가 지원하지 않는 레벨은 지원되는 최상위 레벨로 낮춤
+        void setSimdLevel(SimdLevel level);
+
+        // 컬럼 커널 (모든 포인터는 정렬 불필요)
+        double sum(const double* data, size_t n);
+        double dot(const double* a, const double* b, size_t n);
+        MinMax minMax(const double* data, size_t n);   // n == 0이면 {+inf, -inf}
+
+        // out[i] = prices[i + 1] / prices[i] - 1, out 크기는 n - 1 이상이어야 함
+        void simpleReturns(const double* prices, size_t n, double* out);
+
+        // threshold보다 큰 값의 개수
+        size_t countAbove(const double* data, size_t n, double threshold);
+
+        // [lower, upper] 범위를 벗어나는 첫 인덱스, 없으면 n
+        size_t findFirstOutside(const double* data, size_t n, double lower, double upper);
+
+    } // namespace kernels
+} // namespace models
@@ -7,16 +7,18 @@
 
 namespace models {
 
+    // 문자열 이름 기반 팩토리 조회 (느린 경로)
+    // 타입을 아는 코드는 ModelRegistry::loadAll<T>()를 사용
     class ModelManager {
     public:
         // Singleton 인스턴스 얻기
         static ModelManager& getInstance();
 
         // 팩토리 등록
-        void registerFactory(const std::string& modelName, std::shared_ptr<ModelFactory> factory);
+        void registerFactory(const std::string& modelName, std::shared_ptr<const ModelFactory> factory);
 
         // 팩토리 얻기
-        std::shared_ptr<ModelFactory> getFactory(const std::string& modelName) const;
+        std::shared_ptr<const ModelFactory> getFactory(const std::string& modelName) const;
 
     private:
         ModelManager() = default;
@@ -24,7 +26,7 @@ namespace models {
         ModelManager(const ModelManager&) = delete;
         ModelManager& operator=(const ModelManager&) = delete;
 
-        std::unordered_map<std::string, std::shared_ptr<ModelFactory>> factories_;
+        std::unordered_map<std::string, std::shared_ptr<const ModelFactory>> factories_;
     };
 
 }  // namespace models
\ No newline at end of file
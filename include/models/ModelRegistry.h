@@ -0,0 +1,129 @@
+#pragma once
+
+#include "models/MarketData.h"
+#include "models/MarketDataBatch.h"
+#include "models/ModelSchema.h"
+#include "models/Order.h"
+#include "models/Trade.h"
+#include "models/TradingSignal.h"
+#include "models/User.h"
+#include "models/UserSettings.h"
+#include <drogon/orm/Result.h>
+#include <drogon/orm/Row.h>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace models {
+
+    // 모델별 컴파일 타임 등록 정보
+    // - NAME: ModelManager(문자열 조회 경로)에 등록되는 이름
+    // - Handle: 결과 벡터의 원소 타입 (값 또는 풀 할당 shared_ptr)
+    template <typename Model>
+    struct ModelTraits;
+
+    // 값 타입 모델 공통 구현: RowDecoder 하나로 결과셋 전체를 연속 벡터에 디코딩
+    template <typename Model>
+    struct ValueModelTraits {
+        using Handle = Model;
+
+        static void decodeInto(const drogon::orm::Result& result, std::vector<Handle>& out) {
+            out.reserve(out.size() + result.size());
+            const schema::RowDecoder<Model> decoder(result);
+            for (const auto& row : result) {
+                decoder.decode(row, out.emplace_back());
+            }
+        }
+
+        static Handle decodeRow(const drogon::orm::Row& row) {
+            return schema::RowDecoder<Model>(row).decode(row);
+        }
+    };
+
+    template <>
+    struct ModelTraits<MarketData> {
+        static constexpr std::string_view NAME = "market_data";
+
+        // MarketData는 메모리 풀에서 할당
+        using Handle = std::shared_ptr<MarketData>;
+
+        static void decodeInto(const drogon::orm::Result& result, std::vector<Handle>& out) {
+            out.reserve(out.size() + result.size());
+            const schema::RowDecoder<MarketData> decoder(result);
+            for (const auto& row : result) {
+                out.push_back(MarketData::fromDbRow(row, decoder));
+            }
+        }
+
+        static Handle decodeRow(const drogon::orm::Row& row) {
+            return MarketData::fromDbRow(row);
+        }
+    };
+
+    template <>
+    struct ModelTraits<TradingSignal> : ValueModelTraits<TradingSignal> {
+        static constexpr std::string_view NAME = "trading_signal";
+    };
+
+    template <>
+    struct ModelTraits<Order> : ValueModelTraits<Order> {
+        static constexpr std::string_view NAME = "order";
+    };
+
+    template <>
+    struct ModelTraits<Trade> : ValueModelTraits<Trade> {
+        static constexpr std::string_view NAME = "trade";
+    };
+
+    template <>
+    struct ModelTraits<User> : ValueModelTraits<User> {
+        static constexpr std::string_view NAME = "user";
+    };
+
+    template <>
+    struct ModelTraits<UserSettings> : ValueModelTraits<UserSettings> {
+        static constexpr std::string_view NAME = "user_settings";
+    };
+
+    // 타입 기반 모델 레지스트리 (빠른 경로)
+    // 가상 호출/다운캐스트 없이 결과셋 전체를 구체 타입 벡터로 변환
+    // 문자열 이름 기반 조회가 필요한 경우에만 ModelManager를 사용
+    class ModelRegistry {
+    public:
+        template <typename Model>
+        using Handle = typename ModelTraits<Model>::Handle;
+
+        template <typename Model>
+        static std::vector<Handle<Model>> loadAll(const drogon::orm::Result& result) {
+            std::vector<Handle<Model>> models;
+            ModelTraits<Model>::decodeInto(result, models);
+            return models;
+        }
+
+        // 기존 벡터 뒤에 추가 (페이지 단위 로드 시 용량 재사용)
+        template <typename Model>
+        static void loadInto(const drogon::orm::Result& result, std::vector<Handle<Model>>& out) {
+            ModelTraits<Model>::decodeInto(result, out);
+        }
+
+        template <typename Model>
+        static Handle<Model> loadOne(const drogon::orm::Row& row) {
+            return ModelTraits<Model>::decodeRow(row);
+        }
+
+        // 시세 집계용 컬럼 배치 (행 객체를 만들지 않음)
+        static MarketDataBatch loadMarketDataBatch(const drogon::orm::Result& result) {
+            return MarketDataBatch::fromDbResult(result);
+        }
+
+        template <typename Model>
+        static constexpr std::string_view name() {
+            return ModelTraits<Model>::NAME;
+        }
+
+        // 모든 모델 팩토리를 ModelManager에 등록 (문자열 조회 경로, 시작 시 1회)
+        static void registerFactories();
+    };
+
+} // namespace models
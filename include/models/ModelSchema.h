@@ -0,0 +1,354 @@
+#pragma once
+
+#include "database/StatementRegistry.h"
+#include "models/FieldReader.h"
+#include "utils/JsonUtils.h"
+#include "utils/JsonWriter.h"
+#include <drogon/orm/Field.h>
+#include <drogon/orm/Result.h>
+#include <drogon/orm/Row.h>
+#include <json/json.h>
+#include <trantor/utils/Date.h>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace models {
+    namespace schema {
+
+        // 필드 플래그
+        enum FieldFlag : uint8_t {
+            KEY = 1 << 0,             // UPDATE의 WHERE 키
+            INSERT = 1 << 1,          // INSERT 컬럼
+            UPDATE = 1 << 2,          // UPDATE SET 컬럼
+            JSON = 1 << 3,            // JSON 출력 대상
+            NOW_ON_UPDATE = 1 << 4    // UPDATE 시 CURRENT_TIMESTAMP로 갱신
+        };
+
+        constexpr uint8_t COLUMN = INSERT | UPDATE | JSON;   // 일반 컬럼
+        constexpr uint8_t GENERATED = JSON;                  // DB가 채우는 컬럼 (created_at 등)
+
+        // 모델 필드 하나의 컴파일 타임 기술자
+        // Value는 DB/JSON 상의 값 타입 (int64_t, double, bool, std::string, trantor::Date, Json::Value)
+        template <typename Value, typename Getter, typename Setter>
+        struct FieldDescriptor {
+            using ValueType = Value;
+
+            std::string_view name;   // 컬럼명 = JSON 키
+            Getter get;
+            Setter set;
+            uint8_t flags;
+        };
+
+        template <typename Value, typename Getter, typename Setter>
+        constexpr FieldDescriptor<Value, Getter, Setter> field(
+            std::string_view name, Getter get, Setter set, uint8_t flags
+        ) {
+            return FieldDescriptor<Value, Getter, Setter>{name, get, set, flags};
+        }
+
+        // 모델별 특수화: TABLE(테이블명), FIELDS(FieldDescriptor tuple)
+        template <typename Model>
+        struct ModelSchema;
+
+        template <typename Model>
+        constexpr size_t fieldCount() {
+            return std::tuple_size_v<std::decay_t<decltype(ModelSchema<Model>::FIELDS)>>;
+        }
+
+        // 모든 필드에 대해 fn(descriptor) 호출 (컴파일 타임에 전개)
+        template <typename Model, typename Fn>
+        void forEachField(Fn&& fn) {
+            std::apply([&fn](const auto&... fields) { (fn(fields), ...); }, ModelSchema<Model>::FIELDS);
+        }
+
+        namespace detail {
+
+            template <typename Desc>
+            using ValueOf = typename std::decay_t<Desc>::ValueType;
+
+            template <typename Value>
+            Value fromDbField(const drogon::orm::Field& field) {
+                if constexpr (std::is_same_v<Value, trantor::Date>) {
+                    return FieldReader::readTimestamp(field);
+                } else if constexpr (std::is_same_v<Value, int64_t>) {
+                    return FieldReader::readInt64(field);
+                } else if constexpr (std::is_same_v<Value, double>) {
+                    return FieldReader::readDouble(field);
+                } else if constexpr (std::is_same_v<Value, bool>) {
+                    return FieldReader::readBool(field);
+                } else if constexpr (std::is_same_v<Value, Json::Value>) {
+                    return utils::JsonUtils::parseJson(field.as<std::string>());
+                } else {
+                    return field.as<Value>();
+                }
+            }
+
+            // execSqlSync에 넘길 파라미터 값
+            template <typename Desc, typename Model>
+            auto toDbParam(const Desc& desc, const Model& model) {
+                using Value = ValueOf<Desc>;
+                decltype(auto) raw = std::invoke(desc.get, model);
+                if constexpr (std::is_same_v<Value, trantor::Date>) {
+                    return raw.toFormattedString(false);
+                } else if constexpr (std::is_same_v<Value, Json::Value>) {
+                    return utils::JsonUtils::toJsonString(raw);
+                } else if constexpr (std::is_same_v<Value, std::string>) {
+                    return std::string(raw);
+                } else {
+                    return static_cast<Value>(raw);
+                }
+            }
+
+            template <typename Model, uint8_t Flag, size_t I>
+            auto paramIf(const Model& model) {
+                constexpr const auto& desc = std::get<I>(ModelSchema<Model>::FIELDS);
+                if constexpr ((desc.flags & Flag) != 0) {
+                    return std::make_tuple(toDbParam(desc, model));
+                } else {
+                    return std::tuple<>();
+                }
+            }
+
+            template <typename Model, uint8_t Flag, size_t... I>
+            auto collectParams(const Model& model, std::index_sequence<I...>) {
+                return std::tuple_cat(paramIf<Model, Flag, I>(model)...);
+            }
+
+            template <typename Model, size_t... I>
+            constexpr std::array<std::string_view, sizeof...(I)> fieldNames(std::index_sequence<I...>) {
+                return {std::get<I>(ModelSchema<Model>::FIELDS).name...};
+            }
+
+        } // namespace detail
+
+        // ---------- JSON ----------
+
+        template <typename Model>
+        Json::Value toJson(const Model& model) {
+            Json::Value json;
+            forEachField<Model>([&](const auto& desc) {
+                if ((desc.flags & JSON) == 0) {
+                    return;
+                }
+                using Value = detail::ValueOf<decltype(desc)>;
+                Json::Value& target = json[std::string(desc.name)];
+                decltype(auto) raw = std::invoke(desc.get, model);
+                if constexpr (std::is_same_v<Value, trantor::Date>) {
+                    target = raw.toFormattedString(false);
+                } else if constexpr (std::is_same_v<Value, int64_t>) {
+                    target = static_cast<Json::Int64>(raw);
+                } else if constexpr (std::is_same_v<Value, std::string>) {
+                    target = std::string(raw);
+                } else {
+                    target = raw;
+                }
+            });
+            return json;
+        }
+
+        template <typename Model>
+        void writeJson(const Model& model, utils::JsonWriter& writer) {
+            writer.beginObject();
+            forEachField<Model>([&](const auto& desc) {
+                if ((desc.flags & JSON) == 0) {
+                    return;
+                }
+                using Value = detail::ValueOf<decltype(desc)>;
+                writer.key(desc.name);
+                decltype(auto) raw = std::invoke(desc.get, model);
+                if constexpr (std::is_same_v<Value, trantor::Date>) {
+                    writer.timestamp(raw);
+                } else if constexpr (std::is_same_v<Value, std::string>) {
+                    writer.value(std::string_view(raw));
+                } else if constexpr (std::is_same_v<Value, Json::Value>) {
+                    writer.value(raw);
+                } else {
+                    writer.value(static_cast<Value>(raw));
+                }
+            });
+            writer.endObject();
+        }
+
+        // ---------- DB 행 디코더 ----------
+
+        // 컬럼 위치를 결과셋당 한 번만 찾아두고 행마다 인덱스로 접근
+        template <typename Model>
+        class RowDecoder {
+        public:
+            static constexpr size_t FIELD_COUNT = fieldCount<Model>();
+
+            explicit RowDecoder(const drogon::orm::Result& result) {
+                columns_.fill(NO_COLUMN);
+                for (drogon::orm::Result::RowSizeType col = 0; col < result.columns(); ++col) {
+                    bindColumn(result.columnName(col), col);
+                }
+            }
+
+            explicit RowDecoder(const drogon::orm::Row& row) {
+                columns_.fill(NO_COLUMN);
+                for (drogon::orm::Row::SizeType col = 0; col < row.size(); ++col) {
+                    bindColumn(row[col].name(), col);
+                }
+            }
+
+            // 결과셋에 없는 컬럼과 NULL 값은 건너뜀 (모델 기본값 유지)
+            void decode(const drogon::orm::Row& row, Model& model) const {
+                decodeFields(row, model, std::make_index_sequence<FIELD_COUNT>{});
+            }
+
+            Model decode(const drogon::orm::Row& row) const {
+                Model model;
+                decode(row, model);
+                return model;
+            }
+
+        private:
+            static constexpr size_t NO_COLUMN = static_cast<size_t>(-1);
+
+            void bindColumn(std::string_view columnName, size_t column) {
+                static constexpr auto NAMES = detail::fieldNames<Model>(std::make_index_sequence<FIELD_COUNT>{});
+                for (size_t i = 0; i < FIELD_COUNT; ++i) {
+                    if (NAMES[i] == columnName) {
+                        columns_[i] = column;
+                        return;
+                    }
+                }
+            }
+
+            template <size_t... I>
+            void decodeFields(const drogon::orm::Row& row, Model& model, std::index_sequence<I...>) const {
+                (decodeField<I>(row, model), ...);
+            }
+
+            template <size_t I>
+            void decodeField(const drogon::orm::Row& row, Model& model) const {
+                const size_t column = columns_[I];
+                if (column == NO_COLUMN) {
+                    return;
+                }
+                const auto value = row[static_cast<drogon::orm::Row::SizeType>(column)];
+                if (value.isNull()) {
+                    return;
+                }
+                constexpr const auto& desc = std::get<I>(ModelSchema<Model>::FIELDS);
+                std::invoke(desc.set, model, detail::fromDbField<detail::ValueOf<decltype(desc)>>(value));
+            }
+
+            std::array<size_t, FIELD_COUNT> columns_{};
+        };
+
+        // ---------- SQL 생성 / 바인딩 ----------
+
+        // "INSERT INTO <table> (...) VALUES ($1, ...) RETURNING *" (최초 호출 시 한 번 생성)
+        template <typename Model>
+        const std::string& insertSql() {
+            static const std::string sql = [] {
+                std::string columns;
+                std::string values;
+                size_t param = 0;
+                forEachField<Model>([&](const auto& desc) {
+                    if ((desc.flags & INSERT) == 0) {
+                        return;
+                    }
+                    if (param > 0) {
+                        columns += ", ";
+                        values += ", ";
+                    }
+                    columns += desc.name;
+                    values += "$" + std::to_string(++param);
+                });
+                return "INSERT INTO " + std::string(ModelSchema<Model>::TABLE) +
+                       " (" + columns + ") VALUES (" + values + ") RETURNING *";
+            }();
+            return sql;
+        }
+
+        // "UPDATE <table> SET col = $1, ... WHERE key = $N"
+        template <typename Model>
+        const std::string& updateSql() {
+            static const std::string sql = [] {
+                std::string assignments;
+                std::string key;
+                size_t param = 0;
+                forEachField<Model>([&](const auto& desc) {
+                    if ((desc.flags & (UPDATE | NOW_ON_UPDATE)) == 0) {
+                        if ((desc.flags & KEY) != 0) {
+                            key = std::string(desc.name);
+                        }
+                        return;
+                    }
+                    if (!assignments.empty()) {
+                        assignments += ", ";
+                    }
+                    assignments += desc.name;
+                    if ((desc.flags & UPDATE) != 0) {
+                        assignments += " = $" + std::to_string(++param);
+                    } else {
+                        assignments += " = CURRENT_TIMESTAMP";
+                    }
+                });
+                return "UPDATE " + std::string(ModelSchema<Model>::TABLE) + " SET " + assignments +
+                       " WHERE " + key + " = $" + std::to_string(param + 1);
+            }();
+            return sql;
+        }
+
+        // 단건 INSERT/UPDATE 문장 ("<table>.insert", "<table>.update", 최초 호출 시 등록)
+        // 쓰기는 무해한 warmup 파라미터가 없으므로 (제약 조건 위반 시 그 연결의 warmup 중단) warmup 제외
+        template <typename Model>
+        database::StatementRegistry::Statement& insertStatement() {
+            static auto& statement = database::StatementRegistry::getInstance().registerWithoutWarmup(
+                std::string(ModelSchema<Model>::TABLE) + ".insert", insertSql<Model>());
+            return statement;
+        }
+
+        template <typename Model>
+        database::StatementRegistry::Statement& updateStatement() {
+            static auto& statement = database::StatementRegistry::getInstance().registerWithoutWarmup(
+                std::string(ModelSchema<Model>::TABLE) + ".update", updateSql<Model>());
+            return statement;
+        }
+
+        template <typename Model>
+        auto insertParams(const Model& model) {
+            return detail::collectParams<Model, INSERT>(model, std::make_index_sequence<fieldCount<Model>()>{});
+        }
+
+        template <typename Model>
+        auto updateParams(const Model& model) {
+            constexpr auto indices = std::make_index_sequence<fieldCount<Model>()>{};
+            return std::tuple_cat(
+                detail::collectParams<Model, UPDATE>(model, indices),
+                detail::collectParams<Model, KEY>(model, indices)
+            );
+        }
+
+        // Executor는 DbClient 또는 Transaction (execSqlSync 제공)
+        template <typename Model, typename Executor>
+        drogon::orm::Result execInsert(Executor& executor, const Model& model) {
+            return std::apply(
+                [&executor](const auto&... params) {
+                    return database::StatementRegistry::execute(executor, insertStatement<Model>(), params...);
+                },
+                insertParams(model)
+            );
+        }
+
+        template <typename Model, typename Executor>
+        drogon::orm::Result execUpdate(Executor& executor, const Model& model) {
+            return std::apply(
+                [&executor](const auto&... params) {
+                    return database::StatementRegistry::execute(executor, updateStatement<Model>(), params...);
+                },
+                updateParams(model)
+            );
+        }
+
+    } // namespace schema
+} // namespace models
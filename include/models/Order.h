@@ -1,6 +1,8 @@
 #pragma once
 
 #include "models/BaseModel.h"
+#include "models/ModelSchema.h"
+#include "models/SymbolRegistry.h"
 #include <drogon/orm/Field.h>
 #include <drogon/orm/Result.h>
 #include <drogon/orm/Row.h>
@@ -18,6 +20,7 @@ namespace models {
         int64_t getId() const { return id_; }
         const std::string& getOrderId() const { return order_id_; }
         const std::string& getSymbol() const { return symbol_; }
+        SymbolId getSymbolId() const { return symbol_id_; }
         const std::string& getOrderType() const { return order_type_; }
         const std::string& getSide() const { return side_; }
         double getQuantity() const { return quantity_; }
@@ -34,7 +37,10 @@ namespace models {
         // Setters
         void setId(int64_t id) { id_ = id; }
         void setOrderId(const std::string& order_id) { order_id_ = order_id; }
-        void setSymbol(const std::string& symbol) { symbol_ = symbol; }
+        void setSymbol(const std::string& symbol) {
+            symbol_ = symbol;
+            symbol_id_ = SymbolRegistry::getInstance().tryIntern(symbol);   // 검증은 fromJson에서
+        }
         void setOrderType(const std::string& order_type) { order_type_ = order_type; }
         void setSide(const std::string& side) { side_ = side; }
         void setQuantity(double quantity) { quantity_ = quantity; }
@@ -51,6 +57,7 @@ namespace models {
         // JSON conversion
         Json::Value toJson() const override;
         void fromJson(const Json::Value& json) override;
+        void writeJson(utils::JsonWriter& writer) const override;
 
         // Static factory methods
         static Order fromDbRow(const drogon::orm::Row& row);
@@ -60,6 +67,7 @@ namespace models {
         int64_t id_{0};
         std::string order_id_;
         std::string symbol_;
+        SymbolId symbol_id_{SymbolRegistry::INVALID_ID};
         std::string order_type_;  // MARKET, LIMIT
         std::string side_;        // BUY, SELL
         double quantity_{0.0};
@@ -74,4 +82,28 @@ namespace models {
         trantor::Date created_at_;
     };
 
+    namespace schema {
+        template <>
+        struct ModelSchema<Order> {
+            static constexpr std::string_view TABLE = "orders";
+            static constexpr auto FIELDS = std::make_tuple(
+                field<int64_t>("id", &Order::getId, &Order::setId, KEY | JSON),
+                field<std::string>("order_id", &Order::getOrderId, &Order::setOrderId, COLUMN),
+                field<std::string>("symbol", &Order::getSymbol, &Order::setSymbol, COLUMN),
+                field<std::string>("order_type", &Order::getOrderType, &Order::setOrderType, COLUMN),
+                field<std::string>("side", &Order::getSide, &Order::setSide, COLUMN),
+                field<double>("quantity", &Order::getQuantity, &Order::setQuantity, COLUMN),
+                field<double>("price", &Order::getPrice, &Order::setPrice, COLUMN),
+                field<std::string>("status", &Order::getStatus, &Order::setStatus, COLUMN),
+                field<int64_t>("signal_id", &Order::getSignalId, &Order::setSignalId, COLUMN),
+                field<double>("filled_quantity", &Order::getFilledQuantity, &Order::setFilledQuantity, COLUMN),
+                field<double>("filled_price", &Order::getFilledPrice, &Order::setFilledPrice, COLUMN),
+                field<std::string>("error_message", &Order::getErrorMessage, &Order::setErrorMessage, COLUMN),
+                field<trantor::Date>("timestamp", &Order::getTimestamp, &Order::setTimestamp, COLUMN),
+                field<trantor::Date>("updated_at", &Order::getUpdatedAt, &Order::setUpdatedAt, JSON | NOW_ON_UPDATE),
+                field<trantor::Date>("created_at", &Order::getCreatedAt, &Order::setCreatedAt, GENERATED)
+            );
+        };
+    } // namespace schema
+
 }
\ No newline at end of file
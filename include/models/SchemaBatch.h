@@ -0,0 +1,292 @@
+#pragma once
+
+#include "common/Config.h"
+#include "models/ModelSchema.h"
+#include <drogon/orm/Result.h>
+#include <array>
+#include <charconv>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace models {
+    namespace schema {
+
+        // ---------- 다건 INSERT/UPDATE (unnest 배열 파라미터) ----------
+        // 컬럼마다 PostgreSQL 배열 리터럴 하나를 파라미터로 보내므로 파라미터 수는 행 수와 무관
+        // 청크 크기는 common::BatchConfig의 행 수/바이트 상한에 맞춰 결정
+
+        namespace detail {
+
+            template <typename Value>
+            constexpr std::string_view sqlArrayType() {
+                if constexpr (std::is_same_v<Value, int64_t>) {
+                    return "bigint[]";
+                } else if constexpr (std::is_same_v<Value, double>) {
+                    return "numeric[]";
+                } else if constexpr (std::is_same_v<Value, bool>) {
+                    return "boolean[]";
+                } else if constexpr (std::is_same_v<Value, trantor::Date>) {
+                    return "timestamptz[]";
+                } else if constexpr (std::is_same_v<Value, Json::Value>) {
+                    return "jsonb[]";
+                } else {
+                    return "text[]";
+                }
+            }
+
+            template <typename Model, uint8_t Flag>
+            constexpr size_t countFields() {
+                size_t count = 0;
+                std::apply([&count](const auto&... fields) { ((count += (fields.flags & Flag) != 0 ? 1 : 0), ...); },
+                           ModelSchema<Model>::FIELDS);
+                return count;
+            }
+
+            // 배열 원소 안의 문자열: 큰따옴표로 감싸고 " 와 \ 는 이스케이프
+            inline void appendQuoted(std::string& out, std::string_view text) {
+                out += '"';
+                for (char c : text) {
+                    if (c == '"' || c == '\\') {
+                        out += '\\';
+                    }
+                    out += c;
+                }
+                out += '"';
+            }
+
+            template <typename Desc, typename Model>
+            void appendArrayElement(std::string& out, const Desc& desc, const Model& model) {
+                using Value = ValueOf<Desc>;
+                if constexpr (std::is_same_v<Value, int64_t> || std::is_same_v<Value, double>) {
+                    char buffer[32];
+                    auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer),
+                                                   static_cast<Value>(std::invoke(desc.get, model)));
+                    out.append(buffer, end);
+                } else if constexpr (std::is_same_v<Value, bool>) {
+                    out += std::invoke(desc.get, model) ? 't' : 'f';
+                } else {
+                    appendQuoted(out, toDbParam(desc, model));
+                }
+            }
+
+            inline std::string quoteIdentifier(std::string_view name) {
+                return "\"" + std::string(name) + "\"";
+            }
+
+            // 행 단위로 배열 리터럴을 쌓다가 상한에 도달하면 실행
+            template <size_t N, typename Model, typename Executor, typename AppendRow>
+            size_t execChunked(Executor& executor, database::StatementRegistry::Statement& statement,
+                               const std::vector<Model>& models, AppendRow&& appendRow) {
+                std::array<std::string, N> columns;
+                size_t rows = 0;
+                size_t affected = 0;
+
+                auto reset = [&] {
+                    for (auto& column : columns) {
+                        column.assign(1, '{');
+                    }
+                    rows = 0;
+                };
+                auto flush = [&] {
+                    if (rows == 0) {
+                        return;
+                    }
+                    for (auto& column : columns) {
+                        column += '}';
+                    }
+                    auto result = std::apply(
+                        [&](const auto&... params) {
+                            return database::StatementRegistry::execute(executor, statement, params...);
+                        },
+                        columns);
+                    affected += result.affectedRows();
+                    reset();
+                };
+
+                reset();
+                for (const auto& model : models) {
+                    appendRow(model, columns, rows > 0);
+                    ++rows;
+
+                    size_t bytes = 0;
+                    for (const auto& column : columns) {
+                        bytes += column.size();
+                    }
+                    if (rows >= common::BatchConfig::MAX_ROWS_PER_STATEMENT ||
+                        bytes >= common::BatchConfig::MAX_BYTES_PER_STATEMENT) {
+                        flush();
+                    }
+                }
+                flush();
+
+                return affected;
+            }
+
+        } // namespace detail
+
+        // "INSERT INTO <table> (...) SELECT * FROM unnest($1::text[], ...)"
+        template <typename Model>
+        const std::string& batchInsertSql() {
+            static const std::string sql = [] {
+                std::string columns;
+                std::string arrays;
+                size_t param = 0;
+                forEachField<Model>([&](const auto& desc) {
+                    if ((desc.flags & INSERT) == 0) {
+                        return;
+                    }
+                    if (param > 0) {
+                        columns += ", ";
+                        arrays += ", ";
+                    }
+                    columns += detail::quoteIdentifier(desc.name);
+                    arrays += "$" + std::to_string(++param) + "::" +
+                              std::string(detail::sqlArrayType<detail::ValueOf<decltype(desc)>>());
+                });
+                return "INSERT INTO " + std::string(ModelSchema<Model>::TABLE) +
+                       " (" + columns + ") SELECT * FROM unnest(" + arrays + ")";
+            }();
+            return sql;
+        }
+
+        // "UPDATE <table> AS t SET col = u.col, ... FROM unnest(...) AS u(col, ..., key) WHERE t.key = u.key"
+        template <typename Model>
+        const std::string& batchUpdateSql() {
+            static const std::string sql = [] {
+                std::string assignments;
+                std::string arrays;
+                std::string aliases;
+                std::string key;
+                std::string keyArray;
+                size_t param = 0;
+                forEachField<Model>([&](const auto& desc) {
+                    using Value = detail::ValueOf<decltype(desc)>;
+                    const std::string column = detail::quoteIdentifier(desc.name);
+                    if ((desc.flags & UPDATE) != 0) {
+                        if (param > 0) {
+                            arrays += ", ";
+                            aliases += ", ";
+                        }
+                        if (!assignments.empty()) {
+                            assignments += ", ";
+                        }
+                        assignments += column + " = u." + column;
+                        arrays += "$" + std::to_string(++param) + "::" + std::string(detail::sqlArrayType<Value>());
+                        aliases += column;
+                    } else if ((desc.flags & NOW_ON_UPDATE) != 0) {
+                        if (!assignments.empty()) {
+                            assignments += ", ";
+                        }
+                        assignments += column + " = CURRENT_TIMESTAMP";
+                    } else if ((desc.flags & KEY) != 0) {
+                        key = column;
+                        keyArray = std::string(detail::sqlArrayType<Value>());
+                    }
+                });
+                return "UPDATE " + std::string(ModelSchema<Model>::TABLE) + " AS t SET " + assignments +
+                       " FROM unnest(" + arrays + ", $" + std::to_string(param + 1) + "::" + keyArray +
+                       ") AS u(" + aliases + ", " + key + ") WHERE t." + key + " = u." + key;
+            }();
+            return sql;
+        }
+
+        namespace detail {
+
+            // 배열 파라미터마다 빈 배열("{}")로 warmup (unnest가 0행이라 쓰기 없음)
+            template <size_t... I>
+            database::StatementRegistry::Statement& registerWithEmptyArrays(
+                const std::string& name, const std::string& sql, std::index_sequence<I...>) {
+                return database::StatementRegistry::getInstance().registerStatement(
+                    name, sql, (static_cast<void>(I), std::string("{}"))...);
+            }
+
+        } // namespace detail
+
+        // 다건 INSERT/UPDATE 문장 ("<table>.batch_insert", "<table>.batch_update", 최초 호출 시 등록)
+        template <typename Model>
+        database::StatementRegistry::Statement& batchInsertStatement() {
+            static auto& statement = detail::registerWithEmptyArrays(
+                std::string(ModelSchema<Model>::TABLE) + ".batch_insert", batchInsertSql<Model>(),
+                std::make_index_sequence<detail::countFields<Model, INSERT>()>{});
+            return statement;
+        }
+
+        template <typename Model>
+        database::StatementRegistry::Statement& batchUpdateStatement() {
+            static auto& statement = detail::registerWithEmptyArrays(
+                std::string(ModelSchema<Model>::TABLE) + ".batch_update", batchUpdateSql<Model>(),
+                std::make_index_sequence<detail::countFields<Model, UPDATE>() + detail::countFields<Model, KEY>()>{});
+            return statement;
+        }
+
+        // "= ANY($1::bigint[])" 파라미터용 배열 리터럴 ("{1,2,3}")
+        inline std::string bigintArray(std::span<const int64_t> values) {
+            std::string array;
+            array.reserve(values.size() * 8 + 2);
+            array += '{';
+            char buffer[24];
+            for (size_t i = 0; i < values.size(); ++i) {
+                if (i > 0) {
+                    array += ',';
+                }
+                auto [end, ec] = std::to_chars(buffer, buffer + sizeof(buffer), values[i]);
+                array.append(buffer, end);
+            }
+            array += '}';
+            return array;
+        }
+
+        // Executor는 DbClient 또는 Transaction. 영향받은 행 수 반환
+        template <typename Model, typename Executor>
+        size_t execBatchInsert(Executor& executor, const std::vector<Model>& models) {
+            constexpr size_t N = detail::countFields<Model, INSERT>();
+            return detail::execChunked<N>(executor, batchInsertStatement<Model>(), models,
+                [](const Model& model, std::array<std::string, N>& columns, bool separator) {
+                    size_t index = 0;
+                    forEachField<Model>([&](const auto& desc) {
+                        if ((desc.flags & INSERT) == 0) {
+                            return;
+                        }
+                        auto& column = columns[index++];
+                        if (separator) {
+                            column += ',';
+                        }
+                        detail::appendArrayElement(column, desc, model);
+                    });
+                });
+        }
+
+        template <typename Model, typename Executor>
+        size_t execBatchUpdate(Executor& executor, const std::vector<Model>& models) {
+            constexpr size_t N = detail::countFields<Model, UPDATE>() + detail::countFields<Model, KEY>();
+            return detail::execChunked<N>(executor, batchUpdateStatement<Model>(), models,
+                [](const Model& model, std::array<std::string, N>& columns, bool separator) {
+                    size_t index = 0;
+                    auto append = [&](const auto& desc) {
+                        auto& column = columns[index++];
+                        if (separator) {
+                            column += ',';
+                        }
+                        detail::appendArrayElement(column, desc, model);
+                    };
+                    // SQL의 파라미터 순서와 동일: UPDATE 컬럼 다음 KEY
+                    forEachField<Model>([&](const auto& desc) {
+                        if ((desc.flags & UPDATE) != 0) {
+                            append(desc);
+                        }
+                    });
+                    forEachField<Model>([&](const auto& desc) {
+                        if ((desc.flags & UPDATE) == 0 && (desc.flags & KEY) != 0) {
+                            append(desc);
+                        }
+                    });
+                });
+        }
+
+    } // namespace schema
+} // namespace models
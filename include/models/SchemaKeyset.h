@@ -0,0 +1,134 @@
+#pragma once
+
+#include "models/ModelSchema.h"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace models {
+    namespace schema {
+
+        // ---------- 키셋(커서) 페이지네이션 ----------
+        // (정렬 시각, id) 내림차순. 이전 페이지 마지막 행보다 작은 행만 읽으므로
+        // OFFSET과 달리 페이지 깊이와 무관하게 인덱스 범위 스캔 한 번으로 끝남
+        // 정렬 시각은 timestamp 컬럼이 있으면 timestamp, 없으면 created_at
+
+        namespace detail {
+
+            template <typename Model>
+            constexpr bool hasField(std::string_view name) {
+                bool found = false;
+                std::apply([&](const auto&... fields) { ((found = found || fields.name == name), ...); },
+                           ModelSchema<Model>::FIELDS);
+                return found;
+            }
+
+        } // namespace detail
+
+        template <typename Model>
+        constexpr std::string_view keysetColumn() {
+            return detail::hasField<Model>("timestamp") ? std::string_view("timestamp")
+                                                         : std::string_view("created_at");
+        }
+
+        // 첫 페이지: $1 = limit
+        template <typename Model>
+        const std::string& keysetFirstPageSql() {
+            static const std::string sql =
+                "SELECT * FROM " + std::string(ModelSchema<Model>::TABLE) +
+                " ORDER BY \"" + std::string(keysetColumn<Model>()) + "\" DESC, id DESC LIMIT $1";
+            return sql;
+        }
+
+        // 다음 페이지: $1 = 직전 행 정렬 시각(Unix epoch 마이크로초), $2 = 직전 행 id, $3 = limit
+        // 행 값 비교 (col, id) < (...)는 (col, id) 복합 인덱스로 바로 시작 위치를 찾음
+        template <typename Model>
+        const std::string& keysetNextPageSql() {
+            static const std::string sql = [] {
+                const std::string column = "\"" + std::string(keysetColumn<Model>()) + "\"";
+                return "SELECT * FROM " + std::string(ModelSchema<Model>::TABLE) +
+                       " WHERE (" + column + ", id) < "
+                       "(TIMESTAMPTZ 'epoch' + $1::bigint * INTERVAL '1 microsecond', $2::bigint)"
+                       " ORDER BY " + column + " DESC, id DESC LIMIT $3";
+            }();
+            return sql;
+        }
+
+        // 키셋 다음 페이지 문장 ("<table>.keyset_next_page"). warmup은 epoch 이전 위치라 빈 결과
+        template <typename Model>
+        database::StatementRegistry::Statement& nextPageStatement() {
+            static auto& statement = database::StatementRegistry::getInstance().registerStatement(
+                std::string(ModelSchema<Model>::TABLE) + ".keyset_next_page",
+                keysetNextPageSql<Model>(),
+                int64_t{0}, int64_t{0}, size_t{1});
+            return statement;
+        }
+
+        // 모델의 키셋 위치 {정렬 시각(마이크로초), id}
+        template <typename Model>
+        std::pair<int64_t, int64_t> keysetPosition(const Model& model) {
+            int64_t micros = 0;
+            int64_t id = 0;
+            forEachField<Model>([&](const auto& desc) {
+                using Value = detail::ValueOf<decltype(desc)>;
+                if constexpr (std::is_same_v<Value, trantor::Date>) {
+                    if (desc.name == keysetColumn<Model>()) {
+                        micros = std::invoke(desc.get, model).microSecondsSinceEpoch();
+                    }
+                } else if constexpr (std::is_same_v<Value, int64_t>) {
+                    if ((desc.flags & KEY) != 0) {
+                        id = static_cast<int64_t>(std::invoke(desc.get, model));
+                    }
+                }
+            });
+            return {micros, id};
+        }
+
+        // 심볼별 시간 범위 청크 조회: (timestamp, id) 오름차순
+        // $1 = symbol, $2/$3 = 직전 청크 마지막 행 (timestamp 마이크로초, id), $4 = 범위 끝(마이크로초, 포함), $5 = limit
+        // 첫 청크는 $2 = 범위 시작, $3 = 0 (id는 양수이므로 시작 시각의 행도 포함)
+        // "timestamp" >= $2 조건을 중복으로 두어 (symbol, timestamp) 인덱스 범위 스캔을 사용
+        template <typename Model>
+        const std::string& rangeChunkSql() {
+            static_assert(detail::hasField<Model>("symbol") && detail::hasField<Model>("timestamp"),
+                          "Range streaming requires symbol and timestamp columns");
+            static const std::string sql =
+                "SELECT * FROM " + std::string(ModelSchema<Model>::TABLE) +
+                " WHERE symbol = $1"
+                " AND \"timestamp\" >= TIMESTAMPTZ 'epoch' + $2::bigint * INTERVAL '1 microsecond'"
+                " AND (\"timestamp\", id) > (TIMESTAMPTZ 'epoch' + $2::bigint * INTERVAL '1 microsecond', $3::bigint)"
+                " AND \"timestamp\" <= TIMESTAMPTZ 'epoch' + $4::bigint * INTERVAL '1 microsecond'"
+                " ORDER BY \"timestamp\", id LIMIT $5";
+            return sql;
+        }
+
+        // 범위 청크 문장 ("<table>.range_chunk"). warmup은 빈 심볼이라 빈 결과
+        template <typename Model>
+        database::StatementRegistry::Statement& rangeChunkStatement() {
+            static auto& statement = database::StatementRegistry::getInstance().registerStatement(
+                std::string(ModelSchema<Model>::TABLE) + ".range_chunk",
+                rangeChunkSql<Model>(),
+                std::string(), int64_t{0}, int64_t{0}, int64_t{0}, size_t{1});
+            return statement;
+        }
+
+        // 통계 기반 행 수 추정: $1 = 테이블명
+        // 파티션 테이블이면 부모(reltuples = -1/0) 대신 자식 파티션 합계를 사용
+        // ANALYZE 전의 -1은 0으로 취급
+        inline const char* approximateCountSql() {
+            return "SELECT COALESCE(SUM(GREATEST(c.reltuples, 0)), 0)::bigint AS estimate "
+                   "FROM pg_class c "
+                   "WHERE c.oid = $1::regclass "
+                   "OR c.oid IN (SELECT inhrelid FROM pg_inherits WHERE inhparent = $1::regclass)";
+        }
+
+        // 테이블명이 파라미터이므로 모든 모델이 한 문장을 공유
+        inline database::StatementRegistry::Statement& approximateCountStatement() {
+            static auto& statement = database::StatementRegistry::getInstance().registerStatement(
+                "schema.approximate_count", approximateCountSql(), std::string("pg_class"));
+            return statement;
+        }
+
+    } // namespace schema
+} // namespace models
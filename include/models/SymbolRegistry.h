@@ -0,0 +1,79 @@
+#pragma once
+
+#include "common/Config.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace models {
+
+    // 심볼의 조밀한(dense) 정수 id. 0부터 순서대로 발급되므로 배열 인덱스로 사용 가능
+    using SymbolId = uint32_t;
+
+    // 전역 심볼 인터닝 테이블
+    // - 조회(find/name)는 lock-free (acquire load만 사용)
+    // - 등록(intern)은 드물게 발생하므로 writer끼리만 뮤텍스로 직렬화
+    // - 한 번 발급된 id는 프로세스 수명 동안 변하지 않음 (삭제 없음)
+    class SymbolRegistry {
+    public:
+        static constexpr SymbolId INVALID_ID = std::numeric_limits<SymbolId>::max();
+        static constexpr size_t MAX_SYMBOLS = common::SymbolConfig::MAX_SYMBOLS;
+        static constexpr size_t MAX_SYMBOL_LENGTH = common::SymbolConfig::MAX_SYMBOL_LENGTH;
+
+        static SymbolRegistry& getInstance();
+
+        // 심볼 등록. 이미 등록된 심볼이면 기존 id 반환, 빈 문자열이면 INVALID_ID 반환
+        // 길이 초과는 std::invalid_argument, 용량 초과는 std::length_error
+        SymbolId intern(std::string_view symbol);
+
+        // 예외 없는 intern (모델 setter용): 등록할 수 없는 심볼이면 INVALID_ID
+        SymbolId tryIntern(std::string_view symbol) noexcept;
+
+        // 외부 입력 경계(fromJson, create)에서 setter 호출 전에 검증
+        // 비었거나 MAX_SYMBOL_LENGTH를 넘으면 std::invalid_argument
+        static void validate(std::string_view symbol);
+
+        // 등록된 심볼만 조회 (등록하지 않음)
+        std::optional<SymbolId> find(std::string_view symbol) const;
+
+        // id -> 심볼 문자열 (반환된 view는 프로세스 수명 동안 유효)
+        std::string_view name(SymbolId id) const;
+
+        // 현재 등록된 심볼 수 (유효한 id 범위는 [0, size()))
+        size_t size() const { return size_.load(std::memory_order_acquire); }
+
+        // 시작 시 활성 심볼 일괄 등록
+        void preload(const std::vector<std::string>& symbols);
+
+    private:
+        SymbolRegistry();
+        ~SymbolRegistry() = default;
+        SymbolRegistry(const SymbolRegistry&) = delete;
+        SymbolRegistry& operator=(const SymbolRegistry&) = delete;
+
+        // 오픈 어드레싱 해시 테이블 크기 (부하율 50% 이하 유지, 2의 거듭제곱)
+        static constexpr size_t TABLE_SIZE = MAX_SYMBOLS * 2;
+        static_assert((TABLE_SIZE & (TABLE_SIZE - 1)) == 0, "TABLE_SIZE must be a power of two");
+
+        struct Entry {
+            uint64_t hash{0};
+            uint8_t length{0};
+            char name[MAX_SYMBOL_LENGTH + 1]{};
+        };
+
+        static uint64_t hashOf(std::string_view symbol) noexcept;
+        std::optional<SymbolId> findWithHash(std::string_view symbol, uint64_t hash) const;
+
+        std::array<Entry, MAX_SYMBOLS> entries_;
+        std::array<std::atomic<uint32_t>, TABLE_SIZE> slots_;   // 0 = 빈 슬롯, 그 외 id + 1
+        std::atomic<uint32_t> size_{0};
+        std::mutex writeMutex_;
+    };
+
+} // namespace models
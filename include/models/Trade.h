@@ -1,6 +1,8 @@
 #pragma once
 
 #include "models/BaseModel.h"
+#include "models/ModelSchema.h"
+#include "models/SymbolRegistry.h"
 #include <drogon/orm/Field.h>
 #include <drogon/orm/Result.h>
 #include <drogon/orm/Row.h>
@@ -19,6 +21,7 @@ namespace models {
         const std::string& getTradeId() const { return trade_id_; }
         int64_t getOrderId() const { return order_id_; }
         const std::string& getSymbol() const { return symbol_; }
+        SymbolId getSymbolId() const { return symbol_id_; }
         const std::string& getSide() const { return side_; }
         double getQuantity() const { return quantity_; }
         double getPrice() const { return price_; }
@@ -31,7 +34,10 @@ namespace models {
         void setId(int64_t id) { id_ = id; }
         void setTradeId(const std::string& trade_id) { trade_id_ = trade_id; }
         void setOrderId(int64_t order_id) { order_id_ = order_id; }
-        void setSymbol(const std::string& symbol) { symbol_ = symbol; }
+        void setSymbol(const std::string& symbol) {
+            symbol_ = symbol;
+            symbol_id_ = SymbolRegistry::getInstance().tryIntern(symbol);   // 검증은 fromJson에서
+        }
         void setSide(const std::string& side) { side_ = side; }
         void setQuantity(double quantity) { quantity_ = quantity; }
         void setPrice(double price) { price_ = price; }
@@ -43,6 +49,7 @@ namespace models {
         // JSON conversion
         Json::Value toJson() const override;
         void fromJson(const Json::Value& json) override;
+        void writeJson(utils::JsonWriter& writer) const override;
 
         // Static factory methods
         static Trade fromDbRow(const drogon::orm::Row& row);
@@ -53,6 +60,7 @@ namespace models {
         std::string trade_id_;
         int64_t order_id_{0};
         std::string symbol_;
+        SymbolId symbol_id_{SymbolRegistry::INVALID_ID};
         std::string side_;  // BUY, SELL
         double quantity_{0.0};
         double price_{0.0};
@@ -62,4 +70,24 @@ namespace models {
         trantor::Date created_at_;
     };
 
+    namespace schema {
+        template <>
+        struct ModelSchema<Trade> {
+            static constexpr std::string_view TABLE = "trades";
+            static constexpr auto FIELDS = std::make_tuple(
+                field<int64_t>("id", &Trade::getId, &Trade::setId, KEY | JSON),
+                field<std::string>("trade_id", &Trade::getTradeId, &Trade::setTradeId, COLUMN),
+                field<int64_t>("order_id", &Trade::getOrderId, &Trade::setOrderId, COLUMN),
+                field<std::string>("symbol", &Trade::getSymbol, &Trade::setSymbol, COLUMN),
+                field<std::string>("side", &Trade::getSide, &Trade::setSide, COLUMN),
+                field<double>("quantity", &Trade::getQuantity, &Trade::setQuantity, COLUMN),
+                field<double>("price", &Trade::getPrice, &Trade::setPrice, COLUMN),
+                field<double>("commission", &Trade::getCommission, &Trade::setCommission, COLUMN),
+                field<std::string>("commission_asset", &Trade::getCommissionAsset, &Trade::setCommissionAsset, COLUMN),
+                field<trantor::Date>("timestamp", &Trade::getTimestamp, &Trade::setTimestamp, COLUMN),
+                field<trantor::Date>("created_at", &Trade::getCreatedAt, &Trade::setCreatedAt, GENERATED)
+            );
+        };
+    } // namespace schema
+
 }
\ No newline at end of file
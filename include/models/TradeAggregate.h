@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+
+namespace models {
+
+    // [fromMicros, toMicros) 시간 구간 (epoch 마이크로초)
+    struct TimeRange {
+        int64_t fromMicros{0};
+        int64_t toMicros{0};
+
+        bool empty() const { return fromMicros >= toMicros; }
+    };
+
+    // 체결 집계: 수량 합, 체결 금액(quantity * price) 합, 건수
+    struct TradeAggregate {
+        double volume{0.0};
+        double notional{0.0};
+        int64_t count{0};
+
+        // 거래량 가중 평균가. 체결이 없으면 0
+        double vwap() const { return volume > 0.0 ? notional / volume : 0.0; }
+
+        TradeAggregate& operator+=(const TradeAggregate& other) {
+            volume += other.volume;
+            notional += other.notional;
+            count += other.count;
+            return *this;
+        }
+
+        TradeAggregate& operator-=(const TradeAggregate& other) {
+            volume -= other.volume;
+            notional -= other.notional;
+            count -= other.count;
+            return *this;
+        }
+    };
+
+} // namespace models
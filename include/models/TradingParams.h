@@ -0,0 +1,81 @@
+#pragma once
+
+#include "models/SymbolRegistry.h"
+#include <json/json.h>
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace models {
+
+    // user_settings.strategy_params 를 한 번 해석한 결과
+    // {strategy_type, ma_period, rsi_period, ...나머지 숫자 파라미터}
+    struct StrategyParams {
+        std::string strategyType;
+        int maPeriod{0};
+        int rsiPeriod{0};
+        std::vector<std::pair<std::string, double>> extra;   // 키 기준 정렬
+
+        // 형식이 잘못된 값은 std::invalid_argument
+        static StrategyParams fromJson(const Json::Value& json);
+
+        // 추가 숫자 파라미터 조회 (없으면 fallback)
+        double numeric(std::string_view name, double fallback) const;
+    };
+
+    // user_settings.risk_params 를 한 번 해석한 결과
+    // {max_position_size, stop_loss_pct, take_profit_pct}, 0은 제한 없음
+    struct RiskParams {
+        double maxPositionSize{0.0};
+        double stopLossPct{0.0};
+        double takeProfitPct{0.0};
+
+        // 음수나 숫자가 아닌 값은 std::invalid_argument
+        static RiskParams fromJson(const Json::Value& json);
+
+        bool allowsPosition(double positionSize) const {
+            return maxPositionSize <= 0.0 || positionSize <= maxPositionSize;
+        }
+
+        // 진입가 기준 손절/익절 가격 (설정이 없으면 0)
+        double stopLossPrice(double entryPrice, bool isLong) const {
+            if (stopLossPct <= 0.0) return 0.0;
+            return entryPrice * (isLong ? 1.0 - stopLossPct / 100.0 : 1.0 + stopLossPct / 100.0);
+        }
+
+        double takeProfitPrice(double entryPrice, bool isLong) const {
+            if (takeProfitPct <= 0.0) return 0.0;
+            return entryPrice * (isLong ? 1.0 + takeProfitPct / 100.0 : 1.0 - takeProfitPct / 100.0);
+        }
+    };
+
+    // user_settings.watchlist 를 한 번 해석한 결과 ["BTC/USDT", ...]
+    // 심볼은 SymbolRegistry에 등록하고 정렬된 id 목록으로 포함 여부를 판정
+    struct Watchlist {
+        std::vector<std::string> symbols;
+        std::vector<SymbolId> symbolIds;   // 정렬됨
+
+        static Watchlist fromJson(const Json::Value& json);
+
+        bool contains(SymbolId id) const {
+            return std::binary_search(symbolIds.begin(), symbolIds.end(), id);
+        }
+
+        bool empty() const { return symbolIds.empty(); }
+    };
+
+    // 핫 패스에서 공유하는 불변 스냅샷
+    struct TradingParams {
+        int64_t settingsId{0};
+        int64_t userId{0};
+        std::string exchangeName;
+        bool autoTradeEnabled{false};
+        StrategyParams strategy;
+        RiskParams risk;
+        Watchlist watchlist;
+    };
+
+} // namespace models
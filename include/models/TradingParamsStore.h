@@ -0,0 +1,56 @@
+#pragma once
+
+#include "models/TradingParams.h"
+#include "models/UserSettings.h"
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace models {
+
+    // 사용자 설정별 TradingParams 스냅샷 저장소 (RCU 방식)
+    // - 읽기: 현재 테이블을 atomic load 한 번으로 얻고 조회 (락/JSON 접근 없음)
+    // - 쓰기: 테이블을 복사해 수정한 뒤 통째로 교체. 이전 스냅샷을 쥔 reader는 그대로 안전
+    // - 설정 변경은 드물고 조회는 주문마다 발생하므로 쓰기 비용을 감수
+    class TradingParamsStore {
+    public:
+        using Snapshot = std::shared_ptr<const TradingParams>;
+
+        static TradingParamsStore& getInstance();
+
+        // settingsId의 현재 스냅샷 (없으면 nullptr)
+        Snapshot get(int64_t settingsId) const;
+
+        // 로드/저장된 설정 전체를 게시
+        void publish(const UserSettings& settings);
+
+        // 부분 갱신 (게시된 스냅샷이 없으면 무시)
+        void updateStrategy(int64_t settingsId, const StrategyParams& strategy);
+        void updateRisk(int64_t settingsId, const RiskParams& risk);
+        void updateWatchlist(int64_t settingsId, const Watchlist& watchlist);
+        void updateAutoTrade(int64_t settingsId, bool enabled);
+
+        void remove(int64_t settingsId);
+        void clear();
+
+    private:
+        TradingParamsStore();
+        ~TradingParamsStore() = default;
+        TradingParamsStore(const TradingParamsStore&) = delete;
+        TradingParamsStore& operator=(const TradingParamsStore&) = delete;
+
+        using Table = std::unordered_map<int64_t, Snapshot>;
+
+        // writeMutex_를 쥔 상태에서 현재 스냅샷을 복사/수정 후 교체
+        template <typename Mutator>
+        void modify(int64_t settingsId, Mutator&& mutate);
+
+        void replaceTable(std::shared_ptr<const Table> table);
+
+        std::shared_ptr<const Table> table_;   // std::atomic_load/atomic_store로만 접근
+        std::mutex writeMutex_;
+    };
+
+} // namespace models
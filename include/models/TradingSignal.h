@@ -1,6 +1,8 @@
 #pragma once
 
 #include "models/BaseModel.h"
+#include "models/ModelSchema.h"
+#include "models/SymbolRegistry.h"
 #include <drogon/orm/Field.h>
 #include <drogon/orm/Result.h>
 #include <drogon/orm/Row.h>
@@ -17,6 +19,7 @@ namespace models {
         // Getters
         int64_t getId() const { return id_; }
         const std::string& getSymbol() const { return symbol_; }
+        SymbolId getSymbolId() const { return symbol_id_; }
         const std::string& getSignalType() const { return signal_type_; }
         double getPrice() const { return price_; }
         double getQuantity() const { return quantity_; }
@@ -28,7 +31,10 @@ namespace models {
 
         // Setters
         void setId(int64_t id) { id_ = id; }
-        void setSymbol(const std::string& symbol) { symbol_ = symbol; }
+        void setSymbol(const std::string& symbol) {
+            symbol_ = symbol;
+            symbol_id_ = SymbolRegistry::getInstance().tryIntern(symbol);   // 검증은 fromJson에서
+        }
         void setSignalType(const std::string& signal_type) { signal_type_ = signal_type; }
         void setPrice(double price) { price_ = price; }
         void setQuantity(double quantity) { quantity_ = quantity; }
@@ -41,6 +47,7 @@ namespace models {
         // JSON conversion
         Json::Value toJson() const override;
         void fromJson(const Json::Value& json) override;
+        void writeJson(utils::JsonWriter& writer) const override;
 
         // Static factory methods
         static TradingSignal fromDbRow(const drogon::orm::Row& row);
@@ -49,6 +56,7 @@ namespace models {
     private:
         int64_t id_{0};
         std::string symbol_;
+        SymbolId symbol_id_{SymbolRegistry::INVALID_ID};
         std::string signal_type_;  // BUY, SELL
         double price_{0.0};
         double quantity_{0.0};
@@ -59,4 +67,23 @@ namespace models {
         trantor::Date created_at_;
     };
 
+    namespace schema {
+        template <>
+        struct ModelSchema<TradingSignal> {
+            static constexpr std::string_view TABLE = "trading_signals";
+            static constexpr auto FIELDS = std::make_tuple(
+                field<int64_t>("id", &TradingSignal::getId, &TradingSignal::setId, KEY | JSON),
+                field<std::string>("symbol", &TradingSignal::getSymbol, &TradingSignal::setSymbol, COLUMN),
+                field<std::string>("signal_type", &TradingSignal::getSignalType, &TradingSignal::setSignalType, COLUMN),
+                field<double>("price", &TradingSignal::getPrice, &TradingSignal::setPrice, COLUMN),
+                field<double>("quantity", &TradingSignal::getQuantity, &TradingSignal::setQuantity, COLUMN),
+                field<std::string>("strategy_name", &TradingSignal::getStrategyName, &TradingSignal::setStrategyName, COLUMN),
+                field<double>("confidence", &TradingSignal::getConfidence, &TradingSignal::setConfidence, COLUMN),
+                field<Json::Value>("parameters", &TradingSignal::getParameters, &TradingSignal::setParameters, COLUMN),
+                field<trantor::Date>("timestamp", &TradingSignal::getTimestamp, &TradingSignal::setTimestamp, COLUMN),
+                field<trantor::Date>("created_at", &TradingSignal::getCreatedAt, &TradingSignal::setCreatedAt, GENERATED)
+            );
+        };
+    } // namespace schema
+
 }
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "models/BaseModel.h"
+#include "models/ModelSchema.h"
 #include <string>
 #include <json/json.h>
 #include <trantor/utils/Date.h>
@@ -38,6 +39,7 @@ namespace models {
         // JSON conversion
         Json::Value toJson() const override;
         void fromJson(const Json::Value& json) override;
+        void writeJson(utils::JsonWriter& writer) const override;
 
         // DB conversion
         static User fromDbRow(const drogon::orm::Row& row);
@@ -54,4 +56,21 @@ namespace models {
         trantor::Date updated_at_;
     };
 
+    namespace schema {
+        template <>
+        struct ModelSchema<User> {
+            static constexpr std::string_view TABLE = "users";
+            static constexpr auto FIELDS = std::make_tuple(
+                field<int64_t>("id", &User::getId, &User::setId, KEY | JSON),
+                field<std::string>("email", &User::getEmail, &User::setEmail, COLUMN),
+                field<std::string>("username", &User::getUsername, &User::setUsername, COLUMN),
+                field<std::string>("password_hash", &User::getPasswordHash, &User::setPasswordHash, INSERT | UPDATE),
+                field<bool>("is_active", &User::isActive, &User::setIsActive, COLUMN),
+                field<trantor::Date>("last_login_at", &User::getLastLoginAt, &User::setLastLoginAt, COLUMN),
+                field<trantor::Date>("created_at", &User::getCreatedAt, &User::setCreatedAt, GENERATED),
+                field<trantor::Date>("updated_at", &User::getUpdatedAt, &User::setUpdatedAt, GENERATED)
+            );
+        };
+    } // namespace schema
+
 } // namespace models
\ No newline at end of file
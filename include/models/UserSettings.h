@@ -1,11 +1,14 @@
 #pragma once
 
 #include "models/BaseModel.h"
+#include "models/ModelSchema.h"
+#include "models/TradingParams.h"
 #include <string>
 #include <json/json.h>
 #include <trantor/utils/Date.h>
 #include <drogon/orm/Row.h>
 #include <drogon/orm/Result.h>
+#include <memory>
 #include <vector>
 
 namespace models {
@@ -23,6 +26,9 @@ namespace models {
         const Json::Value& getStrategyParams() const { return strategy_params_; }
         const Json::Value& getWatchlist() const { return watchlist_; }
         const Json::Value& getRiskParams() const { return risk_params_; }
+        const StrategyParams& getParsedStrategyParams() const { return parsed_strategy_params_; }
+        const Watchlist& getParsedWatchlist() const { return parsed_watchlist_; }
+        const RiskParams& getParsedRiskParams() const { return parsed_risk_params_; }
         bool isAutoTradeEnabled() const { return auto_trade_enabled_; }
         const trantor::Date& getCreatedAt() const { return created_at_; }
         const trantor::Date& getUpdatedAt() const { return updated_at_; }
@@ -32,9 +38,10 @@ namespace models {
         void setUserId(int64_t user_id) { user_id_ = user_id; }
         void setExchangeName(const std::string& exchange_name) { exchange_name_ = exchange_name; }
         void setApiCredentials(const Json::Value& api_credentials) { api_credentials_ = api_credentials; }
-        void setStrategyParams(const Json::Value& strategy_params) { strategy_params_ = strategy_params; }
-        void setWatchlist(const Json::Value& watchlist) { watchlist_ = watchlist; }
-        void setRiskParams(const Json::Value& risk_params) { risk_params_ = risk_params; }
+        // JSON 파라미터는 설정 시점에 검증/해석 (형식 오류 시 std::invalid_argument)
+        void setStrategyParams(const Json::Value& strategy_params);
+        void setWatchlist(const Json::Value& watchlist);
+        void setRiskParams(const Json::Value& risk_params);
         void setAutoTradeEnabled(bool enabled) { auto_trade_enabled_ = enabled; }
         void setCreatedAt(const trantor::Date& created_at) { created_at_ = created_at; }
         void setUpdatedAt(const trantor::Date& updated_at) { updated_at_ = updated_at; }
@@ -42,11 +49,15 @@ namespace models {
         // JSON conversion
         Json::Value toJson() const override;
         void fromJson(const Json::Value& json) override;
+        void writeJson(utils::JsonWriter& writer) const override;
 
         // DB conversion
         static UserSettings fromDbRow(const drogon::orm::Row& row);
         static std::vector<UserSettings> fromDbResult(const drogon::orm::Result& result);
 
+        // 해석된 파라미터로 불변 스냅샷 생성
+        std::shared_ptr<const TradingParams> makeTradingParams() const;
+
     private:
         int64_t id_{0};
         int64_t user_id_{0};
@@ -55,9 +66,31 @@ namespace models {
         Json::Value strategy_params_;    // {strategy_type, ma_period, rsi_period, etc}
         Json::Value watchlist_;         // ["BTC/USDT", "ETH/USDT", ...]
         Json::Value risk_params_;       // {max_position_size, stop_loss_pct, take_profit_pct}
+        StrategyParams parsed_strategy_params_;
+        Watchlist parsed_watchlist_;
+        RiskParams parsed_risk_params_;
         bool auto_trade_enabled_{false};
         trantor::Date created_at_;
         trantor::Date updated_at_;
     };
 
+    namespace schema {
+        template <>
+        struct ModelSchema<UserSettings> {
+            static constexpr std::string_view TABLE = "user_settings";
+            static constexpr auto FIELDS = std::make_tuple(
+                field<int64_t>("id", &UserSettings::getId, &UserSettings::setId, KEY | JSON),
+                field<int64_t>("user_id", &UserSettings::getUserId, &UserSettings::setUserId, INSERT | JSON),
+                field<std::string>("exchange_name", &UserSettings::getExchangeName, &UserSettings::setExchangeName, COLUMN),
+                field<Json::Value>("api_credentials", &UserSettings::getApiCredentials, &UserSettings::setApiCredentials, COLUMN),
+                field<Json::Value>("strategy_params", &UserSettings::getStrategyParams, &UserSettings::setStrategyParams, COLUMN),
+                field<Json::Value>("watchlist", &UserSettings::getWatchlist, &UserSettings::setWatchlist, COLUMN),
+                field<Json::Value>("risk_params", &UserSettings::getRiskParams, &UserSettings::setRiskParams, COLUMN),
+                field<bool>("auto_trade_enabled", &UserSettings::isAutoTradeEnabled, &UserSettings::setAutoTradeEnabled, COLUMN),
+                field<trantor::Date>("created_at", &UserSettings::getCreatedAt, &UserSettings::setCreatedAt, GENERATED),
+                field<trantor::Date>("updated_at", &UserSettings::getUpdatedAt, &UserSettings::setUpdatedAt, GENERATED)
+            );
+        };
+    } // namespace schema
+
 } // namespace models
\ No newline at end of file
@@ -1,37 +1,320 @@
 #pragma once
 
 #include <drogon/drogon.h>
+#include <drogon/utils/coroutine.h>
+#include <trantor/utils/Date.h>
+#include "models/ModelRegistry.h"
+#include "models/ModelSchema.h"
+#include "models/SchemaBatch.h"
+#include "models/SchemaKeyset.h"
+#include "common/Config.h"
+#include "database/DbRouter.h"
+#include "database/StatementRegistry.h"
+#include <algorithm>
+#include <functional>
 #include <vector>
 #include <memory>
+#include <span>
+#include <stdexcept>
 #include <string>
+#include <tuple>
 
 namespace models {
     namespace mappers {
 
+        // 모델 공통 CRUD
+        // - *Async: C++20 코루틴. DB 왕복 동안 IO 스레드를 점유하지 않으므로
+        //   동시 요청 수는 스레드 수가 아니라 커넥션 풀 크기에 의해 제한됨
+        // - 동기 버전: 비동기 버전을 sync_wait로 감싼 얇은 래퍼 (호출 스레드 블로킹)
+        // 테이블/컬럼 정보는 schema::ModelSchema<T>에서 가져옴
         template<typename T>
         class BaseMapper {
         public:
-            // CRUD 기본 연산
-            virtual T insert(const T& model) = 0;
-            virtual T findById(int64_t id) = 0;
-            virtual std::vector<T> findAll() = 0;
-            virtual std::vector<T> findByCriteria(const std::string& whereClause) = 0;
-            virtual void update(const T& model) = 0;
-            virtual void deleteById(int64_t id) = 0;
-            virtual size_t count(const std::string& whereClause = "") = 0;
+            // CRUD 기본 연산 (동기)
+            virtual T insert(const T& model) { return drogon::sync_wait(insertAsync(model)); }
+            virtual T findById(int64_t id) { return drogon::sync_wait(findByIdAsync(id)); }
+            // 여러 id를 "WHERE id = ANY($1)"로 조회 (MAX_ROWS_PER_STATEMENT개씩 한 번의 왕복)
+            // 없는 id는 생략, 결과 순서는 보장하지 않음
+            std::vector<T> findByIds(std::span<const int64_t> ids) {
+                return drogon::sync_wait(findByIdsAsync(std::vector<int64_t>(ids.begin(), ids.end())));
+            }
+            virtual std::vector<T> findAll() { return drogon::sync_wait(findAllAsync()); }
+            virtual std::vector<T> findByCriteria(const std::string& whereClause) {
+                return drogon::sync_wait(findByCriteriaAsync(whereClause));
+            }
+            virtual void update(const T& model) { drogon::sync_wait(updateAsync(model)); }
+            virtual void deleteById(int64_t id) { drogon::sync_wait(deleteByIdAsync(id)); }
+            virtual size_t count(const std::string& whereClause = "") {
+                return drogon::sync_wait(countAsync(whereClause));
+            }
 
             // 페이징 처리
-            virtual std::vector<T> findWithPaging(size_t limit, size_t offset) = 0;
+            virtual std::vector<T> findWithPaging(size_t limit, size_t offset) {
+                return drogon::sync_wait(findWithPagingAsync(limit, offset));
+            }
+
+            // 키셋 페이지네이션 ((정렬 시각, id) 내림차순, SchemaKeyset.h)
+            std::vector<T> findFirstPage(size_t limit) {
+                return drogon::sync_wait(findFirstPageAsync(limit));
+            }
+            std::vector<T> findPageAfter(int64_t afterTimestampMicros, int64_t afterId, size_t limit) {
+                return drogon::sync_wait(findPageAfterAsync(afterTimestampMicros, afterId, limit));
+            }
+
+            // 심볼/시간 범위 스트리밍: [start, end]를 (timestamp, id) 오름차순으로 fetchSize행씩 읽어
+            // 행마다 visitor 호출. 메모리에는 한 청크만 유지. visitor가 false를 반환하면 중단
+            // 방문한 행 수 반환. symbol/timestamp 컬럼이 있는 모델 전용
+            using RowVisitor = std::function<bool(const T&)>;
+
+            size_t forEachInRange(
+                const std::string& symbol,
+                const trantor::Date& start,
+                const trantor::Date& end,
+                const RowVisitor& visitor,
+                size_t fetchSize = common::PaginationConfig::STREAM_FETCH_SIZE
+            ) {
+                return drogon::sync_wait(forEachInRangeAsync(symbol, start, end, visitor, fetchSize));
+            }
+
+            // 테이블 행 수 근사치. 통계 추정치가 EXACT_COUNT_THRESHOLD 미만이면 COUNT(*) 결과
+            size_t approximateCount() {
+                return drogon::sync_wait(approximateCountAsync());
+            }
+
+            // 다건 INSERT/UPDATE: unnest 배열 파라미터로 청크당 한 번의 왕복. 영향받은 행 수 반환
+            size_t insertBatch(const std::vector<T>& models) {
+                return schema::execBatchInsert(*getDbClient(), models);
+            }
+            size_t insertBatch(const std::vector<T>& models, drogon::orm::Transaction& trans) {
+                return schema::execBatchInsert(trans, models);
+            }
+            size_t updateBatch(const std::vector<T>& models) {
+                return schema::execBatchUpdate(*getDbClient(), models);
+            }
+            size_t updateBatch(const std::vector<T>& models, drogon::orm::Transaction& trans) {
+                return schema::execBatchUpdate(trans, models);
+            }
+
+            // CRUD 기본 연산 (비동기)
+            // Task는 지연 실행되므로 인자는 값으로 받아 코루틴 프레임에 보관
+            drogon::Task<T> insertAsync(T model) {
+                auto result = co_await std::apply(
+                    [client = getDbClient()](const auto&... params) {
+                        return database::StatementRegistry::executeCoro(client, schema::insertStatement<T>(), params...);
+                    },
+                    schema::insertParams(model)
+                );
+                if (result.empty()) {
+                    throw std::runtime_error("Failed to insert into " + tableName());
+                }
+                co_return ModelRegistry::loadOne<T>(result[0]);
+            }
+
+            drogon::Task<T> findByIdAsync(int64_t id) {
+                auto result = co_await database::StatementRegistry::executeCoro(
+                    getReadDbClient(), findByIdStatement_, id);
+                if (result.empty()) {
+                    throw std::runtime_error("Row not found in " + tableName() + ": id " + std::to_string(id));
+                }
+                co_return ModelRegistry::loadOne<T>(result[0]);
+            }
+
+            drogon::Task<std::vector<T>> findByIdsAsync(std::vector<int64_t> ids) {
+                std::vector<T> models;
+                const std::span<const int64_t> all(ids);
+                for (size_t offset = 0; offset < all.size(); offset += common::BatchConfig::MAX_ROWS_PER_STATEMENT) {
+                    const auto chunk = all.subspan(
+                        offset, std::min(common::BatchConfig::MAX_ROWS_PER_STATEMENT, all.size() - offset));
+                    auto result = co_await database::StatementRegistry::executeCoro(
+                        getReadDbClient(), findByIdsStatement_, schema::bigintArray(chunk));
+                    ModelRegistry::loadInto<T>(result, models);
+                }
+                co_return models;
+            }
+
+            drogon::Task<std::vector<T>> findAllAsync() {
+                auto result = co_await database::StatementRegistry::executeCoro(getReadDbClient(), findAllStatement_);
+                co_return ModelRegistry::loadAll<T>(result);
+            }
+
+            // 호출자가 만든 WHERE 절은 호출마다 SQL이 달라 등록하지 않음 (조건이 없으면 findAll 문장)
+            drogon::Task<std::vector<T>> findByCriteriaAsync(std::string whereClause) {
+                if (whereClause.empty()) {
+                    co_return co_await findAllAsync();
+                }
+                std::string sql = "SELECT * FROM " + tableName();
+                if (!whereClause.empty()) {
+                    sql += " WHERE " + whereClause;
+                }
+                auto result = co_await getReadDbClient()->execSqlCoro(sql);
+                co_return ModelRegistry::loadAll<T>(result);
+            }
+
+            drogon::Task<> updateAsync(T model) {
+                auto result = co_await std::apply(
+                    [client = getDbClient()](const auto&... params) {
+                        return database::StatementRegistry::executeCoro(client, schema::updateStatement<T>(), params...);
+                    },
+                    schema::updateParams(model)
+                );
+                if (result.affectedRows() == 0) {
+                    throw std::runtime_error("Row not found for update in " + tableName());
+                }
+            }
+
+            drogon::Task<> deleteByIdAsync(int64_t id) {
+                auto result = co_await database::StatementRegistry::executeCoro(
+                    getDbClient(), deleteByIdStatement_, id);
+                if (result.affectedRows() == 0) {
+                    throw std::runtime_error("Row not found for deletion in " + tableName());
+                }
+            }
+
+            drogon::Task<size_t> countAsync(std::string whereClause = "") {
+                if (whereClause.empty()) {
+                    auto result = co_await database::StatementRegistry::executeCoro(getReadDbClient(), countStatement_);
+                    co_return result[0]["count"].template as<size_t>();
+                }
+                std::string sql = "SELECT COUNT(*) FROM " + tableName();
+                if (!whereClause.empty()) {
+                    sql += " WHERE " + whereClause;
+                }
+                auto result = co_await getReadDbClient()->execSqlCoro(sql);
+                co_return result[0]["count"].template as<size_t>();
+            }
+
+            drogon::Task<std::vector<T>> findWithPagingAsync(size_t limit, size_t offset) {
+                auto result = co_await database::StatementRegistry::executeCoro(
+                    getReadDbClient(), pageStatement_, limit, offset);
+                co_return ModelRegistry::loadAll<T>(result);
+            }
+
+            drogon::Task<std::vector<T>> findFirstPageAsync(size_t limit) {
+                auto result = co_await database::StatementRegistry::executeCoro(
+                    getReadDbClient(), firstPageStatement_, limit);
+                co_return ModelRegistry::loadAll<T>(result);
+            }
+
+            drogon::Task<std::vector<T>> findPageAfterAsync(int64_t afterTimestampMicros, int64_t afterId, size_t limit) {
+                auto result = co_await database::StatementRegistry::executeCoro(
+                    getReadDbClient(), nextPageStatement_, afterTimestampMicros, afterId, limit);
+                co_return ModelRegistry::loadAll<T>(result);
+            }
+
+            drogon::Task<size_t> forEachInRangeAsync(
+                std::string symbol,
+                trantor::Date start,
+                trantor::Date end,
+                RowVisitor visitor,
+                size_t fetchSize = common::PaginationConfig::STREAM_FETCH_SIZE
+            ) {
+                if (fetchSize == 0) {
+                    throw std::invalid_argument("Fetch size must be positive");
+                }
+                const int64_t endMicros = end.microSecondsSinceEpoch();
+                int64_t afterMicros = start.microSecondsSinceEpoch();
+                int64_t afterId = 0;
+                size_t visited = 0;
+
+                for (;;) {
+                    auto result = co_await database::StatementRegistry::executeCoro(
+                        getReadDbClient(), schema::rangeChunkStatement<T>(), symbol, afterMicros, afterId, endMicros, fetchSize);
+                    auto chunk = ModelRegistry::loadAll<T>(result);
+                    for (const auto& model : chunk) {
+                        ++visited;
+                        if (!visitor(model)) {
+                            co_return visited;
+                        }
+                    }
+                    if (result.size() < fetchSize || chunk.empty()) {
+                        co_return visited;
+                    }
+                    std::tie(afterMicros, afterId) = schema::keysetPosition(chunk.back());
+                }
+            }
+
+            drogon::Task<size_t> approximateCountAsync() {
+                auto result = co_await database::StatementRegistry::executeCoro(
+                    getReadDbClient(), approximateCountStatement_, tableName());
+                const auto estimate = result[0]["estimate"].template as<int64_t>();
+                if (estimate < static_cast<int64_t>(common::PaginationConfig::EXACT_COUNT_THRESHOLD)) {
+                    co_return co_await countAsync();
+                }
+                co_return static_cast<size_t>(estimate);
+            }
 
         protected:
-            BaseMapper() = default;
+            // 반복 실행되는 문장은 StatementRegistry에 등록 (시작 시 풀 연결마다 미리 준비)
+            // warmup은 롤백되는 트랜잭션에서 실행되므로 DELETE도 id 0으로 안전하게 등록 가능
+            // 전체 스캔(findAll/count)과 INSERT/UPDATE는 이름/통계만 등록하고 warmup에서 제외
+            // 파티션 테이블(orders/trades)에서 id 조회/삭제와 update(WHERE id)는 파티션 키 조건이 없어
+            // 모든 파티션의 (id, timestamp) PK 인덱스를 확인 (비용은 보존 파티션 수에 비례)
+            BaseMapper()
+                : findByIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                      tableName() + ".find_by_id",
+                      "SELECT * FROM " + tableName() + " WHERE id = $1",
+                      int64_t{0})),
+                  findByIdsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                      tableName() + ".find_by_ids",
+                      "SELECT * FROM " + tableName() + " WHERE id = ANY($1::bigint[])",
+                      std::string("{}"))),
+                  deleteByIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                      tableName() + ".delete_by_id",
+                      "DELETE FROM " + tableName() + " WHERE id = $1",
+                      int64_t{0})),
+                  firstPageStatement_(database::StatementRegistry::getInstance().registerStatement(
+                      tableName() + ".keyset_first_page",
+                      schema::keysetFirstPageSql<T>(),
+                      size_t{1})),
+                  findAllStatement_(database::StatementRegistry::getInstance().registerWithoutWarmup(
+                      tableName() + ".find_all",
+                      "SELECT * FROM " + tableName())),
+                  countStatement_(database::StatementRegistry::getInstance().registerWithoutWarmup(
+                      tableName() + ".count",
+                      "SELECT COUNT(*) FROM " + tableName())),
+                  pageStatement_(database::StatementRegistry::getInstance().registerStatement(
+                      tableName() + ".find_with_paging",
+                      "SELECT * FROM " + tableName() + " ORDER BY id LIMIT $1 OFFSET $2",
+                      size_t{1}, size_t{0})),
+                  nextPageStatement_(schema::nextPageStatement<T>()),
+                  approximateCountStatement_(schema::approximateCountStatement()) {
+                // 스키마 공용 문장도 warmup 전에 등록되도록 생성 시점에 한 번 조회
+                schema::insertStatement<T>();
+                schema::updateStatement<T>();
+                schema::batchInsertStatement<T>();
+                schema::batchUpdateStatement<T>();
+                if constexpr (schema::detail::hasField<T>("symbol") && schema::detail::hasField<T>("timestamp")) {
+                    schema::rangeChunkStatement<T>();
+                }
+            }
             virtual ~BaseMapper() = default;
-            
-            // DB 클라이언트 가져오기
-            auto getDbClient() {
-                return drogon::app().getDbClient();
+
+            // 쓰기/트랜잭션용 primary 클라이언트
+            drogon::orm::DbClientPtr getDbClient() const {
+                return database::DbRouter::getInstance().writer();
+            }
+
+            // 단순 조회용. replica가 건강하면 replica, 아니면 primary (DbRouter)
+            // 갱신 직후 재조회가 잦은 모델은 primary를 반환하도록 재정의
+            virtual drogon::orm::DbClientPtr getReadDbClient() const {
+                return database::DbRouter::getInstance().reader();
             }
+
+            static const std::string& tableName() {
+                static const std::string name(schema::ModelSchema<T>::TABLE);
+                return name;
+            }
+
+            database::StatementRegistry::Statement& findByIdStatement_;
+            database::StatementRegistry::Statement& findByIdsStatement_;
+            database::StatementRegistry::Statement& deleteByIdStatement_;
+            database::StatementRegistry::Statement& firstPageStatement_;
+            database::StatementRegistry::Statement& findAllStatement_;
+            database::StatementRegistry::Statement& countStatement_;
+            database::StatementRegistry::Statement& pageStatement_;
+            database::StatementRegistry::Statement& nextPageStatement_;
+            database::StatementRegistry::Statement& approximateCountStatement_;
         };
 
     } // namespace mappers
-} // namespace models
\ No newline at end of file
+} // namespace models
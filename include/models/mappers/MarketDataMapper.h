@@ -1,9 +1,16 @@
 #pragma once
 
 #include <drogon/drogon.h>
+#include <drogon/utils/coroutine.h>
 #include <trantor/utils/Date.h>
 #include "models/MarketData.h"
+#include "models/MarketDataBatch.h"
+#include "models/CandleBar.h"
+#include "database/DbRouter.h"
+#include "database/StatementRegistry.h"
+#include <functional>
 #include <memory>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -25,16 +32,44 @@ namespace models {
             std::shared_ptr<MarketData> insert(const std::shared_ptr<MarketData>& marketData);
 
             std::shared_ptr<MarketData> findById(int64_t id);
+            // "WHERE id = ANY($1)" 한 번의 왕복. 없는 id는 생략, 결과 순서는 보장하지 않음
+            std::vector<std::shared_ptr<MarketData>> findByIds(std::span<const int64_t> ids);
             std::vector<std::shared_ptr<MarketData>> findWithPaging(size_t limit, size_t offset);
             size_t count();
 
+            // 키셋 페이지네이션 ((timestamp, id) 내림차순)
+            std::vector<std::shared_ptr<MarketData>> findFirstPage(size_t limit);
+            std::vector<std::shared_ptr<MarketData>> findPageAfter(
+                int64_t afterTimestampMicros,
+                int64_t afterId,
+                size_t limit
+            );
+            // pg_class 통계 기반 행 수 (작은 테이블은 COUNT(*))
+            size_t approximateCount();
+
             void update(const std::shared_ptr<MarketData>& marketData, Transaction& transaction);
             void update(const std::shared_ptr<MarketData>& marketData);
 
             void deleteById(int64_t id, Transaction& transaction);
             void deleteById(int64_t id);
 
+            // 비동기 CRUD (C++20 코루틴, BaseRepository의 *Via 공통 구현과 같은 시그니처)
+            // DB 왕복 동안 IO 스레드를 점유하지 않음. 풀 객체 대신 값으로 반환
+            drogon::Task<MarketData> insertAsync(MarketData marketData);
+            drogon::Task<MarketData> findByIdAsync(int64_t id);
+            drogon::Task<> updateAsync(MarketData marketData);
+            drogon::Task<> deleteByIdAsync(int64_t id);
+            drogon::Task<std::vector<MarketData>> findWithPagingAsync(size_t limit, size_t offset);
+            drogon::Task<std::vector<MarketData>> findFirstPageAsync(size_t limit);
+            drogon::Task<std::vector<MarketData>> findPageAfterAsync(
+                int64_t afterTimestampMicros,
+                int64_t afterId,
+                size_t limit
+            );
+            drogon::Task<size_t> approximateCountAsync();
+
             // 특화된 쿼리 메서드
+            // 최신 시세는 replica 지연 없이 primary에서 조회
             std::shared_ptr<MarketData> findLatestBySymbol(const std::string& symbol);
             
             std::vector<std::shared_ptr<MarketData>> findBySymbolWithLimit(
@@ -54,20 +89,72 @@ namespace models {
                 const trantor::Date& end
             );
 
+            // 범위 스트리밍: fetchSize행씩 (timestamp, id) 오름차순 청크로 읽어 visitor 호출
+            // visitor가 false를 반환하면 중단. 방문한 행 수 반환
+            using RowVisitor = std::function<bool(const MarketData&)>;
+            size_t forEachInRange(
+                const std::string& symbol,
+                const trantor::Date& start,
+                const trantor::Date& end,
+                const RowVisitor& visitor,
+                size_t fetchSize
+            );
+
+            // 윈도우 분석용 컬럼 배치 (timestamp 오름차순)
+            MarketDataBatch findBatchBySymbolAndTimeRange(
+                const std::string& symbol,
+                const trantor::Date& start,
+                const trantor::Date& end
+            );
+
             std::vector<std::string> getActiveSymbols(
                 const trantor::Date& since,
                 size_t minDataPoints = 1
             );
 
+            // market_bars 봉 델타 upsert (이미 있는 봉과는 병합 규칙으로 합침, 한 트랜잭션)
+            // 같은 (resolution, symbol, open_time)이 bars 안에 중복되면 안 됨. 기록한 봉 수 반환
+            size_t upsertBars(const std::vector<CandleBar>& bars);
+
+            // [fromMicros, toMicros) 구간에서 시작하는 봉 (open_time 오름차순)
+            std::vector<CandleBar> findBars(
+                const std::string& symbol,
+                BarResolution resolution,
+                int64_t fromMicros,
+                int64_t toMicros
+            );
+
         private:
-            MarketDataMapper() = default;
+            MarketDataMapper();
             ~MarketDataMapper() = default;
             MarketDataMapper(const MarketDataMapper&) = delete;
             MarketDataMapper& operator=(const MarketDataMapper&) = delete;
 
+            // 쓰기용 primary / 조회용 replica 라우팅 (DbRouter)
             DbClientPtr getDbClient() const {
-                return drogon::app().getDbClient();
+                return database::DbRouter::getInstance().writer();
             }
+            DbClientPtr getReadDbClient() const {
+                return database::DbRouter::getInstance().reader();
+            }
+
+            // 시세 조회 핫 쿼리 (StatementRegistry에 등록, 시작 시 미리 준비)
+            database::StatementRegistry::Statement& findByIdStatement_;
+            database::StatementRegistry::Statement& findByIdsStatement_;
+            database::StatementRegistry::Statement& findLatestBySymbolStatement_;
+            database::StatementRegistry::Statement& findBySymbolWithLimitStatement_;
+            database::StatementRegistry::Statement& deleteByIdStatement_;
+            database::StatementRegistry::Statement& pageStatement_;
+            database::StatementRegistry::Statement& countStatement_;
+            database::StatementRegistry::Statement& firstPageStatement_;
+            database::StatementRegistry::Statement& nextPageStatement_;
+            database::StatementRegistry::Statement& rangeChunkStatement_;
+            database::StatementRegistry::Statement& approximateCountStatement_;
+            database::StatementRegistry::Statement& findBySymbolAndTimeRangeStatement_;
+            database::StatementRegistry::Statement& findBatchBySymbolAndTimeRangeStatement_;
+            database::StatementRegistry::Statement& activeSymbolsStatement_;
+            database::StatementRegistry::Statement& upsertBarsStatement_;
+            database::StatementRegistry::Statement& findBarsStatement_;
         };
 
     } // namespace mappers
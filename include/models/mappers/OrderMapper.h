@@ -7,36 +7,48 @@
 namespace models {
     namespace mappers {
 
+        // 체결/상태 변경 한 건 (updateOrderStatusBatch 입력)
+        struct OrderStatusUpdate {
+            int64_t id{0};
+            std::string status;
+            double filledQuantity{0.0};
+            double filledPrice{0.0};
+        };
+
         class OrderMapper : public BaseMapper<Order> {
         public:
             using Transaction = drogon::orm::Transaction;
 
             static OrderMapper& getInstance();
 
-            // 기본 CRUD 오버로드 (트랜잭션 지원)
-            Order insert(const Order& order) override;
-            Order insert(const Order& order, Transaction& trans);
+            // 공통 CRUD (동기/비동기)는 BaseMapper, 여기서는 트랜잭션 오버로드만 정의
+            using BaseMapper<Order>::insert;
+            using BaseMapper<Order>::findById;
+            using BaseMapper<Order>::findAll;
+            using BaseMapper<Order>::findByCriteria;
+            using BaseMapper<Order>::update;
+            using BaseMapper<Order>::deleteById;
+            using BaseMapper<Order>::count;
+            using BaseMapper<Order>::findWithPaging;
 
-            Order findById(int64_t id) override;
-            std::vector<Order> findAll() override;
-            std::vector<Order> findByCriteria(const std::string& whereClause) override;
+            // 트랜잭션 오버로드
+            Order insert(const Order& order, Transaction& trans);
             std::vector<Order> findByCriteria(const std::string& whereClause, Transaction& trans);
-            
-            void update(const Order& order) override;
             void update(const Order& order, Transaction& trans);
-            
-            void deleteById(int64_t id) override;
             void deleteById(int64_t id, Transaction& trans);
-            
-            size_t count(const std::string& whereClause = "") override;
-            std::vector<Order> findWithPaging(size_t limit, size_t offset) override;
 
             // Order 전용 메서드
             std::vector<Order> findBySymbol(const std::string& symbol);
             std::vector<Order> findBySymbol(const std::string& symbol, Transaction& trans);
+            std::vector<Order> findBySymbol(const std::string& symbol, size_t limit);
 
             std::vector<Order> findByStatus(const std::string& status);
             std::vector<Order> findByStatus(const std::string& status, Transaction& trans);
+            std::vector<Order> findByStatus(const std::string& status, size_t limit);
+
+            // 거래소 주문 번호 목록으로 조회 (다건 INSERT 후 생성된 id 확인용)
+            // order_id는 order_ids 조회 테이블(V6)로 전역 유일하므로 번호당 최대 한 행
+            std::vector<Order> findByOrderIds(const std::vector<std::string>& orderIds, Transaction& trans);
 
             std::vector<Order> findBySignalId(int64_t signalId);
             std::vector<Order> findBySignalId(int64_t signalId, Transaction& trans);
@@ -62,15 +74,28 @@ namespace models {
                                    double filledQuantity, double filledPrice,
                                    Transaction& trans);
 
+            // 여러 주문의 상태를 한 문장으로 갱신 (unnest 배열 파라미터). 갱신된 행 수 반환
+            size_t updateOrderStatusBatch(const std::vector<OrderStatusUpdate>& updates);
+            size_t updateOrderStatusBatch(const std::vector<OrderStatusUpdate>& updates, Transaction& trans);
+
         private:
-            OrderMapper() = default;
+            OrderMapper();
             ~OrderMapper() override = default;
             OrderMapper(const OrderMapper&) = delete;
             OrderMapper& operator=(const OrderMapper&) = delete;
 
-            drogon::orm::DbClientPtr getDbClient() const {
-                return drogon::app().getDbClient();
-            }
+            // 주문 조회/상태 갱신 문장 (StatementRegistry에 등록, 시작 시 미리 준비)
+            database::StatementRegistry::Statement& findBySymbolStatement_;
+            database::StatementRegistry::Statement& findBySymbolWithLimitStatement_;
+            database::StatementRegistry::Statement& findByStatusStatement_;
+            database::StatementRegistry::Statement& findByStatusWithLimitStatement_;
+            database::StatementRegistry::Statement& findByOrderIdsStatement_;
+            database::StatementRegistry::Statement& findBySignalIdStatement_;
+            database::StatementRegistry::Statement& findByTimeRangeStatement_;
+            database::StatementRegistry::Statement& findPendingStatement_;
+            database::StatementRegistry::Statement& findPendingBySymbolStatement_;
+            database::StatementRegistry::Statement& updateStatusStatement_;
+            database::StatementRegistry::Statement& updateStatusBatchStatement_;
         };
 
     } // namespace mappers
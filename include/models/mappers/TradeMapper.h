@@ -3,6 +3,9 @@
 #include <drogon/drogon.h>
 #include "models/mappers/BaseMapper.h"
 #include "models/Trade.h"
+#include "models/TradeAggregate.h"
+#include <utility>
+#include <vector>
 
 namespace models {
     namespace mappers {
@@ -13,36 +16,33 @@ namespace models {
 
             static TradeMapper& getInstance();
 
-            // 기본 CRUD
-            Trade insert(const Trade& trade) override;
+            // 공통 CRUD (동기/비동기)는 BaseMapper, 여기서는 트랜잭션 오버로드만 정의
+            using BaseMapper<Trade>::insert;
+            using BaseMapper<Trade>::findById;
+            using BaseMapper<Trade>::findAll;
+            using BaseMapper<Trade>::findByCriteria;
+            using BaseMapper<Trade>::update;
+            using BaseMapper<Trade>::deleteById;
+            using BaseMapper<Trade>::count;
+            using BaseMapper<Trade>::findWithPaging;
+
+            // 트랜잭션 오버로드
             Trade insert(const Trade& trade, Transaction& trans);
-
-            Trade findById(int64_t id) override;
-
-            std::vector<Trade> findAll() override;
             std::vector<Trade> findAll(Transaction& trans);
-
-            std::vector<Trade> findByCriteria(const std::string& whereClause) override;
             std::vector<Trade> findByCriteria(const std::string& whereClause, Transaction& trans);
-
-            void update(const Trade& trade) override;
             void update(const Trade& trade, Transaction& trans);
-
-            void deleteById(int64_t id) override;
             void deleteById(int64_t id, Transaction& trans);
-
-            size_t count(const std::string& whereClause = "") override;
             size_t count(const std::string& whereClause, Transaction& trans);
-
-            std::vector<Trade> findWithPaging(size_t limit, size_t offset) override;
             std::vector<Trade> findWithPaging(size_t limit, size_t offset, Transaction& trans);
 
             // Trade 전용 메서드
             std::vector<Trade> findBySymbol(const std::string& symbol);
             std::vector<Trade> findBySymbol(const std::string& symbol, Transaction& trans);
+            std::vector<Trade> findBySymbol(const std::string& symbol, size_t limit);
 
             std::vector<Trade> findByOrderId(int64_t orderId);
             std::vector<Trade> findByOrderId(int64_t orderId, Transaction& trans);
+            std::vector<Trade> findByOrderId(int64_t orderId, size_t limit);
 
             std::vector<Trade> findByTimeRange(
                 const std::string& symbol,
@@ -72,15 +72,39 @@ namespace models {
                                          const trantor::Date& end,
                                          Transaction& trans);
 
+            // [fromMicros, toMicros) 체결을 bucketMicros 폭 버킷별로 집계 (버킷 시작 시각, 합)
+            // TradeAggregateIndex 로드용: 로드 직전 커밋된 체결이 빠지지 않도록 primary에서 조회
+            std::vector<std::pair<int64_t, TradeAggregate>> aggregateBuckets(
+                const std::string& symbol,
+                int64_t fromMicros,
+                int64_t toMicros,
+                int64_t bucketMicros
+            );
+
+            // 두 구간 체결 합 (빈 구간은 행이 없음). 인덱스 경계 밖 자투리 보정용
+            // 인덱스(primary 기준)와 합치므로 같은 시점을 보도록 primary에서 조회
+            TradeAggregate aggregateRanges(
+                const std::string& symbol,
+                const TimeRange& first,
+                const TimeRange& second
+            );
+
         private:
-            TradeMapper() = default;
+            TradeMapper();
             ~TradeMapper() override = default;
             TradeMapper(const TradeMapper&) = delete;
             TradeMapper& operator=(const TradeMapper&) = delete;
 
-            drogon::orm::DbClientPtr getDbClient() const {
-                return drogon::app().getDbClient();
-            }
+            // 체결 조회/집계 문장 (StatementRegistry에 등록, 시작 시 미리 준비)
+            database::StatementRegistry::Statement& findBySymbolStatement_;
+            database::StatementRegistry::Statement& findBySymbolWithLimitStatement_;
+            database::StatementRegistry::Statement& findByOrderIdStatement_;
+            database::StatementRegistry::Statement& findByOrderIdWithLimitStatement_;
+            database::StatementRegistry::Statement& findByTimeRangeStatement_;
+            database::StatementRegistry::Statement& totalVolumeStatement_;
+            database::StatementRegistry::Statement& averagePriceStatement_;
+            database::StatementRegistry::Statement& aggregateBucketsStatement_;
+            database::StatementRegistry::Statement& aggregateRangesStatement_;
         };
 
     } // namespace mappers
@@ -13,33 +13,29 @@ namespace models {
 
             static TradingSignalMapper& getInstance();
 
-            // 기본 CRUD
-            TradingSignal insert(const TradingSignal& signal) override;
+            // 공통 CRUD (동기/비동기)는 BaseMapper, 여기서는 트랜잭션 오버로드만 정의
+            using BaseMapper<TradingSignal>::insert;
+            using BaseMapper<TradingSignal>::findById;
+            using BaseMapper<TradingSignal>::findAll;
+            using BaseMapper<TradingSignal>::findByCriteria;
+            using BaseMapper<TradingSignal>::update;
+            using BaseMapper<TradingSignal>::deleteById;
+            using BaseMapper<TradingSignal>::count;
+            using BaseMapper<TradingSignal>::findWithPaging;
+
+            // 트랜잭션 오버로드
             TradingSignal insert(const TradingSignal& signal, Transaction& trans);
-
-            TradingSignal findById(int64_t id) override;
-
-            std::vector<TradingSignal> findAll() override;
             std::vector<TradingSignal> findAll(Transaction& trans);
-
-            std::vector<TradingSignal> findByCriteria(const std::string& whereClause) override;
             std::vector<TradingSignal> findByCriteria(const std::string& whereClause, Transaction& trans);
-
-            void update(const TradingSignal& signal) override;
             void update(const TradingSignal& signal, Transaction& trans);
-
-            void deleteById(int64_t id) override;
             void deleteById(int64_t id, Transaction& trans);
-
-            size_t count(const std::string& whereClause = "") override;
             size_t count(const std::string& whereClause, Transaction& trans);
-
-            std::vector<TradingSignal> findWithPaging(size_t limit, size_t offset) override;
             std::vector<TradingSignal> findWithPaging(size_t limit, size_t offset, Transaction& trans);
 
             // TradingSignal 전용 메서드
             std::vector<TradingSignal> findBySymbol(const std::string& symbol);
             std::vector<TradingSignal> findBySymbol(const std::string& symbol, Transaction& trans);
+            std::vector<TradingSignal> findBySymbol(const std::string& symbol, size_t limit);
 
             std::vector<TradingSignal> findByStrategyName(const std::string& strategyName);
             std::vector<TradingSignal> findByStrategyName(const std::string& strategyName, Transaction& trans);
@@ -60,14 +56,17 @@ namespace models {
             std::vector<TradingSignal> findPendingSignals(const std::string& symbol, Transaction& trans);
 
         private:
-            TradingSignalMapper() = default;
+            TradingSignalMapper();
             ~TradingSignalMapper() override = default;
             TradingSignalMapper(const TradingSignalMapper&) = delete;
             TradingSignalMapper& operator=(const TradingSignalMapper&) = delete;
 
-            drogon::orm::DbClientPtr getDbClient() const {
-                return drogon::app().getDbClient();
-            }
+            // 신호 조회 문장 (StatementRegistry에 등록, 시작 시 미리 준비)
+            database::StatementRegistry::Statement& findBySymbolStatement_;
+            database::StatementRegistry::Statement& findBySymbolWithLimitStatement_;
+            database::StatementRegistry::Statement& findByStrategyNameStatement_;
+            database::StatementRegistry::Statement& findByTimeRangeStatement_;
+            database::StatementRegistry::Statement& findPendingSignalsStatement_;
         };
 
     } // namespace mappers
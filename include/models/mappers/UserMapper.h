@@ -3,6 +3,7 @@
 #include <drogon/drogon.h>
 #include "models/mappers/BaseMapper.h"
 #include "models/User.h"
+#include <optional>
 
 namespace models {
     namespace mappers {
@@ -13,28 +14,23 @@ namespace models {
 
             static UserMapper& getInstance();
 
-            // 기본 CRUD
-            User insert(const User& user) override;
+            // 공통 CRUD (동기/비동기)는 BaseMapper, 여기서는 트랜잭션 오버로드만 정의
+            using BaseMapper<User>::insert;
+            using BaseMapper<User>::findById;
+            using BaseMapper<User>::findAll;
+            using BaseMapper<User>::findByCriteria;
+            using BaseMapper<User>::update;
+            using BaseMapper<User>::deleteById;
+            using BaseMapper<User>::count;
+            using BaseMapper<User>::findWithPaging;
+
+            // 트랜잭션 오버로드
             User insert(const User& user, Transaction& trans);
-
-            User findById(int64_t id) override;
-
-            std::vector<User> findAll() override;
             std::vector<User> findAll(Transaction& trans);
-
-            std::vector<User> findByCriteria(const std::string& whereClause) override;
             std::vector<User> findByCriteria(const std::string& whereClause, Transaction& trans);
-
-            void update(const User& user) override;
             void update(const User& user, Transaction& trans);
-
-            void deleteById(int64_t id) override;
             void deleteById(int64_t id, Transaction& trans);
-
-            size_t count(const std::string& whereClause = "") override;
             size_t count(const std::string& whereClause, Transaction& trans);
-
-            std::vector<User> findWithPaging(size_t limit, size_t offset) override;
             std::vector<User> findWithPaging(size_t limit, size_t offset, Transaction& trans);
 
             // User 전용 메서드
@@ -45,14 +41,22 @@ namespace models {
             std::vector<User> findActiveUsers();
 
         private:
-            UserMapper() = default;
+            UserMapper();
             ~UserMapper() override = default;
             UserMapper(const UserMapper&) = delete;
             UserMapper& operator=(const UserMapper&) = delete;
 
-            drogon::orm::DbClientPtr getDbClient() const {
-                return drogon::app().getDbClient();
+            // 계정/자격 증명은 갱신 직후 읽는 경로가 많아 replica 지연을 허용하지 않음
+            drogon::orm::DbClientPtr getReadDbClient() const override {
+                return getDbClient();
             }
+
+            // 계정 조회/갱신 문장 (StatementRegistry에 등록, 시작 시 미리 준비)
+            database::StatementRegistry::Statement& findByEmailStatement_;
+            database::StatementRegistry::Statement& findByUsernameStatement_;
+            database::StatementRegistry::Statement& updateLastLoginStatement_;
+            database::StatementRegistry::Statement& updatePasswordStatement_;
+            database::StatementRegistry::Statement& findActiveUsersStatement_;
         };
 
     } // namespace mappers
@@ -3,6 +3,7 @@
 #include <drogon/drogon.h>
 #include "models/mappers/BaseMapper.h"
 #include "models/UserSettings.h"
+#include <optional>
 
 namespace models {
     namespace mappers {
@@ -13,28 +14,23 @@ namespace models {
 
             static UserSettingsMapper& getInstance();
 
-            // 기본 CRUD
-            UserSettings insert(const UserSettings& settings) override;
+            // 공통 CRUD (동기/비동기)는 BaseMapper, 여기서는 트랜잭션 오버로드만 정의
+            using BaseMapper<UserSettings>::insert;
+            using BaseMapper<UserSettings>::findById;
+            using BaseMapper<UserSettings>::findAll;
+            using BaseMapper<UserSettings>::findByCriteria;
+            using BaseMapper<UserSettings>::update;
+            using BaseMapper<UserSettings>::deleteById;
+            using BaseMapper<UserSettings>::count;
+            using BaseMapper<UserSettings>::findWithPaging;
+
+            // 트랜잭션 오버로드
             UserSettings insert(const UserSettings& settings, Transaction& trans);
-
-            UserSettings findById(int64_t id) override;
-
-            std::vector<UserSettings> findAll() override;
             std::vector<UserSettings> findAll(Transaction& trans);
-
-            std::vector<UserSettings> findByCriteria(const std::string& whereClause) override;
             std::vector<UserSettings> findByCriteria(const std::string& whereClause, Transaction& trans);
-
-            void update(const UserSettings& settings) override;
             void update(const UserSettings& settings, Transaction& trans);
-
-            void deleteById(int64_t id) override;
             void deleteById(int64_t id, Transaction& trans);
-
-            size_t count(const std::string& whereClause = "") override;
             size_t count(const std::string& whereClause, Transaction& trans);
-
-            std::vector<UserSettings> findWithPaging(size_t limit, size_t offset) override;
             std::vector<UserSettings> findWithPaging(size_t limit, size_t offset, Transaction& trans);
 
             // UserSettings 전용 메서드
@@ -48,14 +44,25 @@ namespace models {
             void updateRiskParams(int64_t settingsId, const Json::Value& riskParams);
 
         private:
-            UserSettingsMapper() = default;
+            UserSettingsMapper();
             ~UserSettingsMapper() override = default;
             UserSettingsMapper(const UserSettingsMapper&) = delete;
             UserSettingsMapper& operator=(const UserSettingsMapper&) = delete;
 
-            drogon::orm::DbClientPtr getDbClient() const {
-                return drogon::app().getDbClient();
+            // 계정/자격 증명은 갱신 직후 읽는 경로가 많아 replica 지연을 허용하지 않음
+            drogon::orm::DbClientPtr getReadDbClient() const override {
+                return getDbClient();
             }
+
+            // 설정 조회/갱신 문장 (StatementRegistry에 등록, 시작 시 미리 준비)
+            database::StatementRegistry::Statement& findByUserIdStatement_;
+            database::StatementRegistry::Statement& findByUserAndExchangeStatement_;
+            database::StatementRegistry::Statement& findAutoTradeEnabledStatement_;
+            database::StatementRegistry::Statement& updateAutoTradeStatement_;
+            database::StatementRegistry::Statement& updateApiCredentialsStatement_;
+            database::StatementRegistry::Statement& updateStrategyParamsStatement_;
+            database::StatementRegistry::Statement& updateWatchlistStatement_;
+            database::StatementRegistry::Statement& updateRiskParamsStatement_;
         };
 
     } // namespace mappers
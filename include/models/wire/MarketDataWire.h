@@ -0,0 +1,58 @@
+#pragma once
+
+#include "models/MarketData.h"
+#include "models/wire/WireFormat.h"
+#include <trantor/utils/Date.h>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace models {
+    namespace wire {
+
+        // MarketData 레코드 (WIRE_VERSION 1)
+        struct MarketDataRecord {
+            int64_t id;
+            double price;
+            double volume;
+            int64_t timestampMicros;
+            int64_t createdAtMicros;
+            StringRef symbol;
+            StringRef source;
+        };
+        static_assert(sizeof(MarketDataRecord) == 56, "MarketDataRecord layout changed");
+
+        // 인코딩에 필요한 버퍼 크기
+        size_t encodedSize(const MarketData& data);
+
+        // 호출자 버퍼에 메시지를 기록하고 기록한 바이트 수 반환 (공간 부족 시 std::length_error)
+        size_t encode(const MarketData& data, void* buffer, size_t capacity);
+
+        // 역직렬화 없이 버퍼의 필드를 직접 읽는 뷰 (버퍼는 뷰보다 오래 살아 있어야 함)
+        class MarketDataView {
+        public:
+            // 헤더와 문자열 참조 경계를 검증. 실패 시 std::invalid_argument
+            MarketDataView(const void* data, size_t size);
+
+            int64_t id() const { return reader_.load<int64_t>(offsetof(MarketDataRecord, id)); }
+            double price() const { return reader_.load<double>(offsetof(MarketDataRecord, price)); }
+            double volume() const { return reader_.load<double>(offsetof(MarketDataRecord, volume)); }
+            int64_t timestampMicros() const { return reader_.load<int64_t>(offsetof(MarketDataRecord, timestampMicros)); }
+            trantor::Date timestamp() const { return trantor::Date(timestampMicros()); }
+            int64_t createdAtMicros() const { return reader_.load<int64_t>(offsetof(MarketDataRecord, createdAtMicros)); }
+            trantor::Date createdAt() const { return trantor::Date(createdAtMicros()); }
+            std::string_view symbol() const { return reader_.string(reader_.load<StringRef>(offsetof(MarketDataRecord, symbol))); }
+            std::string_view source() const { return reader_.string(reader_.load<StringRef>(offsetof(MarketDataRecord, source))); }
+
+            size_t size() const { return reader_.size(); }
+            uint16_t version() const { return reader_.version(); }
+
+            // 모델 객체로 변환 (복사 발생)
+            std::shared_ptr<MarketData> toModel() const;
+
+        private:
+            WireReader reader_;
+        };
+
+    } // namespace wire
+} // namespace models
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "models/Order.h"
+#include "models/wire/WireFormat.h"
+#include <trantor/utils/Date.h>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace models {
+    namespace wire {
+
+        // Order 레코드 (WIRE_VERSION 1)
+        struct OrderRecord {
+            int64_t id;
+            int64_t signalId;
+            double quantity;
+            double price;
+            double filledQuantity;
+            double filledPrice;
+            int64_t timestampMicros;
+            int64_t updatedAtMicros;
+            int64_t createdAtMicros;
+            StringRef orderId;
+            StringRef symbol;
+            StringRef orderType;
+            StringRef side;
+            StringRef status;
+            StringRef errorMessage;
+        };
+        static_assert(sizeof(OrderRecord) == 120, "OrderRecord layout changed");
+
+        // 인코딩에 필요한 버퍼 크기
+        size_t encodedSize(const Order& order);
+
+        // 호출자 버퍼에 메시지를 기록하고 기록한 바이트 수 반환 (공간 부족 시 std::length_error)
+        size_t encode(const Order& order, void* buffer, size_t capacity);
+
+        // 역직렬화 없이 버퍼의 필드를 직접 읽는 뷰 (버퍼는 뷰보다 오래 살아 있어야 함)
+        class OrderView {
+        public:
+            // 헤더와 문자열 참조 경계를 검증. 실패 시 std::invalid_argument
+            OrderView(const void* data, size_t size);
+
+            int64_t id() const { return reader_.load<int64_t>(offsetof(OrderRecord, id)); }
+            int64_t signalId() const { return reader_.load<int64_t>(offsetof(OrderRecord, signalId)); }
+            double quantity() const { return reader_.load<double>(offsetof(OrderRecord, quantity)); }
+            double price() const { return reader_.load<double>(offsetof(OrderRecord, price)); }
+            double filledQuantity() const { return reader_.load<double>(offsetof(OrderRecord, filledQuantity)); }
+            double filledPrice() const { return reader_.load<double>(offsetof(OrderRecord, filledPrice)); }
+            int64_t timestampMicros() const { return reader_.load<int64_t>(offsetof(OrderRecord, timestampMicros)); }
+            trantor::Date timestamp() const { return trantor::Date(timestampMicros()); }
+            int64_t updatedAtMicros() const { return reader_.load<int64_t>(offsetof(OrderRecord, updatedAtMicros)); }
+            trantor::Date updatedAt() const { return trantor::Date(updatedAtMicros()); }
+            int64_t createdAtMicros() const { return reader_.load<int64_t>(offsetof(OrderRecord, createdAtMicros)); }
+            trantor::Date createdAt() const { return trantor::Date(createdAtMicros()); }
+            std::string_view orderId() const { return reader_.string(reader_.load<StringRef>(offsetof(OrderRecord, orderId))); }
+            std::string_view symbol() const { return reader_.string(reader_.load<StringRef>(offsetof(OrderRecord, symbol))); }
+            std::string_view orderType() const { return reader_.string(reader_.load<StringRef>(offsetof(OrderRecord, orderType))); }
+            std::string_view side() const { return reader_.string(reader_.load<StringRef>(offsetof(OrderRecord, side))); }
+            std::string_view status() const { return reader_.string(reader_.load<StringRef>(offsetof(OrderRecord, status))); }
+            std::string_view errorMessage() const { return reader_.string(reader_.load<StringRef>(offsetof(OrderRecord, errorMessage))); }
+
+            size_t size() const { return reader_.size(); }
+            uint16_t version() const { return reader_.version(); }
+
+            // 모델 객체로 변환 (복사 발생)
+            Order toModel() const;
+
+        private:
+            WireReader reader_;
+        };
+
+    } // namespace wire
+} // namespace models
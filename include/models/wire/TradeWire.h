@@ -0,0 +1,66 @@
+#pragma once
+
+#include "models/Trade.h"
+#include "models/wire/WireFormat.h"
+#include <trantor/utils/Date.h>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace models {
+    namespace wire {
+
+        // Trade 레코드 (WIRE_VERSION 1)
+        struct TradeRecord {
+            int64_t id;
+            int64_t orderId;
+            double quantity;
+            double price;
+            double commission;
+            int64_t timestampMicros;
+            int64_t createdAtMicros;
+            StringRef tradeId;
+            StringRef symbol;
+            StringRef side;
+            StringRef commissionAsset;
+        };
+        static_assert(sizeof(TradeRecord) == 88, "TradeRecord layout changed");
+
+        // 인코딩에 필요한 버퍼 크기
+        size_t encodedSize(const Trade& trade);
+
+        // 호출자 버퍼에 메시지를 기록하고 기록한 바이트 수 반환 (공간 부족 시 std::length_error)
+        size_t encode(const Trade& trade, void* buffer, size_t capacity);
+
+        // 역직렬화 없이 버퍼의 필드를 직접 읽는 뷰 (버퍼는 뷰보다 오래 살아 있어야 함)
+        class TradeView {
+        public:
+            // 헤더와 문자열 참조 경계를 검증. 실패 시 std::invalid_argument
+            TradeView(const void* data, size_t size);
+
+            int64_t id() const { return reader_.load<int64_t>(offsetof(TradeRecord, id)); }
+            int64_t orderId() const { return reader_.load<int64_t>(offsetof(TradeRecord, orderId)); }
+            double quantity() const { return reader_.load<double>(offsetof(TradeRecord, quantity)); }
+            double price() const { return reader_.load<double>(offsetof(TradeRecord, price)); }
+            double commission() const { return reader_.load<double>(offsetof(TradeRecord, commission)); }
+            int64_t timestampMicros() const { return reader_.load<int64_t>(offsetof(TradeRecord, timestampMicros)); }
+            trantor::Date timestamp() const { return trantor::Date(timestampMicros()); }
+            int64_t createdAtMicros() const { return reader_.load<int64_t>(offsetof(TradeRecord, createdAtMicros)); }
+            trantor::Date createdAt() const { return trantor::Date(createdAtMicros()); }
+            std::string_view tradeId() const { return reader_.string(reader_.load<StringRef>(offsetof(TradeRecord, tradeId))); }
+            std::string_view symbol() const { return reader_.string(reader_.load<StringRef>(offsetof(TradeRecord, symbol))); }
+            std::string_view side() const { return reader_.string(reader_.load<StringRef>(offsetof(TradeRecord, side))); }
+            std::string_view commissionAsset() const { return reader_.string(reader_.load<StringRef>(offsetof(TradeRecord, commissionAsset))); }
+
+            size_t size() const { return reader_.size(); }
+            uint16_t version() const { return reader_.version(); }
+
+            // 모델 객체로 변환 (복사 발생)
+            Trade toModel() const;
+
+        private:
+            WireReader reader_;
+        };
+
+    } // namespace wire
+} // namespace models
@@ -0,0 +1,65 @@
+#pragma once
+
+#include "models/TradingSignal.h"
+#include "models/wire/WireFormat.h"
+#include <trantor/utils/Date.h>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+namespace models {
+    namespace wire {
+
+        // TradingSignal 레코드 (WIRE_VERSION 1)
+        // parameters는 JSON 텍스트로 문자열 테이블에 저장
+        struct TradingSignalRecord {
+            int64_t id;
+            double price;
+            double quantity;
+            double confidence;
+            int64_t timestampMicros;
+            int64_t createdAtMicros;
+            StringRef symbol;
+            StringRef signalType;
+            StringRef strategyName;
+            StringRef parameters;
+        };
+        static_assert(sizeof(TradingSignalRecord) == 80, "TradingSignalRecord layout changed");
+
+        // 인코딩에 필요한 버퍼 크기
+        size_t encodedSize(const TradingSignal& signal);
+
+        // 호출자 버퍼에 메시지를 기록하고 기록한 바이트 수 반환 (공간 부족 시 std::length_error)
+        size_t encode(const TradingSignal& signal, void* buffer, size_t capacity);
+
+        // 역직렬화 없이 버퍼의 필드를 직접 읽는 뷰 (버퍼는 뷰보다 오래 살아 있어야 함)
+        class TradingSignalView {
+        public:
+            // 헤더와 문자열 참조 경계를 검증. 실패 시 std::invalid_argument
+            TradingSignalView(const void* data, size_t size);
+
+            int64_t id() const { return reader_.load<int64_t>(offsetof(TradingSignalRecord, id)); }
+            double price() const { return reader_.load<double>(offsetof(TradingSignalRecord, price)); }
+            double quantity() const { return reader_.load<double>(offsetof(TradingSignalRecord, quantity)); }
+            double confidence() const { return reader_.load<double>(offsetof(TradingSignalRecord, confidence)); }
+            int64_t timestampMicros() const { return reader_.load<int64_t>(offsetof(TradingSignalRecord, timestampMicros)); }
+            trantor::Date timestamp() const { return trantor::Date(timestampMicros()); }
+            int64_t createdAtMicros() const { return reader_.load<int64_t>(offsetof(TradingSignalRecord, createdAtMicros)); }
+            trantor::Date createdAt() const { return trantor::Date(createdAtMicros()); }
+            std::string_view symbol() const { return reader_.string(reader_.load<StringRef>(offsetof(TradingSignalRecord, symbol))); }
+            std::string_view signalType() const { return reader_.string(reader_.load<StringRef>(offsetof(TradingSignalRecord, signalType))); }
+            std::string_view strategyName() const { return reader_.string(reader_.load<StringRef>(offsetof(TradingSignalRecord, strategyName))); }
+            std::string_view parametersJson() const { return reader_.string(reader_.load<StringRef>(offsetof(TradingSignalRecord, parameters))); }
+
+            size_t size() const { return reader_.size(); }
+            uint16_t version() const { return reader_.version(); }
+
+            // 모델 객체로 변환 (복사 발생)
+            TradingSignal toModel() const;
+
+        private:
+            WireReader reader_;
+        };
+
+    } // namespace wire
+} // namespace models
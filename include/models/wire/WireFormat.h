@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace models {
+    namespace wire {
+
+        // 바이너리 메시지 레이아웃 (리틀 엔디언, 정렬 불필요)
+        //   [WireHeader 16B][Record (모델별 고정 오프셋)][string table]
+        // - 숫자 필드는 원시 비트 그대로 저장되므로 double 왕복이 손실 없음
+        // - 시각은 epoch 기준 마이크로초(int64)
+        // - 문자열은 StringRef(메시지 시작 기준 offset, length)로 참조
+        // - 이후 버전은 Record 끝에만 필드를 추가하고 recordSize로 구분 (하위 호환)
+        static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "wire format assumes a little-endian host");
+
+        constexpr uint32_t WIRE_MAGIC = 0x31575354;   // "TSW1"
+        constexpr uint16_t WIRE_VERSION = 1;
+
+        enum class MessageType : uint16_t {
+            MarketData = 1,
+            Order = 2,
+            Trade = 3,
+            TradingSignal = 4
+        };
+
+        struct WireHeader {
+            uint32_t magic;
+            uint16_t version;
+            uint16_t type;
+            uint32_t totalSize;    // 헤더 + 레코드 + 문자열 테이블
+            uint32_t recordSize;   // 레코드 크기 (작성한 버전 기준)
+        };
+        static_assert(sizeof(WireHeader) == 16, "WireHeader layout changed");
+
+        struct StringRef {
+            uint32_t offset;
+            uint32_t length;
+        };
+        static_assert(sizeof(StringRef) == 8, "StringRef layout changed");
+
+        // 버퍼 앞부분만 보고 메시지 타입 확인 (채널 디멀티플렉싱용)
+        std::optional<MessageType> peekType(const void* data, size_t size);
+
+        // 호출자 버퍼에 메시지를 기록하는 헬퍼
+        template <typename Record>
+        class WireWriter {
+        public:
+            static_assert(std::is_trivially_copyable_v<Record>, "wire records must be trivially copyable");
+
+            static constexpr size_t FIXED_SIZE = sizeof(WireHeader) + sizeof(Record);
+
+            // requiredSize가 capacity를 넘으면 std::length_error
+            WireWriter(void* buffer, size_t capacity, size_t requiredSize)
+                : buffer_(static_cast<uint8_t*>(buffer)), cursor_(FIXED_SIZE) {
+                if (requiredSize > capacity) {
+                    throw std::length_error("Wire buffer too small: need " + std::to_string(requiredSize) +
+                                            " bytes, have " + std::to_string(capacity));
+                }
+            }
+
+            StringRef append(std::string_view text) {
+                StringRef ref{static_cast<uint32_t>(cursor_), static_cast<uint32_t>(text.size())};
+                std::memcpy(buffer_ + cursor_, text.data(), text.size());
+                cursor_ += text.size();
+                return ref;
+            }
+
+            // 헤더와 레코드를 기록하고 전체 메시지 크기 반환
+            size_t finish(MessageType type, const Record& record) {
+                WireHeader header{
+                    WIRE_MAGIC,
+                    WIRE_VERSION,
+                    static_cast<uint16_t>(type),
+                    static_cast<uint32_t>(cursor_),
+                    static_cast<uint32_t>(sizeof(Record))
+                };
+                std::memcpy(buffer_, &header, sizeof(header));
+                std::memcpy(buffer_ + sizeof(header), &record, sizeof(record));
+                return cursor_;
+            }
+
+        private:
+            uint8_t* buffer_;
+            size_t cursor_;
+        };
+
+        // 메시지 검증 및 제자리(in-place) 필드 접근
+        class WireReader {
+        public:
+            // 헤더, 타입, 크기 검증. 실패 시 std::invalid_argument
+            WireReader(const void* data, size_t size, MessageType expected, size_t recordSize);
+
+            template <typename T>
+            T load(size_t offset) const {
+                T value;
+                std::memcpy(&value, record_ + offset, sizeof(T));
+                return value;
+            }
+
+            // 생성 시 validateString으로 검증된 참조만 사용
+            std::string_view string(StringRef ref) const {
+                return std::string_view(reinterpret_cast<const char*>(data_) + ref.offset, ref.length);
+            }
+
+            void validateString(StringRef ref) const;
+
+            uint16_t version() const { return version_; }
+            size_t size() const { return size_; }
+            const uint8_t* data() const { return data_; }
+
+        private:
+            const uint8_t* data_;
+            const uint8_t* record_;
+            size_t size_;
+            uint16_t version_;
+        };
+
+    } // namespace wire
+} // namespace models
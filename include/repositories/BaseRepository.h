@@ -4,8 +4,21 @@
 #include <optional>
 #include <memory>
 #include <drogon/drogon.h>
+#include <drogon/utils/coroutine.h>
 #include <trantor/utils/Date.h>
+#include "common/Config.h"
+#include "database/DbRouter.h"
+#include "database/GroupCommitter.h"
+#include "database/PipelineExecutor.h"
+#include "models/SchemaKeyset.h"
+#include "repositories/PageToken.h"
 #include <functional>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 namespace repositories {
 
@@ -17,9 +30,22 @@ namespace repositories {
         // CRUD 작업
         virtual T save(const T& entity) = 0;
         virtual std::optional<T> findById(int64_t id) const = 0;
+
+        // 여러 id 한 번에 조회. 결과는 입력 순서, 중복 id는 한 번, 없는 id는 생략
+        // 기본 구현은 findById 반복 (id마다 왕복). 매퍼의 findByIds(= ANY($1))를 쓰는 저장소가 재정의
+        virtual std::vector<T> findByIds(std::span<const int64_t> ids) const {
+            std::vector<T> found;
+            for (int64_t id : uniqueIds(ids)) {
+                if (auto entity = findById(id)) {
+                    found.push_back(std::move(*entity));
+                }
+            }
+            return found;
+        }
         virtual bool deleteById(int64_t id) = 0;
 
-        // 페이징
+        // 페이징 (OFFSET 기반. 깊은 페이지일수록 느려지므로 이력 탐색은 findPage 사용)
+        // totalCount는 pg_class 통계 기반 근사치 (작은 테이블은 정확한 값)
         struct PaginationResult {
             std::vector<T> items;
             size_t totalCount;
@@ -29,6 +55,18 @@ namespace repositories {
         };
 
         virtual PaginationResult findAll(size_t page, size_t pageSize) const = 0;
+
+        // 키셋(커서) 페이징: (정렬 시각, id) 내림차순. 페이지 깊이와 무관하게 비용 일정
+        struct KeysetPage {
+            std::vector<T> items;
+            std::string nextToken;      // 다음 페이지 토큰. 마지막 페이지면 빈 문자열
+            size_t approximateTotal;
+            size_t pageSize;
+        };
+
+        // continuationToken이 비어 있으면 첫 페이지
+        // 잘못된 토큰이나 pageSize(1..MAX_PAGE_SIZE 밖)는 std::invalid_argument
+        virtual KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const = 0;
         
         // 시간 범위 조회
         virtual std::vector<T> findByTimeRange(
@@ -36,22 +74,45 @@ namespace repositories {
             const trantor::Date& end
         ) const = 0;
 
+        // 비동기 CRUD (C++20 코루틴)
+        // 동기 버전을 co_return하면 DB 왕복 동안 IO 스레드를 막으므로 기본 구현 없음
+        // 각 저장소가 매퍼 코루틴 기반 *Via 공통 구현으로 재정의
+        virtual drogon::Task<T> saveAsync(T entity) = 0;
+        virtual drogon::Task<std::optional<T>> findByIdAsync(int64_t id) const = 0;
+        virtual drogon::Task<bool> deleteByIdAsync(int64_t id) = 0;
+        virtual drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const = 0;
+        virtual drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const = 0;
+
+        // 그룹 커밋 저장: 다른 스레드의 쓰기와 한 트랜잭션으로 묶여 COMMIT 후 완료 (GroupCommitter)
+        // 지연보다 처리량이 중요한 작은 쓰기용. 기다리는 동안 스레드를 점유하지 않음 (기본 구현은 save)
+        virtual drogon::Task<T> saveGrouped(T entity) {
+            co_return save(entity);
+        }
+
         // 트랜잭션 실행
         using TransactionPtr = std::shared_ptr<drogon::orm::Transaction>;
         template<typename Func>
         void executeInTransaction(Func&& func) {
-            auto clientPtr = drogon::app().getDbClient();
+            executeInTransaction(std::forward<Func>(func), [] {});
+        }
+
+        // onCommit은 COMMIT이 성공한 뒤에만 호출 (인메모리 인덱스 등 DB와 함께 바뀌어야 하는 상태 반영용)
+        template<typename Func, typename OnCommit>
+        void executeInTransaction(Func&& func, OnCommit&& onCommit) {
+            auto clientPtr = getDbClient();
             clientPtr->newTransactionAsync(
-                [func = std::forward<Func>(func)](const TransactionPtr& transPtr) mutable {
+                [func = std::forward<Func>(func),
+                 onCommit = std::forward<OnCommit>(onCommit)](const TransactionPtr& transPtr) mutable {
                     try {
                         // 사용자 제공 함수 호출
                         func(transPtr);
 
                         // COMMIT
                         auto commitBinder = (*transPtr) << "COMMIT";
-                        commitBinder >> [](const drogon::orm::Result &r) {
+                        commitBinder >> [onCommit = std::move(onCommit)](const drogon::orm::Result &r) mutable {
                             // Commit 성공 시 처리
                             LOG_DEBUG << "Transaction committed successfully";
+                            onCommit();
                         };
                         commitBinder >> [](const std::exception_ptr &e) {
                             // Commit 실행 중 예외 발생 시 처리
@@ -90,9 +151,154 @@ namespace repositories {
     protected:
         BaseRepository() = default;
 
-        // DB 클라이언트 가져오기
+        // BaseMapper 비동기 API 기반 공통 구현 (동기 버전과 같은 의미)
+        template <typename Mapper>
+        static drogon::Task<T> saveVia(Mapper& mapper, T entity) {
+            if (entity.getId() == 0) {
+                co_return co_await mapper.insertAsync(std::move(entity));
+            }
+            co_await mapper.updateAsync(entity);
+            co_return entity;
+        }
+
+        // 매퍼의 트랜잭션 insert/update로 그룹 커밋. onCommit(저장된 엔티티)은 COMMIT 성공 후 호출
+        // op는 이웃 op 실패 시 다시 실행될 수 있으므로 트랜잭션 밖 부수 효과는 onCommit에만 둠
+        template <typename Mapper, typename OnCommit = database::GroupCommitter::NoCommitHook>
+        static drogon::Task<T> saveGroupedVia(Mapper& mapper, T entity, OnCommit onCommit = OnCommit{}) {
+            return database::GroupCommitter::getInstance().submitCoro(
+                [&mapper, entity = std::move(entity)](drogon::orm::Transaction& transaction) -> T {
+                    if (entity.getId() == 0) {
+                        return mapper.insert(entity, transaction);
+                    }
+                    mapper.update(entity, transaction);
+                    return entity;
+                },
+                std::move(onCommit));
+        }
+
+        template <typename Mapper>
+        static std::vector<T> findByIdsVia(Mapper& mapper, std::span<const int64_t> ids) {
+            const auto unique = uniqueIds(ids);
+            if (unique.empty()) {
+                return {};
+            }
+            return orderByIds(unique, mapper.findByIds(unique));
+        }
+
+        // 첫 등장 순서를 유지한 고유 id
+        static std::vector<int64_t> uniqueIds(std::span<const int64_t> ids) {
+            std::vector<int64_t> unique;
+            unique.reserve(ids.size());
+            std::unordered_set<int64_t> seen;
+            seen.reserve(ids.size());
+            for (int64_t id : ids) {
+                if (seen.insert(id).second) {
+                    unique.push_back(id);
+                }
+            }
+            return unique;
+        }
+
+        // DB 순서로 온 행을 ids 순서로 정렬 (ids에 없는 행은 버림)
+        static std::vector<T> orderByIds(const std::vector<int64_t>& ids, std::vector<T> rows) {
+            std::unordered_map<int64_t, size_t> positions;
+            positions.reserve(rows.size());
+            for (size_t i = 0; i < rows.size(); ++i) {
+                positions.emplace(rows[i].getId(), i);
+            }
+            std::vector<T> ordered;
+            ordered.reserve(rows.size());
+            for (int64_t id : ids) {
+                if (const auto it = positions.find(id); it != positions.end()) {
+                    ordered.push_back(std::move(rows[it->second]));
+                }
+            }
+            return ordered;
+        }
+
+        template <typename Mapper>
+        static drogon::Task<std::optional<T>> findByIdVia(Mapper& mapper, int64_t id) {
+            try {
+                co_return std::make_optional(co_await mapper.findByIdAsync(id));
+            } catch (const std::runtime_error&) {
+                co_return std::nullopt;
+            }
+        }
+
+        template <typename Mapper>
+        static drogon::Task<bool> deleteByIdVia(Mapper& mapper, int64_t id) {
+            try {
+                co_await mapper.deleteByIdAsync(id);
+                co_return true;
+            } catch (const std::runtime_error&) {
+                co_return false;
+            }
+        }
+
+        template <typename Mapper>
+        static drogon::Task<PaginationResult> findAllVia(Mapper& mapper, size_t page, size_t pageSize) {
+            PaginationResult result;
+            result.totalCount = co_await mapper.approximateCountAsync();
+            result.items = co_await mapper.findWithPagingAsync(pageSize, page * pageSize);
+            result.pageSize = pageSize;
+            result.currentPage = page;
+            result.totalPages = (result.totalCount + pageSize - 1) / pageSize;
+            co_return result;
+        }
+
+        template <typename Mapper>
+        static drogon::Task<KeysetPage> findPageVia(Mapper& mapper, std::string continuationToken, size_t pageSize) {
+            const auto cursor = decodePageRequest(continuationToken, pageSize);
+            // 한 행을 더 읽어 다음 페이지 존재 여부 판단
+            auto items = cursor
+                ? co_await mapper.findPageAfterAsync(cursor->timestampMicros, cursor->id, pageSize + 1)
+                : co_await mapper.findFirstPageAsync(pageSize + 1);
+            const size_t total = co_await mapper.approximateCountAsync();
+            co_return makeKeysetPage(std::move(items), pageSize, total);
+        }
+
+        static std::optional<PageCursor> decodePageRequest(const std::string& continuationToken, size_t pageSize) {
+            if (pageSize == 0 || pageSize > common::PaginationConfig::MAX_PAGE_SIZE) {
+                throw std::invalid_argument("Page size must be between 1 and " +
+                                            std::to_string(common::PaginationConfig::MAX_PAGE_SIZE));
+            }
+            return PageToken::decode(continuationToken);
+        }
+
+        // items는 pageSize + 1개까지 조회한 결과
+        static KeysetPage makeKeysetPage(std::vector<T> items, size_t pageSize, size_t approximateTotal) {
+            KeysetPage page;
+            if (items.size() > pageSize) {
+                items.pop_back();
+                const auto [timestampMicros, id] = models::schema::keysetPosition(items.back());
+                page.nextToken = PageToken::encode(PageCursor{timestampMicros, id});
+            }
+            page.items = std::move(items);
+            page.approximateTotal = approximateTotal;
+            page.pageSize = pageSize;
+            return page;
+        }
+
+        // 서로 독립적인 문장들을 libpq 파이프라인으로 한 번에 보내고 결과를 순서대로 받음 (PipelineExecutor)
+        // 조회 N개를 N번의 왕복 대신 약 1번의 왕복으로 처리. primary 전용 연결 사용
+        // 전체가 한 트랜잭션이라 한 문장이 실패하면 std::runtime_error
+        static std::vector<database::PipelineResult> executePipeline(const database::Pipeline& pipeline) {
+            return database::PipelineExecutor::getInstance().execute(pipeline);
+        }
+
+        // 문장마다 별도 트랜잭션. 실패는 예외 대신 결과별 succeeded()로 확인
+        static std::vector<database::PipelineResult> executePipelineIndependent(const database::Pipeline& pipeline) {
+            return database::PipelineExecutor::getInstance().executeIndependent(pipeline);
+        }
+
+        // 쓰기/트랜잭션용 primary 클라이언트
         drogon::orm::DbClientPtr getDbClient() const {
-            return drogon::app().getDbClient();
+            return database::DbRouter::getInstance().writer();
+        }
+
+        // 단순 조회용. replica 지연이 임계값 이내면 replica (DbRouter)
+        drogon::orm::DbClientPtr getReadDbClient() const {
+            return database::DbRouter::getInstance().reader();
         }
     };
 
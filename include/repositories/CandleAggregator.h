@@ -0,0 +1,158 @@
+#pragma once
+
+#include "common/Config.h"
+#include "models/CandleBar.h"
+#include "models/MarketData.h"
+#include "models/SymbolRegistry.h"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace repositories {
+
+    // 틱에서 1s/1m/5m/1h/1d OHLCV 봉을 증분 집계하는 프로세스 내 집계기
+    // - 수신 경로(MarketDataRepository::save, saveBatch, copyBatch/upsertBatch의 신규 행)가 틱마다 onTick 호출
+    //   틱 하나당 해상도별로 진행 중인 봉 하나를 갱신 (O(1), 과거 틱 재스캔 없음)
+    // - 해상도별로 진행 중인 봉 + 최근 RECENT_BARS개 마감 봉을 메모리에 유지해 조회에 바로 응답
+    //   coveredFrom 이후에 시작하는 봉은 메모리에 빠짐없이 있음. 그 앞은 호출자가 market_bars에서 읽음
+    // - DB에는 봉 전체가 아니라 마지막 기록 이후의 델타(부분 봉)를 기록하고 market_bars upsert가 병합
+    //   늦은 틱이나 재시작으로 같은 봉이 여러 번 기록돼도 결과는 틱을 한 번에 집계한 것과 같음
+    // - flush 스레드가 FLUSH_INTERVAL마다 구간이 끝난 뒤 CLOSE_GRACE가 지난 델타와
+    //   MAX_DELTA_AGE보다 오래 쌓인 델타를 한 트랜잭션으로 기록. stop()은 남은 델타를 모두 기록
+    class CandleAggregator {
+    public:
+        static constexpr size_t RECENT_BARS = common::CandleConfig::RECENT_BARS;
+        static constexpr size_t RESOLUTION_COUNT = models::BAR_RESOLUTIONS.size();
+
+        struct Options {
+            std::chrono::milliseconds flushInterval{common::CandleConfig::FLUSH_INTERVAL_MS};
+            std::chrono::milliseconds closeGrace{common::CandleConfig::CLOSE_GRACE_MS};
+            std::chrono::milliseconds maxDeltaAge{common::CandleConfig::MAX_DELTA_AGE_MS};
+            size_t maxFlushAttempts = common::CandleConfig::MAX_FLUSH_ATTEMPTS;
+        };
+
+        struct Stats {
+            uint64_t ticks;
+            uint64_t barsWritten;       // 기록한 델타 수
+            uint64_t failed;            // 재시도 후에도 저장하지 못한 델타 수
+            uint64_t flushes;
+            size_t pending;             // 미기록 델타 수
+        };
+
+        // 조회 결과
+        // - bars: [max(from, coveredFrom), to) 구간의 메모리 봉 (open_time 오름차순, 진행 중인 봉 포함)
+        // - unflushed: [from, min(to, coveredFrom)) 구간의 미기록 델타. DB 봉에 merge하면 최신 값이 됨
+        struct BarRange {
+            std::vector<models::CandleBar> bars;
+            std::vector<models::CandleBar> unflushed;
+            int64_t coveredFromMicros;
+        };
+
+        static CandleAggregator& getInstance();
+
+        // flush 스레드 시작. 이미 실행 중이면 std::logic_error
+        void start(const Options& options);
+        void start() { start(Options{}); }
+
+        // flush 스레드 종료 후 남은 델타를 모두 기록
+        void stop();
+
+        bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+        // 틱 반영. flush 스레드 실행 여부와 무관하게 집계 (기록은 실행 중일 때만)
+        void onTick(const models::MarketData& data);
+        void onTick(models::SymbolId symbolId, int64_t timestampMicros, double price, double volume);
+
+        // [fromMicros, toMicros)에서 시작하는 봉
+        BarRange getBars(
+            models::SymbolId symbolId,
+            models::BarResolution resolution,
+            int64_t fromMicros,
+            int64_t toMicros
+        ) const;
+
+        // 진행 중인 봉 (없으면 std::nullopt)
+        std::optional<models::CandleBar> openBar(models::SymbolId symbolId, models::BarResolution resolution) const;
+
+        // 기록 대상 델타를 꺼냄: 구간 종료 + closeGrace <= nowMicros 이거나 maxDeltaAge보다 오래된 것
+        // nowMicros가 int64 최대값이면 전부
+        std::vector<models::CandleBar> takeReadyDeltas(int64_t nowMicros);
+
+        // 기록에 실패한 델타를 되돌림 (다음 flush에서 재시도)
+        void restoreDeltas(const std::vector<models::CandleBar>& deltas);
+
+        // 심볼의 메모리 봉과 미기록 델타를 모두 버림 (메모리는 유지)
+        void discard(models::SymbolId symbolId);
+
+        Stats getStats() const;
+
+    private:
+        CandleAggregator() = default;
+        ~CandleAggregator();
+        CandleAggregator(const CandleAggregator&) = delete;
+        CandleAggregator& operator=(const CandleAggregator&) = delete;
+
+        static constexpr int64_t NOT_COVERED = std::numeric_limits<int64_t>::max();
+
+        struct Delta {
+            models::CandleBar bar;
+            int64_t createdMicros;      // 처음 쌓인 시각 (wall clock)
+        };
+
+        struct Series {
+            std::optional<models::CandleBar> open;
+            std::deque<models::CandleBar> closed;       // open_time 오름차순
+            int64_t coveredFrom{NOT_COVERED};
+            std::map<int64_t, Delta> deltas;            // open_time -> 미기록 델타
+        };
+
+        struct Book {
+            mutable std::mutex mutex;
+            std::array<Series, RESOLUTION_COUNT> series;
+        };
+
+        // 새 델타를 만들었으면 true
+        static bool apply(Series& series, models::SymbolId symbolId, models::BarResolution resolution,
+                          int64_t timestampMicros, double price, double volume, int64_t nowMicros);
+        // 마감 봉 목록에 넣고 RECENT_BARS를 넘으면 가장 오래된 봉을 밀어내며 coveredFrom을 올림
+        static void insertClosed(Series& series, std::deque<models::CandleBar>::iterator position,
+                                 models::CandleBar bar);
+
+        const Book* find(models::SymbolId symbolId) const;
+        Book& acquire(models::SymbolId symbolId);
+
+        void run();
+        void flush(int64_t nowMicros, bool final);
+
+        Options options_;
+        std::mutex lifecycleMutex_;     // start/stop 직렬화
+        std::mutex flushMutex_;         // flush 직렬화
+        std::thread flusher_;
+        std::atomic<bool> running_{false};
+
+        std::mutex stopMutex_;
+        std::condition_variable stopCv_;
+        bool stopRequested_{false};
+
+        std::array<std::atomic<Book*>, models::SymbolRegistry::MAX_SYMBOLS> books_{};
+        std::mutex allocationMutex_;
+        std::vector<std::unique_ptr<Book>> storage_;
+
+        std::atomic<uint64_t> ticks_{0};
+        std::atomic<uint64_t> barsWritten_{0};
+        std::atomic<uint64_t> failed_{0};
+        std::atomic<uint64_t> flushes_{0};
+        std::atomic<size_t> pending_{0};
+    };
+
+} // namespace repositories
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "common/Config.h"
+#include "models/UserSettings.h"
+#include "secure/SecureMemory.h"
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace repositories {
+
+    // 복호화된 사용자 설정 캐시
+    // - settings id 키와 user_id 보조 인덱스. TTL이 지나거나 EncryptionManager 키 세대가 바뀌면 미스
+    // - apiKey/secret 평문은 SecureString(잠금 메모리)에 보관하고 축출/무효화 시 0으로 지움
+    // - 항목 수가 상한에 닿으면 만료가 가장 이른 항목부터 축출
+    // - DB 조회 전에 epoch()를 읽어 put에 넘기면, 그 사이 무효화된 경우 오래된 행을 다시 채우지 않음
+    class DecryptedSettingsCache {
+    public:
+        using Clock = std::chrono::steady_clock;
+        using CredentialsVisitor = std::function<void(std::string_view apiKey, std::string_view secret)>;
+
+        explicit DecryptedSettingsCache(
+            std::chrono::seconds ttl = std::chrono::seconds(common::SettingsCacheConfig::TTL_SECONDS),
+            size_t maxEntries = common::SettingsCacheConfig::MAX_ENTRIES
+        );
+        DecryptedSettingsCache(const DecryptedSettingsCache&) = delete;
+        DecryptedSettingsCache& operator=(const DecryptedSettingsCache&) = delete;
+
+        uint64_t epoch() const;
+
+        // encrypted: DB에 저장된(암호문) 상태의 행, apiKey/secret: 복호화한 평문 (필드가 없으면 nullopt)
+        // 더 새로운 keyGeneration이면 이전 세대 항목을 모두 폐기, 더 오래된 세대면 저장하지 않음
+        // epoch 불일치, 오래된 키 세대, 평문 길이 초과, 잠금 메모리 고갈 시 저장하지 않고 false
+        bool put(
+            const models::UserSettings& encrypted,
+            const std::optional<std::string>& apiKey,
+            const std::optional<std::string>& secret,
+            uint64_t keyGeneration,
+            uint64_t epoch
+        );
+        // 사용자의 설정 id 전체 목록 기록 (각 행은 먼저 put)
+        void putUser(int64_t userId, std::vector<int64_t> settingsIds, uint64_t keyGeneration, uint64_t epoch);
+
+        // 평문 자격증명을 채운 복사본
+        std::optional<models::UserSettings> find(int64_t id, uint64_t keyGeneration) const;
+        // 목록이 없거나 목록의 항목 중 하나라도 미스면 nullopt
+        std::optional<std::vector<models::UserSettings>> findByUser(int64_t userId, uint64_t keyGeneration) const;
+        // 이미 읽은 행의 암호문이 캐시와 같으면 평문으로 바꾸고 true (목록/페이지 조회용)
+        bool decryptFromCache(models::UserSettings& row, uint64_t keyGeneration) const;
+        // 평문을 힙에 복사하지 않고 잠금 메모리에서 바로 전달. 미스면 false
+        bool visitCredentials(int64_t id, uint64_t keyGeneration, const CredentialsVisitor& visitor) const;
+
+        void invalidate(int64_t id);
+        void invalidateUser(int64_t userId);
+        void invalidateAll();
+
+        size_t size() const;
+
+    private:
+        struct Entry {
+            models::UserSettings encrypted;
+            std::optional<SecureString> apiKey;
+            std::optional<SecureString> secret;
+            Clock::time_point expiresAt;
+        };
+
+        struct UserEntry {
+            std::vector<int64_t> settingsIds;
+            Clock::time_point expiresAt;
+        };
+
+        const Entry* findLiveLocked(int64_t id, uint64_t keyGeneration, Clock::time_point now) const;
+        void makeRoomLocked(Clock::time_point now);
+        static models::UserSettings materialize(const Entry& entry);
+
+        const std::chrono::seconds ttl_;
+        const size_t maxEntries_;
+
+        mutable std::shared_mutex mutex_;
+        uint64_t epoch_{0};
+        uint64_t keyGeneration_{0};
+        std::unordered_map<int64_t, Entry> entries_;
+        std::unordered_map<int64_t, UserEntry> users_;
+    };
+
+} // namespace repositories
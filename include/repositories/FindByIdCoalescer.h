@@ -0,0 +1,156 @@
+#pragma once
+
+#include "common/Config.h"
+#include <trantor/net/EventLoop.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace repositories {
+
+    // 동시에 들어온 단건 findById를 모아 findByIds 한 번으로 조회 (dataloader 방식)
+    // - 빈 배치에 처음 들어온 호출이 리더: 진행 중인 조회가 없으면 바로 조회하고,
+    //   있으면 그 조회가 끝날 때까지(최대 window, 또는 maxBatch개 id가 찰 때까지) id를 더 모은 뒤
+    //   loader를 한 번 호출해 결과를 배치의 모든 호출자에게 나눠줌 (경합이 없으면 지연 없음)
+    // - 같은 배치 안의 중복 id는 한 번만 조회 (요청별 dedup)
+    // - 배치가 끝나면 결과를 버리므로 캐시가 아님: 조회 시점 이후의 변경은 다음 호출에서 보임
+    // - 호출 스레드를 블로킹하므로 동기 경로 전용 (코루틴 경로는 findByIds 사용)
+    //   drogon/trantor 이벤트 루프 스레드에서 호출되면 다른 호출을 기다리지 않고 바로 단건 조회
+    template <typename T>
+    class FindByIdCoalescer {
+    public:
+        // 고유 id 목록을 받아 찾은 행을 반환 (순서 무관, 없는 id는 생략)
+        using Loader = std::function<std::vector<T>(const std::vector<int64_t>&)>;
+
+        struct Stats {
+            uint64_t requests;
+            uint64_t queries;       // loader 호출 수
+            uint64_t deduplicated;  // 같은 배치의 중복 id로 합쳐진 요청 수
+            uint64_t bypassed;      // 이벤트 루프 스레드에서 모으지 않고 바로 조회한 요청 수
+        };
+
+        explicit FindByIdCoalescer(
+            Loader loader,
+            std::chrono::microseconds window = std::chrono::microseconds(common::FindByIdConfig::COALESCE_WINDOW_US),
+            size_t maxBatch = common::FindByIdConfig::MAX_BATCH
+        ) : loader_(std::move(loader)), window_(window), maxBatch_(maxBatch) {
+            if (maxBatch_ == 0) {
+                throw std::invalid_argument("Coalescer batch size must be positive");
+            }
+        }
+
+        FindByIdCoalescer(const FindByIdCoalescer&) = delete;
+        FindByIdCoalescer& operator=(const FindByIdCoalescer&) = delete;
+
+        // loader 예외는 같은 배치의 모든 호출자에게 전달
+        std::optional<T> load(int64_t id) {
+            requests_.fetch_add(1, std::memory_order_relaxed);
+            if (trantor::EventLoop::getEventLoopOfCurrentThread() != nullptr) {
+                // 루프 스레드를 다른 호출의 배치에 묶어 두지 않음
+                bypassed_.fetch_add(1, std::memory_order_relaxed);
+                queries_.fetch_add(1, std::memory_order_relaxed);
+                for (auto& row : loader_({id})) {
+                    if (row.getId() == id) {
+                        return std::move(row);
+                    }
+                }
+                return std::nullopt;
+            }
+
+            std::shared_ptr<Batch> batch;
+            bool leader = false;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!open_) {
+                    open_ = std::make_shared<Batch>();
+                    leader = true;
+                }
+                batch = open_;
+                if (batch->found.emplace(id, std::nullopt).second) {
+                    batch->ids.push_back(id);
+                } else {
+                    deduplicated_.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (batch->ids.size() >= maxBatch_) {
+                    open_.reset();      // 가득 참: 리더를 깨우고 다음 호출은 새 배치로
+                    changed_.notify_all();
+                }
+            }
+
+            if (leader) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    changed_.wait_for(lock, window_, [this, &batch] { return open_ != batch || inFlight_ == 0; });
+                    if (open_ == batch) {
+                        open_.reset();
+                    }
+                    ++inFlight_;
+                }
+                // 닫힌 배치는 리더만 접근하므로 잠금 없이 채움
+                try {
+                    for (auto& row : loader_(batch->ids)) {
+                        const auto it = batch->found.find(row.getId());
+                        if (it != batch->found.end()) {
+                            it->second.emplace(std::move(row));
+                        }
+                    }
+                    batch->done.set_value();
+                } catch (...) {
+                    batch->done.set_exception(std::current_exception());
+                }
+                queries_.fetch_add(1, std::memory_order_relaxed);
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    --inFlight_;
+                }
+                changed_.notify_all();  // 이 조회를 기다리며 모으던 리더를 깨움
+            }
+
+            batch->ready.get();     // 완료 후 found는 읽기 전용
+            return batch->found.at(id);
+        }
+
+        Stats getStats() const {
+            return Stats{
+                requests_.load(std::memory_order_relaxed),
+                queries_.load(std::memory_order_relaxed),
+                deduplicated_.load(std::memory_order_relaxed),
+                bypassed_.load(std::memory_order_relaxed)
+            };
+        }
+
+    private:
+        struct Batch {
+            std::vector<int64_t> ids;                                   // 고유 id (도착 순서)
+            std::unordered_map<int64_t, std::optional<T>> found;
+            std::promise<void> done;
+            std::shared_future<void> ready{done.get_future().share()};
+        };
+
+        Loader loader_;
+        std::chrono::microseconds window_;
+        size_t maxBatch_;
+
+        std::mutex mutex_;
+        std::condition_variable changed_;   // 배치가 차거나 진행 중인 조회가 끝남
+        std::shared_ptr<Batch> open_;       // 아직 id를 받는 배치
+        size_t inFlight_{0};                // 진행 중인 loader 호출 수
+
+        std::atomic<uint64_t> requests_{0};
+        std::atomic<uint64_t> queries_{0};
+        std::atomic<uint64_t> deduplicated_{0};
+        std::atomic<uint64_t> bypassed_{0};
+    };
+
+} // namespace repositories
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "common/Config.h"
+#include "models/MarketData.h"
+#include "models/SymbolRegistry.h"
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace repositories {
+
+    // 심볼별 최신 시세 + 최근 틱 링 버퍼 (프로세스 내 캐시)
+    // - 심볼 슬롯은 SymbolId로 직접 인덱싱 (해시 조회 없음), 첫 갱신 시 할당하고 해제하지 않음
+    // - 슬롯마다 seqlock: 쓰기는 시퀀스를 홀수로 만든 뒤 갱신, 읽기는 시퀀스가 바뀌지 않았을 때만 채택
+    //   필드는 relaxed 원자 변수라 읽기 쪽은 락/RMW 없이 로드 몇 번으로 끝남
+    // - 링은 도착 순서로 RECENT_TICKS개를 유지. coveredSince 이후 구간은 빠짐없이 들어 있음을 보장하고
+    //   그보다 이른 구간을 묻는 조회는 미스로 처리해 호출자가 DB로 폴백
+    class MarketDataCache {
+    public:
+        static constexpr size_t CAPACITY = common::MarketDataCacheConfig::RECENT_TICKS;
+        static constexpr size_t MAX_SOURCE_LENGTH = 31;     // MarketData::source_ 크기 - 1
+
+        struct Tick {
+            int64_t id;                 // 아직 기록되지 않은 수신 틱은 0
+            double price;
+            double volume;
+            int64_t timestampMicros;
+        };
+
+        struct Quote {
+            Tick tick;
+            std::string source;
+        };
+
+        // [since, 최신] 구간 요약. 구간의 첫/마지막 틱은 timestamp 기준
+        struct WindowSummary {
+            size_t count;
+            double firstPrice;
+            double lastPrice;
+        };
+
+        static MarketDataCache& getInstance();
+
+        // 수신 경로: 최신 시세 갱신(더 새로운 timestamp일 때만) + 링에 추가
+        void update(const models::MarketData& data);
+        void update(models::SymbolId symbolId, const Tick& tick, std::string_view source);
+
+        // DB에서 읽은 최근 틱으로 슬롯 초기화 (timestamp 오름차순)
+        // completeHistory면 심볼의 전체 이력이므로 어떤 구간도 캐시에서 응답 가능
+        // 이미 수신된 틱 중 DB의 마지막 틱보다 새로운 것은 유지
+        void warm(models::SymbolId symbolId,
+                  const std::vector<Tick>& ascending,
+                  std::string_view latestSource,
+                  bool completeHistory);
+
+        // 슬롯 비우기 (메모리는 유지)
+        void invalidate(models::SymbolId symbolId);
+
+        // 미스면 std::nullopt
+        std::optional<double> latestPrice(models::SymbolId symbolId) const;
+        std::optional<Quote> latestQuote(models::SymbolId symbolId) const;
+
+        // 링이 sinceMicros 이후를 모두 담고 있을 때만 값 반환
+        std::optional<WindowSummary> summarizeSince(models::SymbolId symbolId, int64_t sinceMicros) const;
+
+    private:
+        MarketDataCache() = default;
+        ~MarketDataCache() = default;
+        MarketDataCache(const MarketDataCache&) = delete;
+        MarketDataCache& operator=(const MarketDataCache&) = delete;
+
+        static constexpr int64_t NOT_COVERED = std::numeric_limits<int64_t>::max();
+        static constexpr int64_t FULLY_COVERED = std::numeric_limits<int64_t>::min();
+        static constexpr size_t SOURCE_WORDS = (MAX_SOURCE_LENGTH + 1) / sizeof(uint64_t);
+
+        struct Cell {
+            std::atomic<int64_t> timestampMicros{0};
+            std::atomic<double> price{0.0};
+            std::atomic<double> volume{0.0};
+        };
+
+        struct alignas(common::MemoryConfig::CACHE_LINE_SIZE) Slot {
+            std::atomic<uint64_t> sequence{0};      // 홀수면 쓰기 중
+
+            std::atomic<bool> hasLatest{false};
+            std::atomic<int64_t> latestId{0};
+            std::atomic<double> latestPrice{0.0};
+            std::atomic<double> latestVolume{0.0};
+            std::atomic<int64_t> latestTimestamp{0};
+            std::array<std::atomic<uint64_t>, SOURCE_WORDS> latestSource{};
+
+            std::atomic<uint64_t> appended{0};      // 링에 추가된 총 틱 수 (다음 위치 = appended % CAPACITY)
+            std::atomic<int64_t> coveredSince{NOT_COVERED};
+            std::array<Cell, CAPACITY> ring;
+        };
+
+        // 쓰기 잠금 (시퀀스를 짝수 -> 홀수로 CAS)
+        static void beginWrite(Slot& slot);
+        static void endWrite(Slot& slot);
+
+        // seqlock 읽기. read가 일관된 스냅샷을 얻으면 true
+        template <typename Read>
+        static bool readConsistent(const Slot& slot, Read&& read);
+
+        static void append(Slot& slot, const Tick& tick);
+        static void storeLatest(Slot& slot, const Tick& tick, std::string_view source);
+
+        const Slot* find(models::SymbolId symbolId) const;
+        Slot& acquire(models::SymbolId symbolId);
+
+        std::array<std::atomic<Slot*>, models::SymbolRegistry::MAX_SYMBOLS> slots_{};
+        std::mutex allocationMutex_;
+        std::vector<std::unique_ptr<Slot>> storage_;
+    };
+
+} // namespace repositories
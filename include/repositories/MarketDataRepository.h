@@ -1,9 +1,15 @@
 #pragma once
 
 #include "repositories/BaseRepository.h"
+#include "repositories/FindByIdCoalescer.h"
 #include "models/MarketData.h"
 #include "models/mappers/MarketDataMapper.h"
+#include "repositories/MarketDataCache.h"
+#include "repositories/CandleAggregator.h"
+#include "database/PgConnection.h"
 #include <string>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <vector>
 
@@ -18,15 +24,26 @@ namespace repositories {
         // BaseRepository 구현
         models::MarketData save(const models::MarketData& marketData) override;
         std::optional<models::MarketData> findById(int64_t id) const override;
+        std::vector<models::MarketData> findByIds(std::span<const int64_t> ids) const override;
         bool deleteById(int64_t id) override;
 
         PaginationResult findAll(size_t page, size_t pageSize) const override;
+        KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const override;
         std::vector<models::MarketData> findByTimeRange(
             const trantor::Date& start,
             const trantor::Date& end
         ) const override;
 
+        // 비동기 CRUD (매퍼 코루틴 사용, 캐시/봉 집계 반영은 동기 버전과 동일)
+        drogon::Task<models::MarketData> saveAsync(models::MarketData marketData) override;
+        drogon::Task<std::optional<models::MarketData>> findByIdAsync(int64_t id) const override;
+        drogon::Task<bool> deleteByIdAsync(int64_t id) override;
+        drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const override;
+        drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const override;
+
         // MarketData 전용 메서드
+        // findLatestBySymbol/getLatestPrice/hasPriceChangeExceededThreshold는 MarketDataCache에서 먼저 응답하고
+        // 미스일 때만 DB 조회. 캐시의 최신 틱은 아직 기록 전일 수 있음 (id 0)
         std::optional<models::MarketData> findLatestBySymbol(const std::string& symbol) const;
         std::vector<models::MarketData> findBySymbol(
             const std::string& symbol,
@@ -37,6 +54,20 @@ namespace repositories {
             const trantor::Date& start,
             const trantor::Date& end
         ) const;
+        // 대용량 범위 조회: fetchSize행씩 청크로 읽어 visitor 호출 (범위 크기와 무관하게 메모리 일정)
+        using RowVisitor = models::mappers::MarketDataMapper::RowVisitor;
+        size_t forEachInRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end,
+            const RowVisitor& visitor,
+            size_t fetchSize = common::PaginationConfig::STREAM_FETCH_SIZE
+        ) const;
+        models::MarketDataBatch findBatchBySymbolAndTimeRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end
+        ) const;
         double getLatestPrice(const std::string& symbol) const;
         bool hasPriceChangeExceededThreshold(
             const std::string& symbol,
@@ -47,12 +78,36 @@ namespace repositories {
             const trantor::Date& since,
             size_t minDataPoints = 1
         ) const;
+        // [start, end)에서 시작하는 OHLCV 봉 (open_time 오름차순, 진행 중인 봉 포함)
+        // CandleAggregator가 보유한 구간은 메모리에서, 그 앞은 market_bars + 미기록 델타로 응답
+        std::vector<models::CandleBar> findBars(
+            const std::string& symbol,
+            models::BarResolution resolution,
+            const trantor::Date& start,
+            const trantor::Date& end
+        ) const;
 
         // 벌크 작업
+        // MarketDataWriteBehind가 실행 중이고 전부 신규 행이면 캐시/봉에 반영한 뒤 쓰기 지연 큐에 넣고 즉시 반환
+        // 그 밖에는 copyBatch/upsertBatch로 바로 기록
         void saveBatch(const std::vector<models::MarketData>& marketDataList);
 
-        // 캐시 관련 (TODO)
+        // DB에만 기록하고 캐시는 건드리지 않음: 전부 신규 행이면 COPY, id가 있는 행이 섞여 있으면 upsert
+        // (MarketDataWriteBehind의 sink. 큐에 넣을 때 이미 캐시에 반영됨)
+        void persistBatch(const std::vector<models::MarketData>& marketDataList);
+
+        // COPY (FORMAT binary)로 market_data에 직접 적재 (RETURNING 없음). 적재한 행 수 반환
+        // 성공하면 캐시와 봉 집계에 반영 (신규 행이라 캐시의 id는 0)
+        size_t copyBatch(const std::vector<models::MarketData>& marketDataList);
+
+        // 임시 staging 테이블에 COPY 후 id가 있는 행은 UPDATE, 없는 행은 INSERT (단일 트랜잭션)
+        // 커밋 후 신규 행은 캐시와 봉 집계에 반영, 기존 행을 고친 심볼은 캐시 슬롯을 비움
+        size_t upsertBatch(const std::vector<models::MarketData>& marketDataList);
+
+        // 캐시 관련
+        // 심볼의 캐시 슬롯 비우기 (다음 조회는 DB에서 읽어 다시 채움)
         void invalidateCache(const std::string& symbol);
+        // DB의 최근 RECENT_TICKS개 틱으로 캐시 채우기 (시작 시 활성 심볼마다 호출)
         void warmupCache(const std::string& symbol);
 
     private:
@@ -62,9 +117,29 @@ namespace repositories {
         MarketDataRepository& operator=(const MarketDataRepository&) = delete;
 
         models::mappers::MarketDataMapper& mapper_{models::mappers::MarketDataMapper::getInstance()};
+        // 동시에 들어온 findById를 모아 한 번의 findByIds로 조회
+        mutable FindByIdCoalescer<models::MarketData> byId_{
+            [this](const std::vector<int64_t>& ids) { return loadByIds(ids); }};
+        MarketDataCache& cache_{MarketDataCache::getInstance()};
+        CandleAggregator& candles_{CandleAggregator::getInstance()};
+
+        // DB 최신 틱 조회 (캐시 미스 경로). 찾으면 캐시에도 반영
+        std::optional<models::MarketData> loadLatestBySymbol(const std::string& symbol) const;
+
+        // 고유 id로 DB 조회 (순서 무관, findByIds와 byId_ 공용)
+        std::vector<models::MarketData> loadByIds(const std::vector<int64_t>& ids) const;
+
+        // DB 기록만 수행 (copyBatch/upsertBatch/persistBatch 공용)
+        size_t copyRows(const std::vector<models::MarketData>& marketDataList);
+        size_t upsertRows(const std::vector<models::MarketData>& marketDataList);
+        // 커밋된 배치를 캐시와 봉 집계에 반영
+        void publishCommitted(const std::vector<models::MarketData>& marketDataList);
+
+        // COPY 전용 libpq 연결 (지연 생성, copyMutex_ 보유 상태에서만 사용)
+        database::PgConnection& copyConnection();
 
-        // 캐시 키 생성 헬퍼
-        std::string createCacheKey(const std::string& symbol, const std::string& suffix = "") const;
+        std::unique_ptr<database::PgConnection> copyConnection_;
+        std::mutex copyMutex_;
     };
 
 } // namespace repositories
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "common/Config.h"
+#include "models/MarketData.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace repositories {
+
+    // MarketData::update_queue()를 소비하는 쓰기 지연(write-behind) 단계
+    // - 생산자(MarketDataRepository::saveBatch)는 enqueue만 호출하고 DB 지연과 무관하게 즉시 반환
+    // - 전용 flush 스레드가 BATCH_SIZE만큼 쌓이거나 FLUSH_INTERVAL이 지나면
+    //   큐를 비워 Options::sink(운영에서는 MarketDataRepository::persistBatch)로 기록
+    // - 미기록 틱 수는 capacity로 제한하고, 초과 시 OverflowPolicy에 따라 처리
+    // - stop()은 남은 틱을 모두 기록한 뒤 반환
+    class MarketDataWriteBehind {
+    public:
+        // 배치 기록 함수. 예외를 던지면 maxFlushAttempts까지 재시도
+        using Sink = std::function<void(const std::vector<models::MarketData>&)>;
+
+        enum class OverflowPolicy {
+            Block,          // 공간이 생길 때까지 생산자 대기 (명시적 backpressure)
+            DropNewest,     // 새 틱을 버림
+            DropOldest      // 가장 오래된 미기록 틱을 버리고 새 틱을 넣음
+        };
+
+        struct Options {
+            size_t capacity = common::WriteBehindConfig::QUEUE_CAPACITY;
+            size_t batchSize = common::WriteBehindConfig::BATCH_SIZE;
+            std::chrono::milliseconds flushInterval{common::WriteBehindConfig::FLUSH_INTERVAL_MS};
+            size_t maxFlushAttempts = common::WriteBehindConfig::MAX_FLUSH_ATTEMPTS;
+            OverflowPolicy policy = OverflowPolicy::DropOldest;
+            Sink sink;
+        };
+
+        enum class EnqueueResult {
+            Queued,
+            Dropped,        // 용량 초과로 버려짐 (DropNewest)
+            Closed          // 실행 중이 아니거나 Block 대기 중 종료됨: 호출자가 직접 기록해야 함
+        };
+
+        struct Stats {
+            uint64_t enqueued;
+            uint64_t written;
+            uint64_t dropped;       // 용량 초과로 버린 틱
+            uint64_t failed;        // 재시도 후에도 저장하지 못한 틱
+            uint64_t flushes;
+            size_t pending;
+        };
+
+        static MarketDataWriteBehind& getInstance();
+
+        // flush 스레드 시작. 이미 실행 중이면 std::logic_error, sink가 없으면 std::invalid_argument
+        void start(const Options& options);
+
+        // 새 틱 수신을 막고 남은 틱을 모두 기록한 뒤 flush 스레드 종료
+        void stop();
+
+        bool isRunning() const { return running_.load(std::memory_order_acquire); }
+
+        EnqueueResult enqueue(std::shared_ptr<models::MarketData> data);
+
+        // flush 스레드를 즉시 깨움 (완료를 기다리지 않음)
+        void requestFlush();
+
+        Stats getStats() const;
+
+    private:
+        MarketDataWriteBehind() = default;
+        ~MarketDataWriteBehind();
+        MarketDataWriteBehind(const MarketDataWriteBehind&) = delete;
+        MarketDataWriteBehind& operator=(const MarketDataWriteBehind&) = delete;
+
+        void run();
+        void drain(std::vector<std::shared_ptr<models::MarketData>>& batch, size_t maxItems);
+        void writeBatch(const std::vector<std::shared_ptr<models::MarketData>>& batch);
+        // 용량 안이면 pending_을 하나 늘리고 늘린 뒤의 값, 가득 찼으면 0
+        size_t tryReserve();
+        // Block 정책: 용량이 빌 때까지 대기. 종료로 깨어나면 false
+        bool waitForSpace();
+
+        Options options_;
+        std::mutex lifecycleMutex_;     // start/stop 직렬화
+        std::thread flusher_;
+        std::atomic<bool> running_{false};
+        std::atomic<bool> stopping_{false};
+
+        // enqueue 진행 중인 생산자 수. stop()의 마지막 drain은 이 값이 0이 된 뒤 수행
+        std::atomic<size_t> activeProducers_{0};
+
+        // 큐에 있거나 넣는 중인 미기록 틱 수 (LockFreeQueue는 크기를 제공하지 않으므로 별도 관리)
+        // push 전에 증가시키므로 항상 큐의 실제 원소 수 이상 (pop한 만큼만 감소)
+        std::atomic<size_t> pending_{0};
+
+        // flush 스레드 깨우기용. 생산자는 배치 임계값을 넘을 때만 notify
+        std::mutex wakeMutex_;
+        std::condition_variable wakeCv_;
+        bool flushRequested_{false};
+
+        // Block 정책에서 대기 중인 생산자 깨우기용
+        std::mutex spaceMutex_;
+        std::condition_variable spaceCv_;
+        std::atomic<size_t> blockedProducers_{0};
+
+        std::atomic<uint64_t> enqueued_{0};
+        std::atomic<uint64_t> written_{0};
+        std::atomic<uint64_t> dropped_{0};
+        std::atomic<uint64_t> failed_{0};
+        std::atomic<uint64_t> flushes_{0};
+    };
+
+} // namespace repositories
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "models/Order.h"
+#include "models/SymbolRegistry.h"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace repositories {
+
+    // 미체결(open) 주문 인메모리 인덱스
+    // - id / order_id / 심볼 / 상태별로 조회. 종결 상태(FILLED 등)가 되면 인덱스에서 제거
+    // - 시작 시 rebuild()로 DB에서 채운 뒤에는 미체결 주문 조회의 기준 데이터로 사용
+    //   (OrderRepository를 거치지 않은 주문 쓰기는 반영되지 않으므로 주문 쓰기는 저장소로만 수행)
+    // - 조회는 공유 잠금, 갱신은 배타 잠금. 결과는 복사본, timestamp 내림차순 (DB 쿼리와 같은 순서)
+    class OpenOrderIndex {
+    public:
+        // orders_status_check 중 종결되지 않은 상태
+        static constexpr std::array<std::string_view, 1> OPEN_STATUSES{"PENDING"};
+        static bool isOpenStatus(std::string_view status);
+
+        OpenOrderIndex() = default;
+        OpenOrderIndex(const OpenOrderIndex&) = delete;
+        OpenOrderIndex& operator=(const OpenOrderIndex&) = delete;
+
+        // 미체결 주문 전체로 교체하고 ready 상태로 전환
+        void rebuild(const std::vector<models::Order>& openOrders);
+        // rebuild 전이면 false (호출자는 DB로 조회)
+        bool isReady() const;
+
+        // 저장된 주문 반영: 미체결이면 추가/교체, 종결이면 제거. id가 0이면 무시
+        void upsert(const models::Order& order);
+        // 상태/체결 갱신. 인덱스에 없는 주문이 미체결 상태로 바뀌면 false (호출자가 행을 읽어 upsert)
+        bool applyStatus(int64_t id, const std::string& status, double filledQuantity, double filledPrice);
+        void erase(int64_t id);
+
+        std::optional<models::Order> findById(int64_t id) const;
+        std::optional<models::Order> findByOrderId(const std::string& orderId) const;
+        // symbol이 비어 있으면 전체 미체결 주문
+        std::vector<models::Order> findOpen(const std::string& symbol = "") const;
+        std::vector<models::Order> findByStatus(const std::string& status, size_t limit) const;
+
+        size_t size() const;
+
+    private:
+        void insertLocked(const models::Order& order);
+        void eraseLocked(int64_t id);
+        std::vector<models::Order> collectLocked(const std::unordered_set<int64_t>& ids, size_t limit) const;
+
+        mutable std::shared_mutex mutex_;
+        bool ready_{false};
+        std::unordered_map<int64_t, models::Order> orders_;
+        std::unordered_map<std::string, int64_t> byOrderId_;     // order_id는 DB에서 전역 유일 (order_ids, V6)
+        std::unordered_map<models::SymbolId, std::unordered_set<int64_t>> bySymbol_;
+        std::unordered_map<std::string, std::unordered_set<int64_t>> byStatus_;
+    };
+
+} // namespace repositories
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "repositories/BaseRepository.h"
+#include "repositories/FindByIdCoalescer.h"
 #include "models/Order.h"
 #include "models/mappers/OrderMapper.h"
+#include "repositories/OpenOrderIndex.h"
 #include <string>
 #include <optional>
 #include <vector>
@@ -18,19 +20,37 @@ namespace repositories {
         // BaseRepository 구현
         models::Order save(const models::Order& order) override;
         std::optional<models::Order> findById(int64_t id) const override;
+        std::vector<models::Order> findByIds(std::span<const int64_t> ids) const override;
         bool deleteById(int64_t id) override;
 
         PaginationResult findAll(size_t page, size_t pageSize) const override;
+        KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const override;
         std::vector<models::Order> findByTimeRange(
             const trantor::Date& start,
             const trantor::Date& end
         ) const override;
 
+        // 비동기 CRUD (매퍼 코루틴 사용)
+        drogon::Task<models::Order> saveAsync(models::Order order) override;
+        drogon::Task<std::optional<models::Order>> findByIdAsync(int64_t id) const override;
+        drogon::Task<bool> deleteByIdAsync(int64_t id) override;
+        drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const override;
+        drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const override;
+
+        // 그룹 커밋 저장 (GroupCommitter)
+        drogon::Task<models::Order> saveGrouped(models::Order order) override;
+
         // Order 전용 메서드
         std::vector<models::Order> findBySymbol(const std::string& symbol, size_t limit = 100) const;
+        // 미체결 상태는 OpenOrderIndex에서 응답 (SQL 없음), 종결 상태는 DB 조회
         std::vector<models::Order> findByStatus(const std::string& status, size_t limit = 100) const;
         std::vector<models::Order> findBySignalId(int64_t signalId) const;
         std::vector<models::Order> findPendingOrders(const std::string& symbol = "") const;
+        std::optional<models::Order> findOpenByOrderId(const std::string& orderId) const;
+
+        // 미체결 주문 인덱스를 DB(primary)에서 다시 채움. 시작 시 호출
+        // 이후 이 저장소를 통한 save/updateOrderStatus/saveBatch/delete가 인덱스를 갱신
+        void rebuildOpenOrderIndex();
 
         // 특정 시간 범위 내 심볼별 조회 (OrderMapper 제공)
         std::vector<models::Order> findBySymbolAndTimeRange(
@@ -39,8 +59,21 @@ namespace repositories {
             const trantor::Date& end
         ) const;
 
+        // 대용량 범위 조회: fetchSize행씩 청크로 읽어 visitor 호출 (범위 크기와 무관하게 메모리 일정)
+        // visitor가 false를 반환하면 중단. 방문한 행 수 반환
+        using RowVisitor = models::mappers::OrderMapper::RowVisitor;
+        size_t forEachInRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end,
+            const RowVisitor& visitor,
+            size_t fetchSize = common::PaginationConfig::STREAM_FETCH_SIZE
+        ) const;
+
         // 주문 상태 업데이트
         void updateOrderStatus(int64_t id, const std::string& status, double filledQuantity = 0.0, double filledPrice = 0.0);
+        // 체결 버스트 등 다건 상태 변경 (한 번의 왕복). 갱신된 행 수 반환
+        size_t updateOrderStatusBatch(const std::vector<models::mappers::OrderStatusUpdate>& updates);
 
         // 벌크 작업 예시
         void saveBatch(const std::vector<models::Order>& orderList);
@@ -52,6 +85,13 @@ namespace repositories {
         OrderRepository& operator=(const OrderRepository&) = delete;
 
         models::mappers::OrderMapper& mapper_{models::mappers::OrderMapper::getInstance()};
+        // 동시에 들어온 findById를 모아 한 번의 findByIds로 조회
+        mutable FindByIdCoalescer<models::Order> byId_{
+            [this](const std::vector<int64_t>& ids) { return mapper_.findByIds(ids); }};
+        OpenOrderIndex openOrders_;
+
+        // 인덱스에 없는 주문이 미체결 상태로 바뀐 경우 행을 읽어 반영
+        void applyStatusToIndex(int64_t id, const std::string& status, double filledQuantity, double filledPrice);
     };
 
 } // namespace repositories
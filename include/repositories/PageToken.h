@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace repositories {
+
+    // 키셋 페이지네이션의 위치: 직전 페이지 마지막 행의 (정렬 시각, id)
+    struct PageCursor {
+        int64_t timestampMicros;
+        int64_t id;
+    };
+
+    // 클라이언트에 넘기는 불투명 continuation 토큰
+    // 형식: base64url(버전 1바이트 + timestampMicros 8바이트 + id 8바이트, 빅 엔디언), 패딩 없음
+    class PageToken {
+    public:
+        static std::string encode(const PageCursor& cursor);
+
+        // 빈 토큰은 첫 페이지(std::nullopt). 형식이 잘못되면 std::invalid_argument
+        static std::optional<PageCursor> decode(std::string_view token);
+    };
+
+} // namespace repositories
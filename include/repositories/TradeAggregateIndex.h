@@ -0,0 +1,113 @@
+#pragma once
+
+#include "common/Config.h"
+#include "models/SymbolRegistry.h"
+#include "models/Trade.h"
+#include "models/TradeAggregate.h"
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace repositories {
+
+    // 심볼별 체결 집계(수량/금액/건수) 인메모리 인덱스
+    // - [coverage.from, coverage.to) 구간을 BUCKET 폭으로 나눠 버킷별 합을 Fenwick 트리로 유지
+    //   임의 구간 합은 버킷 경계에 맞춘 안쪽 부분을 O(log n)으로 계산하고,
+    //   경계 밖 자투리(와 인덱스 구간 밖)는 residual로 돌려줘 호출자가 원본 행으로 보정
+    // - 로드 후에는 TradeRepository를 거치는 체결 삽입이 add로 반영되어야 정확함
+    //   (수정/삭제는 이전 값을 모르므로 invalidate로 다시 로드)
+    // - 로드는 beginLoad -> DB 집계 -> finishLoad. 그 사이 같은 심볼에 쓰기가 있었거나
+    //   쓰기가 진행 중(WriteGuard)이면 설치하지 않음
+    class TradeAggregateIndex {
+    public:
+        static constexpr int64_t BUCKET_MICROS =
+            static_cast<int64_t>(common::TradeAggregateConfig::BUCKET_SECONDS) * 1000000;
+        static constexpr int64_t HISTORY_MICROS =
+            static_cast<int64_t>(common::TradeAggregateConfig::HISTORY_DAYS) * 24 * 60 * 60 * 1000000;
+        static constexpr int64_t SPAN_MICROS =
+            static_cast<int64_t>(common::TradeAggregateConfig::SPAN_DAYS) * 24 * 60 * 60 * 1000000;
+        static constexpr size_t SPAN_BUCKETS = static_cast<size_t>(SPAN_MICROS / BUCKET_MICROS);
+
+        struct LoadToken {
+            uint64_t epoch;
+            uint64_t version;
+        };
+
+        // 체결 쓰기 구간. DB 쓰기 전에 만들고 add/invalidate로 반영한 뒤 파괴
+        // 커밋됐지만 아직 add되지 않은 체결을 로드 스냅샷이 읽으면 add와 이중으로 계산되므로
+        // 구간이 열려 있는 동안 끝난 로드와, 구간과 겹친 로드는 설치하지 않음
+        class WriteGuard {
+        public:
+            WriteGuard(TradeAggregateIndex& index, std::vector<models::SymbolId> symbolIds);
+            ~WriteGuard();
+            WriteGuard(const WriteGuard&) = delete;
+            WriteGuard& operator=(const WriteGuard&) = delete;
+
+        private:
+            TradeAggregateIndex& index_;
+            std::vector<models::SymbolId> symbolIds_;   // 중복 없음
+        };
+
+        // indexed: 버킷 경계에 맞는 안쪽 구간의 합
+        // residual: 원본 행으로 더해야 할 구간 (앞/뒤 자투리, 빈 구간은 empty())
+        struct Lookup {
+            models::TradeAggregate indexed;
+            std::array<models::TimeRange, 2> residual;
+        };
+
+        // 버킷 시작 시각 (BUCKET_MICROS 단위 내림)
+        static int64_t bucketStart(int64_t timestampMicros);
+
+        TradeAggregateIndex() = default;
+        TradeAggregateIndex(const TradeAggregateIndex&) = delete;
+        TradeAggregateIndex& operator=(const TradeAggregateIndex&) = delete;
+
+        LoadToken beginLoad(models::SymbolId symbolId);
+        // buckets: (버킷 시작 시각, 합). fromMicros는 버킷 경계로 내림, 구간은 SPAN_MICROS
+        // beginLoad 이후 심볼에 add/invalidate/쓰기 구간이 있었거나 쓰기 구간이 열려 있으면 false
+        bool finishLoad(
+            models::SymbolId symbolId,
+            const LoadToken& token,
+            int64_t fromMicros,
+            const std::vector<std::pair<int64_t, models::TradeAggregate>>& buckets
+        );
+
+        // 로드되지 않았으면 std::nullopt
+        std::optional<models::TimeRange> coverage(models::SymbolId symbolId) const;
+        std::optional<Lookup> lookup(models::SymbolId symbolId, int64_t fromMicros, int64_t toMicros) const;
+
+        // 저장된 체결 반영. 구간 밖 체결은 residual 쿼리가 원본 행에서 읽으므로 무시
+        void add(const models::Trade& trade);
+        void add(models::SymbolId symbolId, int64_t timestampMicros, double quantity, double price);
+
+        void invalidate(models::SymbolId symbolId);
+        void invalidateAll();
+
+    private:
+        struct Series {
+            int64_t fromBucket{0};                      // 구간 시작 버킷 번호 (epoch / BUCKET_MICROS)
+            std::vector<models::TradeAggregate> buckets;
+            std::vector<models::TradeAggregate> tree;   // Fenwick (1-based, tree[0] 미사용)
+        };
+
+        static void grow(Series& series, size_t size);
+        static void addAt(Series& series, size_t index, const models::TradeAggregate& delta);
+        // 앞에서부터 count개 버킷의 합
+        static models::TradeAggregate prefix(const Series& series, size_t count);
+
+        void touchLocked(models::SymbolId symbolId);
+        void beginWrite(const std::vector<models::SymbolId>& symbolIds);
+        void endWrite(const std::vector<models::SymbolId>& symbolIds);
+
+        mutable std::shared_mutex mutex_;
+        uint64_t epoch_{0};                                         // invalidateAll마다 증가
+        std::unordered_map<models::SymbolId, uint64_t> versions_;   // 심볼별 쓰기 횟수
+        std::unordered_map<models::SymbolId, size_t> writers_;      // 심볼별 열린 WriteGuard 수
+        std::unordered_map<models::SymbolId, Series> series_;
+    };
+
+} // namespace repositories
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "repositories/BaseRepository.h"
+#include "repositories/FindByIdCoalescer.h"
 #include "models/Trade.h"
 #include "models/mappers/TradeMapper.h"
+#include "repositories/TradeAggregateIndex.h"
 #include <string>
 #include <optional>
 #include <vector>
@@ -19,14 +21,26 @@ namespace repositories {
         // BaseRepository 구현
         models::Trade save(const models::Trade& trade) override;
         std::optional<models::Trade> findById(int64_t id) const override;
+        std::vector<models::Trade> findByIds(std::span<const int64_t> ids) const override;
         bool deleteById(int64_t id) override;
 
         PaginationResult findAll(size_t page, size_t pageSize) const override;
+        KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const override;
         std::vector<models::Trade> findByTimeRange(
             const trantor::Date& start,
             const trantor::Date& end
         ) const override;
 
+        // 비동기 CRUD (매퍼 코루틴 사용)
+        drogon::Task<models::Trade> saveAsync(models::Trade trade) override;
+        drogon::Task<std::optional<models::Trade>> findByIdAsync(int64_t id) const override;
+        drogon::Task<bool> deleteByIdAsync(int64_t id) override;
+        drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const override;
+        drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const override;
+
+        // 그룹 커밋 저장 (GroupCommitter)
+        drogon::Task<models::Trade> saveGrouped(models::Trade trade) override;
+
         // Trade 전용 메서드
         std::vector<models::Trade> findBySymbol(const std::string& symbol, size_t limit = 100) const;
         std::vector<models::Trade> findByOrderId(int64_t orderId, size_t limit = 100) const;
@@ -37,12 +51,33 @@ namespace repositories {
             const trantor::Date& end
         ) const;
 
+        // 대용량 범위 조회: fetchSize행씩 청크로 읽어 visitor 호출 (범위 크기와 무관하게 메모리 일정)
+        // visitor가 false를 반환하면 중단. 방문한 행 수 반환
+        using RowVisitor = models::mappers::TradeMapper::RowVisitor;
+        size_t forEachInRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end,
+            const RowVisitor& visitor,
+            size_t fetchSize = common::PaginationConfig::STREAM_FETCH_SIZE
+        ) const;
+
+        // [start, end) 체결 집계 (수량/금액/건수)
+        // TradeAggregateIndex의 버킷 누적 합으로 응답하고 버킷 경계 밖 자투리만 원본 행에서 보정
+        models::TradeAggregate getSymbolAggregate(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end
+        ) const;
+
+        // [start, end) 체결 수량 합
         double getSymbolTotalVolume(
             const std::string& symbol,
             const trantor::Date& start,
             const trantor::Date& end
         ) const;
 
+        // [start, end) 거래량 가중 평균가 (VWAP). 체결이 없으면 0
         double getSymbolAveragePrice(
             const std::string& symbol,
             const trantor::Date& start,
@@ -59,6 +94,14 @@ namespace repositories {
         TradeRepository& operator=(const TradeRepository&) = delete;
 
         models::mappers::TradeMapper& mapper_{models::mappers::TradeMapper::getInstance()};
+        // 동시에 들어온 findById를 모아 한 번의 findByIds로 조회
+        mutable FindByIdCoalescer<models::Trade> byId_{
+            [this](const std::vector<int64_t>& ids) { return mapper_.findByIds(ids); }};
+
+        // 심볼 집계 인덱스를 DB에서 로드 (로드 중 쓰기가 겹치면 재시도). 실패하면 false
+        bool loadAggregates(models::SymbolId symbolId, const std::string& symbol) const;
+
+        mutable TradeAggregateIndex aggregates_;
     };
 
 } // namespace repositories
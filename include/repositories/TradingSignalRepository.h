@@ -1,6 +1,7 @@
 #pragma once
 
 #include "repositories/BaseRepository.h"
+#include "repositories/FindByIdCoalescer.h"
 #include "models/TradingSignal.h"
 #include "models/mappers/TradingSignalMapper.h"
 #include <string>
@@ -19,14 +20,26 @@ namespace repositories {
         // BaseRepository 구현
         models::TradingSignal save(const models::TradingSignal& signal) override;
         std::optional<models::TradingSignal> findById(int64_t id) const override;
+        std::vector<models::TradingSignal> findByIds(std::span<const int64_t> ids) const override;
         bool deleteById(int64_t id) override;
 
         PaginationResult findAll(size_t page, size_t pageSize) const override;
+        KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const override;
         std::vector<models::TradingSignal> findByTimeRange(
             const trantor::Date& start,
             const trantor::Date& end
         ) const override;
 
+        // 비동기 CRUD (매퍼 코루틴 사용)
+        drogon::Task<models::TradingSignal> saveAsync(models::TradingSignal signal) override;
+        drogon::Task<std::optional<models::TradingSignal>> findByIdAsync(int64_t id) const override;
+        drogon::Task<bool> deleteByIdAsync(int64_t id) override;
+        drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const override;
+        drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const override;
+
+        // 그룹 커밋 저장 (GroupCommitter)
+        drogon::Task<models::TradingSignal> saveGrouped(models::TradingSignal signal) override;
+
         // TradingSignal 전용 메서드
         std::vector<models::TradingSignal> findBySymbol(const std::string& symbol, size_t limit = 100) const;
         std::vector<models::TradingSignal> findByStrategyName(const std::string& strategyName, size_t limit = 100) const;
@@ -39,6 +52,17 @@ namespace repositories {
             const trantor::Date& end
         ) const;
 
+        // 대용량 범위 조회: fetchSize행씩 청크로 읽어 visitor 호출 (범위 크기와 무관하게 메모리 일정)
+        // visitor가 false를 반환하면 중단. 방문한 행 수 반환
+        using RowVisitor = models::mappers::TradingSignalMapper::RowVisitor;
+        size_t forEachInRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end,
+            const RowVisitor& visitor,
+            size_t fetchSize = common::PaginationConfig::STREAM_FETCH_SIZE
+        ) const;
+
         // 벌크 작업
         void saveBatch(const std::vector<models::TradingSignal>& signalList);
 
@@ -49,6 +73,9 @@ namespace repositories {
         TradingSignalRepository& operator=(const TradingSignalRepository&) = delete;
 
         models::mappers::TradingSignalMapper& mapper_{models::mappers::TradingSignalMapper::getInstance()};
+        // 동시에 들어온 findById를 모아 한 번의 findByIds로 조회
+        mutable FindByIdCoalescer<models::TradingSignal> byId_{
+            [this](const std::vector<int64_t>& ids) { return mapper_.findByIds(ids); }};
     };
 
 } // namespace repositories
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "repositories/BaseRepository.h"
+#include "repositories/FindByIdCoalescer.h"
 #include "models/User.h"
 #include "models/mappers/UserMapper.h"
 #include <string>
@@ -19,14 +20,23 @@ namespace repositories {
         // BaseRepository 구현
         models::User save(const models::User& user) override;
         std::optional<models::User> findById(int64_t id) const override;
+        std::vector<models::User> findByIds(std::span<const int64_t> ids) const override;
         bool deleteById(int64_t id) override;
 
         PaginationResult findAll(size_t page, size_t pageSize) const override;
+        KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const override;
         std::vector<models::User> findByTimeRange(
             const trantor::Date& start,
             const trantor::Date& end
         ) const override;
 
+        // 비동기 CRUD (매퍼 코루틴 사용)
+        drogon::Task<models::User> saveAsync(models::User user) override;
+        drogon::Task<std::optional<models::User>> findByIdAsync(int64_t id) const override;
+        drogon::Task<bool> deleteByIdAsync(int64_t id) override;
+        drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const override;
+        drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const override;
+
         // User 전용 메서드
         std::optional<models::User> findByEmail(const std::string& email) const;
         std::optional<models::User> findByUsername(const std::string& username) const;
@@ -49,6 +59,9 @@ namespace repositories {
         UserRepository& operator=(const UserRepository&) = delete;
 
         models::mappers::UserMapper& mapper_{models::mappers::UserMapper::getInstance()};
+        // 동시에 들어온 findById를 모아 한 번의 findByIds로 조회
+        mutable FindByIdCoalescer<models::User> byId_{
+            [this](const std::vector<int64_t>& ids) { return mapper_.findByIds(ids); }};
     };
 
 } // namespace repositories
\ No newline at end of file
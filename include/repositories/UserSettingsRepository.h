@@ -1,7 +1,9 @@
 #pragma once
 
 #include "repositories/BaseRepository.h"
+#include "repositories/DecryptedSettingsCache.h"
 #include "models/UserSettings.h"
+#include "models/TradingParamsStore.h"
 #include "models/mappers/UserSettingsMapper.h"
 #include <string>
 #include <optional>
@@ -22,11 +24,19 @@ namespace repositories {
         bool deleteById(int64_t id) override;
 
         PaginationResult findAll(size_t page, size_t pageSize) const override;
+        KeysetPage findPage(const std::string& continuationToken, size_t pageSize) const override;
         std::vector<models::UserSettings> findByTimeRange(
             const trantor::Date& start,
             const trantor::Date& end
         ) const override;
 
+        // 비동기 CRUD (매퍼 코루틴 사용, 암복호화/스냅샷 게시/캐시 무효화는 동기 버전과 동일)
+        drogon::Task<models::UserSettings> saveAsync(models::UserSettings settings) override;
+        drogon::Task<std::optional<models::UserSettings>> findByIdAsync(int64_t id) const override;
+        drogon::Task<bool> deleteByIdAsync(int64_t id) override;
+        drogon::Task<PaginationResult> findAllAsync(size_t page, size_t pageSize) const override;
+        drogon::Task<KeysetPage> findPageAsync(std::string continuationToken, size_t pageSize) const override;
+
         // UserSettings 전용 메서드
         std::vector<models::UserSettings> findByUserId(int64_t userId) const;
         std::optional<models::UserSettings> findByUserAndExchange(
@@ -42,6 +52,15 @@ namespace repositories {
         void updateWatchlist(int64_t settingsId, const Json::Value& watchlist);
         void updateRiskParams(int64_t settingsId, const Json::Value& riskParams);
 
+        // 해석된 전략/리스크/관심종목 스냅샷 (주문 평가 등 핫 패스용, 없으면 nullptr)
+        models::TradingParamsStore::Snapshot getTradingParams(int64_t settingsId) const;
+
+        // 복호화된 apiKey/secret을 잠금 메모리에서 바로 전달 (자동매매 루프 등 반복 조회용, 캐시 미스면 한 번 로드)
+        // 설정이 없으면 false
+        bool withApiCredentials(int64_t settingsId, const DecryptedSettingsCache::CredentialsVisitor& visitor) const;
+        // 복호화 캐시 전체 폐기 (키 교체는 키 세대로 자동 감지)
+        void invalidateDecryptedCache();
+
         // 벌크 작업
         void saveBatch(const std::vector<models::UserSettings>& settingsList);
 
@@ -51,7 +70,14 @@ namespace repositories {
         UserSettingsRepository(const UserSettingsRepository&) = delete;
         UserSettingsRepository& operator=(const UserSettingsRepository&) = delete;
 
+        // credentials의 apiKey/secret을 저장용으로 암호화 (없으면 그대로)
+        static void encryptCredentials(models::UserSettings& settings);
+
+        // 캐시에 같은 암호문이 있으면 재사용, 없으면 복호화 후 캐시 (epoch: DB 조회 전에 읽은 캐시 epoch)
+        void decryptCredentials(models::UserSettings& settings, uint64_t epoch) const;
+
         models::mappers::UserSettingsMapper& mapper_{models::mappers::UserSettingsMapper::getInstance()};
+        mutable DecryptedSettingsCache cache_;
     };
 
 } // namespace repositories
\ No newline at end of file
@@ -51,9 +51,7 @@ private:
     CryptoAuditor& operator=(const CryptoAuditor&) = delete;
 
     // 내부 헬퍼 메서드
-    bool isRateLimitExceeded(const std::string& userId, const std::string& operation);
     void recordOperationAttempt(const std::string& userId, const std::string& operation);
-    bool isKnownIpAddress(const std::string& userId, const std::string& sourceIp);
     void notifySecurityTeam(const Json::Value& alertData);
     
     static constexpr size_t MAX_OPERATIONS_PER_MINUTE = 60;
@@ -4,6 +4,8 @@
 #include <memory>
 #include <chrono>
 #include <mutex>
+#include <atomic>
+#include <cstdint>
 #include <openssl/evp.h>
 #include <openssl/rand.h>
 #include "KeyGenerator.h"
@@ -28,6 +30,8 @@ public:
     bool isKeyValid() const;
     std::string exportEncryptedKey(const std::string& masterKey);
     void importEncryptedKey(const std::string& encryptedKey, const std::string& masterKey);
+    // 키가 교체될 때마다 증가 (복호화 결과 캐시 무효화 판단용)
+    uint64_t getKeyGeneration() const { return keyGeneration_.load(std::memory_order_acquire); }
 
     // 메타데이터
     struct EncryptionMetadata {
@@ -58,6 +62,7 @@ private:
     std::string key_;
     std::string keyId_;
     time_t keyCreationTime_;
+    std::atomic<uint64_t> keyGeneration_{0};
     mutable std::mutex mutex_;
 
     // 재암호화 관련 새 멤버들
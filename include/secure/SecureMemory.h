@@ -0,0 +1,65 @@
+#pragma once
+#include <cstddef>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+// 잠금(mlock) 메모리 풀
+// - 고정 크기 슬롯 영역을 한 번에 매핑해 스왑/코어 덤프에서 제외
+// - 반환된 슬롯은 즉시 0으로 지움
+// - mlock이 RLIMIT_MEMLOCK 등으로 실패하면 경고 후 잠그지 않은 채 사용 (0으로 지우기는 유지)
+class LockedMemoryPool {
+public:
+    static constexpr size_t SLOT_SIZE = 256;     // API 키/시크릿 한 개 분량
+    static constexpr size_t SLOT_COUNT = 2048;   // 512KB
+
+    static LockedMemoryPool& getInstance() {
+        static LockedMemoryPool instance;
+        return instance;
+    }
+
+    // 남은 슬롯이 없으면 nullptr
+    char* allocate();
+    void deallocate(char* slot);
+
+    size_t available() const;
+    bool isLocked() const { return locked_; }
+
+private:
+    LockedMemoryPool();
+    ~LockedMemoryPool();
+    LockedMemoryPool(const LockedMemoryPool&) = delete;
+    LockedMemoryPool& operator=(const LockedMemoryPool&) = delete;
+
+    char* base_{nullptr};
+    size_t bytes_{0};
+    bool locked_{false};
+    std::vector<char*> freeSlots_;
+    mutable std::mutex mutex_;
+};
+
+// 잠금 메모리 슬롯에 보관하는 평문 (복사 불가, 이동 가능). 소멸 시 0으로 지움
+class SecureString {
+public:
+    static constexpr size_t MAX_LENGTH = LockedMemoryPool::SLOT_SIZE;
+
+    SecureString() = default;
+    // 길이 초과 시 std::invalid_argument, 풀 고갈 시 std::runtime_error
+    explicit SecureString(std::string_view plaintext);
+    ~SecureString();
+
+    SecureString(SecureString&& other) noexcept;
+    SecureString& operator=(SecureString&& other) noexcept;
+    SecureString(const SecureString&) = delete;
+    SecureString& operator=(const SecureString&) = delete;
+
+    std::string_view view() const { return std::string_view(data_ ? data_ : "", length_); }
+    size_t size() const { return length_; }
+    bool empty() const { return length_ == 0; }
+
+private:
+    void release() noexcept;
+
+    char* data_{nullptr};
+    size_t length_{0};
+};
@@ -34,6 +34,9 @@ namespace utils {
         std::string getDbName() const { return dbName; }
         std::string getDbUser() const { return dbUser; }
         std::string getDbPassword() const { return dbPassword; }
+        // 읽기 전용 replica (DB_REPLICA_HOST가 비어 있으면 사용 안 함)
+        std::string getDbReplicaHost() const { return dbReplicaHost; }
+        int getDbReplicaPort() const { return dbReplicaPort; }
         
         // Security configuration getters
         std::string getSslCertPath() const { return sslCertPath; }
@@ -66,6 +69,8 @@ namespace utils {
         std::string dbName{"trading_db"};
         std::string dbUser{"trading_user"};
         std::string dbPassword;
+        std::string dbReplicaHost;
+        int dbReplicaPort{5432};
 
         // Security configuration
         bool enableSsl{false};
@@ -1,6 +1,8 @@
 #pragma once
 
+#include "utils/JsonWriter.h"
 #include <json/json.h>
+#include <memory>
 #include <string>
 
 namespace utils {
@@ -8,8 +10,22 @@ namespace utils {
     class JsonUtils {
     public:
         static std::string toJsonString(const Json::Value& value) {
-            Json::FastWriter writer;
-            return writer.write(value);
+            auto& writer = JsonWriter::threadLocal();
+            writer.value(value);
+            return std::string(writer.view());
+        }
+
+        // 모델 목록을 DOM 없이 JSON 배열 문자열로 직렬화
+        // (원소는 writeJson(JsonWriter&)를 제공하는 모델 또는 그 shared_ptr)
+        template <typename Container>
+        static std::string toJsonArray(const Container& items) {
+            auto& writer = JsonWriter::threadLocal();
+            writer.beginArray();
+            for (const auto& item : items) {
+                writeItem(writer, item);
+            }
+            writer.endArray();
+            return std::string(writer.view());
         }
 
         static Json::Value parseJson(const std::string& jsonStr) {
@@ -20,6 +36,21 @@ namespace utils {
             }
             return root;
         }
+
+    private:
+        template <typename T>
+        static void writeItem(JsonWriter& writer, const T& item) {
+            item.writeJson(writer);
+        }
+
+        template <typename T>
+        static void writeItem(JsonWriter& writer, const std::shared_ptr<T>& item) {
+            if (item) {
+                item->writeJson(writer);
+            } else {
+                writer.nullValue();
+            }
+        }
     };
 
 } // namespace utils
\ No newline at end of file
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <json/json.h>
+#include <trantor/utils/Date.h>
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace utils {
+
+    // DOM(Json::Value)을 거치지 않고 출력 버퍼에 바로 JSON을 기록하는 스트리밍 writer
+    // - 버퍼는 clear() 후 재사용되므로 반복 직렬화 시 할당이 거의 발생하지 않음
+    // - 숫자는 std::to_chars로 포맷 (double은 왕복 가능한 최단 표현)
+    // - 구조 오류(짝이 맞지 않는 begin/end 등)는 std::logic_error
+    class JsonWriter {
+    public:
+        explicit JsonWriter(size_t initialCapacity = 4096);
+
+        // 스레드별 재사용 writer (clear된 상태로 반환)
+        // 결과를 복사/소비하기 전에 같은 스레드에서 다시 호출하면 내용이 지워지므로 중첩 사용 금지
+        static JsonWriter& threadLocal();
+
+        void clear();
+        std::string_view view() const { return buffer_; }
+        const std::string& str() const { return buffer_; }
+        std::string release();   // 버퍼를 넘겨주고 writer는 빈 상태가 됨
+
+        // 구조
+        JsonWriter& beginObject();
+        JsonWriter& endObject();
+        JsonWriter& beginArray();
+        JsonWriter& endArray();
+        JsonWriter& key(std::string_view name);
+
+        // 값
+        JsonWriter& value(std::string_view text);
+        JsonWriter& value(const char* text) { return value(std::string_view(text)); }
+        JsonWriter& value(const std::string& text) { return value(std::string_view(text)); }
+        JsonWriter& value(bool flag);
+        JsonWriter& value(int number) { return value(static_cast<int64_t>(number)); }
+        JsonWriter& value(int64_t number);
+        JsonWriter& value(uint64_t number);
+        JsonWriter& value(double number);          // NaN/Inf는 null
+        JsonWriter& value(const Json::Value& json); // 기존 DOM 값을 그대로 기록
+        JsonWriter& nullValue();
+
+        // trantor::Date::toFormattedString(false)와 같은 형식 ("YYYYMMDD HH:MM:SS", UTC)
+        JsonWriter& timestamp(const trantor::Date& date);
+
+        // key + value 축약
+        template <typename T>
+        JsonWriter& field(std::string_view name, const T& fieldValue) {
+            key(name);
+            return value(fieldValue);
+        }
+        JsonWriter& timestampField(std::string_view name, const trantor::Date& date) {
+            key(name);
+            return timestamp(date);
+        }
+
+    private:
+        static constexpr size_t MAX_DEPTH = 64;
+
+        enum class Scope : uint8_t { Object, Array };
+
+        struct Frame {
+            Scope scope;
+            bool hasElements;
+        };
+
+        void beforeValue();
+        void writeEscaped(std::string_view text);
+
+        std::string buffer_;
+        std::array<Frame, MAX_DEPTH> stack_{};
+        size_t depth_{0};
+        bool expectingValue_{false};   // key() 직후
+    };
+
+} // namespace utils
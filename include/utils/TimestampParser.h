@@ -0,0 +1,24 @@
+#pragma once
+
+#include <trantor/utils/Date.h>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+namespace utils {
+
+    // PostgreSQL timestamp/timestamptz 텍스트 파서
+    // 지원 형식: "YYYY-MM-DD HH:MM:SS[.ffffff][Z|±HH[:MM]]" (날짜/시간 구분자는 ' ' 또는 'T')
+    // - 오프셋이 없으면 UTC로 해석 (trantor::Date::fromDbString과 동일)
+    // - "YYYY-MM-DD HH:MM:SS" 부분의 변환 결과를 스레드별로 캐시하여
+    //   같은 초에 속한 연속 행은 달력 계산 없이 처리
+    class TimestampParser {
+    public:
+        // epoch 기준 마이크로초, 형식이 맞지 않으면 std::nullopt
+        static std::optional<int64_t> parseMicros(std::string_view text);
+
+        // 지원하지 않는 형식은 trantor::Date::fromDbString으로 폴백
+        static trantor::Date parse(std::string_view text);
+    };
+
+} // namespace utils
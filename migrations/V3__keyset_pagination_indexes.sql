@@ -0,0 +1,17 @@
+-- 키셋 페이지네이션용 복합 인덱스
+-- WHERE (timestamp, id) < ($1, $2) ORDER BY timestamp DESC, id DESC LIMIT n 이
+-- 페이지 깊이와 무관하게 인덱스 범위 스캔 한 번으로 처리되도록 정렬 키 전체를 포함
+CREATE INDEX IF NOT EXISTS idx_market_data_timestamp_id ON market_data(timestamp, id);
+CREATE INDEX IF NOT EXISTS idx_trading_signals_timestamp_id ON trading_signals(timestamp, id);
+CREATE INDEX IF NOT EXISTS idx_orders_timestamp_id ON orders(timestamp, id);
+CREATE INDEX IF NOT EXISTS idx_trades_timestamp_id ON trades(timestamp, id);
+
+-- timestamp 컬럼이 없는 테이블은 created_at 기준
+CREATE INDEX IF NOT EXISTS idx_users_created_at_id ON users(created_at, id);
+CREATE INDEX IF NOT EXISTS idx_user_settings_created_at_id ON user_settings(created_at, id);
+
+-- 근사 행 수(pg_class.reltuples)가 바로 쓸 수 있도록 통계 갱신
+ANALYZE market_data;
+ANALYZE trading_signals;
+ANALYZE orders;
+ANALYZE trades;
@@ -0,0 +1,199 @@
+-- market_data / orders / trades 시간 범위 파티셔닝 (timestamp 기준, UTC 경계)
+-- - market_data는 일 단위, orders/trades는 월 단위
+-- - 파티션 이름: <table>_pYYYYMMDD (일) / <table>_pYYYYMM (월)
+--   database::PartitionManager가 같은 규칙으로 앞으로 쓸 파티션을 미리 만들고 보존 기간이 지난 파티션을 DETACH
+-- - 기본(DEFAULT) 파티션은 두지 않음: 있으면 DETACH CONCURRENTLY와 최신 행 조회의 정렬 Append가 막힘
+--   (어느 파티션에도 속하지 않는 timestamp는 INSERT 오류)
+-- - 파티션 키가 모든 유니크 제약에 포함되어야 하므로
+--   PK는 (id, timestamp), orders.order_id / trades.trade_id 유니크는 (..., timestamp)로 바뀌고
+--   trades.order_id -> orders(id) 외래 키는 유지할 수 없어 제거
+
+-- 1. 파티션 생성 함수
+-- 빈 테이블을 만든 뒤 ATTACH (CREATE TABLE ... PARTITION OF와 달리 부모에 ACCESS EXCLUSIVE 잠금을 잡지 않음)
+CREATE OR REPLACE FUNCTION ensure_time_partition(
+    p_parent TEXT,
+    p_child TEXT,
+    p_from TIMESTAMPTZ,
+    p_to TIMESTAMPTZ
+) RETURNS BOOLEAN AS $$
+BEGIN
+    IF to_regclass(p_child) IS NOT NULL THEN
+        RETURN FALSE;
+    END IF;
+    PERFORM set_config('lock_timeout', '5s', true);
+    EXECUTE format('CREATE TABLE %I (LIKE %I INCLUDING DEFAULTS INCLUDING CONSTRAINTS)', p_child, p_parent);
+    EXECUTE format('ALTER TABLE %I ATTACH PARTITION %I FOR VALUES FROM (%L) TO (%L)',
+                   p_parent, p_child, p_from, p_to);
+    RETURN TRUE;
+END;
+$$ LANGUAGE plpgsql;
+
+-- [p_from, p_to]를 덮는 구간 파티션을 모두 생성 (p_granularity: 'day' | 'month'), 새로 만든 수 반환
+CREATE OR REPLACE FUNCTION create_time_partitions(
+    p_parent TEXT,
+    p_granularity TEXT,
+    p_from TIMESTAMPTZ,
+    p_to TIMESTAMPTZ
+) RETURNS INTEGER AS $$
+DECLARE
+    v_step INTERVAL := CASE p_granularity WHEN 'day' THEN INTERVAL '1 day' ELSE INTERVAL '1 month' END;
+    v_format TEXT := CASE p_granularity WHEN 'day' THEN 'YYYYMMDD' ELSE 'YYYYMM' END;
+    v_start TIMESTAMP := date_trunc(p_granularity, p_from AT TIME ZONE 'UTC');
+    v_created INTEGER := 0;
+BEGIN
+    WHILE v_start <= p_to AT TIME ZONE 'UTC' LOOP
+        IF ensure_time_partition(
+            p_parent,
+            p_parent || '_p' || to_char(v_start, v_format),
+            v_start AT TIME ZONE 'UTC',
+            (v_start + v_step) AT TIME ZONE 'UTC'
+        ) THEN
+            v_created := v_created + 1;
+        END IF;
+        v_start := v_start + v_step;
+    END LOOP;
+    RETURN v_created;
+END;
+$$ LANGUAGE plpgsql;
+
+-- 2. 기존 테이블을 비켜 두고 이름/제약/인덱스 이름을 새 테이블에 넘김
+ALTER TABLE trades DROP CONSTRAINT IF EXISTS trades_order_id_fkey;
+
+ALTER TABLE market_data RENAME TO market_data_legacy;
+ALTER TABLE market_data_legacy DROP CONSTRAINT market_data_pkey;
+DROP INDEX IF EXISTS idx_market_data_symbol_timestamp, idx_market_data_created_at, idx_market_data_timestamp_id;
+ALTER SEQUENCE market_data_id_seq OWNED BY NONE;
+
+ALTER TABLE orders RENAME TO orders_legacy;
+ALTER TABLE orders_legacy DROP CONSTRAINT orders_pkey, DROP CONSTRAINT orders_order_id_unique;
+DROP INDEX IF EXISTS idx_orders_symbol_timestamp, idx_orders_status, idx_orders_created_at, idx_orders_timestamp_id;
+ALTER SEQUENCE orders_id_seq OWNED BY NONE;
+
+ALTER TABLE trades RENAME TO trades_legacy;
+ALTER TABLE trades_legacy DROP CONSTRAINT trades_pkey, DROP CONSTRAINT trades_trade_id_unique;
+DROP INDEX IF EXISTS idx_trades_symbol_timestamp, idx_trades_created_at, idx_trades_timestamp_id;
+ALTER SEQUENCE trades_id_seq OWNED BY NONE;
+
+-- 3. 파티션 테이블
+CREATE TABLE market_data (
+    id BIGINT NOT NULL DEFAULT nextval('market_data_id_seq'),
+    symbol VARCHAR(20) NOT NULL,
+    price DECIMAL(20,8) NOT NULL,
+    volume DECIMAL(20,8) NOT NULL,
+    timestamp TIMESTAMPTZ NOT NULL,
+    source VARCHAR(50) NOT NULL,
+    created_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP,
+
+    CONSTRAINT market_data_pkey PRIMARY KEY (id, timestamp),
+    CONSTRAINT market_data_symbol_check CHECK (length(symbol) > 0),
+    CONSTRAINT market_data_price_check CHECK (price > 0),
+    CONSTRAINT market_data_volume_check CHECK (volume >= 0)
+) PARTITION BY RANGE (timestamp);
+ALTER SEQUENCE market_data_id_seq OWNED BY market_data.id;
+
+CREATE TABLE orders (
+    id BIGINT NOT NULL DEFAULT nextval('orders_id_seq'),
+    order_id VARCHAR(100) NOT NULL,
+    symbol VARCHAR(20) NOT NULL,
+    order_type VARCHAR(20) NOT NULL,
+    side VARCHAR(10) NOT NULL,
+    quantity DECIMAL(20,8) NOT NULL,
+    price DECIMAL(20,8),
+    status VARCHAR(20) NOT NULL,
+    signal_id BIGINT REFERENCES trading_signals(id),
+    filled_quantity DECIMAL(20,8) DEFAULT 0,
+    filled_price DECIMAL(20,8),
+    error_message TEXT,
+    timestamp TIMESTAMPTZ NOT NULL,
+    updated_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP,
+    created_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP,
+
+    CONSTRAINT orders_pkey PRIMARY KEY (id, timestamp),
+    CONSTRAINT orders_order_id_unique UNIQUE (order_id, timestamp),
+    CONSTRAINT orders_symbol_check CHECK (length(symbol) > 0),
+    CONSTRAINT orders_order_type_check CHECK (order_type IN ('MARKET', 'LIMIT')),
+    CONSTRAINT orders_side_check CHECK (side IN ('BUY', 'SELL')),
+    CONSTRAINT orders_quantity_check CHECK (quantity > 0),
+    CONSTRAINT orders_price_check CHECK (price IS NULL OR price > 0),
+    CONSTRAINT orders_status_check CHECK (status IN ('PENDING', 'FILLED', 'CANCELLED', 'REJECTED')),
+    CONSTRAINT orders_filled_quantity_check CHECK (filled_quantity >= 0)
+) PARTITION BY RANGE (timestamp);
+ALTER SEQUENCE orders_id_seq OWNED BY orders.id;
+
+CREATE TABLE trades (
+    id BIGINT NOT NULL DEFAULT nextval('trades_id_seq'),
+    trade_id VARCHAR(100) NOT NULL,
+    order_id BIGINT,
+    symbol VARCHAR(20) NOT NULL,
+    side VARCHAR(10) NOT NULL,
+    quantity DECIMAL(20,8) NOT NULL,
+    price DECIMAL(20,8) NOT NULL,
+    commission DECIMAL(20,8),
+    commission_asset VARCHAR(20),
+    timestamp TIMESTAMPTZ NOT NULL,
+    created_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP,
+
+    CONSTRAINT trades_pkey PRIMARY KEY (id, timestamp),
+    CONSTRAINT trades_trade_id_unique UNIQUE (trade_id, timestamp),
+    CONSTRAINT trades_symbol_check CHECK (length(symbol) > 0),
+    CONSTRAINT trades_side_check CHECK (side IN ('BUY', 'SELL')),
+    CONSTRAINT trades_quantity_check CHECK (quantity > 0),
+    CONSTRAINT trades_price_check CHECK (price > 0),
+    CONSTRAINT trades_commission_check CHECK (commission IS NULL OR commission >= 0),
+    CONSTRAINT trades_commission_asset_check CHECK (
+        (commission IS NULL AND commission_asset IS NULL) OR
+        (commission IS NOT NULL AND commission_asset IS NOT NULL)
+    )
+) PARTITION BY RANGE (timestamp);
+ALTER SEQUENCE trades_id_seq OWNED BY trades.id;
+
+-- 4. 인덱스 (부모에 만들면 현재/이후 파티션 모두에 생성)
+CREATE INDEX idx_market_data_symbol_timestamp ON market_data(symbol, timestamp);
+CREATE INDEX idx_market_data_created_at ON market_data(created_at);
+CREATE INDEX idx_market_data_timestamp_id ON market_data(timestamp, id);
+
+CREATE INDEX idx_orders_symbol_timestamp ON orders(symbol, timestamp);
+CREATE INDEX idx_orders_status ON orders(status);
+CREATE INDEX idx_orders_created_at ON orders(created_at);
+CREATE INDEX idx_orders_timestamp_id ON orders(timestamp, id);
+-- 미체결 주문 조회(findPendingOrders)가 파티션마다 작은 부분 인덱스만 확인하도록
+CREATE INDEX idx_orders_pending_timestamp ON orders(timestamp) WHERE status = 'PENDING';
+
+CREATE INDEX idx_trades_symbol_timestamp ON trades(symbol, timestamp);
+CREATE INDEX idx_trades_order_id ON trades(order_id);
+CREATE INDEX idx_trades_created_at ON trades(created_at);
+CREATE INDEX idx_trades_timestamp_id ON trades(timestamp, id);
+
+-- 5. 기존 행이 걸친 구간 + 앞으로 쓸 구간 파티션 생성 후 데이터 이동
+SELECT create_time_partitions('market_data', 'day',
+    COALESCE((SELECT MIN(timestamp) FROM market_data_legacy), now()),
+    GREATEST(COALESCE((SELECT MAX(timestamp) FROM market_data_legacy), now()), now() + INTERVAL '7 days'));
+SELECT create_time_partitions('orders', 'month',
+    COALESCE((SELECT MIN(timestamp) FROM orders_legacy), now()),
+    GREATEST(COALESCE((SELECT MAX(timestamp) FROM orders_legacy), now()), now() + INTERVAL '2 months'));
+SELECT create_time_partitions('trades', 'month',
+    COALESCE((SELECT MIN(timestamp) FROM trades_legacy), now()),
+    GREATEST(COALESCE((SELECT MAX(timestamp) FROM trades_legacy), now()), now() + INTERVAL '2 months'));
+
+INSERT INTO market_data (id, symbol, price, volume, timestamp, source, created_at)
+SELECT id, symbol, price, volume, timestamp, source, created_at FROM market_data_legacy;
+
+INSERT INTO orders (id, order_id, symbol, order_type, side, quantity, price, status, signal_id,
+                    filled_quantity, filled_price, error_message, timestamp, updated_at, created_at)
+SELECT id, order_id, symbol, order_type, side, quantity, price, status, signal_id,
+       filled_quantity, filled_price, error_message, timestamp, updated_at, created_at
+FROM orders_legacy;
+
+INSERT INTO trades (id, trade_id, order_id, symbol, side, quantity, price, commission,
+                    commission_asset, timestamp, created_at)
+SELECT id, trade_id, order_id, symbol, side, quantity, price, commission,
+       commission_asset, timestamp, created_at
+FROM trades_legacy;
+
+DROP TABLE trades_legacy;
+DROP TABLE orders_legacy;
+DROP TABLE market_data_legacy;
+
+ANALYZE market_data;
+ANALYZE orders;
+ANALYZE trades;
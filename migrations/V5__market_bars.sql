@@ -0,0 +1,29 @@
+-- 다중 해상도 OHLCV 봉 (repositories::CandleAggregator가 틱에서 증분 집계해 배치 upsert)
+-- - 해상도별 LIST 파티션: 1s 봉만 따로 정리/보존 정책을 둘 수 있도록 분리
+-- - 같은 봉이 여러 번(부분 봉, 늦은 틱, 재시작 전후) 기록되면 병합:
+--   high/low는 최대/최소, volume/tick_count는 합, open/close는 first/last_tick_at이 더 이른/늦은 쪽
+CREATE TABLE market_bars (
+    symbol VARCHAR(20) NOT NULL,
+    resolution VARCHAR(3) NOT NULL,
+    open_time TIMESTAMPTZ NOT NULL,
+    open DECIMAL(20,8) NOT NULL,
+    high DECIMAL(20,8) NOT NULL,
+    low DECIMAL(20,8) NOT NULL,
+    close DECIMAL(20,8) NOT NULL,
+    volume DECIMAL(20,8) NOT NULL,
+    tick_count BIGINT NOT NULL,
+    first_tick_at TIMESTAMPTZ NOT NULL,
+    last_tick_at TIMESTAMPTZ NOT NULL,
+    updated_at TIMESTAMPTZ NOT NULL DEFAULT CURRENT_TIMESTAMP,
+
+    CONSTRAINT market_bars_pkey PRIMARY KEY (resolution, symbol, open_time),
+    CONSTRAINT market_bars_resolution_check CHECK (resolution IN ('1s', '1m', '5m', '1h', '1d')),
+    CONSTRAINT market_bars_price_check CHECK (low > 0 AND high >= low),
+    CONSTRAINT market_bars_volume_check CHECK (volume >= 0 AND tick_count > 0)
+) PARTITION BY LIST (resolution);
+
+CREATE TABLE market_bars_1s PARTITION OF market_bars FOR VALUES IN ('1s');
+CREATE TABLE market_bars_1m PARTITION OF market_bars FOR VALUES IN ('1m');
+CREATE TABLE market_bars_5m PARTITION OF market_bars FOR VALUES IN ('5m');
+CREATE TABLE market_bars_1h PARTITION OF market_bars FOR VALUES IN ('1h');
+CREATE TABLE market_bars_1d PARTITION OF market_bars FOR VALUES IN ('1d');
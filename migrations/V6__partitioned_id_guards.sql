@@ -0,0 +1,70 @@
+-- 파티션 테이블의 거래소 번호 전역 유일성 보장 (orders.order_id, trades.trade_id)
+-- - V4 이후 유니크 제약은 (order_id, timestamp) / (trade_id, timestamp)라 같은 번호가 다른 timestamp로 중복 가능
+--   (파티션 키가 없는 전역 유니크 인덱스는 파티션 테이블에 만들 수 없음)
+-- - 파티션되지 않은 조회 테이블을 트리거로 함께 유지: 번호가 이미 있으면 INSERT/UPDATE가 unique_violation으로 실패
+-- - 조회 테이블의 timestamp로 번호 조회를 해당 파티션 하나로 좁힘 (OrderMapper::findByOrderIds)
+-- - 보존 기간이 지나 DETACH된 파티션의 행은 트리거를 거치지 않으므로 번호는 계속 예약된 채로 남음
+--   (거래소 번호는 재사용되지 않으므로 의도한 동작, 행 하나가 작아 증가량은 무시할 수준)
+
+CREATE TABLE order_ids (
+    order_id VARCHAR(100) PRIMARY KEY,
+    id BIGINT NOT NULL,
+    timestamp TIMESTAMPTZ NOT NULL
+);
+
+CREATE TABLE trade_ids (
+    trade_id VARCHAR(100) PRIMARY KEY,
+    id BIGINT NOT NULL,
+    timestamp TIMESTAMPTZ NOT NULL
+);
+
+-- 1. 기존 행으로 채움 (중복이 있으면 여기서 실패하므로 마이그레이션 전에 정리 필요)
+INSERT INTO order_ids (order_id, id, timestamp) SELECT order_id, id, timestamp FROM orders;
+INSERT INTO trade_ids (trade_id, id, timestamp) SELECT trade_id, id, timestamp FROM trades;
+
+-- 2. 유지 트리거 (부모에 만들면 현재/이후 파티션 모두에 적용, COPY에도 실행됨)
+CREATE OR REPLACE FUNCTION maintain_order_ids() RETURNS TRIGGER AS $$
+BEGIN
+    IF TG_OP IN ('UPDATE', 'DELETE') THEN
+        DELETE FROM order_ids WHERE order_id = OLD.order_id AND id = OLD.id;
+    END IF;
+    IF TG_OP IN ('INSERT', 'UPDATE') THEN
+        INSERT INTO order_ids (order_id, id, timestamp) VALUES (NEW.order_id, NEW.id, NEW.timestamp);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+CREATE OR REPLACE FUNCTION maintain_trade_ids() RETURNS TRIGGER AS $$
+BEGIN
+    IF TG_OP IN ('UPDATE', 'DELETE') THEN
+        DELETE FROM trade_ids WHERE trade_id = OLD.trade_id AND id = OLD.id;
+    END IF;
+    IF TG_OP IN ('INSERT', 'UPDATE') THEN
+        INSERT INTO trade_ids (trade_id, id, timestamp) VALUES (NEW.trade_id, NEW.id, NEW.timestamp);
+    END IF;
+    RETURN NULL;
+END;
+$$ LANGUAGE plpgsql;
+
+-- 상태/체결 갱신처럼 번호와 timestamp가 그대로인 UPDATE에는 실행하지 않음
+CREATE TRIGGER orders_order_ids_insert_delete
+    AFTER INSERT OR DELETE ON orders
+    FOR EACH ROW EXECUTE FUNCTION maintain_order_ids();
+CREATE TRIGGER orders_order_ids_update
+    AFTER UPDATE OF order_id, timestamp ON orders
+    FOR EACH ROW
+    WHEN (OLD.order_id IS DISTINCT FROM NEW.order_id OR OLD.timestamp IS DISTINCT FROM NEW.timestamp)
+    EXECUTE FUNCTION maintain_order_ids();
+
+CREATE TRIGGER trades_trade_ids_insert_delete
+    AFTER INSERT OR DELETE ON trades
+    FOR EACH ROW EXECUTE FUNCTION maintain_trade_ids();
+CREATE TRIGGER trades_trade_ids_update
+    AFTER UPDATE OF trade_id, timestamp ON trades
+    FOR EACH ROW
+    WHEN (OLD.trade_id IS DISTINCT FROM NEW.trade_id OR OLD.timestamp IS DISTINCT FROM NEW.timestamp)
+    EXECUTE FUNCTION maintain_trade_ids();
+
+ANALYZE order_ids;
+ANALYZE trade_ids;
@@ -0,0 +1,243 @@
+#include "database/BinaryCopyWriter.h"
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+namespace database {
+
+    namespace {
+
+        // "PGCOPY\n\377\r\n\0" + flags(0) + header extension length(0)
+        constexpr uint8_t COPY_SIGNATURE[] = {'P', 'G', 'C', 'O', 'P', 'Y', '\n', 0xFF, '\r', '\n', 0x00};
+
+        // PostgreSQL epoch(2000-01-01)과 Unix epoch의 차이 (마이크로초)
+        constexpr int64_t POSTGRES_EPOCH_OFFSET_MICROS = 946684800LL * 1000000;
+
+        constexpr uint16_t NUMERIC_POS = 0x0000;
+        constexpr uint16_t NUMERIC_NEG = 0x4000;
+        constexpr uint16_t NUMERIC_NAN = 0xC000;
+
+        void append16(std::vector<uint8_t>& out, uint16_t value) {
+            out.push_back(static_cast<uint8_t>(value >> 8));
+            out.push_back(static_cast<uint8_t>(value));
+        }
+
+    } // namespace
+
+    BinaryCopyWriter::BinaryCopyWriter(PgConnection& connection, const std::string& copySql)
+        : connection_(connection) {
+        PGresult* result = PQexec(connection_.raw(), copySql.c_str());
+        const auto status = PQresultStatus(result);
+        PQclear(result);
+        if (status != PGRES_COPY_IN) {
+            throw std::runtime_error("Failed to start COPY: " + connection_.lastError());
+        }
+        active_ = true;
+
+        buffer_.reserve(FLUSH_THRESHOLD + 1024);
+        buffer_.insert(buffer_.end(), std::begin(COPY_SIGNATURE), std::end(COPY_SIGNATURE));
+        put32(0);   // flags
+        put32(0);   // header extension length
+    }
+
+    BinaryCopyWriter::~BinaryCopyWriter() {
+        if (active_) {
+            PQputCopyEnd(connection_.raw(), "aborted by client");
+            while (PGresult* result = PQgetResult(connection_.raw())) {
+                PQclear(result);
+            }
+        }
+    }
+
+    void BinaryCopyWriter::beginRow(int16_t fieldCount) {
+        flushIfNeeded();
+        put16(static_cast<uint16_t>(fieldCount));
+        ++rows_;
+    }
+
+    void BinaryCopyWriter::addNull() {
+        put32(static_cast<uint32_t>(-1));
+    }
+
+    void BinaryCopyWriter::addInt64(int64_t value) {
+        put32(8);
+        put64(static_cast<uint64_t>(value));
+    }
+
+    void BinaryCopyWriter::addFloat8(double value) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        put32(8);
+        put64(bits);
+    }
+
+    void BinaryCopyWriter::addText(std::string_view value) {
+        put32(static_cast<uint32_t>(value.size()));
+        buffer_.insert(buffer_.end(), value.begin(), value.end());
+    }
+
+    void BinaryCopyWriter::addNumeric(double value, int scale) {
+        if (std::isnan(value)) {
+            put32(8);
+            put16(0);
+            put16(0);
+            put16(NUMERIC_NAN);
+            put16(0);
+            return;
+        }
+        if (std::isinf(value)) {
+            throw std::invalid_argument("Infinite value cannot be stored as numeric");
+        }
+
+        char text[64];
+        auto [end, ec] = std::to_chars(text, text + sizeof(text), value, std::chars_format::fixed, scale);
+        if (ec != std::errc()) {
+            throw std::invalid_argument("Numeric value out of range");
+        }
+
+        // 길이 자리를 먼저 확보한 뒤 인코딩 결과 크기로 채움
+        const size_t lengthPos = buffer_.size();
+        put32(0);
+        encodeNumeric(std::string_view(text, static_cast<size_t>(end - text)), buffer_);
+        const uint32_t length = static_cast<uint32_t>(buffer_.size() - lengthPos - 4);
+        buffer_[lengthPos] = static_cast<uint8_t>(length >> 24);
+        buffer_[lengthPos + 1] = static_cast<uint8_t>(length >> 16);
+        buffer_[lengthPos + 2] = static_cast<uint8_t>(length >> 8);
+        buffer_[lengthPos + 3] = static_cast<uint8_t>(length);
+    }
+
+    void BinaryCopyWriter::addTimestampMicros(int64_t epochMicros) {
+        put32(8);
+        put64(static_cast<uint64_t>(epochMicros - POSTGRES_EPOCH_OFFSET_MICROS));
+    }
+
+    size_t BinaryCopyWriter::finish() {
+        put16(static_cast<uint16_t>(-1));   // 트레일러
+        flush();
+
+        active_ = false;
+        if (PQputCopyEnd(connection_.raw(), nullptr) != 1) {
+            throw std::runtime_error("Failed to end COPY: " + connection_.lastError());
+        }
+
+        std::string error;
+        while (PGresult* result = PQgetResult(connection_.raw())) {
+            if (PQresultStatus(result) != PGRES_COMMAND_OK && error.empty()) {
+                error = PQresultErrorMessage(result);
+            }
+            PQclear(result);
+        }
+        if (!error.empty()) {
+            throw std::runtime_error("COPY failed: " + error);
+        }
+        return rows_;
+    }
+
+    // numeric 바이너리 형식: ndigits, weight, sign, dscale (int16) + base-10000 자릿수 배열
+    // 값 = sum(digit[i] * 10000^(weight - i))
+    void BinaryCopyWriter::encodeNumeric(std::string_view decimal, std::vector<uint8_t>& out) {
+        uint16_t sign = NUMERIC_POS;
+        if (!decimal.empty() && decimal.front() == '-') {
+            sign = NUMERIC_NEG;
+            decimal.remove_prefix(1);
+        }
+
+        const size_t dot = decimal.find('.');
+        std::string_view integerPart = decimal.substr(0, dot);
+        std::string_view fractionPart = dot == std::string_view::npos ? std::string_view() : decimal.substr(dot + 1);
+
+        while (!integerPart.empty() && integerPart.front() == '0') {
+            integerPart.remove_prefix(1);
+        }
+        const uint16_t dscale = static_cast<uint16_t>(fractionPart.size());
+
+        // 정수부는 앞쪽을, 소수부는 뒤쪽을 0으로 채워 4자리 그룹으로 맞춤
+        const size_t integerGroups = (integerPart.size() + 3) / 4;
+        const size_t fractionGroups = (fractionPart.size() + 3) / 4;
+        std::vector<uint16_t> digits;
+        digits.reserve(integerGroups + fractionGroups);
+
+        const size_t integerPad = integerGroups * 4 - integerPart.size();
+        for (size_t group = 0; group < integerGroups; ++group) {
+            uint16_t digit = 0;
+            for (size_t k = 0; k < 4; ++k) {
+                const size_t pos = group * 4 + k;
+                const int d = pos < integerPad ? 0 : integerPart[pos - integerPad] - '0';
+                digit = static_cast<uint16_t>(digit * 10 + d);
+            }
+            digits.push_back(digit);
+        }
+        for (size_t group = 0; group < fractionGroups; ++group) {
+            uint16_t digit = 0;
+            for (size_t k = 0; k < 4; ++k) {
+                const size_t pos = group * 4 + k;
+                const int d = pos < fractionPart.size() ? fractionPart[pos] - '0' : 0;
+                digit = static_cast<uint16_t>(digit * 10 + d);
+            }
+            digits.push_back(digit);
+        }
+
+        int16_t weight = static_cast<int16_t>(integerGroups) - 1;
+
+        // 앞쪽 0 그룹 제거 (소수부만 있는 값)
+        size_t first = 0;
+        while (first < digits.size() && digits[first] == 0) {
+            ++first;
+            --weight;
+        }
+        size_t last = digits.size();
+        while (last > first && digits[last - 1] == 0) {
+            --last;
+        }
+
+        if (first == last) {
+            // 0은 자릿수 없이 표현
+            append16(out, 0);
+            append16(out, 0);
+            append16(out, NUMERIC_POS);
+            append16(out, dscale);
+            return;
+        }
+
+        append16(out, static_cast<uint16_t>(last - first));
+        append16(out, static_cast<uint16_t>(weight));
+        append16(out, sign);
+        append16(out, dscale);
+        for (size_t i = first; i < last; ++i) {
+            append16(out, digits[i]);
+        }
+    }
+
+    void BinaryCopyWriter::put16(uint16_t value) {
+        append16(buffer_, value);
+    }
+
+    void BinaryCopyWriter::put32(uint32_t value) {
+        put16(static_cast<uint16_t>(value >> 16));
+        put16(static_cast<uint16_t>(value));
+    }
+
+    void BinaryCopyWriter::put64(uint64_t value) {
+        put32(static_cast<uint32_t>(value >> 32));
+        put32(static_cast<uint32_t>(value));
+    }
+
+    void BinaryCopyWriter::flushIfNeeded() {
+        if (buffer_.size() >= FLUSH_THRESHOLD) {
+            flush();
+        }
+    }
+
+    void BinaryCopyWriter::flush() {
+        if (buffer_.empty()) {
+            return;
+        }
+        if (PQputCopyData(connection_.raw(), reinterpret_cast<const char*>(buffer_.data()),
+                          static_cast<int>(buffer_.size())) != 1) {
+            throw std::runtime_error("Failed to send COPY data: " + connection_.lastError());
+        }
+        buffer_.clear();
+    }
+
+} // namespace database
@@ -0,0 +1,191 @@
+#include "database/DbRouter.h"
+#include "utils/Logger.h"
+#include <stdexcept>
+
+namespace database {
+
+    namespace {
+
+        // 재생할 WAL이 없으면(수신 LSN == 재생 LSN) 마지막 재생 시각이 오래되어도 지연 0
+        // primary에 연결된 경우(복구 모드 아님)도 0
+        constexpr const char* LAG_SQL =
+            "SELECT CASE "
+            "WHEN NOT pg_is_in_recovery() THEN 0 "
+            "WHEN pg_last_wal_receive_lsn() = pg_last_wal_replay_lsn() THEN 0 "
+            "ELSE COALESCE(EXTRACT(EPOCH FROM now() - pg_last_xact_replay_timestamp()) * 1000, 0) "
+            "END::bigint AS lag_ms";
+
+        // 설정 JSON이 아니라 drogon에 실제로 등록된 클라이언트인지 확인
+        // (설정에만 있고 앱에 적용되지 않은 클라이언트로 라우팅하지 않도록)
+        bool isClientConfigured(const std::string& name) {
+            try {
+                return drogon::app().getDbClient(name) != nullptr;
+            } catch (const std::exception&) {
+                return false;
+            }
+        }
+
+        constexpr const char* REQUEST_STATE_KEY = "db.read_your_writes";
+
+    } // namespace
+
+    thread_local DbRouter::ReadYourWritesPtr DbRouter::currentState_;
+
+    DbRouter::ReadYourWritesScope::ReadYourWritesScope()
+        : ReadYourWritesScope(currentState_ ? currentState_ : std::make_shared<ReadYourWrites>()) {
+    }
+
+    DbRouter::ReadYourWritesScope::ReadYourWritesScope(ReadYourWritesPtr state)
+        : state_(std::move(state)), previous_(currentState_) {
+        currentState_ = state_;
+    }
+
+    DbRouter::ReadYourWritesScope::~ReadYourWritesScope() {
+        // 중첩 범위가 다른 상태를 썼으면 바깥 상태도 쓰기 상태로 표시
+        if (previous_ && previous_ != state_ && hasWritten()) {
+            previous_->wrote.store(true, std::memory_order_release);
+        }
+        currentState_ = std::move(previous_);
+    }
+
+    DbRouter& DbRouter::getInstance() {
+        static DbRouter instance;
+        return instance;
+    }
+
+    DbRouter::~DbRouter() {
+        stop();
+    }
+
+    void DbRouter::start(const Options& options) {
+        if (options.checkInterval.count() <= 0) {
+            throw std::invalid_argument("Replica lag check interval must be positive");
+        }
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (running_.load(std::memory_order_acquire)) {
+            throw std::logic_error("DB router is already running");
+        }
+        if (!isClientConfigured(options.replicaClientName)) {
+            TRADING_LOG_INFO("Read replica '{}' not configured; all queries use the primary",
+                             options.replicaClientName);
+            return;
+        }
+
+        options_ = options;
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stopRequested_ = false;
+        }
+        running_.store(true, std::memory_order_release);
+        monitor_ = std::thread([this] { monitor(); });
+
+        TRADING_LOG_INFO("Read replica routing started (client={}, maxLag={}ms, interval={}ms)",
+                         options_.replicaClientName, options_.maxLag.count(), options_.checkInterval.count());
+    }
+
+    void DbRouter::stop() {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+        replicaHealthy_.store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stopRequested_ = true;
+        }
+        stopCv_.notify_one();
+        if (monitor_.joinable()) {
+            monitor_.join();
+        }
+        running_.store(false, std::memory_order_release);
+    }
+
+    drogon::orm::DbClientPtr DbRouter::writer() {
+        if (currentState_) {
+            currentState_->wrote.store(true, std::memory_order_release);
+        }
+        return primary();
+    }
+
+    drogon::orm::DbClientPtr DbRouter::reader() {
+        if (currentState_ && currentState_->wrote.load(std::memory_order_acquire)) {
+            pinnedReads_.fetch_add(1, std::memory_order_relaxed);
+            primaryReads_.fetch_add(1, std::memory_order_relaxed);
+            return primary();
+        }
+        if (!replicaHealthy_.load(std::memory_order_acquire)) {
+            primaryReads_.fetch_add(1, std::memory_order_relaxed);
+            return primary();
+        }
+        replicaReads_.fetch_add(1, std::memory_order_relaxed);
+        return drogon::app().getDbClient(options_.replicaClientName);
+    }
+
+    DbRouter::ReadYourWritesPtr DbRouter::requestState(const drogon::HttpRequestPtr& req) {
+        const auto& attributes = req->attributes();
+        if (!attributes->find(REQUEST_STATE_KEY)) {
+            attributes->insert(REQUEST_STATE_KEY, std::make_shared<ReadYourWrites>());
+        }
+        return attributes->get<ReadYourWritesPtr>(REQUEST_STATE_KEY);
+    }
+
+    void DbRouter::installRequestScope() {
+        // 핸들러는 pre-handling advice와 같은 스레드에서 시작하므로 동기 구간 전체가 요청 상태를 공유
+        // 응답 후 같은 요청의 상태일 때만 해제 (그 사이 같은 스레드가 다른 요청을 시작했으면 건드리지 않음)
+        // 코루틴 핸들러가 다른 스레드에서 응답하면 시작 스레드에 상태가 남지만 다음 요청이 덮어쓰고,
+        // 그 사이의 읽기는 primary로 갈 뿐이라 최신성은 깨지지 않음
+        drogon::app().registerPreHandlingAdvice([](const drogon::HttpRequestPtr& req) {
+            currentState_ = requestState(req);
+        });
+        drogon::app().registerPostHandlingAdvice(
+            [](const drogon::HttpRequestPtr& req, const drogon::HttpResponsePtr&) {
+                if (currentState_ && currentState_ == req->attributes()->get<ReadYourWritesPtr>(REQUEST_STATE_KEY)) {
+                    currentState_.reset();
+                }
+            });
+    }
+
+    DbRouter::Stats DbRouter::getStats() const {
+        return Stats{
+            replicaReads_.load(std::memory_order_relaxed),
+            primaryReads_.load(std::memory_order_relaxed),
+            pinnedReads_.load(std::memory_order_relaxed),
+            lastLagMillis_.load(std::memory_order_relaxed),
+            replicaHealthy_.load(std::memory_order_relaxed)
+        };
+    }
+
+    void DbRouter::monitor() {
+        std::unique_lock<std::mutex> lock(stopMutex_);
+        while (!stopRequested_) {
+            lock.unlock();
+            const int64_t lag = measureLag();
+            const bool healthy = lag >= 0 && lag <= options_.maxLag.count();
+            const bool wasHealthy = replicaHealthy_.exchange(healthy, std::memory_order_acq_rel);
+            lastLagMillis_.store(lag, std::memory_order_relaxed);
+
+            if (wasHealthy != healthy) {
+                if (healthy) {
+                    TRADING_LOG_INFO("Read replica caught up (lag={}ms); routing reads to replica", lag);
+                } else {
+                    TRADING_LOG_WARN("Read replica lag {}ms exceeds {}ms or is unavailable; routing reads to primary",
+                                     lag, options_.maxLag.count());
+                }
+            }
+
+            lock.lock();
+            stopCv_.wait_for(lock, options_.checkInterval, [this] { return stopRequested_; });
+        }
+    }
+
+    int64_t DbRouter::measureLag() {
+        try {
+            auto result = drogon::app().getDbClient(options_.replicaClientName)->execSqlSync(LAG_SQL);
+            return result[0]["lag_ms"].as<int64_t>();
+        } catch (const std::exception& e) {
+            TRADING_LOG_DEBUG("Replica lag check failed: {}", e.what());
+            return -1;
+        }
+    }
+
+} // namespace database
@@ -0,0 +1,32 @@
+#include "database/GroupCommitter.h"
+#include "database/DbRouter.h"
+#include <future>
+
+namespace database {
+
+    GroupCommitter& GroupCommitter::getInstance() {
+        // 라우터 싱글톤을 먼저 생성해 종료 시 이 객체보다 늦게 파괴되도록 보장 (소멸자에서 커밋)
+        DbRouter::getInstance();
+        static GroupCommitter instance;
+        return instance;
+    }
+
+    GroupCommitter::GroupCommitter()
+        : BasicGroupCommitter([](const std::function<void(Transaction&)>& body) {
+              std::promise<bool> commitResult;
+              auto commitFuture = commitResult.get_future();
+              {
+                  // 마지막 참조가 해제될 때 COMMIT, 결과는 콜백으로 전달됨
+                  auto transaction = DbRouter::primary()->newTransaction(
+                      [&commitResult](bool success) { commitResult.set_value(success); });
+                  try {
+                      body(*transaction);
+                  } catch (...) {
+                      transaction->rollback();
+                      throw;
+                  }
+              }
+              return commitFuture.get();
+          }) {}
+
+} // namespace database
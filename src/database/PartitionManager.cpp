@@ -0,0 +1,255 @@
+#include "database/PartitionManager.h"
+#include "database/DbRouter.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace database {
+
+    namespace {
+
+        using namespace std::chrono;
+
+        constexpr const char* LIST_SQL =
+            "SELECT c.relname::text AS name, i.inhdetachpending AS pending "
+            "FROM pg_inherits i JOIN pg_class c ON c.oid = i.inhrelid "
+            "WHERE i.inhparent = to_regclass($1)";
+
+        constexpr const char* ENSURE_SQL =
+            "SELECT ensure_time_partition($1, $2, $3::timestamptz, $4::timestamptz)";
+
+        std::string quoteIdentifier(const std::string& name) {
+            std::string quoted = "\"";
+            for (char c : name) {
+                if (c == '"') {
+                    quoted += '"';
+                }
+                quoted += c;
+            }
+            quoted += '"';
+            return quoted;
+        }
+
+        std::string toTimestampLiteral(sys_days day) {
+            const year_month_day ymd{day};
+            char buffer[32];
+            std::snprintf(buffer, sizeof(buffer), "%04d-%02u-%02u 00:00:00+00",
+                          static_cast<int>(ymd.year()), static_cast<unsigned>(ymd.month()),
+                          static_cast<unsigned>(ymd.day()));
+            return buffer;
+        }
+
+    } // namespace
+
+    std::vector<PartitionManager::Policy> PartitionManager::defaultPolicies() {
+        using Config = common::PartitionConfig;
+        return {
+            {"market_data", Granularity::DAILY, Config::MARKET_DATA_PREMAKE_DAYS, Config::MARKET_DATA_RETAIN_DAYS},
+            {"orders", Granularity::MONTHLY, Config::ORDER_PREMAKE_MONTHS, Config::ORDER_RETAIN_MONTHS},
+            {"trades", Granularity::MONTHLY, Config::TRADE_PREMAKE_MONTHS, Config::TRADE_RETAIN_MONTHS},
+        };
+    }
+
+    sys_days PartitionManager::periodStart(Granularity granularity, sys_days day) {
+        if (granularity == Granularity::DAILY) {
+            return day;
+        }
+        const year_month_day ymd{day};
+        return sys_days{ymd.year() / ymd.month() / 1};
+    }
+
+    sys_days PartitionManager::advance(Granularity granularity, sys_days start, int periods) {
+        if (granularity == Granularity::DAILY) {
+            return start + days{periods};
+        }
+        const year_month_day ymd{periodStart(granularity, start)};
+        return sys_days{ymd + months{periods}};
+    }
+
+    std::string PartitionManager::partitionName(const Policy& policy, sys_days start) {
+        const year_month_day ymd{start};
+        char suffix[16];
+        if (policy.granularity == Granularity::DAILY) {
+            std::snprintf(suffix, sizeof(suffix), "%04d%02u%02u", static_cast<int>(ymd.year()),
+                          static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()));
+        } else {
+            std::snprintf(suffix, sizeof(suffix), "%04d%02u", static_cast<int>(ymd.year()),
+                          static_cast<unsigned>(ymd.month()));
+        }
+        return policy.table + "_p" + suffix;
+    }
+
+    std::optional<sys_days> PartitionManager::parsePartitionStart(const Policy& policy, const std::string& name) {
+        const std::string prefix = policy.table + "_p";
+        const size_t digits = policy.granularity == Granularity::DAILY ? 8 : 6;
+        if (name.size() != prefix.size() + digits || name.compare(0, prefix.size(), prefix) != 0) {
+            return std::nullopt;
+        }
+        const std::string suffix = name.substr(prefix.size());
+        if (!std::all_of(suffix.begin(), suffix.end(), [](unsigned char c) { return std::isdigit(c); })) {
+            return std::nullopt;
+        }
+
+        const int yearValue = std::stoi(suffix.substr(0, 4));
+        const unsigned monthValue = static_cast<unsigned>(std::stoi(suffix.substr(4, 2)));
+        const unsigned dayValue = digits == 8 ? static_cast<unsigned>(std::stoi(suffix.substr(6, 2))) : 1;
+        const year_month_day ymd{year{yearValue}, month{monthValue}, day{dayValue}};
+        if (!ymd.ok()) {
+            return std::nullopt;
+        }
+        return sys_days{ymd};
+    }
+
+    PartitionManager::Plan PartitionManager::plan(
+        const Policy& policy,
+        sys_days today,
+        const std::vector<std::string>& existing
+    ) {
+        Plan result;
+        const sys_days current = periodStart(policy.granularity, today);
+        const std::unordered_set<std::string> present(existing.begin(), existing.end());
+
+        for (size_t i = 0; i <= policy.premake; ++i) {
+            const sys_days start = advance(policy.granularity, current, static_cast<int>(i));
+            auto name = partitionName(policy, start);
+            if (!present.count(name)) {
+                result.create.push_back(Period{std::move(name), start, advance(policy.granularity, start, 1)});
+            }
+        }
+
+        if (policy.retain > 0) {
+            const sys_days cutoff = advance(policy.granularity, current, -static_cast<int>(policy.retain - 1));
+            std::vector<std::pair<sys_days, std::string>> expired;
+            for (const auto& name : existing) {
+                const auto start = parsePartitionStart(policy, name);
+                if (start && *start < cutoff) {
+                    expired.emplace_back(*start, name);
+                }
+            }
+            std::sort(expired.begin(), expired.end());
+            for (auto& [start, name] : expired) {
+                result.detach.push_back(std::move(name));
+            }
+        }
+        return result;
+    }
+
+    PartitionManager& PartitionManager::getInstance() {
+        static PartitionManager instance;
+        return instance;
+    }
+
+    PartitionManager::~PartitionManager() {
+        stop();
+    }
+
+    void PartitionManager::start(const Options& options) {
+        if (options.interval.count() <= 0) {
+            throw std::invalid_argument("Partition maintenance interval must be positive");
+        }
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (running_.load(std::memory_order_acquire)) {
+            throw std::logic_error("Partition manager is already running");
+        }
+
+        options_ = options;
+        runOnce();
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stopRequested_ = false;
+        }
+        running_.store(true, std::memory_order_release);
+        worker_ = std::thread([this] { loop(); });
+
+        TRADING_LOG_INFO("Partition maintenance started ({} tables, interval={}ms)",
+                         options_.policies.size(), options_.interval.count());
+    }
+
+    void PartitionManager::stop() {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stopRequested_ = true;
+        }
+        stopCv_.notify_one();
+        if (worker_.joinable()) {
+            worker_.join();
+        }
+        running_.store(false, std::memory_order_release);
+    }
+
+    void PartitionManager::runOnce() {
+        std::lock_guard<std::mutex> run(runMutex_);
+        const auto today = floor<days>(system_clock::now());
+        for (const auto& policy : options_.policies) {
+            try {
+                maintain(policy, today, options_.dropDetached);
+            } catch (const std::exception& e) {
+                TRADING_LOG_ERROR("Partition maintenance for {} failed: {}", policy.table, e.what());
+            }
+        }
+    }
+
+    void PartitionManager::loop() {
+        std::unique_lock<std::mutex> lock(stopMutex_);
+        while (!stopCv_.wait_for(lock, options_.interval, [this] { return stopRequested_; })) {
+            lock.unlock();
+            runOnce();
+            lock.lock();
+        }
+    }
+
+    void PartitionManager::maintain(const Policy& policy, sys_days today, bool dropDetached) {
+        // DDL은 항상 primary에서
+        auto client = DbRouter::primary();
+        const auto table = quoteIdentifier(policy.table);
+
+        std::vector<std::string> existing;
+        const auto rows = client->execSqlSync(LIST_SQL, policy.table);
+        for (const auto& row : rows) {
+            auto name = row["name"].as<std::string>();
+            if (!row["pending"].as<bool>()) {
+                existing.push_back(std::move(name));
+                continue;
+            }
+            // 중단된 DETACH CONCURRENTLY 마무리
+            client->execSqlSync("ALTER TABLE " + table + " DETACH PARTITION " + quoteIdentifier(name) + " FINALIZE");
+            TRADING_LOG_INFO("Finalized pending detach of partition {}", name);
+            if (dropDetached) {
+                client->execSqlSync("DROP TABLE " + quoteIdentifier(name));
+            }
+        }
+
+        const auto work = plan(policy, today, existing);
+        for (const auto& period : work.create) {
+            try {
+                client->execSqlSync(ENSURE_SQL, policy.table, period.name,
+                                    toTimestampLiteral(period.from), toTimestampLiteral(period.to));
+                TRADING_LOG_INFO("Created partition {} [{}, {})", period.name,
+                                 toTimestampLiteral(period.from), toTimestampLiteral(period.to));
+            } catch (const std::exception& e) {
+                TRADING_LOG_ERROR("Failed to create partition {}: {}", period.name, e.what());
+            }
+        }
+
+        for (const auto& name : work.detach) {
+            try {
+                // 트랜잭션 밖에서만 실행 가능 (execSqlSync 단일 문장)
+                client->execSqlSync("ALTER TABLE " + table + " DETACH PARTITION " + quoteIdentifier(name) + " CONCURRENTLY");
+                if (dropDetached) {
+                    client->execSqlSync("DROP TABLE " + quoteIdentifier(name));
+                }
+                TRADING_LOG_INFO("Detached expired partition {}{}", name, dropDetached ? " (dropped)" : "");
+            } catch (const std::exception& e) {
+                TRADING_LOG_ERROR("Failed to detach partition {}: {}", name, e.what());
+            }
+        }
+    }
+
+} // namespace database
@@ -0,0 +1,65 @@
+#include "database/PgConnection.h"
+#include "utils/Config.h"
+#include <stdexcept>
+
+namespace database {
+
+    namespace {
+
+        // libpq 연결 문자열 값 이스케이프 ('...' 안의 \ 와 ')
+        std::string quote(const std::string& value) {
+            std::string quoted = "'";
+            for (char c : value) {
+                if (c == '\\' || c == '\'') {
+                    quoted += '\\';
+                }
+                quoted += c;
+            }
+            quoted += '\'';
+            return quoted;
+        }
+
+    } // namespace
+
+    std::string PgConnection::connectionStringFromConfig() {
+        const auto& config = utils::Config::getInstance();
+        return "host=" + quote(config.getDbHost()) +
+               " port=" + std::to_string(config.getDbPort()) +
+               " dbname=" + quote(config.getDbName()) +
+               " user=" + quote(config.getDbUser()) +
+               " password=" + quote(config.getDbPassword());
+    }
+
+    PgConnection::PgConnection(const std::string& connectionString)
+        : connectionString_(connectionString),
+          conn_(PQconnectdb(connectionString.c_str())) {
+        if (!conn_ || PQstatus(conn_.get()) != CONNECTION_OK) {
+            throw std::runtime_error("Failed to connect to PostgreSQL: " + lastError());
+        }
+    }
+
+    void PgConnection::exec(const std::string& sql) {
+        PGresult* result = PQexec(conn_.get(), sql.c_str());
+        const auto status = PQresultStatus(result);
+        PQclear(result);
+        if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK) {
+            throw std::runtime_error("PostgreSQL command failed: " + lastError());
+        }
+    }
+
+    bool PgConnection::ensureConnected() {
+        if (PQstatus(conn_.get()) == CONNECTION_OK) {
+            return true;
+        }
+        PQreset(conn_.get());
+        return PQstatus(conn_.get()) == CONNECTION_OK;
+    }
+
+    std::string PgConnection::lastError() const {
+        if (!conn_) {
+            return "out of memory";
+        }
+        return PQerrorMessage(conn_.get());
+    }
+
+} // namespace database
@@ -0,0 +1,272 @@
+#include "database/PipelineExecutor.h"
+#include <poll.h>
+#include <cerrno>
+#include <chrono>
+#include <cstdlib>
+#include <stdexcept>
+
+namespace database {
+
+    namespace {
+
+        // 파라미터 포인터 배열 (NULL은 nullptr)
+        std::vector<const char*> paramValues(const std::vector<std::optional<std::string>>& params) {
+            std::vector<const char*> values;
+            values.reserve(params.size());
+            for (const auto& param : params) {
+                values.push_back(param ? param->c_str() : nullptr);
+            }
+            return values;
+        }
+
+        std::string statementError(size_t index, const PGresult* result) {
+            return "statement " + std::to_string(index) + ": " + PQresultErrorMessage(result);
+        }
+
+#ifdef LIBPQ_HAS_PIPELINING
+        // 소켓이 읽기(또는 보낼 데이터가 남았으면 쓰기) 가능해질 때까지 대기
+        void waitSocket(PGconn* conn, bool wantWrite, std::chrono::steady_clock::time_point deadline) {
+            pollfd descriptor{};
+            descriptor.fd = PQsocket(conn);
+            descriptor.events = static_cast<short>(POLLIN | (wantWrite ? POLLOUT : 0));
+            for (;;) {
+                const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now()).count();
+                if (remaining <= 0) {
+                    throw std::runtime_error("Pipeline timed out waiting for results");
+                }
+                const int ready = poll(&descriptor, 1, static_cast<int>(remaining));
+                if (ready > 0) {
+                    return;
+                }
+                if (ready < 0 && errno != EINTR) {
+                    throw std::runtime_error("Pipeline socket wait failed");
+                }
+            }
+        }
+#endif
+
+    } // namespace
+
+    std::string PipelineResult::errorMessage() const {
+#ifdef LIBPQ_HAS_PIPELINING
+        if (PQresultStatus(result_.get()) == PGRES_PIPELINE_ABORTED) {
+            return "aborted by an earlier failed statement";
+        }
+#endif
+        return PQresultErrorMessage(result_.get());
+    }
+
+    size_t PipelineResult::affectedRows() const {
+        const char* tuples = PQcmdTuples(result_.get());
+        return tuples[0] == '\0' ? 0 : static_cast<size_t>(std::strtoull(tuples, nullptr, 10));
+    }
+
+    size_t PipelineResult::column(const char* name) const {
+        const int index = PQfnumber(result_.get(), name);
+        if (index < 0) {
+            throw std::out_of_range(std::string("Unknown result column: ") + name);
+        }
+        return static_cast<size_t>(index);
+    }
+
+    int64_t PipelineResult::readInt64(size_t row, size_t column) const {
+        if (isNull(row, column)) {
+            throw std::runtime_error("Not an integer: NULL");
+        }
+        const auto text = value(row, column);
+        int64_t parsed{};
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), parsed);
+        if (ec != std::errc() || ptr != text.data() + text.size()) {
+            throw std::runtime_error("Not an integer: " + std::string(text));
+        }
+        return parsed;
+    }
+
+    double PipelineResult::readDouble(size_t row, size_t column) const {
+        if (isNull(row, column)) {
+            throw std::runtime_error("Not a number: NULL");
+        }
+        const auto text = value(row, column);
+        double parsed{};
+        const auto [ptr, ec] = std::from_chars(text.data(), text.data() + text.size(), parsed);
+        if (ec == std::errc() && ptr == text.data() + text.size()) {
+            return parsed;
+        }
+        // NaN / Infinity 등 (값은 NUL 종료 문자열)
+        char* end = nullptr;
+        parsed = std::strtod(text.data(), &end);
+        if (text.empty() || end != text.data() + text.size()) {
+            throw std::runtime_error("Not a number: " + std::string(text));
+        }
+        return parsed;
+    }
+
+    PipelineExecutor& PipelineExecutor::getInstance() {
+        static PipelineExecutor instance;
+        return instance;
+    }
+
+    std::vector<PipelineResult> PipelineExecutor::execute(const Pipeline& pipeline) {
+        std::string error;
+        auto results = run(pipeline, false, error);
+        if (!error.empty()) {
+            throw std::runtime_error("Pipeline " + error);
+        }
+        return results;
+    }
+
+    std::vector<PipelineResult> PipelineExecutor::executeIndependent(const Pipeline& pipeline) {
+        std::string error;  // 문장 실패는 결과마다 확인
+        return run(pipeline, true, error);
+    }
+
+    std::vector<PipelineResult> PipelineExecutor::run(const Pipeline& pipeline, bool independent, std::string& error) {
+        if (pipeline.empty() || pipeline.size() > common::PipelineConfig::MAX_STATEMENTS) {
+            throw std::invalid_argument("Pipeline must contain between 1 and " +
+                                        std::to_string(common::PipelineConfig::MAX_STATEMENTS) + " statements");
+        }
+
+        auto connection = acquire();
+        auto results = pipeliningSupported()
+            ? runPipelined(*connection, pipeline, independent, error)
+            : runSequential(*connection, pipeline, independent, error);
+        // 전송 오류로 예외가 나면 여기까지 오지 않으므로 연결은 폐기됨
+        release(std::move(connection));
+        return results;
+    }
+
+    std::unique_ptr<PgConnection> PipelineExecutor::acquire() {
+        std::unique_ptr<PgConnection> connection;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!idle_.empty()) {
+                connection = std::move(idle_.back());
+                idle_.pop_back();
+            }
+        }
+        if (connection && connection->ensureConnected()) {
+            return connection;
+        }
+        return std::make_unique<PgConnection>(PgConnection::connectionStringFromConfig());
+    }
+
+    void PipelineExecutor::release(std::unique_ptr<PgConnection> connection) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (idle_.size() < common::PipelineConfig::MAX_IDLE_CONNECTIONS) {
+            idle_.push_back(std::move(connection));
+        }
+    }
+
+    std::vector<PipelineResult> PipelineExecutor::runPipelined(
+        PgConnection& connection,
+        const Pipeline& pipeline,
+        bool independent,
+        std::string& error
+    ) {
+#ifdef LIBPQ_HAS_PIPELINING
+        PGconn* conn = connection.raw();
+        // 비블로킹: 보낼 데이터가 송신 버퍼를 넘어도 결과를 읽으며 보내므로 교착 없음
+        if (PQsetnonblocking(conn, 1) != 0 || PQenterPipelineMode(conn) != 1) {
+            throw std::runtime_error("Failed to enter pipeline mode: " + connection.lastError());
+        }
+
+        for (const auto& statement : pipeline.statements_) {
+            const auto values = paramValues(statement.params);
+            if (PQsendQueryParams(conn, statement.sql.c_str(), static_cast<int>(values.size()),
+                                  nullptr, values.data(), nullptr, nullptr, 0) != 1) {
+                throw std::runtime_error("Failed to queue pipeline statement: " + connection.lastError());
+            }
+            // Sync마다 암묵적 트랜잭션이 끝나므로 문장별 Sync는 실패를 그 문장에 가둠
+            if (independent && PQpipelineSync(conn) != 1) {
+                throw std::runtime_error("Failed to send pipeline sync: " + connection.lastError());
+            }
+        }
+        if (!independent && PQpipelineSync(conn) != 1) {
+            throw std::runtime_error("Failed to send pipeline sync: " + connection.lastError());
+        }
+
+        // 결과 순서: 문장마다 (결과, nullptr), Sync마다 PGRES_PIPELINE_SYNC
+        // 같은 Sync 구간에서 실패한 문장 뒤의 문장은 PGRES_PIPELINE_ABORTED
+        std::vector<PipelineResult> results;
+        results.reserve(pipeline.size());
+        const auto deadline = std::chrono::steady_clock::now() +
+                              std::chrono::milliseconds(common::PipelineConfig::TIMEOUT_MS);
+        bool current = false;   // 현재 문장의 결과를 받았고 구분자(nullptr)를 기다리는 중
+        size_t pendingSyncs = independent ? pipeline.size() : 1;
+        bool synced = false;
+        while (!synced) {
+            const int flushed = PQflush(conn);
+            if (flushed < 0 || PQconsumeInput(conn) != 1) {
+                throw std::runtime_error("Pipeline connection failed: " + connection.lastError());
+            }
+            while (!PQisBusy(conn)) {
+                PGresult* result = PQgetResult(conn);
+                if (result == nullptr) {
+                    if (!current) {
+                        break;
+                    }
+                    current = false;
+                    continue;
+                }
+                if (PQresultStatus(result) == PGRES_PIPELINE_SYNC) {
+                    PQclear(result);
+                    if (--pendingSyncs == 0) {
+                        synced = true;
+                        break;
+                    }
+                    continue;
+                }
+                if (PQresultStatus(result) == PGRES_FATAL_ERROR && error.empty()) {
+                    error = statementError(results.size(), result);
+                }
+                results.emplace_back(result);
+                current = true;
+            }
+            if (!synced) {
+                waitSocket(conn, flushed == 1, deadline);
+            }
+        }
+
+        if (PQexitPipelineMode(conn) != 1 || PQsetnonblocking(conn, 0) != 0) {
+            throw std::runtime_error("Failed to leave pipeline mode: " + connection.lastError());
+        }
+        if (results.size() != pipeline.size()) {
+            throw std::runtime_error("Pipeline returned " + std::to_string(results.size()) +
+                                     " results for " + std::to_string(pipeline.size()) + " statements");
+        }
+        return results;
+#else
+        return runSequential(connection, pipeline, independent, error);
+#endif
+    }
+
+    std::vector<PipelineResult> PipelineExecutor::runSequential(
+        PgConnection& connection,
+        const Pipeline& pipeline,
+        bool independent,
+        std::string& error
+    ) {
+        std::vector<PipelineResult> results;
+        results.reserve(pipeline.size());
+        for (const auto& statement : pipeline.statements_) {
+            const auto values = paramValues(statement.params);
+            PGresult* result = PQexecParams(connection.raw(), statement.sql.c_str(),
+                                            static_cast<int>(values.size()), nullptr, values.data(),
+                                            nullptr, nullptr, 0);
+            if (result == nullptr) {
+                throw std::runtime_error("Pipeline connection failed: " + connection.lastError());
+            }
+            const auto status = PQresultStatus(result);
+            results.emplace_back(result);
+            if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK && error.empty()) {
+                error = statementError(results.size() - 1, result);
+                if (!independent) {
+                    break;  // 파이프라인과 같은 의미: 실패 이후 문장은 실행하지 않음
+                }
+            }
+        }
+        return results;
+    }
+
+} // namespace database
@@ -0,0 +1,157 @@
+#include "database/StatementRegistry.h"
+#include "utils/Logger.h"
+#include <stdexcept>
+
+namespace database {
+
+    void StatementRegistry::Statement::record(std::chrono::steady_clock::time_point started) {
+        const auto micros = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - started).count());
+        calls.fetch_add(1, std::memory_order_relaxed);
+        totalMicros.fetch_add(micros, std::memory_order_relaxed);
+
+        uint64_t currentMax = maxMicros.load(std::memory_order_relaxed);
+        while (micros > currentMax &&
+               !maxMicros.compare_exchange_weak(currentMax, micros, std::memory_order_relaxed)) {
+        }
+    }
+
+    StatementRegistry& StatementRegistry::getInstance() {
+        static StatementRegistry instance;
+        return instance;
+    }
+
+    StatementRegistry::Statement& StatementRegistry::add(
+        const std::string& name,
+        const std::string& sql,
+        std::function<void(drogon::orm::DbClient&)> warmup
+    ) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = byName_.find(name);
+        if (it != byName_.end()) {
+            if (it->second->sql != sql) {
+                throw std::logic_error("Statement '" + name + "' is already registered with different SQL");
+            }
+            return *it->second;
+        }
+
+        auto& statement = statements_.emplace_back();
+        statement.name = name;
+        statement.sql = sql;
+        statement.warmup = std::move(warmup);
+        byName_.emplace(name, &statement);
+        return statement;
+    }
+
+    size_t StatementRegistry::warmup(const drogon::orm::DbClientPtr& client, size_t connectionCount) {
+        std::vector<Statement*> statements;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto& statement : statements_) {
+                if (statement.warmup) {
+                    statements.push_back(&statement);
+                }
+            }
+        }
+        if (statements.empty() || connectionCount == 0) {
+            return 0;
+        }
+
+        // 트랜잭션은 커밋/롤백까지 연결을 독점하므로 connectionCount개를 동시에 열면 서로 다른 연결이 배정됨
+        std::vector<std::shared_ptr<drogon::orm::Transaction>> transactions;
+        transactions.reserve(connectionCount);
+        for (size_t i = 0; i < connectionCount; ++i) {
+            transactions.push_back(client->newTransaction());
+        }
+
+        size_t prepared = 0;
+        for (auto& transaction : transactions) {
+            for (auto* statement : statements) {
+                try {
+                    statement->warmup(*transaction);
+                    ++prepared;
+                } catch (const std::exception& e) {
+                    // 한 문장이 실패하면 트랜잭션이 중단되므로 이 연결의 나머지는 건너뜀
+                    TRADING_LOG_WARN("Statement warmup failed for {}: {}", statement->name, e.what());
+                    break;
+                }
+            }
+            transaction->rollback();
+        }
+
+        TRADING_LOG_INFO("Prepared {} statements on {} connections ({} total)",
+                         statements.size(), connectionCount, prepared);
+        return prepared;
+    }
+
+    bool StatementRegistry::refreshServerStats(drogon::orm::DbClient& client) {
+        std::vector<std::pair<std::string, std::string>> statements;   // (name, sql)
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& statement : statements_) {
+                statements.emplace_back(statement.name, statement.sql);
+            }
+        }
+
+        std::unordered_map<std::string, ServerStats> collected;
+        try {
+            for (const auto& [name, sql] : statements) {
+                auto result = client.execSqlSync(
+                    "SELECT COALESCE(SUM(calls), 0)::bigint AS calls, "
+                    "COALESCE(SUM(total_plan_time), 0) AS plan_ms, "
+                    "COALESCE(SUM(total_exec_time), 0) AS exec_ms "
+                    "FROM pg_stat_statements WHERE query = $1",
+                    sql);
+                ServerStats stats;
+                stats.calls = result[0]["calls"].as<uint64_t>();
+                stats.totalPlanMillis = result[0]["plan_ms"].as<double>();
+                stats.totalExecMillis = result[0]["exec_ms"].as<double>();
+                collected.emplace(name, stats);
+            }
+        } catch (const std::exception& e) {
+            TRADING_LOG_DEBUG("pg_stat_statements unavailable: {}", e.what());
+            return false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        serverStats_ = std::move(collected);
+        return true;
+    }
+
+    std::vector<StatementRegistry::StatementStats> StatementRegistry::getStats() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::vector<StatementStats> stats;
+        stats.reserve(statements_.size());
+        for (const auto& statement : statements_) {
+            StatementStats entry{
+                statement.name,
+                statement.sql,
+                statement.calls.load(std::memory_order_relaxed),
+                statement.errors.load(std::memory_order_relaxed),
+                statement.totalMicros.load(std::memory_order_relaxed),
+                statement.maxMicros.load(std::memory_order_relaxed),
+                0, 0.0, 0.0
+            };
+            auto it = serverStats_.find(statement.name);
+            if (it != serverStats_.end()) {
+                entry.serverCalls = it->second.calls;
+                entry.totalPlanMillis = it->second.totalPlanMillis;
+                entry.totalExecMillis = it->second.totalExecMillis;
+            }
+            stats.push_back(std::move(entry));
+        }
+        return stats;
+    }
+
+    void StatementRegistry::resetStats() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto& statement : statements_) {
+            statement.calls.store(0, std::memory_order_relaxed);
+            statement.errors.store(0, std::memory_order_relaxed);
+            statement.totalMicros.store(0, std::memory_order_relaxed);
+            statement.maxMicros.store(0, std::memory_order_relaxed);
+        }
+        serverStats_.clear();
+    }
+
+} // namespace database
@@ -4,6 +4,22 @@
 #include "utils/Config.h"
 #include "utils/Logger.h"
 #include "utils/MigrationManager.h"
+#include "models/SymbolRegistry.h"
+#include "models/ModelRegistry.h"
+#include "models/mappers/MarketDataMapper.h"
+#include "models/mappers/OrderMapper.h"
+#include "models/mappers/TradeMapper.h"
+#include "models/mappers/TradingSignalMapper.h"
+#include "models/mappers/UserMapper.h"
+#include "models/mappers/UserSettingsMapper.h"
+#include "database/DbRouter.h"
+#include "database/GroupCommitter.h"
+#include "database/PartitionManager.h"
+#include "database/StatementRegistry.h"
+#include "repositories/CandleAggregator.h"
+#include "repositories/MarketDataRepository.h"
+#include "repositories/MarketDataWriteBehind.h"
+#include "repositories/OrderRepository.h"
 
 namespace fs = std::filesystem;
 
@@ -34,13 +50,97 @@ int main() {
            .addListener("0.0.0.0", 8000)
            .setThreadNum(16);
 
-        // Drogon 설정 파일 로드 (DB 설정 포함)
-        app.loadConfigFile(config.findConfigFile("drogon.json"));
+        // Drogon 설정 적용 (DB 설정 포함)
+        // 파일을 다시 읽지 않고 환경 변수(DB 접속 정보, DB_REPLICA_HOST의 replica 클라이언트)를 반영한 설정을 사용
+        app.loadConfigJson(config.getDrogonConfig());
 
-        // DB 마이그레이션 실행 (이제 DB 설정이 로드된 후)
-        auto& mgt = utils::MigrationManager::getInstance();
-        mgt.migrate();
+        // 문자열 이름 기반 팩토리 조회 경로 등록
+        models::ModelRegistry::registerFactories();
+
+        // 요청마다 read-your-writes 범위 적용 (쓴 요청의 이후 조회는 primary)
+        database::DbRouter::installRequestScope();
+
+        // DB 작업은 drogon이 DB 클라이언트를 만든 뒤(app.run() 안)에 실행
+        // 실패하면 서버를 멈추고 1로 종료
+        bool startupFailed = false;
+        app.registerBeginningAdvice([&startupFailed] {
+            // DB 마이그레이션 실행 (이제 DB 설정이 로드된 후)
+            try {
+                utils::MigrationManager::getInstance().migrate();
+            } catch (const std::exception& e) {
+                TRADING_LOG_ERROR("Server startup failed: {}", e.what());
+                startupFailed = true;
+                drogon::app().quit();
+                return;
+            }
+
+            // 시간 범위 파티션 보장/만료 분리 (현재 구간 파티션은 쓰기 시작 전에 생성)
+            database::PartitionManager::getInstance().start();
+
+            // 심볼 레지스트리 선로딩 (이후 등장하는 심볼은 요청 시 등록)
+            try {
+                auto since = trantor::Date::now().after(
+                    -static_cast<double>(common::SymbolConfig::PRELOAD_WINDOW_DAYS) * 24 * 60 * 60);
+                auto activeSymbols = repositories::MarketDataRepository::getInstance().getActiveSymbols(since);
+                models::SymbolRegistry::getInstance().preload(activeSymbols);
+                TRADING_LOG_INFO("Symbol registry preloaded with {} symbols", activeSymbols.size());
+
+                // 최신 시세/최근 틱 캐시 선로딩
+                auto& marketDataRepository = repositories::MarketDataRepository::getInstance();
+                for (const auto& symbol : activeSymbols) {
+                    marketDataRepository.warmupCache(symbol);
+                }
+            } catch (const std::exception& e) {
+                TRADING_LOG_WARN("Symbol registry preload failed: {}", e.what());
+            }
         
+            // 미체결 주문 인덱스 구성 (실패 시 미체결 조회는 DB로 폴백)
+            try {
+                repositories::OrderRepository::getInstance().rebuildOpenOrderIndex();
+            } catch (const std::exception& e) {
+                TRADING_LOG_WARN("Open order index rebuild failed: {}", e.what());
+            }
+
+            // 핫 쿼리 사전 준비: 매퍼 싱글톤 생성 시 StatementRegistry에 등록된 문장을
+            // 풀의 모든 연결에서 한 번씩 실행해 연결별 PQprepare를 요청 경로 밖으로 옮김
+            try {
+                models::mappers::MarketDataMapper::getInstance();
+                models::mappers::OrderMapper::getInstance();
+                models::mappers::TradeMapper::getInstance();
+                models::mappers::TradingSignalMapper::getInstance();
+                models::mappers::UserMapper::getInstance();
+                models::mappers::UserSettingsMapper::getInstance();
+
+                const auto& dbClients = utils::Config::getInstance().getDrogonConfig()["db_clients"];
+                const size_t poolSize = dbClients.empty() ? 1 : dbClients[0].get("number_of_connections", 1).asUInt();
+                database::StatementRegistry::getInstance().warmup(drogon::app().getDbClient(), poolSize);
+            } catch (const std::exception& e) {
+                TRADING_LOG_WARN("Statement warmup failed: {}", e.what());
+            }
+
+            // 조회를 replica로 보내는 라우팅 시작 (DB_REPLICA_HOST 미설정 시 모두 primary)
+            // 문장 사전 준비는 primary에서만 수행: replica는 읽기 전용이라 DELETE warmup이 실패함
+            database::DbRouter::getInstance().start();
+        });
+
+        // 작은 쓰기를 묶어 커밋하는 그룹 커밋 스레드 시작 (saveGrouped 경로)
+        auto& groupCommitter = database::GroupCommitter::getInstance();
+        groupCommitter.start();
+
+        // 시세 쓰기 지연 flush 스레드 시작 (수신 경로는 큐에만 넣고 DB 기록은 배치로 처리)
+        // 저장소를 먼저 생성해 종료 시 쓰기 지연 객체보다 늦게 파괴되도록 함 (소멸자에서 flush)
+        auto& marketDataRepository = repositories::MarketDataRepository::getInstance();
+        auto& marketDataWriter = repositories::MarketDataWriteBehind::getInstance();
+        repositories::MarketDataWriteBehind::Options writerOptions;
+        writerOptions.sink = [&marketDataRepository](const std::vector<models::MarketData>& rows) {
+            marketDataRepository.persistBatch(rows);
+        };
+        marketDataWriter.start(writerOptions);
+
+        // 틱 -> OHLCV 봉 증분 집계 flush 스레드 시작 (마감된 봉 델타를 market_bars에 배치 기록)
+        auto& candleAggregator = repositories::CandleAggregator::getInstance();
+        candleAggregator.start();
+
         // 서버 시작 메시지
         std::cout << "\n==================================" << std::endl;
         std::cout << "Server starting on http://0.0.0.0:8000" << std::endl;
@@ -51,8 +151,15 @@ int main() {
         
         // 서버 시작
         app.run();
+
+        // 종료 시 남은 시세를 모두 기록
+        marketDataWriter.stop();
+        candleAggregator.stop();
+        groupCommitter.stop();
+        database::DbRouter::getInstance().stop();
+        database::PartitionManager::getInstance().stop();
         
-        return 0;
+        return startupFailed ? 1 : 0;
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
         if (utils::Logger::getLogger()) {
@@ -0,0 +1,46 @@
+#include "models/CandleBar.h"
+#include "models/FieldReader.h"
+#include <string>
+
+namespace models {
+
+    std::optional<BarResolution> parseBarResolution(std::string_view text) {
+        for (auto resolution : BAR_RESOLUTIONS) {
+            if (toString(resolution) == text) {
+                return resolution;
+            }
+        }
+        return std::nullopt;
+    }
+
+    CandleBar CandleBar::fromDbRow(const drogon::orm::Row& row) {
+        CandleBar bar;
+        bar.symbolId = SymbolRegistry::getInstance().intern(row["symbol"].as<std::string>());
+        bar.resolution = parseBarResolution(row["resolution"].as<std::string>()).value_or(BarResolution::S1);
+        bar.openTimeMicros = FieldReader::readTimestampMicros(row["open_time"]);
+        bar.open = FieldReader::readDouble(row["open"]);
+        bar.high = FieldReader::readDouble(row["high"]);
+        bar.low = FieldReader::readDouble(row["low"]);
+        bar.close = FieldReader::readDouble(row["close"]);
+        bar.volume = FieldReader::readDouble(row["volume"]);
+        bar.tickCount = static_cast<uint64_t>(FieldReader::readInt64(row["tick_count"]));
+        bar.firstTickMicros = FieldReader::readTimestampMicros(row["first_tick_at"]);
+        bar.lastTickMicros = FieldReader::readTimestampMicros(row["last_tick_at"]);
+        return bar;
+    }
+
+    Json::Value CandleBar::toJson() const {
+        Json::Value json;
+        json["symbol"] = std::string(SymbolRegistry::getInstance().name(symbolId));
+        json["resolution"] = std::string(toString(resolution));
+        json["open_time"] = Json::Int64(openTimeMicros);
+        json["open"] = open;
+        json["high"] = high;
+        json["low"] = low;
+        json["close"] = close;
+        json["volume"] = volume;
+        json["tick_count"] = Json::UInt64(tickCount);
+        return json;
+    }
+
+} // namespace models
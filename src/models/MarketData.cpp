@@ -8,6 +8,7 @@ namespace models {
         id_.store(other.id_.load(std::memory_order_relaxed));
         strncpy(symbol_, other.symbol_, sizeof(symbol_));
         symbol_[sizeof(symbol_) - 1] = '\0';
+        symbol_id_ = other.symbol_id_;
         price_.store(other.price_.load(std::memory_order_relaxed));
         volume_.store(other.volume_.load(std::memory_order_relaxed));
         timestamp_ = other.timestamp_;
@@ -16,6 +17,22 @@ namespace models {
         created_at_ = other.created_at_;
     }
 
+    MarketData& MarketData::operator=(const MarketData& other) {
+        if (this != &other) {
+            id_.store(other.id_.load(std::memory_order_relaxed));
+            strncpy(symbol_, other.symbol_, sizeof(symbol_));
+            symbol_[sizeof(symbol_) - 1] = '\0';
+            symbol_id_ = other.symbol_id_;
+            price_.store(other.price_.load(std::memory_order_relaxed));
+            volume_.store(other.volume_.load(std::memory_order_relaxed));
+            timestamp_ = other.timestamp_;
+            strncpy(source_, other.source_, sizeof(source_));
+            source_[sizeof(source_) - 1] = '\0';
+            created_at_ = other.created_at_;
+        }
+        return *this;
+    }
+
 
     memory::MemoryPool<MarketData>& MarketData::memory_pool() {
         static memory::MemoryPool<MarketData> pool(1024);
@@ -33,6 +50,7 @@ namespace models {
         double volume,
         const std::string& source
     ) {
+        SymbolRegistry::validate(symbol);
         auto ptr = MarketData::memory_pool().allocate();
         ptr->setSymbol(symbol);
         ptr->setPrice(price);
@@ -46,15 +64,11 @@ namespace models {
     }
 
     Json::Value MarketData::toJson() const {
-        Json::Value json;
-        json["id"] = static_cast<Json::Int64>(id_.load(std::memory_order_relaxed));
-        json["symbol"] = symbol_;
-        json["price"] = price_.load(std::memory_order_relaxed);
-        json["volume"] = volume_.load(std::memory_order_relaxed);
-        json["timestamp"] = timestamp_.toFormattedString(false);
-        json["source"] = source_;
-        json["created_at"] = created_at_.toFormattedString(false);
-        return json;
+        return schema::toJson(*this);
+    }
+
+    void MarketData::writeJson(utils::JsonWriter& writer) const {
+        schema::writeJson(*this, writer);
     }
 
     void MarketData::fromJson(const Json::Value& json) {
@@ -69,6 +83,7 @@ namespace models {
                 throw std::invalid_argument("Missing required fields in MarketData JSON");
             }
 
+            SymbolRegistry::validate(json["symbol"].asString());
             setSymbol(json["symbol"].asString());
             setPrice(json["price"].asDouble());
             setVolume(json["volume"].asDouble());
@@ -96,15 +111,16 @@ namespace models {
     }
 
     std::shared_ptr<MarketData> MarketData::fromDbRow(const drogon::orm::Row& row) {
+        return fromDbRow(row, schema::RowDecoder<MarketData>(row));
+    }
+
+    std::shared_ptr<MarketData> MarketData::fromDbRow(
+        const drogon::orm::Row& row,
+        const schema::RowDecoder<MarketData>& decoder
+    ) {
         auto data = MarketData::memory_pool().allocate();
         try {
-            data->setId(row["id"].as<int64_t>());
-            data->setSymbol(row["symbol"].as<std::string>());
-            data->setPrice(row["price"].as<double>());
-            data->setVolume(row["volume"].as<double>());
-            data->setTimestamp(trantor::Date::fromDbString(row["timestamp"].as<std::string>()));
-            data->setSource(row["source"].as<std::string>());
-            data->setCreatedAt(trantor::Date::fromDbString(row["created_at"].as<std::string>()));
+            decoder.decode(row, *data);
         } catch (const std::exception& e) {
             TRADING_LOG_ERROR("Error creating MarketData from DB row: {}", e.what());
             MarketData::memory_pool().deallocate(data); // 메모리 풀 반환
@@ -121,9 +137,11 @@ namespace models {
         std::vector<std::shared_ptr<MarketData>> marketDataList;
         marketDataList.reserve(result.size());
 
+        // 컬럼 위치는 결과셋당 한 번만 조회
+        const schema::RowDecoder<MarketData> decoder(result);
         for (const auto& row : result) {
             try {
-                marketDataList.push_back(fromDbRow(row));
+                marketDataList.push_back(fromDbRow(row, decoder));
             } catch (const std::exception& e) {
                 TRADING_LOG_ERROR("Error processing row in batch: {}", e.what());
                 // 개별 실패는 기록하고 계속 진행
@@ -0,0 +1,104 @@
+#include "models/MarketDataBatch.h"
+#include "models/FieldReader.h"
+#include "utils/Logger.h"
+
+namespace models {
+
+    void MarketDataBatch::reserve(size_t capacity) {
+        prices_.reserve(capacity);
+        volumes_.reserve(capacity);
+        timestamps_.reserve(capacity);
+    }
+
+    void MarketDataBatch::clear() {
+        prices_.clear();
+        volumes_.clear();
+        timestamps_.clear();
+    }
+
+    void MarketDataBatch::append(double price, double volume, int64_t timestampMicros) {
+        prices_.push_back(price);
+        volumes_.push_back(volume);
+        timestamps_.push_back(timestampMicros);
+    }
+
+    void MarketDataBatch::append(const MarketData& data) {
+        if (symbol_id_ == SymbolRegistry::INVALID_ID) {
+            symbol_id_ = data.getSymbolId();
+        }
+        append(data.getPrice(), data.getVolume(), data.getTimestamp().microSecondsSinceEpoch());
+    }
+
+    MarketDataBatch MarketDataBatch::fromDbResult(const drogon::orm::Result& result) {
+        MarketDataBatch batch;
+        if (result.empty()) {
+            return batch;
+        }
+
+        // 컬럼 인덱스는 한 번만 조회하고 행마다 이름 검색을 하지 않음
+        const auto priceCol = result.columnNumber("price");
+        const auto volumeCol = result.columnNumber("volume");
+        const auto timestampCol = result.columnNumber("timestamp");
+
+        batch.reserve(result.size());
+        for (const auto& row : result) {
+            try {
+                batch.append(
+                    FieldReader::readDouble(row[priceCol]),
+                    FieldReader::readDouble(row[volumeCol]),
+                    FieldReader::readTimestampMicros(row[timestampCol])
+                );
+            } catch (const std::exception& e) {
+                TRADING_LOG_ERROR("Error processing row in market data batch: {}", e.what());
+                continue;
+            }
+        }
+
+        return batch;
+    }
+
+    double MarketDataBatch::totalVolume() const {
+        return kernels::sum(volumes_.data(), volumes_.size());
+    }
+
+    double MarketDataBatch::vwap() const {
+        double volume = totalVolume();
+        if (volume == 0.0) {
+            return 0.0;
+        }
+        return kernels::dot(prices_.data(), volumes_.data(), prices_.size()) / volume;
+    }
+
+    kernels::MinMax MarketDataBatch::priceRange() const {
+        return kernels::minMax(prices_.data(), prices_.size());
+    }
+
+    std::vector<double> MarketDataBatch::returns() const {
+        if (prices_.size() < 2) {
+            return {};
+        }
+        std::vector<double> out(prices_.size() - 1);
+        kernels::simpleReturns(prices_.data(), prices_.size(), out.data());
+        return out;
+    }
+
+    double MarketDataBatch::priceChangePercent() const {
+        if (prices_.size() < 2 || prices_.front() == 0.0) {
+            return 0.0;
+        }
+        return (prices_.back() - prices_.front()) / prices_.front() * 100.0;
+    }
+
+    size_t MarketDataBatch::countPricesAbove(double threshold) const {
+        return kernels::countAbove(prices_.data(), prices_.size(), threshold);
+    }
+
+    std::optional<size_t> MarketDataBatch::findFirstPriceOutside(double lower, double upper) const {
+        size_t index = kernels::findFirstOutside(prices_.data(), prices_.size(), lower, upper);
+        if (index == prices_.size()) {
+            return std::nullopt;
+        }
+        return index;
+    }
+
+} // namespace models
@@ -0,0 +1,418 @@
+#include "models/MarketDataKernels.h"
+#include <algorithm>
+#include <atomic>
+#include <limits>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define TRADING_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace models {
+    namespace kernels {
+
+        namespace {
+
+            // 레벨별 구현 함수 테이블
+            struct KernelTable {
+                SimdLevel level;
+                double (*sum)(const double*, size_t);
+                double (*dot)(const double*, const double*, size_t);
+                MinMax (*minMax)(const double*, size_t);
+                void (*simpleReturns)(const double*, size_t, double*);
+                size_t (*countAbove)(const double*, size_t, double);
+                size_t (*findFirstOutside)(const double*, size_t, double, double);
+            };
+
+            // ---------- Scalar (폴백) ----------
+
+            double sumScalar(const double* data, size_t n) {
+                double total = 0.0;
+                for (size_t i = 0; i < n; ++i) {
+                    total += data[i];
+                }
+                return total;
+            }
+
+            double dotScalar(const double* a, const double* b, size_t n) {
+                double total = 0.0;
+                for (size_t i = 0; i < n; ++i) {
+                    total += a[i] * b[i];
+                }
+                return total;
+            }
+
+            MinMax minMaxScalar(const double* data, size_t n) {
+                MinMax result{std::numeric_limits<double>::infinity(),
+                              -std::numeric_limits<double>::infinity()};
+                for (size_t i = 0; i < n; ++i) {
+                    result.min = std::min(result.min, data[i]);
+                    result.max = std::max(result.max, data[i]);
+                }
+                return result;
+            }
+
+            void simpleReturnsScalar(const double* prices, size_t n, double* out) {
+                for (size_t i = 0; i + 1 < n; ++i) {
+                    out[i] = prices[i + 1] / prices[i] - 1.0;
+                }
+            }
+
+            size_t countAboveScalar(const double* data, size_t n, double threshold) {
+                size_t count = 0;
+                for (size_t i = 0; i < n; ++i) {
+                    count += data[i] > threshold ? 1 : 0;
+                }
+                return count;
+            }
+
+            size_t findFirstOutsideScalar(const double* data, size_t n, double lower, double upper) {
+                for (size_t i = 0; i < n; ++i) {
+                    if (data[i] < lower || data[i] > upper) {
+                        return i;
+                    }
+                }
+                return n;
+            }
+
+            constexpr KernelTable SCALAR_TABLE{
+                SimdLevel::Scalar,
+                sumScalar,
+                dotScalar,
+                minMaxScalar,
+                simpleReturnsScalar,
+                countAboveScalar,
+                findFirstOutsideScalar
+            };
+
+#ifdef TRADING_KERNELS_X86
+            // ---------- SSE2 (x86-64 기본 명령어셋) ----------
+
+            double horizontalSum(__m128d v) {
+                return _mm_cvtsd_f64(v) + _mm_cvtsd_f64(_mm_unpackhi_pd(v, v));
+            }
+
+            double sumSse2(const double* data, size_t n) {
+                __m128d acc0 = _mm_setzero_pd();
+                __m128d acc1 = _mm_setzero_pd();
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4) {
+                    acc0 = _mm_add_pd(acc0, _mm_loadu_pd(data + i));
+                    acc1 = _mm_add_pd(acc1, _mm_loadu_pd(data + i + 2));
+                }
+                double total = horizontalSum(_mm_add_pd(acc0, acc1));
+                for (; i < n; ++i) {
+                    total += data[i];
+                }
+                return total;
+            }
+
+            double dotSse2(const double* a, const double* b, size_t n) {
+                __m128d acc0 = _mm_setzero_pd();
+                __m128d acc1 = _mm_setzero_pd();
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4) {
+                    acc0 = _mm_add_pd(acc0, _mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));
+                    acc1 = _mm_add_pd(acc1, _mm_mul_pd(_mm_loadu_pd(a + i + 2), _mm_loadu_pd(b + i + 2)));
+                }
+                double total = horizontalSum(_mm_add_pd(acc0, acc1));
+                for (; i < n; ++i) {
+                    total += a[i] * b[i];
+                }
+                return total;
+            }
+
+            MinMax minMaxSse2(const double* data, size_t n) {
+                if (n < 2) {
+                    return minMaxScalar(data, n);
+                }
+                __m128d vmin = _mm_loadu_pd(data);
+                __m128d vmax = vmin;
+                size_t i = 2;
+                for (; i + 2 <= n; i += 2) {
+                    __m128d v = _mm_loadu_pd(data + i);
+                    vmin = _mm_min_pd(vmin, v);
+                    vmax = _mm_max_pd(vmax, v);
+                }
+                MinMax result{
+                    std::min(_mm_cvtsd_f64(vmin), _mm_cvtsd_f64(_mm_unpackhi_pd(vmin, vmin))),
+                    std::max(_mm_cvtsd_f64(vmax), _mm_cvtsd_f64(_mm_unpackhi_pd(vmax, vmax)))
+                };
+                for (; i < n; ++i) {
+                    result.min = std::min(result.min, data[i]);
+                    result.max = std::max(result.max, data[i]);
+                }
+                return result;
+            }
+
+            void simpleReturnsSse2(const double* prices, size_t n, double* out) {
+                if (n < 2) {
+                    return;
+                }
+                const __m128d one = _mm_set1_pd(1.0);
+                const size_t m = n - 1;
+                size_t i = 0;
+                for (; i + 2 <= m; i += 2) {
+                    __m128d prev = _mm_loadu_pd(prices + i);
+                    __m128d next = _mm_loadu_pd(prices + i + 1);
+                    _mm_storeu_pd(out + i, _mm_sub_pd(_mm_div_pd(next, prev), one));
+                }
+                for (; i < m; ++i) {
+                    out[i] = prices[i + 1] / prices[i] - 1.0;
+                }
+            }
+
+            size_t countAboveSse2(const double* data, size_t n, double threshold) {
+                const __m128d t = _mm_set1_pd(threshold);
+                size_t count = 0;
+                size_t i = 0;
+                for (; i + 2 <= n; i += 2) {
+                    int mask = _mm_movemask_pd(_mm_cmpgt_pd(_mm_loadu_pd(data + i), t));
+                    count += static_cast<size_t>(__builtin_popcount(mask));
+                }
+                for (; i < n; ++i) {
+                    count += data[i] > threshold ? 1 : 0;
+                }
+                return count;
+            }
+
+            size_t findFirstOutsideSse2(const double* data, size_t n, double lower, double upper) {
+                const __m128d lo = _mm_set1_pd(lower);
+                const __m128d hi = _mm_set1_pd(upper);
+                size_t i = 0;
+                for (; i + 2 <= n; i += 2) {
+                    __m128d v = _mm_loadu_pd(data + i);
+                    int mask = _mm_movemask_pd(_mm_or_pd(_mm_cmplt_pd(v, lo), _mm_cmpgt_pd(v, hi)));
+                    if (mask != 0) {
+                        return i + static_cast<size_t>(__builtin_ctz(mask));
+                    }
+                }
+                return i + findFirstOutsideScalar(data + i, n - i, lower, upper);
+            }
+
+            constexpr KernelTable SSE2_TABLE{
+                SimdLevel::SSE2,
+                sumSse2,
+                dotSse2,
+                minMaxSse2,
+                simpleReturnsSse2,
+                countAboveSse2,
+                findFirstOutsideSse2
+            };
+
+            // ---------- AVX2 (런타임에 CPU 지원 확인 후 사용) ----------
+
+            __attribute__((target("avx2"))) double horizontalSum256(__m256d v) {
+                __m128d low = _mm256_castpd256_pd128(v);
+                __m128d high = _mm256_extractf128_pd(v, 1);
+                return horizontalSum(_mm_add_pd(low, high));
+            }
+
+            __attribute__((target("avx2"))) double sumAvx2(const double* data, size_t n) {
+                __m256d acc0 = _mm256_setzero_pd();
+                __m256d acc1 = _mm256_setzero_pd();
+                __m256d acc2 = _mm256_setzero_pd();
+                __m256d acc3 = _mm256_setzero_pd();
+                size_t i = 0;
+                for (; i + 16 <= n; i += 16) {
+                    acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+                    acc1 = _mm256_add_pd(acc1, _mm256_loadu_pd(data + i + 4));
+                    acc2 = _mm256_add_pd(acc2, _mm256_loadu_pd(data + i + 8));
+                    acc3 = _mm256_add_pd(acc3, _mm256_loadu_pd(data + i + 12));
+                }
+                for (; i + 4 <= n; i += 4) {
+                    acc0 = _mm256_add_pd(acc0, _mm256_loadu_pd(data + i));
+                }
+                double total = horizontalSum256(
+                    _mm256_add_pd(_mm256_add_pd(acc0, acc1), _mm256_add_pd(acc2, acc3)));
+                for (; i < n; ++i) {
+                    total += data[i];
+                }
+                return total;
+            }
+
+            __attribute__((target("avx2,fma"))) double dotAvx2(const double* a, const double* b, size_t n) {
+                __m256d acc0 = _mm256_setzero_pd();
+                __m256d acc1 = _mm256_setzero_pd();
+                size_t i = 0;
+                for (; i + 8 <= n; i += 8) {
+                    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), acc0);
+                    acc1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), _mm256_loadu_pd(b + i + 4), acc1);
+                }
+                for (; i + 4 <= n; i += 4) {
+                    acc0 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i), acc0);
+                }
+                double total = horizontalSum256(_mm256_add_pd(acc0, acc1));
+                for (; i < n; ++i) {
+                    total += a[i] * b[i];
+                }
+                return total;
+            }
+
+            __attribute__((target("avx2"))) MinMax minMaxAvx2(const double* data, size_t n) {
+                if (n < 4) {
+                    return minMaxScalar(data, n);
+                }
+                __m256d vmin = _mm256_loadu_pd(data);
+                __m256d vmax = vmin;
+                size_t i = 4;
+                for (; i + 4 <= n; i += 4) {
+                    __m256d v = _mm256_loadu_pd(data + i);
+                    vmin = _mm256_min_pd(vmin, v);
+                    vmax = _mm256_max_pd(vmax, v);
+                }
+                alignas(32) double mins[4];
+                alignas(32) double maxs[4];
+                _mm256_store_pd(mins, vmin);
+                _mm256_store_pd(maxs, vmax);
+                MinMax result{
+                    std::min(std::min(mins[0], mins[1]), std::min(mins[2], mins[3])),
+                    std::max(std::max(maxs[0], maxs[1]), std::max(maxs[2], maxs[3]))
+                };
+                for (; i < n; ++i) {
+                    result.min = std::min(result.min, data[i]);
+                    result.max = std::max(result.max, data[i]);
+                }
+                return result;
+            }
+
+            __attribute__((target("avx2"))) void simpleReturnsAvx2(const double* prices, size_t n, double* out) {
+                if (n < 2) {
+                    return;
+                }
+                const __m256d one = _mm256_set1_pd(1.0);
+                const size_t m = n - 1;
+                size_t i = 0;
+                for (; i + 4 <= m; i += 4) {
+                    __m256d prev = _mm256_loadu_pd(prices + i);
+                    __m256d next = _mm256_loadu_pd(prices + i + 1);
+                    _mm256_storeu_pd(out + i, _mm256_sub_pd(_mm256_div_pd(next, prev), one));
+                }
+                for (; i < m; ++i) {
+                    out[i] = prices[i + 1] / prices[i] - 1.0;
+                }
+            }
+
+            __attribute__((target("avx2,popcnt"))) size_t countAboveAvx2(const double* data, size_t n, double threshold) {
+                const __m256d t = _mm256_set1_pd(threshold);
+                size_t count = 0;
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4) {
+                    int mask = _mm256_movemask_pd(_mm256_cmp_pd(_mm256_loadu_pd(data + i), t, _CMP_GT_OQ));
+                    count += static_cast<size_t>(_mm_popcnt_u32(static_cast<unsigned>(mask)));
+                }
+                for (; i < n; ++i) {
+                    count += data[i] > threshold ? 1 : 0;
+                }
+                return count;
+            }
+
+            __attribute__((target("avx2"))) size_t findFirstOutsideAvx2(
+                const double* data, size_t n, double lower, double upper
+            ) {
+                const __m256d lo = _mm256_set1_pd(lower);
+                const __m256d hi = _mm256_set1_pd(upper);
+                size_t i = 0;
+                for (; i + 4 <= n; i += 4) {
+                    __m256d v = _mm256_loadu_pd(data + i);
+                    __m256d outside = _mm256_or_pd(_mm256_cmp_pd(v, lo, _CMP_LT_OQ),
+                                                   _mm256_cmp_pd(v, hi, _CMP_GT_OQ));
+                    int mask = _mm256_movemask_pd(outside);
+                    if (mask != 0) {
+                        return i + static_cast<size_t>(__builtin_ctz(static_cast<unsigned>(mask)));
+                    }
+                }
+                return i + findFirstOutsideScalar(data + i, n - i, lower, upper);
+            }
+
+            constexpr KernelTable AVX2_TABLE{
+                SimdLevel::AVX2,
+                sumAvx2,
+                dotAvx2,
+                minMaxAvx2,
+                simpleReturnsAvx2,
+                countAboveAvx2,
+                findFirstOutsideAvx2
+            };
+#endif
+
+            SimdLevel detectSimdLevel() {
+#ifdef TRADING_KERNELS_X86
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") &&
+                    __builtin_cpu_supports("popcnt")) {
+                    return SimdLevel::AVX2;
+                }
+                return SimdLevel::SSE2;
+#else
+                return SimdLevel::Scalar;
+#endif
+            }
+
+            const KernelTable* tableFor(SimdLevel level) {
+#ifdef TRADING_KERNELS_X86
+                switch (level) {
+                    case SimdLevel::AVX2:
+                        return &AVX2_TABLE;
+                    case SimdLevel::SSE2:
+                        return &SSE2_TABLE;
+                    case SimdLevel::Scalar:
+                        break;
+                }
+#else
+                (void)level;
+#endif
+                return &SCALAR_TABLE;
+            }
+
+            std::atomic<const KernelTable*> activeTable{nullptr};
+
+            const KernelTable& table() {
+                const KernelTable* current = activeTable.load(std::memory_order_acquire);
+                if (!current) {
+                    current = tableFor(detectSimdLevel());
+                    activeTable.store(current, std::memory_order_release);
+                }
+                return *current;
+            }
+
+        } // namespace
+
+        SimdLevel activeSimdLevel() {
+            return table().level;
+        }
+
+        void setSimdLevel(SimdLevel level) {
+            SimdLevel supported = detectSimdLevel();
+            if (static_cast<int>(level) > static_cast<int>(supported)) {
+                level = supported;
+            }
+            activeTable.store(tableFor(level), std::memory_order_release);
+        }
+
+        double sum(const double* data, size_t n) {
+            return table().sum(data, n);
+        }
+
+        double dot(const double* a, const double* b, size_t n) {
+            return table().dot(a, b, n);
+        }
+
+        MinMax minMax(const double* data, size_t n) {
+            return table().minMax(data, n);
+        }
+
+        void simpleReturns(const double* prices, size_t n, double* out) {
+            table().simpleReturns(prices, n, out);
+        }
+
+        size_t countAbove(const double* data, size_t n, double threshold) {
+            return table().countAbove(data, n, threshold);
+        }
+
+        size_t findFirstOutside(const double* data, size_t n, double lower, double upper) {
+            return table().findFirstOutside(data, n, lower, upper);
+        }
+
+    } // namespace kernels
+} // namespace models
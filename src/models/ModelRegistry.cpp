@@ -0,0 +1,34 @@
+#include "models/ModelRegistry.h"
+#include "models/ModelManager.h"
+#include "models/factories/MarketDataFactory.h"
+#include "models/factories/OrderFactory.h"
+#include "models/factories/TradeFactory.h"
+#include "models/factories/TradingSignalFactory.h"
+#include "models/factories/UserFactory.h"
+#include "models/factories/UserSettingsFactory.h"
+#include <string>
+
+namespace models {
+
+    namespace {
+
+        // 팩토리는 프로세스 수명 동안 유지되는 싱글톤이므로 소유권 없이 등록
+        template <typename Model, typename Factory>
+        void registerFactory(ModelManager& manager) {
+            std::shared_ptr<const ModelFactory> factory(&Factory::getInstance(), [](const ModelFactory*) {});
+            manager.registerFactory(std::string(ModelTraits<Model>::NAME), std::move(factory));
+        }
+
+    } // namespace
+
+    void ModelRegistry::registerFactories() {
+        auto& manager = ModelManager::getInstance();
+        registerFactory<MarketData, factories::MarketDataFactory>(manager);
+        registerFactory<TradingSignal, factories::TradingSignalFactory>(manager);
+        registerFactory<Order, factories::OrderFactory>(manager);
+        registerFactory<Trade, factories::TradeFactory>(manager);
+        registerFactory<User, factories::UserFactory>(manager);
+        registerFactory<UserSettings, factories::UserSettingsFactory>(manager);
+    }
+
+} // namespace models
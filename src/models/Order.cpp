@@ -4,23 +4,11 @@
 namespace models {
 
     Json::Value Order::toJson() const {
-        Json::Value json;
-        json["id"] = static_cast<Json::Int64>(id_);
-        json["order_id"] = order_id_;
-        json["symbol"] = symbol_;
-        json["order_type"] = order_type_;
-        json["side"] = side_;
-        json["quantity"] = quantity_;
-        json["price"] = price_;
-        json["status"] = status_;
-        json["signal_id"] = static_cast<Json::Int64>(signal_id_);
-        json["filled_quantity"] = filled_quantity_;
-        json["filled_price"] = filled_price_;
-        json["error_message"] = error_message_;
-        json["timestamp"] = timestamp_.toFormattedString(false);
-        json["updated_at"] = updated_at_.toFormattedString(false);
-        json["created_at"] = created_at_.toFormattedString(false);
-        return json;
+        return schema::toJson(*this);
+    }
+
+    void Order::writeJson(utils::JsonWriter& writer) const {
+        schema::writeJson(*this, writer);
     }
 
     void Order::fromJson(const Json::Value& json) {
@@ -35,7 +23,8 @@ namespace models {
         }
 
         order_id_ = json.get("order_id", "").asString();
-        symbol_ = json["symbol"].asString();
+        SymbolRegistry::validate(json["symbol"].asString());
+        setSymbol(json["symbol"].asString());
         order_type_ = json["order_type"].asString();
         side_ = json["side"].asString();
         
@@ -102,39 +91,27 @@ namespace models {
     }
 
     Order Order::fromDbRow(const drogon::orm::Row& row) {
-        Order order;
-        
         try {
-            order.setId(row["id"].as<int64_t>());
-            order.setOrderId(row["order_id"].as<std::string>());
-            order.setSymbol(row["symbol"].as<std::string>());
-            order.setOrderType(row["order_type"].as<std::string>());
-            order.setSide(row["side"].as<std::string>());
-            order.setQuantity(row["quantity"].as<double>());
-            order.setPrice(row["price"].as<double>());
-            order.setStatus(row["status"].as<std::string>());
-            order.setSignalId(row["signal_id"].as<int64_t>());
-            order.setFilledQuantity(row["filled_quantity"].as<double>());
-            order.setFilledPrice(row["filled_price"].as<double>());
-            order.setErrorMessage(row["error_message"].as<std::string>());
-            order.setTimestamp(trantor::Date::fromDbString(row["timestamp"].as<std::string>()));
-            order.setUpdatedAt(trantor::Date::fromDbString(row["updated_at"].as<std::string>()));
-            order.setCreatedAt(trantor::Date::fromDbString(row["created_at"].as<std::string>()));
+            return schema::RowDecoder<Order>(row).decode(row);
         } catch (const std::exception& e) {
             throw std::runtime_error(std::string("Error creating Order from DB row: ") + e.what());
         }
-        
-        return order;
     }
 
     std::vector<Order> Order::fromDbResult(const drogon::orm::Result& result) {
         std::vector<Order> orders;
         orders.reserve(result.size());
-        
+
+        // 컬럼 위치는 결과셋당 한 번만 조회
+        const schema::RowDecoder<Order> decoder(result);
         for (const auto& row : result) {
-            orders.push_back(fromDbRow(row));
+            try {
+                orders.push_back(decoder.decode(row));
+            } catch (const std::exception& e) {
+                throw std::runtime_error(std::string("Error creating Order from DB row: ") + e.what());
+            }
         }
-        
+
         return orders;
     }
 
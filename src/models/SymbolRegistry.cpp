@@ -0,0 +1,130 @@
+#include "models/SymbolRegistry.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace models {
+
+    SymbolRegistry& SymbolRegistry::getInstance() {
+        static SymbolRegistry instance;
+        return instance;
+    }
+
+    SymbolRegistry::SymbolRegistry() {
+        for (auto& slot : slots_) {
+            slot.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t SymbolRegistry::hashOf(std::string_view symbol) noexcept {
+        // FNV-1a 64bit
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : symbol) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        return hash;
+    }
+
+    std::optional<SymbolId> SymbolRegistry::findWithHash(std::string_view symbol, uint64_t hash) const {
+        size_t index = static_cast<size_t>(hash) & (TABLE_SIZE - 1);
+        for (size_t probe = 0; probe < TABLE_SIZE; ++probe) {
+            uint32_t slot = slots_[index].load(std::memory_order_acquire);
+            if (slot == 0) {
+                return std::nullopt;
+            }
+
+            const Entry& entry = entries_[slot - 1];
+            if (entry.hash == hash &&
+                std::string_view(entry.name, entry.length) == symbol) {
+                return slot - 1;
+            }
+            index = (index + 1) & (TABLE_SIZE - 1);
+        }
+        return std::nullopt;
+    }
+
+    std::optional<SymbolId> SymbolRegistry::find(std::string_view symbol) const {
+        if (symbol.empty()) {
+            return std::nullopt;
+        }
+        return findWithHash(symbol, hashOf(symbol));
+    }
+
+    SymbolId SymbolRegistry::intern(std::string_view symbol) {
+        if (symbol.empty()) {
+            return INVALID_ID;
+        }
+
+        const uint64_t hash = hashOf(symbol);
+        if (auto id = findWithHash(symbol, hash)) {
+            return *id;
+        }
+
+        if (symbol.size() > MAX_SYMBOL_LENGTH) {
+            throw std::invalid_argument("Symbol exceeds maximum length: " + std::string(symbol));
+        }
+
+        std::lock_guard<std::mutex> lock(writeMutex_);
+
+        // 락 획득 사이에 다른 writer가 등록했을 수 있음
+        if (auto id = findWithHash(symbol, hash)) {
+            return *id;
+        }
+
+        const uint32_t id = size_.load(std::memory_order_relaxed);
+        if (id >= MAX_SYMBOLS) {
+            throw std::length_error("Symbol registry capacity exceeded");
+        }
+
+        // 엔트리를 먼저 채운 뒤 슬롯을 release로 공개해야 reader가 완성된 엔트리만 봄
+        Entry& entry = entries_[id];
+        entry.hash = hash;
+        entry.length = static_cast<uint8_t>(symbol.size());
+        std::memcpy(entry.name, symbol.data(), symbol.size());
+        entry.name[symbol.size()] = '\0';
+
+        size_t index = static_cast<size_t>(hash) & (TABLE_SIZE - 1);
+        while (slots_[index].load(std::memory_order_relaxed) != 0) {
+            index = (index + 1) & (TABLE_SIZE - 1);
+        }
+        slots_[index].store(id + 1, std::memory_order_release);
+        size_.store(id + 1, std::memory_order_release);
+
+        return id;
+    }
+
+    SymbolId SymbolRegistry::tryIntern(std::string_view symbol) noexcept {
+        if (symbol.empty() || symbol.size() > MAX_SYMBOL_LENGTH) {
+            return INVALID_ID;
+        }
+        try {
+            return intern(symbol);
+        } catch (...) {
+            return INVALID_ID;      // 용량 초과
+        }
+    }
+
+    void SymbolRegistry::validate(std::string_view symbol) {
+        if (symbol.empty()) {
+            throw std::invalid_argument("Symbol must not be empty");
+        }
+        if (symbol.size() > MAX_SYMBOL_LENGTH) {
+            throw std::invalid_argument("Symbol exceeds maximum length: " + std::string(symbol));
+        }
+    }
+
+    std::string_view SymbolRegistry::name(SymbolId id) const {
+        if (id >= size()) {
+            throw std::out_of_range("Unknown symbol id: " + std::to_string(id));
+        }
+        const Entry& entry = entries_[id];
+        return std::string_view(entry.name, entry.length);
+    }
+
+    void SymbolRegistry::preload(const std::vector<std::string>& symbols) {
+        for (const auto& symbol : symbols) {
+            intern(symbol);
+        }
+    }
+
+} // namespace models
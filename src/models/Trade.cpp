@@ -4,19 +4,11 @@
 namespace models {
 
     Json::Value Trade::toJson() const {
-        Json::Value json;
-        json["id"] = static_cast<Json::Int64>(id_);
-        json["trade_id"] = trade_id_;
-        json["order_id"] = static_cast<Json::Int64>(order_id_);
-        json["symbol"] = symbol_;
-        json["side"] = side_;
-        json["quantity"] = quantity_;
-        json["price"] = price_;
-        json["commission"] = commission_;
-        json["commission_asset"] = commission_asset_;
-        json["timestamp"] = timestamp_.toFormattedString(false);
-        json["created_at"] = created_at_.toFormattedString(false);
-        return json;
+        return schema::toJson(*this);
+    }
+
+    void Trade::writeJson(utils::JsonWriter& writer) const {
+        schema::writeJson(*this, writer);
     }
 
     void Trade::fromJson(const Json::Value& json) {
@@ -38,7 +30,8 @@ namespace models {
             order_id_ = json["order_id"].asInt64();
         }
 
-        symbol_ = json["symbol"].asString();
+        SymbolRegistry::validate(json["symbol"].asString());
+        setSymbol(json["symbol"].asString());
         side_ = json["side"].asString();
         
         // 거래 방향 유효성 검사
@@ -87,35 +80,27 @@ namespace models {
     }
 
     Trade Trade::fromDbRow(const drogon::orm::Row& row) {
-        Trade trade;
-        
         try {
-            trade.setId(row["id"].as<int64_t>());
-            trade.setTradeId(row["trade_id"].as<std::string>());
-            trade.setOrderId(row["order_id"].as<int64_t>());
-            trade.setSymbol(row["symbol"].as<std::string>());
-            trade.setSide(row["side"].as<std::string>());
-            trade.setQuantity(row["quantity"].as<double>());
-            trade.setPrice(row["price"].as<double>());
-            trade.setCommission(row["commission"].as<double>());
-            trade.setCommissionAsset(row["commission_asset"].as<std::string>());
-            trade.setTimestamp(trantor::Date::fromDbString(row["timestamp"].as<std::string>()));
-            trade.setCreatedAt(trantor::Date::fromDbString(row["created_at"].as<std::string>()));
+            return schema::RowDecoder<Trade>(row).decode(row);
         } catch (const std::exception& e) {
             throw std::runtime_error(std::string("Error creating Trade from DB row: ") + e.what());
         }
-        
-        return trade;
     }
 
     std::vector<Trade> Trade::fromDbResult(const drogon::orm::Result& result) {
         std::vector<Trade> trades;
         trades.reserve(result.size());
-        
+
+        // 컬럼 위치는 결과셋당 한 번만 조회
+        const schema::RowDecoder<Trade> decoder(result);
         for (const auto& row : result) {
-            trades.push_back(fromDbRow(row));
+            try {
+                trades.push_back(decoder.decode(row));
+            } catch (const std::exception& e) {
+                throw std::runtime_error(std::string("Error creating Trade from DB row: ") + e.what());
+            }
         }
-        
+
         return trades;
     }
 
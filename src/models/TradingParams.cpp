@@ -0,0 +1,132 @@
+#include "models/TradingParams.h"
+#include <cmath>
+#include <stdexcept>
+
+namespace models {
+
+    namespace {
+
+        int readPeriod(const Json::Value& json, const char* key) {
+            if (!json.isMember(key) || json[key].isNull()) {
+                return 0;
+            }
+            const auto& value = json[key];
+            if (!value.isIntegral() || value.asInt64() < 0 || value.asInt64() > 100000) {
+                throw std::invalid_argument(std::string("Invalid strategy parameter: ") + key);
+            }
+            return value.asInt();
+        }
+
+        double readNonNegative(const Json::Value& json, const char* key) {
+            if (!json.isMember(key) || json[key].isNull()) {
+                return 0.0;
+            }
+            const auto& value = json[key];
+            if (!value.isNumeric()) {
+                throw std::invalid_argument(std::string("Risk parameter must be numeric: ") + key);
+            }
+            const double number = value.asDouble();
+            if (!std::isfinite(number) || number < 0.0) {
+                throw std::invalid_argument(std::string("Risk parameter must be non-negative: ") + key);
+            }
+            return number;
+        }
+
+    } // namespace
+
+    StrategyParams StrategyParams::fromJson(const Json::Value& json) {
+        StrategyParams params;
+        if (json.isNull()) {
+            return params;
+        }
+        if (!json.isObject()) {
+            throw std::invalid_argument("strategy_params must be a JSON object");
+        }
+
+        if (json.isMember("strategy_type")) {
+            if (!json["strategy_type"].isString()) {
+                throw std::invalid_argument("strategy_type must be a string");
+            }
+            params.strategyType = json["strategy_type"].asString();
+        }
+        params.maPeriod = readPeriod(json, "ma_period");
+        params.rsiPeriod = readPeriod(json, "rsi_period");
+
+        // 나머지 숫자 값은 정렬된 배열로 보관 (문자열/객체 값은 무시)
+        for (const auto& name : json.getMemberNames()) {
+            if (name == "strategy_type" || name == "ma_period" || name == "rsi_period") {
+                continue;
+            }
+            const auto& value = json[name];
+            if (value.isNumeric()) {
+                params.extra.emplace_back(name, value.asDouble());
+            }
+        }
+        std::sort(params.extra.begin(), params.extra.end());
+
+        return params;
+    }
+
+    double StrategyParams::numeric(std::string_view name, double fallback) const {
+        auto it = std::lower_bound(extra.begin(), extra.end(), name,
+            [](const std::pair<std::string, double>& entry, std::string_view key) {
+                return std::string_view(entry.first) < key;
+            });
+        if (it != extra.end() && it->first == name) {
+            return it->second;
+        }
+        return fallback;
+    }
+
+    RiskParams RiskParams::fromJson(const Json::Value& json) {
+        RiskParams params;
+        if (json.isNull()) {
+            return params;
+        }
+        if (!json.isObject()) {
+            throw std::invalid_argument("risk_params must be a JSON object");
+        }
+
+        params.maxPositionSize = readNonNegative(json, "max_position_size");
+        params.stopLossPct = readNonNegative(json, "stop_loss_pct");
+        params.takeProfitPct = readNonNegative(json, "take_profit_pct");
+
+        if (params.stopLossPct >= 100.0) {
+            throw std::invalid_argument("stop_loss_pct must be below 100");
+        }
+
+        return params;
+    }
+
+    Watchlist Watchlist::fromJson(const Json::Value& json) {
+        Watchlist watchlist;
+        if (json.isNull()) {
+            return watchlist;
+        }
+        if (!json.isArray()) {
+            throw std::invalid_argument("watchlist must be a JSON array");
+        }
+
+        auto& registry = SymbolRegistry::getInstance();
+        watchlist.symbols.reserve(json.size());
+        watchlist.symbolIds.reserve(json.size());
+        for (const auto& item : json) {
+            if (!item.isString() || item.asString().empty()) {
+                throw std::invalid_argument("watchlist entries must be non-empty strings");
+            }
+            const SymbolId id = registry.intern(item.asString());
+            if (id == SymbolRegistry::INVALID_ID) {
+                throw std::invalid_argument("Invalid watchlist symbol: " + item.asString());
+            }
+            watchlist.symbols.push_back(item.asString());
+            watchlist.symbolIds.push_back(id);
+        }
+
+        std::sort(watchlist.symbolIds.begin(), watchlist.symbolIds.end());
+        watchlist.symbolIds.erase(std::unique(watchlist.symbolIds.begin(), watchlist.symbolIds.end()),
+                                  watchlist.symbolIds.end());
+
+        return watchlist;
+    }
+
+} // namespace models
@@ -0,0 +1,83 @@
+#include "models/TradingParamsStore.h"
+#include <utility>
+
+namespace models {
+
+    TradingParamsStore& TradingParamsStore::getInstance() {
+        static TradingParamsStore instance;
+        return instance;
+    }
+
+    TradingParamsStore::TradingParamsStore()
+        : table_(std::make_shared<const Table>()) {
+    }
+
+    TradingParamsStore::Snapshot TradingParamsStore::get(int64_t settingsId) const {
+        auto table = std::atomic_load_explicit(&table_, std::memory_order_acquire);
+        auto it = table->find(settingsId);
+        return it != table->end() ? it->second : nullptr;
+    }
+
+    void TradingParamsStore::publish(const UserSettings& settings) {
+        auto snapshot = settings.makeTradingParams();
+
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        auto table = std::make_shared<Table>(*std::atomic_load_explicit(&table_, std::memory_order_acquire));
+        (*table)[settings.getId()] = std::move(snapshot);
+        replaceTable(std::move(table));
+    }
+
+    template <typename Mutator>
+    void TradingParamsStore::modify(int64_t settingsId, Mutator&& mutate) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        auto current = std::atomic_load_explicit(&table_, std::memory_order_acquire);
+        auto it = current->find(settingsId);
+        if (it == current->end()) {
+            return;
+        }
+
+        auto updated = std::make_shared<TradingParams>(*it->second);
+        mutate(*updated);
+
+        auto table = std::make_shared<Table>(*current);
+        (*table)[settingsId] = std::move(updated);
+        replaceTable(std::move(table));
+    }
+
+    void TradingParamsStore::updateStrategy(int64_t settingsId, const StrategyParams& strategy) {
+        modify(settingsId, [&strategy](TradingParams& params) { params.strategy = strategy; });
+    }
+
+    void TradingParamsStore::updateRisk(int64_t settingsId, const RiskParams& risk) {
+        modify(settingsId, [&risk](TradingParams& params) { params.risk = risk; });
+    }
+
+    void TradingParamsStore::updateWatchlist(int64_t settingsId, const Watchlist& watchlist) {
+        modify(settingsId, [&watchlist](TradingParams& params) { params.watchlist = watchlist; });
+    }
+
+    void TradingParamsStore::updateAutoTrade(int64_t settingsId, bool enabled) {
+        modify(settingsId, [enabled](TradingParams& params) { params.autoTradeEnabled = enabled; });
+    }
+
+    void TradingParamsStore::remove(int64_t settingsId) {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        auto current = std::atomic_load_explicit(&table_, std::memory_order_acquire);
+        if (current->find(settingsId) == current->end()) {
+            return;
+        }
+        auto table = std::make_shared<Table>(*current);
+        table->erase(settingsId);
+        replaceTable(std::move(table));
+    }
+
+    void TradingParamsStore::clear() {
+        std::lock_guard<std::mutex> lock(writeMutex_);
+        replaceTable(std::make_shared<const Table>());
+    }
+
+    void TradingParamsStore::replaceTable(std::shared_ptr<const Table> table) {
+        std::atomic_store_explicit(&table_, std::move(table), std::memory_order_release);
+    }
+
+} // namespace models
@@ -4,18 +4,11 @@
 namespace models {
 
     Json::Value TradingSignal::toJson() const {
-        Json::Value json;
-        json["id"] = static_cast<Json::Int64>(id_);
-        json["symbol"] = symbol_;
-        json["signal_type"] = signal_type_;
-        json["price"] = price_;
-        json["quantity"] = quantity_;
-        json["strategy_name"] = strategy_name_;
-        json["confidence"] = confidence_;
-        json["parameters"] = parameters_;
-        json["timestamp"] = timestamp_.toFormattedString(false);
-        json["created_at"] = created_at_.toFormattedString(false);
-        return json;
+        return schema::toJson(*this);
+    }
+
+    void TradingSignal::writeJson(utils::JsonWriter& writer) const {
+        schema::writeJson(*this, writer);
     }
 
     void TradingSignal::fromJson(const Json::Value& json) {
@@ -31,7 +24,8 @@ namespace models {
         }
 
         // 필드 값 설정
-        symbol_ = json["symbol"].asString();
+        SymbolRegistry::validate(json["symbol"].asString());
+        setSymbol(json["symbol"].asString());
         signal_type_ = json["signal_type"].asString();
         
         // signal_type 유효성 검사
@@ -70,41 +64,27 @@ namespace models {
     }
 
     TradingSignal TradingSignal::fromDbRow(const drogon::orm::Row& row) {
-        TradingSignal signal;
-        
         try {
-            signal.setId(row["id"].as<int64_t>());
-            signal.setSymbol(row["symbol"].as<std::string>());
-            signal.setSignalType(row["signal_type"].as<std::string>());
-            signal.setPrice(row["price"].as<double>());
-            signal.setQuantity(row["quantity"].as<double>());
-            signal.setStrategyName(row["strategy_name"].as<std::string>());
-            signal.setConfidence(row["confidence"].as<double>());
-            
-            // JSONB 필드 파싱
-            Json::Reader reader;
-            Json::Value parameters;
-            if (reader.parse(row["parameters"].as<std::string>(), parameters)) {
-                signal.setParameters(parameters);
-            }
-            
-            signal.setTimestamp(trantor::Date::fromDbString(row["timestamp"].as<std::string>()));
-            signal.setCreatedAt(trantor::Date::fromDbString(row["created_at"].as<std::string>()));
+            return schema::RowDecoder<TradingSignal>(row).decode(row);
         } catch (const std::exception& e) {
             throw std::runtime_error(std::string("Error creating TradingSignal from DB row: ") + e.what());
         }
-        
-        return signal;
     }
 
     std::vector<TradingSignal> TradingSignal::fromDbResult(const drogon::orm::Result& result) {
         std::vector<TradingSignal> signals;
         signals.reserve(result.size());
-        
+
+        // 컬럼 위치는 결과셋당 한 번만 조회
+        const schema::RowDecoder<TradingSignal> decoder(result);
         for (const auto& row : result) {
-            signals.push_back(fromDbRow(row));
+            try {
+                signals.push_back(decoder.decode(row));
+            } catch (const std::exception& e) {
+                throw std::runtime_error(std::string("Error creating TradingSignal from DB row: ") + e.what());
+            }
         }
-        
+
         return signals;
     }
 
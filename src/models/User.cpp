@@ -4,15 +4,11 @@
 namespace models {
 
     Json::Value User::toJson() const {
-        Json::Value json;
-        json["id"] = static_cast<Json::Int64>(id_);
-        json["email"] = email_;
-        json["username"] = username_;
-        json["is_active"] = is_active_;
-        json["last_login_at"] = last_login_at_.toFormattedString(false);
-        json["created_at"] = created_at_.toFormattedString(false);
-        json["updated_at"] = updated_at_.toFormattedString(false);
-        return json;
+        return schema::toJson(*this);
+    }
+
+    void User::writeJson(utils::JsonWriter& writer) const {
+        schema::writeJson(*this, writer);
     }
 
     void User::fromJson(const Json::Value& json) {
@@ -49,26 +45,27 @@ namespace models {
     }
 
     User User::fromDbRow(const drogon::orm::Row& row) {
-        User user;
-        user.setId(row["id"].as<int64_t>());
-        user.setEmail(row["email"].as<std::string>());
-        user.setUsername(row["username"].as<std::string>());
-        user.setPasswordHash(row["password_hash"].as<std::string>());
-        user.setIsActive(row["is_active"].as<bool>());
-        user.setLastLoginAt(trantor::Date::fromDbString(row["last_login_at"].as<std::string>()));
-        user.setCreatedAt(trantor::Date::fromDbString(row["created_at"].as<std::string>()));
-        user.setUpdatedAt(trantor::Date::fromDbString(row["updated_at"].as<std::string>()));
-        return user;
+        try {
+            return schema::RowDecoder<User>(row).decode(row);
+        } catch (const std::exception& e) {
+            throw std::runtime_error(std::string("Error creating User from DB row: ") + e.what());
+        }
     }
 
     std::vector<User> User::fromDbResult(const drogon::orm::Result& result) {
         std::vector<User> users;
         users.reserve(result.size());
-        
+
+        // 컬럼 위치는 결과셋당 한 번만 조회
+        const schema::RowDecoder<User> decoder(result);
         for (const auto& row : result) {
-            users.push_back(fromDbRow(row));
+            try {
+                users.push_back(decoder.decode(row));
+            } catch (const std::exception& e) {
+                throw std::runtime_error(std::string("Error creating User from DB row: ") + e.what());
+            }
         }
-        
+
         return users;
     }
 
@@ -5,18 +5,38 @@
 namespace models {
 
     Json::Value UserSettings::toJson() const {
-        Json::Value json;
-        json["id"] = static_cast<Json::Int64>(id_);
-        json["user_id"] = static_cast<Json::Int64>(user_id_);
-        json["exchange_name"] = exchange_name_;
-        json["api_credentials"] = api_credentials_;
-        json["strategy_params"] = strategy_params_;
-        json["watchlist"] = watchlist_;
-        json["risk_params"] = risk_params_;
-        json["auto_trade_enabled"] = auto_trade_enabled_;
-        json["created_at"] = created_at_.toFormattedString(false);
-        json["updated_at"] = updated_at_.toFormattedString(false);
-        return json;
+        return schema::toJson(*this);
+    }
+
+    void UserSettings::writeJson(utils::JsonWriter& writer) const {
+        schema::writeJson(*this, writer);
+    }
+
+    void UserSettings::setStrategyParams(const Json::Value& strategy_params) {
+        parsed_strategy_params_ = StrategyParams::fromJson(strategy_params);
+        strategy_params_ = strategy_params;
+    }
+
+    void UserSettings::setWatchlist(const Json::Value& watchlist) {
+        parsed_watchlist_ = Watchlist::fromJson(watchlist);
+        watchlist_ = watchlist;
+    }
+
+    void UserSettings::setRiskParams(const Json::Value& risk_params) {
+        parsed_risk_params_ = RiskParams::fromJson(risk_params);
+        risk_params_ = risk_params;
+    }
+
+    std::shared_ptr<const TradingParams> UserSettings::makeTradingParams() const {
+        auto params = std::make_shared<TradingParams>();
+        params->settingsId = id_;
+        params->userId = user_id_;
+        params->exchangeName = exchange_name_;
+        params->autoTradeEnabled = auto_trade_enabled_;
+        params->strategy = parsed_strategy_params_;
+        params->risk = parsed_risk_params_;
+        params->watchlist = parsed_watchlist_;
+        return params;
     }
 
     void UserSettings::fromJson(const Json::Value& json) {
@@ -36,15 +56,15 @@ namespace models {
         }
 
         if (json.isMember("strategy_params")) {
-            strategy_params_ = json["strategy_params"];
+            setStrategyParams(json["strategy_params"]);
         }
 
         if (json.isMember("watchlist")) {
-            watchlist_ = json["watchlist"];
+            setWatchlist(json["watchlist"]);
         }
 
         if (json.isMember("risk_params")) {
-            risk_params_ = json["risk_params"];
+            setRiskParams(json["risk_params"]);
         }
 
         if (json.isMember("auto_trade_enabled")) {
@@ -61,28 +81,27 @@ namespace models {
     }
 
     UserSettings UserSettings::fromDbRow(const drogon::orm::Row& row) {
-        UserSettings settings;
-        settings.setId(row["id"].as<int64_t>());
-        settings.setUserId(row["user_id"].as<int64_t>());
-        settings.setExchangeName(row["exchange_name"].as<std::string>());
-        settings.setApiCredentials(utils::JsonUtils::parseJson(row["api_credentials"].as<std::string>()));
-        settings.setStrategyParams(utils::JsonUtils::parseJson(row["strategy_params"].as<std::string>()));
-        settings.setWatchlist(utils::JsonUtils::parseJson(row["watchlist"].as<std::string>()));
-        settings.setRiskParams(utils::JsonUtils::parseJson(row["risk_params"].as<std::string>()));
-        settings.setAutoTradeEnabled(row["auto_trade_enabled"].as<bool>());
-        settings.setCreatedAt(trantor::Date::fromDbString(row["created_at"].as<std::string>()));
-        settings.setUpdatedAt(trantor::Date::fromDbString(row["updated_at"].as<std::string>()));
-        return settings;
+        try {
+            return schema::RowDecoder<UserSettings>(row).decode(row);
+        } catch (const std::exception& e) {
+            throw std::runtime_error(std::string("Error creating UserSettings from DB row: ") + e.what());
+        }
     }
 
     std::vector<UserSettings> UserSettings::fromDbResult(const drogon::orm::Result& result) {
         std::vector<UserSettings> settingsList;
         settingsList.reserve(result.size());
-        
+
+        // 컬럼 위치는 결과셋당 한 번만 조회
+        const schema::RowDecoder<UserSettings> decoder(result);
         for (const auto& row : result) {
-            settingsList.push_back(fromDbRow(row));
+            try {
+                settingsList.push_back(decoder.decode(row));
+            } catch (const std::exception& e) {
+                throw std::runtime_error(std::string("Error creating UserSettings from DB row: ") + e.what());
+            }
         }
-        
+
         return settingsList;
     }
 
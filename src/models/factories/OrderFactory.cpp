@@ -22,11 +22,17 @@ namespace models {
         std::vector<std::shared_ptr<BaseModel>> OrderFactory::createFromDbResult(const drogon::orm::Result& result) const {
             std::vector<std::shared_ptr<BaseModel>> orders;
             orders.reserve(result.size());
-            
+
+            // 컬럼 위치는 결과셋당 한 번만 조회
+            const schema::RowDecoder<Order> decoder(result);
             for (const auto& row : result) {
-                orders.push_back(createFromDbRow(row));
+                try {
+                    orders.push_back(std::make_shared<Order>(decoder.decode(row)));
+                } catch (const std::exception& e) {
+                    throw std::runtime_error(std::string("Error in OrderFactory::createFromDbResult: ") + e.what());
+                }
             }
-            
+
             return orders;
         }
 
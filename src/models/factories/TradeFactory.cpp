@@ -22,11 +22,17 @@ namespace models {
         std::vector<std::shared_ptr<BaseModel>> TradeFactory::createFromDbResult(const drogon::orm::Result& result) const {
             std::vector<std::shared_ptr<BaseModel>> trades;
             trades.reserve(result.size());
-            
+
+            // 컬럼 위치는 결과셋당 한 번만 조회
+            const schema::RowDecoder<Trade> decoder(result);
             for (const auto& row : result) {
-                trades.push_back(createFromDbRow(row));
+                try {
+                    trades.push_back(std::make_shared<Trade>(decoder.decode(row)));
+                } catch (const std::exception& e) {
+                    throw std::runtime_error(std::string("Error in TradeFactory::createFromDbResult: ") + e.what());
+                }
             }
-            
+
             return trades;
         }
 
@@ -22,11 +22,17 @@ namespace models {
         std::vector<std::shared_ptr<BaseModel>> TradingSignalFactory::createFromDbResult(const drogon::orm::Result& result) const {
             std::vector<std::shared_ptr<BaseModel>> signals;
             signals.reserve(result.size());
-            
+
+            // 컬럼 위치는 결과셋당 한 번만 조회
+            const schema::RowDecoder<TradingSignal> decoder(result);
             for (const auto& row : result) {
-                signals.push_back(createFromDbRow(row));
+                try {
+                    signals.push_back(std::make_shared<TradingSignal>(decoder.decode(row)));
+                } catch (const std::exception& e) {
+                    throw std::runtime_error(std::string("Error in TradingSignalFactory::createFromDbResult: ") + e.what());
+                }
             }
-            
+
             return signals;
         }
 
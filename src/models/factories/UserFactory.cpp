@@ -22,11 +22,17 @@ namespace models {
         std::vector<std::shared_ptr<BaseModel>> UserFactory::createFromDbResult(const drogon::orm::Result& result) const {
             std::vector<std::shared_ptr<BaseModel>> users;
             users.reserve(result.size());
-            
+
+            // 컬럼 위치는 결과셋당 한 번만 조회
+            const schema::RowDecoder<User> decoder(result);
             for (const auto& row : result) {
-                users.push_back(createFromDbRow(row));
+                try {
+                    users.push_back(std::make_shared<User>(decoder.decode(row)));
+                } catch (const std::exception& e) {
+                    throw std::runtime_error(std::string("Error in UserFactory::createFromDbResult: ") + e.what());
+                }
             }
-            
+
             return users;
         }
 
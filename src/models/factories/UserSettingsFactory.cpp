@@ -22,11 +22,17 @@ namespace models {
         std::vector<std::shared_ptr<BaseModel>> UserSettingsFactory::createFromDbResult(const drogon::orm::Result& result) const {
             std::vector<std::shared_ptr<BaseModel>> settingsList;
             settingsList.reserve(result.size());
-            
+
+            // 컬럼 위치는 결과셋당 한 번만 조회
+            const schema::RowDecoder<UserSettings> decoder(result);
             for (const auto& row : result) {
-                settingsList.push_back(createFromDbRow(row));
+                try {
+                    settingsList.push_back(std::make_shared<UserSettings>(decoder.decode(row)));
+                } catch (const std::exception& e) {
+                    throw std::runtime_error(std::string("Error in UserSettingsFactory::createFromDbResult: ") + e.what());
+                }
             }
-            
+
             return settingsList;
         }
 
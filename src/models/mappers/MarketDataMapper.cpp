@@ -1,30 +1,139 @@
 #include "models/mappers/MarketDataMapper.h"
+#include "models/SchemaKeyset.h"
+#include "models/SchemaBatch.h"
+#include "common/Config.h"
+#include <algorithm>
+#include <array>
+#include <charconv>
 #include <stdexcept>
+#include <tuple>
 
 namespace models {
     namespace mappers {
 
+        namespace {
+
+            // 시각은 epoch 마이크로초 bigint 배열로 전달 (문자열 포맷/해석 없음)
+            const char* const UPSERT_BARS_SQL =
+                "INSERT INTO market_bars AS b (symbol, resolution, open_time, open, high, low, close, "
+                "volume, tick_count, first_tick_at, last_tick_at) "
+                "SELECT u.symbol, u.resolution, TIMESTAMPTZ 'epoch' + u.open_us * INTERVAL '1 microsecond', "
+                "u.open, u.high, u.low, u.close, u.volume, u.tick_count, "
+                "TIMESTAMPTZ 'epoch' + u.first_us * INTERVAL '1 microsecond', "
+                "TIMESTAMPTZ 'epoch' + u.last_us * INTERVAL '1 microsecond' "
+                "FROM unnest($1::text[], $2::text[], $3::bigint[], $4::numeric[], $5::numeric[], $6::numeric[], "
+                "$7::numeric[], $8::numeric[], $9::bigint[], $10::bigint[], $11::bigint[]) "
+                "AS u(symbol, resolution, open_us, open, high, low, close, volume, tick_count, first_us, last_us) "
+                "ON CONFLICT (resolution, symbol, open_time) DO UPDATE SET "
+                "open = CASE WHEN EXCLUDED.first_tick_at < b.first_tick_at THEN EXCLUDED.open ELSE b.open END, "
+                "close = CASE WHEN EXCLUDED.last_tick_at >= b.last_tick_at THEN EXCLUDED.close ELSE b.close END, "
+                "first_tick_at = LEAST(b.first_tick_at, EXCLUDED.first_tick_at), "
+                "last_tick_at = GREATEST(b.last_tick_at, EXCLUDED.last_tick_at), "
+                "high = GREATEST(b.high, EXCLUDED.high), "
+                "low = LEAST(b.low, EXCLUDED.low), "
+                "volume = b.volume + EXCLUDED.volume, "
+                "tick_count = b.tick_count + EXCLUDED.tick_count, "
+                "updated_at = CURRENT_TIMESTAMP";
+
+            // 비동기 경로는 풀 객체를 값으로 복사해 반환 (BaseRepository의 *Via 공통 구현용)
+            std::vector<MarketData> toValues(const drogon::orm::Result& result) {
+                std::vector<MarketData> values;
+                values.reserve(result.size());
+                for (const auto& row : MarketData::fromDbResult(result)) {
+                    values.push_back(*row);
+                }
+                return values;
+            }
+
+            template <typename Number>
+            void appendNumber(std::string& out, Number value) {
+                char buffer[32];
+                out.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), value).ptr);
+            }
+
+        } // namespace
+
         MarketDataMapper& MarketDataMapper::getInstance() {
             static MarketDataMapper instance;
             return instance;
         }
 
+        // find_by_id(s) / deleteById / update(WHERE id)는 timestamp 조건이 없어 보존 중인 일 단위 파티션을 모두 확인
+        // (id만 가진 호출자용. 시간 범위를 아는 조회는 findByTimeRange 계열 사용)
+        MarketDataMapper::MarketDataMapper()
+            : findByIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_by_id",
+                  "SELECT * FROM market_data WHERE id = $1",
+                  int64_t{0})),
+              findByIdsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_by_ids",
+                  "SELECT * FROM market_data WHERE id = ANY($1::bigint[])",
+                  std::string("{}"))),
+              findLatestBySymbolStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_latest_by_symbol",
+                  "SELECT * FROM market_data WHERE symbol = $1 ORDER BY timestamp DESC LIMIT 1",
+                  std::string())),
+              findBySymbolWithLimitStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_by_symbol_with_limit",
+                  "SELECT * FROM market_data WHERE symbol = $1 ORDER BY timestamp DESC LIMIT $2",
+                  std::string(), size_t{1})),
+              deleteByIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.delete_by_id",
+                  "DELETE FROM market_data WHERE id = $1",
+                  int64_t{0})),
+              pageStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_with_paging",
+                  "SELECT * FROM market_data ORDER BY timestamp DESC LIMIT $1 OFFSET $2",
+                  size_t{1}, size_t{0})),
+              // 전체 COUNT와 활성 심볼 집계는 warmup만으로 테이블 전체를 읽으므로 warmup 제외
+              countStatement_(database::StatementRegistry::getInstance().registerWithoutWarmup(
+                  "market_data.count",
+                  "SELECT COUNT(*) as count FROM market_data")),
+              firstPageStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.keyset_first_page",
+                  schema::keysetFirstPageSql<MarketData>(),
+                  size_t{1})),
+              nextPageStatement_(schema::nextPageStatement<MarketData>()),
+              rangeChunkStatement_(schema::rangeChunkStatement<MarketData>()),
+              approximateCountStatement_(schema::approximateCountStatement()),
+              findBySymbolAndTimeRangeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_by_symbol_and_time_range",
+                  "SELECT * FROM market_data WHERE symbol = $1 "
+                  "AND timestamp BETWEEN $2 AND $3 ORDER BY timestamp DESC",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              findBatchBySymbolAndTimeRangeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_data.find_batch_by_symbol_and_time_range",
+                  "SELECT price, volume, timestamp FROM market_data WHERE symbol = $1 "
+                  "AND timestamp BETWEEN $2 AND $3 ORDER BY timestamp ASC",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              activeSymbolsStatement_(database::StatementRegistry::getInstance().registerWithoutWarmup(
+                  "market_data.active_symbols",
+                  "SELECT symbol FROM market_data WHERE timestamp >= $1 "
+                  "GROUP BY symbol HAVING COUNT(*) >= $2 ORDER BY symbol")),
+              // 빈 배열이면 unnest가 0행이라 쓰기 없음
+              upsertBarsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_bars.upsert",
+                  UPSERT_BARS_SQL,
+                  std::string("{}"), std::string("{}"), std::string("{}"), std::string("{}"),
+                  std::string("{}"), std::string("{}"), std::string("{}"), std::string("{}"),
+                  std::string("{}"), std::string("{}"), std::string("{}"))),
+              findBarsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "market_bars.find_range",
+                  "SELECT * FROM market_bars WHERE resolution = $1 AND symbol = $2 "
+                  "AND open_time >= TIMESTAMPTZ 'epoch' + $3 * INTERVAL '1 microsecond' "
+                  "AND open_time < TIMESTAMPTZ 'epoch' + $4 * INTERVAL '1 microsecond' "
+                  "ORDER BY open_time ASC",
+                  std::string(), std::string(), int64_t{0}, int64_t{0})) {
+            // 단건 INSERT/UPDATE 문장도 시작 시 등록 (warmup 제외, ModelSchema.h)
+            schema::insertStatement<MarketData>();
+            schema::updateStatement<MarketData>();
+        }
+
         std::shared_ptr<MarketData> MarketDataMapper::insert(
             const std::shared_ptr<MarketData>& marketData,
             Transaction& transaction
         ) {
-            const auto sql = 
-                "INSERT INTO market_data (symbol, price, volume, timestamp, source) "
-                "VALUES ($1, $2, $3, $4, $5) RETURNING *";
-            
-            auto result = transaction.execSqlSync(
-                sql,
-                marketData->getSymbol(),
-                marketData->getPrice(),
-                marketData->getVolume(),
-                marketData->getTimestamp().toFormattedString(false),
-                marketData->getSource()
-            );
+            auto result = schema::execInsert(transaction, *marketData);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert market data");
@@ -34,18 +143,7 @@ namespace models {
         }
 
         std::shared_ptr<MarketData> MarketDataMapper::insert(const std::shared_ptr<MarketData>& marketData) {
-            const auto sql = 
-                "INSERT INTO market_data (symbol, price, volume, timestamp, source) "
-                "VALUES ($1, $2, $3, $4, $5) RETURNING *";
-            
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                marketData->getSymbol(),
-                marketData->getPrice(),
-                marketData->getVolume(),
-                marketData->getTimestamp().toFormattedString(false),
-                marketData->getSource()
-            );
+            auto result = schema::execInsert(*getDbClient(), *marketData);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert market data");
@@ -55,9 +153,7 @@ namespace models {
         }
 
         std::shared_ptr<MarketData> MarketDataMapper::findById(int64_t id) {
-            const auto sql = "SELECT * FROM market_data WHERE id = $1";
-            
-            auto result = getDbClient()->execSqlSync(sql, id);
+            auto result = database::StatementRegistry::execute(*getReadDbClient(), findByIdStatement_, id);
             if (result.empty()) {
                 throw std::runtime_error("Market data not found with id: " + std::to_string(id));
             }
@@ -65,32 +161,100 @@ namespace models {
             return MarketData::fromDbRow(result[0]);
         }
 
+        std::vector<std::shared_ptr<MarketData>> MarketDataMapper::findByIds(std::span<const int64_t> ids) {
+            std::vector<std::shared_ptr<MarketData>> found;
+            for (size_t offset = 0; offset < ids.size(); offset += common::BatchConfig::MAX_ROWS_PER_STATEMENT) {
+                const auto chunk = ids.subspan(
+                    offset, std::min(common::BatchConfig::MAX_ROWS_PER_STATEMENT, ids.size() - offset));
+                auto result = database::StatementRegistry::execute(
+                    *getReadDbClient(), findByIdsStatement_, schema::bigintArray(chunk));
+                auto rows = MarketData::fromDbResult(result);
+                found.insert(found.end(), std::make_move_iterator(rows.begin()), std::make_move_iterator(rows.end()));
+            }
+            return found;
+        }
+
         std::vector<std::shared_ptr<MarketData>> MarketDataMapper::findWithPaging(size_t limit, size_t offset) {
-            const auto sql = "SELECT * FROM market_data ORDER BY timestamp DESC LIMIT $1 OFFSET $2";
-            auto result = getDbClient()->execSqlSync(sql, limit, offset);
+            auto result = database::StatementRegistry::execute(*getReadDbClient(), pageStatement_, limit, offset);
             return MarketData::fromDbResult(result);
         }
 
         size_t MarketDataMapper::count() {
-            const auto sql = "SELECT COUNT(*) as count FROM market_data";
-            auto result = getDbClient()->execSqlSync(sql);
+            auto result = database::StatementRegistry::execute(*getReadDbClient(), countStatement_);
             return result[0]["count"].as<size_t>();
         }
 
+        std::vector<std::shared_ptr<MarketData>> MarketDataMapper::findFirstPage(size_t limit) {
+            auto result = database::StatementRegistry::execute(*getReadDbClient(), firstPageStatement_, limit);
+            return MarketData::fromDbResult(result);
+        }
+
+        std::vector<std::shared_ptr<MarketData>> MarketDataMapper::findPageAfter(
+            int64_t afterTimestampMicros,
+            int64_t afterId,
+            size_t limit
+        ) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), nextPageStatement_, afterTimestampMicros, afterId, limit);
+            return MarketData::fromDbResult(result);
+        }
+
+        size_t MarketDataMapper::approximateCount() {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), approximateCountStatement_, std::string(schema::ModelSchema<MarketData>::TABLE));
+            const auto estimate = result[0]["estimate"].as<int64_t>();
+            if (estimate < static_cast<int64_t>(common::PaginationConfig::EXACT_COUNT_THRESHOLD)) {
+                return count();
+            }
+            return static_cast<size_t>(estimate);
+        }
+
+        size_t MarketDataMapper::forEachInRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end,
+            const RowVisitor& visitor,
+            size_t fetchSize
+        ) {
+            if (fetchSize == 0) {
+                throw std::invalid_argument("Fetch size must be positive");
+            }
+            const int64_t endMicros = end.microSecondsSinceEpoch();
+            int64_t afterMicros = start.microSecondsSinceEpoch();
+            int64_t afterId = 0;
+            size_t visited = 0;
+
+            for (;;) {
+                auto result = database::StatementRegistry::execute(
+                    *getReadDbClient(), rangeChunkStatement_, symbol, afterMicros, afterId, endMicros, fetchSize);
+                // 청크 안에서 행마다 풀 객체 하나를 디코딩/방문 후 반환하므로 상주 객체는 최대 1개
+                const schema::RowDecoder<MarketData> decoder(result);
+                for (const auto& row : result) {
+                    auto data = MarketData::fromDbRow(row, decoder);
+                    ++visited;
+                    if (!visitor(*data)) {
+                        return visited;
+                    }
+                    afterMicros = data->getTimestamp().microSecondsSinceEpoch();
+                    afterId = data->getId();
+                }
+                if (result.size() < fetchSize) {
+                    return visited;
+                }
+            }
+        }
+
         void MarketDataMapper::update(const std::shared_ptr<MarketData>& marketData, Transaction& transaction) {
-            const auto sql = 
-                "UPDATE market_data SET symbol = $1, price = $2, volume = $3, "
-                "timestamp = $4, source = $5 WHERE id = $6";
-            
-            auto result = transaction.execSqlSync(
-                sql,
-                marketData->getSymbol(),
-                marketData->getPrice(),
-                marketData->getVolume(),
-                marketData->getTimestamp().toFormattedString(false),
-                marketData->getSource(),
-                marketData->getId()
-            );
+            auto result = schema::execUpdate(transaction, *marketData);
+
+            if (result.affectedRows() == 0) {
+                throw std::runtime_error("Market data not found for update, id: " + 
+                    std::to_string(marketData->getId()));
+            }
+        }
+
+        void MarketDataMapper::update(const std::shared_ptr<MarketData>& marketData) {
+            auto result = schema::execUpdate(*getDbClient(), *marketData);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("Market data not found for update, id: " + 
@@ -99,20 +263,100 @@ namespace models {
         }
 
         void MarketDataMapper::deleteById(int64_t id, Transaction& transaction) {
-            const auto sql = "DELETE FROM market_data WHERE id = $1";
-            auto result = transaction.execSqlSync(sql, id);
+            auto result = database::StatementRegistry::execute(transaction, deleteByIdStatement_, id);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("Market data not found for deletion, id: " + std::to_string(id));
             }
         }
 
+        void MarketDataMapper::deleteById(int64_t id) {
+            auto result = database::StatementRegistry::execute(*getDbClient(), deleteByIdStatement_, id);
+
+            if (result.affectedRows() == 0) {
+                throw std::runtime_error("Market data not found for deletion, id: " + std::to_string(id));
+            }
+        }
+
+        drogon::Task<MarketData> MarketDataMapper::insertAsync(MarketData marketData) {
+            auto result = co_await std::apply(
+                [client = getDbClient()](const auto&... params) {
+                    return database::StatementRegistry::executeCoro(
+                        client, schema::insertStatement<MarketData>(), params...);
+                },
+                schema::insertParams(marketData)
+            );
+            if (result.empty()) {
+                throw std::runtime_error("Failed to insert market data");
+            }
+            co_return *MarketData::fromDbRow(result[0]);
+        }
+
+        drogon::Task<MarketData> MarketDataMapper::findByIdAsync(int64_t id) {
+            auto result = co_await database::StatementRegistry::executeCoro(
+                getReadDbClient(), findByIdStatement_, id);
+            if (result.empty()) {
+                throw std::runtime_error("Market data not found with id: " + std::to_string(id));
+            }
+            co_return *MarketData::fromDbRow(result[0]);
+        }
+
+        drogon::Task<> MarketDataMapper::updateAsync(MarketData marketData) {
+            auto result = co_await std::apply(
+                [client = getDbClient()](const auto&... params) {
+                    return database::StatementRegistry::executeCoro(
+                        client, schema::updateStatement<MarketData>(), params...);
+                },
+                schema::updateParams(marketData)
+            );
+            if (result.affectedRows() == 0) {
+                throw std::runtime_error("Market data not found for update, id: " +
+                    std::to_string(marketData.getId()));
+            }
+        }
+
+        drogon::Task<> MarketDataMapper::deleteByIdAsync(int64_t id) {
+            auto result = co_await database::StatementRegistry::executeCoro(getDbClient(), deleteByIdStatement_, id);
+            if (result.affectedRows() == 0) {
+                throw std::runtime_error("Market data not found for deletion, id: " + std::to_string(id));
+            }
+        }
+
+        drogon::Task<std::vector<MarketData>> MarketDataMapper::findWithPagingAsync(size_t limit, size_t offset) {
+            auto result = co_await database::StatementRegistry::executeCoro(
+                getReadDbClient(), pageStatement_, limit, offset);
+            co_return toValues(result);
+        }
+
+        drogon::Task<std::vector<MarketData>> MarketDataMapper::findFirstPageAsync(size_t limit) {
+            auto result = co_await database::StatementRegistry::executeCoro(getReadDbClient(), firstPageStatement_, limit);
+            co_return toValues(result);
+        }
+
+        drogon::Task<std::vector<MarketData>> MarketDataMapper::findPageAfterAsync(
+            int64_t afterTimestampMicros,
+            int64_t afterId,
+            size_t limit
+        ) {
+            auto result = co_await database::StatementRegistry::executeCoro(
+                getReadDbClient(), nextPageStatement_, afterTimestampMicros, afterId, limit);
+            co_return toValues(result);
+        }
+
+        drogon::Task<size_t> MarketDataMapper::approximateCountAsync() {
+            auto result = co_await database::StatementRegistry::executeCoro(
+                getReadDbClient(), approximateCountStatement_, std::string(schema::ModelSchema<MarketData>::TABLE));
+            const auto estimate = result[0]["estimate"].as<int64_t>();
+            if (estimate < static_cast<int64_t>(common::PaginationConfig::EXACT_COUNT_THRESHOLD)) {
+                auto counted = co_await database::StatementRegistry::executeCoro(getReadDbClient(), countStatement_);
+                co_return counted[0]["count"].as<size_t>();
+            }
+            co_return static_cast<size_t>(estimate);
+        }
+
         std::shared_ptr<MarketData> MarketDataMapper::findLatestBySymbol(const std::string& symbol) {
-            const auto sql = 
-                "SELECT * FROM market_data WHERE symbol = $1 "
-                "ORDER BY timestamp DESC LIMIT 1";
-            
-            auto result = getDbClient()->execSqlSync(sql, symbol);
+            auto result = database::StatementRegistry::execute(
+                *database::DbRouter::primary(), findLatestBySymbolStatement_, symbol);
             if (result.empty()) {
                 throw std::runtime_error("No market data found for symbol: " + symbol);
             }
@@ -124,13 +368,145 @@ namespace models {
             const std::string& symbol,
             size_t limit
         ) {
-            const auto sql = 
-                "SELECT * FROM market_data WHERE symbol = $1 "
-                "ORDER BY timestamp DESC LIMIT $2";
-            
-            auto result = getDbClient()->execSqlSync(sql, symbol, limit);
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), findBySymbolWithLimitStatement_, symbol, limit);
+            return MarketData::fromDbResult(result);
+        }
+
+        std::vector<std::shared_ptr<MarketData>> MarketDataMapper::findBySymbolAndTimeRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end,
+            Transaction& transaction
+        ) {
+            auto result = database::StatementRegistry::execute(
+                transaction,
+                findBySymbolAndTimeRangeStatement_,
+                symbol,
+                start.toFormattedString(false),
+                end.toFormattedString(false)
+            );
             return MarketData::fromDbResult(result);
         }
 
+        std::vector<std::shared_ptr<MarketData>> MarketDataMapper::findBySymbolAndTimeRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end
+        ) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBySymbolAndTimeRangeStatement_,
+                symbol,
+                start.toFormattedString(false),
+                end.toFormattedString(false)
+            );
+            return MarketData::fromDbResult(result);
+        }
+
+        MarketDataBatch MarketDataMapper::findBatchBySymbolAndTimeRange(
+            const std::string& symbol,
+            const trantor::Date& start,
+            const trantor::Date& end
+        ) {
+            // 분석에 필요한 컬럼만 조회
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBatchBySymbolAndTimeRangeStatement_,
+                symbol,
+                start.toFormattedString(false),
+                end.toFormattedString(false)
+            );
+
+            auto batch = MarketDataBatch::fromDbResult(result);
+            batch.setSymbolId(SymbolRegistry::getInstance().intern(symbol));
+            return batch;
+        }
+
+        std::vector<std::string> MarketDataMapper::getActiveSymbols(
+            const trantor::Date& since,
+            size_t minDataPoints
+        ) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                activeSymbolsStatement_,
+                since.toFormattedString(false),
+                static_cast<int64_t>(minDataPoints)
+            );
+
+            std::vector<std::string> symbols;
+            symbols.reserve(result.size());
+            for (const auto& row : result) {
+                symbols.push_back(row["symbol"].as<std::string>());
+            }
+            return symbols;
+        }
+
+        size_t MarketDataMapper::upsertBars(const std::vector<CandleBar>& bars) {
+            if (bars.empty()) {
+                return 0;
+            }
+
+            auto transaction = getDbClient()->newTransaction();
+            size_t written = 0;
+            for (size_t begin = 0; begin < bars.size(); begin += common::BatchConfig::MAX_ROWS_PER_STATEMENT) {
+                const size_t end = std::min(bars.size(), begin + common::BatchConfig::MAX_ROWS_PER_STATEMENT);
+                std::array<std::string, 11> columns;
+                columns.fill("{");
+                for (size_t i = begin; i < end; ++i) {
+                    const auto& bar = bars[i];
+                    if (i > begin) {
+                        for (auto& column : columns) {
+                            column += ',';
+                        }
+                    }
+                    schema::detail::appendQuoted(columns[0], SymbolRegistry::getInstance().name(bar.symbolId));
+                    schema::detail::appendQuoted(columns[1], toString(bar.resolution));
+                    appendNumber(columns[2], bar.openTimeMicros);
+                    appendNumber(columns[3], bar.open);
+                    appendNumber(columns[4], bar.high);
+                    appendNumber(columns[5], bar.low);
+                    appendNumber(columns[6], bar.close);
+                    appendNumber(columns[7], bar.volume);
+                    appendNumber(columns[8], bar.tickCount);
+                    appendNumber(columns[9], bar.firstTickMicros);
+                    appendNumber(columns[10], bar.lastTickMicros);
+                }
+                for (auto& column : columns) {
+                    column += '}';
+                }
+                written += database::StatementRegistry::execute(
+                    *transaction,
+                    upsertBarsStatement_,
+                    columns[0], columns[1], columns[2], columns[3], columns[4], columns[5],
+                    columns[6], columns[7], columns[8], columns[9], columns[10]
+                ).affectedRows();
+            }
+            return written;
+        }
+
+        std::vector<CandleBar> MarketDataMapper::findBars(
+            const std::string& symbol,
+            BarResolution resolution,
+            int64_t fromMicros,
+            int64_t toMicros
+        ) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBarsStatement_,
+                std::string(toString(resolution)),
+                symbol,
+                fromMicros,
+                toMicros
+            );
+
+            std::vector<CandleBar> bars;
+            bars.reserve(result.size());
+            for (const auto& row : result) {
+                bars.push_back(CandleBar::fromDbRow(row));
+            }
+            return bars;
+        }
+
     } // namespace mappers
 } // namespace models
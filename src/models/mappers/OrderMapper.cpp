@@ -1,68 +1,114 @@
 #include "models/mappers/OrderMapper.h"
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
+#include <charconv>
 
 namespace models {
     namespace mappers {
 
+        namespace {
+
+            // id만으로 찾으므로(호출자에게 timestamp가 없음) 모든 파티션의 PK 인덱스를 확인
+            const char* const STATUS_BATCH_SQL =
+                "UPDATE orders AS o SET status = u.status, filled_quantity = u.filled_quantity, "
+                "filled_price = u.filled_price, updated_at = CURRENT_TIMESTAMP "
+                "FROM unnest($1::bigint[], $2::text[], $3::numeric[], $4::numeric[]) "
+                "AS u(id, status, filled_quantity, filled_price) WHERE o.id = u.id";
+
+            template <typename Executor>
+            size_t execStatusBatch(Executor& executor, database::StatementRegistry::Statement& statement,
+                                   const std::vector<OrderStatusUpdate>& updates) {
+                size_t affected = 0;
+                for (size_t begin = 0; begin < updates.size(); begin += common::BatchConfig::MAX_ROWS_PER_STATEMENT) {
+                    const size_t end = std::min(updates.size(), begin + common::BatchConfig::MAX_ROWS_PER_STATEMENT);
+                    std::string ids = "{";
+                    std::string statuses = "{";
+                    std::string quantities = "{";
+                    std::string prices = "{";
+                    for (size_t i = begin; i < end; ++i) {
+                        const auto& update = updates[i];
+                        if (i > begin) {
+                            ids += ',';
+                            statuses += ',';
+                            quantities += ',';
+                            prices += ',';
+                        }
+                        ids += std::to_string(update.id);
+                        schema::detail::appendQuoted(statuses, update.status);
+                        char buffer[32];
+                        quantities.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), update.filledQuantity).ptr);
+                        prices.append(buffer, std::to_chars(buffer, buffer + sizeof(buffer), update.filledPrice).ptr);
+                    }
+                    ids += '}';
+                    statuses += '}';
+                    quantities += '}';
+                    prices += '}';
+                    affected += database::StatementRegistry::execute(
+                        executor, statement, ids, statuses, quantities, prices).affectedRows();
+                }
+                return affected;
+            }
+
+        } // namespace
+
         OrderMapper& OrderMapper::getInstance() {
             static OrderMapper instance;
             return instance;
         }
 
-        // insert
-        Order OrderMapper::insert(const Order& order) {
-            const auto sql = 
-                "INSERT INTO orders (order_id, symbol, order_type, side, quantity, "
-                "price, status, signal_id, filled_quantity, filled_price, "
-                "error_message, timestamp) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12) RETURNING *";
-                
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                order.getOrderId(),
-                order.getSymbol(),
-                order.getOrderType(),
-                order.getSide(),
-                order.getQuantity(),
-                order.getPrice(),
-                order.getStatus(),
-                order.getSignalId(),
-                order.getFilledQuantity(),
-                order.getFilledPrice(),
-                order.getErrorMessage(),
-                order.getTimestamp().toFormattedString(false)
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Failed to insert order");
-            }
-
-            return Order::fromDbRow(result[0]);
-        }
+        // 시간 범위 warmup은 epoch 구간이라 빈 결과, 상태 갱신 warmup은 id 0이라 갱신 없음 (롤백되는 트랜잭션)
+        OrderMapper::OrderMapper()
+            : findBySymbolStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_symbol",
+                  "SELECT * FROM orders WHERE symbol = $1 ORDER BY timestamp DESC",
+                  std::string())),
+              findBySymbolWithLimitStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_symbol_with_limit",
+                  "SELECT * FROM orders WHERE symbol = $1 ORDER BY timestamp DESC LIMIT $2",
+                  std::string(), size_t{1})),
+              findByStatusStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_status",
+                  "SELECT * FROM orders WHERE status = $1 ORDER BY timestamp DESC",
+                  std::string())),
+              findByStatusWithLimitStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_status_with_limit",
+                  "SELECT * FROM orders WHERE status = $1 ORDER BY timestamp DESC LIMIT $2",
+                  std::string(), size_t{1})),
+              findByOrderIdsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_order_ids",
+                  "SELECT o.* FROM order_ids k JOIN orders o ON o.id = k.id AND o.timestamp = k.timestamp "
+                  "WHERE k.order_id = ANY($1::text[])",
+                  std::string("{}"))),
+              findBySignalIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_signal_id",
+                  "SELECT * FROM orders WHERE signal_id = $1 ORDER BY timestamp DESC",
+                  int64_t{0})),
+              findByTimeRangeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_by_time_range",
+                  "SELECT * FROM orders WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
+                  "ORDER BY timestamp",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              findPendingStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_pending",
+                  "SELECT * FROM orders WHERE status = 'PENDING'")),
+              findPendingBySymbolStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.find_pending_by_symbol",
+                  "SELECT * FROM orders WHERE status = 'PENDING' AND symbol = $1",
+                  std::string())),
+              updateStatusStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.update_status",
+                  "UPDATE orders SET status = $1, filled_quantity = $2, filled_price = $3, "
+                  "updated_at = CURRENT_TIMESTAMP WHERE id = $4",
+                  std::string("PENDING"), 0.0, 0.0, int64_t{0})),
+              updateStatusBatchStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "orders.update_status_batch",
+                  STATUS_BATCH_SQL,
+                  std::string("{}"), std::string("{}"), std::string("{}"), std::string("{}"))) {}
 
+        // insert
         Order OrderMapper::insert(const Order& order, Transaction& trans) {
-            const auto sql = 
-                "INSERT INTO orders (order_id, symbol, order_type, side, quantity, "
-                "price, status, signal_id, filled_quantity, filled_price, "
-                "error_message, timestamp) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9, $10, $11, $12) RETURNING *";
-
-            auto result = trans.execSqlSync(
-                sql,
-                order.getOrderId(),
-                order.getSymbol(),
-                order.getOrderType(),
-                order.getSide(),
-                order.getQuantity(),
-                order.getPrice(),
-                order.getStatus(),
-                order.getSignalId(),
-                order.getFilledQuantity(),
-                order.getFilledPrice(),
-                order.getErrorMessage(),
-                order.getTimestamp().toFormattedString(false)
-            );
+            auto result = schema::execInsert(trans, order);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert order in transaction");
@@ -71,100 +117,19 @@ namespace models {
             return Order::fromDbRow(result[0]);
         }
 
-        // findById
-        Order OrderMapper::findById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM orders WHERE id = $1",
-                id
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Order not found");
-            }
-
-            return Order::fromDbRow(result[0]);
-        }
-
-        // findAll
-        std::vector<Order> OrderMapper::findAll() {
-            auto result = getDbClient()->execSqlSync("SELECT * FROM orders");
-            return Order::fromDbResult(result);
-        }
-
         // findByCriteria
-        std::vector<Order> OrderMapper::findByCriteria(const std::string& whereClause) {
-            std::string sql = "SELECT * FROM orders";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
-            return Order::fromDbResult(result);
-        }
-
+        // 호출자가 만든 WHERE 절은 호출마다 SQL이 달라 등록하지 않음
         std::vector<Order> OrderMapper::findByCriteria(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT * FROM orders";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
+            if (whereClause.empty()) {
+                return Order::fromDbResult(database::StatementRegistry::execute(trans, findAllStatement_));
             }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = trans.execSqlSync("SELECT * FROM orders WHERE " + whereClause);
             return Order::fromDbResult(result);
         }
 
         // update
-        void OrderMapper::update(const Order& order) {
-            const auto sql =
-                "UPDATE orders SET order_id = $1, symbol = $2, order_type = $3, "
-                "side = $4, quantity = $5, price = $6, status = $7, signal_id = $8, "
-                "filled_quantity = $9, filled_price = $10, error_message = $11, "
-                "timestamp = $12, updated_at = CURRENT_TIMESTAMP WHERE id = $13";
-
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                order.getOrderId(),
-                order.getSymbol(),
-                order.getOrderType(),
-                order.getSide(),
-                order.getQuantity(),
-                order.getPrice(),
-                order.getStatus(),
-                order.getSignalId(),
-                order.getFilledQuantity(),
-                order.getFilledPrice(),
-                order.getErrorMessage(),
-                order.getTimestamp().toFormattedString(false),
-                order.getId()
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("Order not found for update");
-            }
-        }
-
         void OrderMapper::update(const Order& order, Transaction& trans) {
-            const auto sql =
-                "UPDATE orders SET order_id = $1, symbol = $2, order_type = $3, "
-                "side = $4, quantity = $5, price = $6, status = $7, signal_id = $8, "
-                "filled_quantity = $9, filled_price = $10, error_message = $11, "
-                "timestamp = $12, updated_at = CURRENT_TIMESTAMP WHERE id = $13";
-
-            auto result = trans.execSqlSync(
-                sql,
-                order.getOrderId(),
-                order.getSymbol(),
-                order.getOrderType(),
-                order.getSide(),
-                order.getQuantity(),
-                order.getPrice(),
-                order.getStatus(),
-                order.getSignalId(),
-                order.getFilledQuantity(),
-                order.getFilledPrice(),
-                order.getErrorMessage(),
-                order.getTimestamp().toFormattedString(false),
-                order.getId()
-            );
+            auto result = schema::execUpdate(trans, order);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("Order not found for update in transaction");
@@ -172,97 +137,77 @@ namespace models {
         }
 
         // deleteById
-        void OrderMapper::deleteById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "DELETE FROM orders WHERE id = $1",
-                id
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("Order not found for deletion");
-            }
-        }
-
         void OrderMapper::deleteById(int64_t id, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "DELETE FROM orders WHERE id = $1",
-                id
-            );
+            auto result = database::StatementRegistry::execute(trans, deleteByIdStatement_, id);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("Order not found for deletion in transaction");
             }
         }
 
-        // count
-        size_t OrderMapper::count(const std::string& whereClause) {
-            std::string sql = "SELECT COUNT(*) FROM orders";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
-            return result[0]["count"].as<size_t>();
-        }
-
-        // findWithPaging
-        std::vector<Order> OrderMapper::findWithPaging(size_t limit, size_t offset) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM orders ORDER BY id LIMIT $1 OFFSET $2",
-                limit,
-                offset
-            );
-            return Order::fromDbResult(result);
-        }
-
         // findBySymbol
         std::vector<Order> OrderMapper::findBySymbol(const std::string& symbol) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM orders WHERE symbol = $1 ORDER BY timestamp DESC",
-                symbol
-            );
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), findBySymbolStatement_, symbol);
             return Order::fromDbResult(result);
         }
 
         std::vector<Order> OrderMapper::findBySymbol(const std::string& symbol, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM orders WHERE symbol = $1 ORDER BY timestamp DESC",
-                symbol
-            );
+            auto result = database::StatementRegistry::execute(trans, findBySymbolStatement_, symbol);
+            return Order::fromDbResult(result);
+        }
+
+        std::vector<Order> OrderMapper::findBySymbol(const std::string& symbol, size_t limit) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), findBySymbolWithLimitStatement_, symbol, limit);
             return Order::fromDbResult(result);
         }
 
         // findByStatus
         std::vector<Order> OrderMapper::findByStatus(const std::string& status) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM orders WHERE status = $1 ORDER BY timestamp DESC",
-                status
-            );
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), findByStatusStatement_, status);
             return Order::fromDbResult(result);
         }
 
         std::vector<Order> OrderMapper::findByStatus(const std::string& status, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM orders WHERE status = $1 ORDER BY timestamp DESC",
-                status
-            );
+            auto result = database::StatementRegistry::execute(trans, findByStatusStatement_, status);
+            return Order::fromDbResult(result);
+        }
+
+        std::vector<Order> OrderMapper::findByStatus(const std::string& status, size_t limit) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), findByStatusWithLimitStatement_, status, limit);
+            return Order::fromDbResult(result);
+        }
+
+        // findByOrderIds
+        std::vector<Order> OrderMapper::findByOrderIds(const std::vector<std::string>& orderIds, Transaction& trans) {
+            if (orderIds.empty()) {
+                return {};
+            }
+            std::string array = "{";
+            for (size_t i = 0; i < orderIds.size(); ++i) {
+                if (i > 0) {
+                    array += ',';
+                }
+                schema::detail::appendQuoted(array, orderIds[i]);
+            }
+            array += '}';
+            // order_ids(V6)는 order_id당 한 행이므로 중복 없이 찾고, 그 timestamp로 파티션 하나만 확인
+            auto result = database::StatementRegistry::execute(trans, findByOrderIdsStatement_, array);
             return Order::fromDbResult(result);
         }
 
         // findBySignalId
         std::vector<Order> OrderMapper::findBySignalId(int64_t signalId) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM orders WHERE signal_id = $1 ORDER BY timestamp DESC",
-                signalId
-            );
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(), findBySignalIdStatement_, signalId);
             return Order::fromDbResult(result);
         }
 
         std::vector<Order> OrderMapper::findBySignalId(int64_t signalId, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM orders WHERE signal_id = $1 ORDER BY timestamp DESC",
-                signalId
-            );
+            auto result = database::StatementRegistry::execute(trans, findBySignalIdStatement_, signalId);
             return Order::fromDbResult(result);
         }
 
@@ -272,9 +217,9 @@ namespace models {
             const trantor::Date& start,
             const trantor::Date& end
         ) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM orders WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
-                "ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByTimeRangeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -288,9 +233,9 @@ namespace models {
             const trantor::Date& end,
             Transaction& trans
         ) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM orders WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
-                "ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findByTimeRangeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -299,36 +244,35 @@ namespace models {
         }
 
         // findPendingOrders
+        // 미체결 주문은 주문 관리 판단에 쓰이므로 replica 지연을 허용하지 않고 primary에서 조회
         std::vector<Order> OrderMapper::findPendingOrders(const std::string& symbol) {
-            std::string sql = "SELECT * FROM orders WHERE status = 'PENDING'";
+            auto client = database::DbRouter::primary();
             if (!symbol.empty()) {
-                sql += " AND symbol = $1";
-                auto result = getDbClient()->execSqlSync(sql, symbol);
+                auto result = database::StatementRegistry::execute(*client, findPendingBySymbolStatement_, symbol);
                 return Order::fromDbResult(result);
             }
-            
-            auto result = getDbClient()->execSqlSync(sql);
+
+            auto result = database::StatementRegistry::execute(*client, findPendingStatement_);
             return Order::fromDbResult(result);
         }
 
         std::vector<Order> OrderMapper::findPendingOrders(const std::string& symbol, Transaction& trans) {
-            std::string sql = "SELECT * FROM orders WHERE status = 'PENDING'";
             if (!symbol.empty()) {
-                sql += " AND symbol = $1";
-                auto result = trans.execSqlSync(sql, symbol);
+                auto result = database::StatementRegistry::execute(trans, findPendingBySymbolStatement_, symbol);
                 return Order::fromDbResult(result);
             }
-            
-            auto result = trans.execSqlSync(sql);
+
+            auto result = database::StatementRegistry::execute(trans, findPendingStatement_);
             return Order::fromDbResult(result);
         }
 
         // updateOrderStatus
+        // STATUS_BATCH_SQL과 같이 id만으로 찾으므로 파티션 프루닝 없음 (보존 파티션 수만큼 인덱스 탐색)
         void OrderMapper::updateOrderStatus(int64_t id, const std::string& status, 
                                             double filledQuantity, double filledPrice) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE orders SET status = $1, filled_quantity = $2, filled_price = $3, "
-                "updated_at = CURRENT_TIMESTAMP WHERE id = $4",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateStatusStatement_,
                 status,
                 filledQuantity,
                 filledPrice,
@@ -343,9 +287,9 @@ namespace models {
         void OrderMapper::updateOrderStatus(int64_t id, const std::string& status, 
                                             double filledQuantity, double filledPrice,
                                             Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "UPDATE orders SET status = $1, filled_quantity = $2, filled_price = $3, "
-                "updated_at = CURRENT_TIMESTAMP WHERE id = $4",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                updateStatusStatement_,
                 status,
                 filledQuantity,
                 filledPrice,
@@ -357,5 +301,13 @@ namespace models {
             }
         }
 
+        size_t OrderMapper::updateOrderStatusBatch(const std::vector<OrderStatusUpdate>& updates) {
+            return execStatusBatch(*getDbClient(), updateStatusBatchStatement_, updates);
+        }
+
+        size_t OrderMapper::updateOrderStatusBatch(const std::vector<OrderStatusUpdate>& updates, Transaction& trans) {
+            return execStatusBatch(trans, updateStatusBatchStatement_, updates);
+        }
+
     } // namespace mappers
 } // namespace models
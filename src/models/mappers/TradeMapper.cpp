@@ -1,4 +1,5 @@
 #include "models/mappers/TradeMapper.h"
+#include "models/FieldReader.h"
 #include <stdexcept>
 #include <sstream>
 
@@ -10,50 +11,60 @@ namespace models {
             return instance;
         }
 
-        Trade TradeMapper::insert(const Trade& trade) {
-            const auto sql = 
-                "INSERT INTO trades (trade_id, order_id, symbol, side, quantity, "
-                "price, commission, commission_asset, timestamp) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9) RETURNING *";
-                
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                trade.getTradeId(),
-                trade.getOrderId(),
-                trade.getSymbol(),
-                trade.getSide(),
-                trade.getQuantity(),
-                trade.getPrice(),
-                trade.getCommission(),
-                trade.getCommissionAsset(),
-                trade.getTimestamp().toFormattedString(false)
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Failed to insert trade");
-            }
-
-            return Trade::fromDbRow(result[0]);
-        }
+        // 시간 범위 warmup은 epoch 구간/빈 심볼이라 빈 결과 (버킷 크기는 0으로 나누지 않도록 1)
+        TradeMapper::TradeMapper()
+            : findBySymbolStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.find_by_symbol",
+                  "SELECT * FROM trades WHERE symbol = $1 ORDER BY timestamp DESC",
+                  std::string())),
+              findBySymbolWithLimitStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.find_by_symbol_with_limit",
+                  "SELECT * FROM trades WHERE symbol = $1 ORDER BY timestamp DESC LIMIT $2",
+                  std::string(), size_t{1})),
+              findByOrderIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.find_by_order_id",
+                  "SELECT * FROM trades WHERE order_id = $1 ORDER BY timestamp",
+                  int64_t{0})),
+              findByOrderIdWithLimitStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.find_by_order_id_with_limit",
+                  "SELECT * FROM trades WHERE order_id = $1 ORDER BY timestamp LIMIT $2",
+                  int64_t{0}, size_t{1})),
+              findByTimeRangeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.find_by_time_range",
+                  "SELECT * FROM trades WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
+                  "ORDER BY timestamp",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              totalVolumeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.total_volume",
+                  "SELECT SUM(quantity) as total_volume FROM trades "
+                  "WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              averagePriceStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.average_price",
+                  "SELECT AVG(price) as avg_price FROM trades "
+                  "WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              aggregateBucketsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.aggregate_buckets",
+                  "SELECT floor(extract(epoch FROM timestamp) * 1000000 / $4)::bigint AS bucket, "
+                  "SUM(quantity) AS volume, SUM(quantity * price) AS notional, COUNT(*) AS count "
+                  "FROM trades WHERE symbol = $1 "
+                  "AND timestamp >= TIMESTAMPTZ 'epoch' + $2 * INTERVAL '1 microsecond' "
+                  "AND timestamp < TIMESTAMPTZ 'epoch' + $3 * INTERVAL '1 microsecond' "
+                  "GROUP BY 1 ORDER BY 1",
+                  std::string(), int64_t{0}, int64_t{0}, int64_t{1})),
+              aggregateRangesStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trades.aggregate_ranges",
+                  "SELECT COALESCE(SUM(quantity), 0) AS volume, COALESCE(SUM(quantity * price), 0) AS notional, "
+                  "COUNT(*) AS count FROM trades WHERE symbol = $1 AND ("
+                  "(timestamp >= TIMESTAMPTZ 'epoch' + $2 * INTERVAL '1 microsecond' "
+                  "AND timestamp < TIMESTAMPTZ 'epoch' + $3 * INTERVAL '1 microsecond') OR "
+                  "(timestamp >= TIMESTAMPTZ 'epoch' + $4 * INTERVAL '1 microsecond' "
+                  "AND timestamp < TIMESTAMPTZ 'epoch' + $5 * INTERVAL '1 microsecond'))",
+                  std::string(), int64_t{0}, int64_t{0}, int64_t{0}, int64_t{0})) {}
 
         Trade TradeMapper::insert(const Trade& trade, Transaction& trans) {
-            const auto sql = 
-                "INSERT INTO trades (trade_id, order_id, symbol, side, quantity, "
-                "price, commission, commission_asset, timestamp) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8, $9) RETURNING *";
-                
-            auto result = trans.execSqlSync(
-                sql,
-                trade.getTradeId(),
-                trade.getOrderId(),
-                trade.getSymbol(),
-                trade.getSide(),
-                trade.getQuantity(),
-                trade.getPrice(),
-                trade.getCommission(),
-                trade.getCommissionAsset(),
-                trade.getTimestamp().toFormattedString(false)
-            );
+            auto result = schema::execInsert(trans, trade);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert trade in transaction");
@@ -62,113 +73,32 @@ namespace models {
             return Trade::fromDbRow(result[0]);
         }
 
-        Trade TradeMapper::findById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trades WHERE id = $1",
-                id
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Trade not found");
-            }
-
-            return Trade::fromDbRow(result[0]);
-        }
-
-        std::vector<Trade> TradeMapper::findAll() {
-            auto result = getDbClient()->execSqlSync("SELECT * FROM trades");
-            return Trade::fromDbResult(result);
-        }
-
         std::vector<Trade> TradeMapper::findAll(Transaction& trans) {
-            auto result = trans.execSqlSync("SELECT * FROM trades");
-            return Trade::fromDbResult(result);
-        }
-
-        std::vector<Trade> TradeMapper::findByCriteria(const std::string& whereClause) {
-            std::string sql = "SELECT * FROM trades";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
+            auto result = database::StatementRegistry::execute(trans, findAllStatement_);
             return Trade::fromDbResult(result);
         }
 
+        // 호출자가 만든 WHERE 절은 호출마다 SQL이 달라 등록하지 않음
         std::vector<Trade> TradeMapper::findByCriteria(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT * FROM trades";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
+            if (whereClause.empty()) {
+                return findAll(trans);
             }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = trans.execSqlSync("SELECT * FROM trades WHERE " + whereClause);
             return Trade::fromDbResult(result);
         }
 
-        void TradeMapper::update(const Trade& trade) {
-            const auto sql =
-                "UPDATE trades SET trade_id = $1, order_id = $2, symbol = $3, "
-                "side = $4, quantity = $5, price = $6, commission = $7, "
-                "commission_asset = $8, timestamp = $9 WHERE id = $10";
-
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                trade.getTradeId(),
-                trade.getOrderId(),
-                trade.getSymbol(),
-                trade.getSide(),
-                trade.getQuantity(),
-                trade.getPrice(),
-                trade.getCommission(),
-                trade.getCommissionAsset(),
-                trade.getTimestamp().toFormattedString(false),
-                trade.getId()
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("Trade not found for update");
-            }
-        }
-
         void TradeMapper::update(const Trade& trade, Transaction& trans) {
-            const auto sql =
-                "UPDATE trades SET trade_id = $1, order_id = $2, symbol = $3, "
-                "side = $4, quantity = $5, price = $6, commission = $7, "
-                "commission_asset = $8, timestamp = $9 WHERE id = $10";
-
-            auto result = trans.execSqlSync(
-                sql,
-                trade.getTradeId(),
-                trade.getOrderId(),
-                trade.getSymbol(),
-                trade.getSide(),
-                trade.getQuantity(),
-                trade.getPrice(),
-                trade.getCommission(),
-                trade.getCommissionAsset(),
-                trade.getTimestamp().toFormattedString(false),
-                trade.getId()
-            );
+            auto result = schema::execUpdate(trans, trade);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("Trade not found for update in transaction");
             }
         }
 
-        void TradeMapper::deleteById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "DELETE FROM trades WHERE id = $1",
-                id
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("Trade not found for deletion");
-            }
-        }
-
         void TradeMapper::deleteById(int64_t id, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "DELETE FROM trades WHERE id = $1",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                deleteByIdStatement_,
                 id
             );
 
@@ -177,38 +107,17 @@ namespace models {
             }
         }
 
-        size_t TradeMapper::count(const std::string& whereClause) {
-            std::string sql = "SELECT COUNT(*) FROM trades";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
-            return result[0]["count"].as<size_t>();
-        }
-
         size_t TradeMapper::count(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT COUNT(*) FROM trades";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = whereClause.empty()
+                ? database::StatementRegistry::execute(trans, countStatement_)
+                : trans.execSqlSync("SELECT COUNT(*) FROM trades WHERE " + whereClause);
             return result[0]["count"].as<size_t>();
         }
 
-        std::vector<Trade> TradeMapper::findWithPaging(size_t limit, size_t offset) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trades ORDER BY id LIMIT $1 OFFSET $2",
-                limit,
-                offset
-            );
-            return Trade::fromDbResult(result);
-        }
-
         std::vector<Trade> TradeMapper::findWithPaging(size_t limit, size_t offset, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trades ORDER BY id LIMIT $1 OFFSET $2",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                pageStatement_,
                 limit,
                 offset
             );
@@ -216,45 +125,69 @@ namespace models {
         }
 
         std::vector<Trade> TradeMapper::findBySymbol(const std::string& symbol) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trades WHERE symbol = $1 ORDER BY timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBySymbolStatement_,
                 symbol
             );
             return Trade::fromDbResult(result);
         }
 
         std::vector<Trade> TradeMapper::findBySymbol(const std::string& symbol, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trades WHERE symbol = $1 ORDER BY timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findBySymbolStatement_,
                 symbol
             );
             return Trade::fromDbResult(result);
         }
 
+        std::vector<Trade> TradeMapper::findBySymbol(const std::string& symbol, size_t limit) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBySymbolWithLimitStatement_,
+                symbol,
+                limit
+            );
+            return Trade::fromDbResult(result);
+        }
+
         std::vector<Trade> TradeMapper::findByOrderId(int64_t orderId) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trades WHERE order_id = $1 ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByOrderIdStatement_,
                 orderId
             );
             return Trade::fromDbResult(result);
         }
 
         std::vector<Trade> TradeMapper::findByOrderId(int64_t orderId, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trades WHERE order_id = $1 ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findByOrderIdStatement_,
                 orderId
             );
             return Trade::fromDbResult(result);
         }
 
+        std::vector<Trade> TradeMapper::findByOrderId(int64_t orderId, size_t limit) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByOrderIdWithLimitStatement_,
+                orderId,
+                limit
+            );
+            return Trade::fromDbResult(result);
+        }
+
         std::vector<Trade> TradeMapper::findByTimeRange(
             const std::string& symbol,
             const trantor::Date& start,
             const trantor::Date& end
         ) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trades WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
-                "ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByTimeRangeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -268,9 +201,9 @@ namespace models {
             const trantor::Date& end,
             Transaction& trans
         ) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trades WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
-                "ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findByTimeRangeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -283,9 +216,9 @@ namespace models {
             const trantor::Date& start,
             const trantor::Date& end
         ) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT SUM(quantity) as total_volume FROM trades "
-                "WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                totalVolumeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -304,9 +237,9 @@ namespace models {
             const trantor::Date& end,
             Transaction& trans
         ) {
-            auto result = trans.execSqlSync(
-                "SELECT SUM(quantity) as total_volume FROM trades "
-                "WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                totalVolumeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -324,9 +257,9 @@ namespace models {
             const trantor::Date& start,
             const trantor::Date& end
         ) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT AVG(price) as avg_price FROM trades "
-                "WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                averagePriceStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -345,9 +278,9 @@ namespace models {
             const trantor::Date& end,
             Transaction& trans
         ) {
-            auto result = trans.execSqlSync(
-                "SELECT AVG(price) as avg_price FROM trades "
-                "WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                averagePriceStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -360,5 +293,52 @@ namespace models {
             return result[0]["avg_price"].as<double>();
         }
 
+        std::vector<std::pair<int64_t, TradeAggregate>> TradeMapper::aggregateBuckets(
+            const std::string& symbol,
+            int64_t fromMicros,
+            int64_t toMicros,
+            int64_t bucketMicros
+        ) {
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(), aggregateBucketsStatement_, symbol, fromMicros, toMicros, bucketMicros);
+
+            std::vector<std::pair<int64_t, TradeAggregate>> buckets;
+            buckets.reserve(result.size());
+            for (const auto& row : result) {
+                buckets.emplace_back(
+                    FieldReader::readInt64(row["bucket"]) * bucketMicros,
+                    TradeAggregate{
+                        FieldReader::readDouble(row["volume"]),
+                        FieldReader::readDouble(row["notional"]),
+                        FieldReader::readInt64(row["count"])
+                    });
+            }
+            return buckets;
+        }
+
+        TradeAggregate TradeMapper::aggregateRanges(
+            const std::string& symbol,
+            const TimeRange& first,
+            const TimeRange& second
+        ) {
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                aggregateRangesStatement_,
+                symbol,
+                first.fromMicros,
+                first.toMicros,
+                second.fromMicros,
+                second.toMicros
+            );
+            if (result.empty()) {
+                return TradeAggregate{};
+            }
+            return TradeAggregate{
+                FieldReader::readDouble(result[0]["volume"]),
+                FieldReader::readDouble(result[0]["notional"]),
+                FieldReader::readInt64(result[0]["count"])
+            };
+        }
+
     } // namespace mappers
 } // namespace models
@@ -11,48 +11,34 @@ namespace models {
             return instance;
         }
 
-        TradingSignal TradingSignalMapper::insert(const TradingSignal& signal) {
-            const auto sql = 
-                "INSERT INTO trading_signals (symbol, signal_type, price, quantity, "
-                "strategy_name, confidence, parameters, timestamp) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8) RETURNING *";
-                
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                signal.getSymbol(),
-                signal.getSignalType(),
-                signal.getPrice(),
-                signal.getQuantity(),
-                signal.getStrategyName(),
-                signal.getConfidence(),
-                utils::JsonUtils::toJsonString(signal.getParameters()),
-                signal.getTimestamp().toFormattedString(false)
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Failed to insert trading signal");
-            }
-
-            return TradingSignal::fromDbRow(result[0]);
-        }
+        TradingSignalMapper::TradingSignalMapper()
+            : findBySymbolStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trading_signals.find_by_symbol",
+                  "SELECT * FROM trading_signals WHERE symbol = $1 ORDER BY timestamp DESC",
+                  std::string())),
+              findBySymbolWithLimitStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trading_signals.find_by_symbol_with_limit",
+                  "SELECT * FROM trading_signals WHERE symbol = $1 ORDER BY timestamp DESC LIMIT $2",
+                  std::string(), size_t{1})),
+              findByStrategyNameStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trading_signals.find_by_strategy_name",
+                  "SELECT * FROM trading_signals WHERE strategy_name = $1 ORDER BY timestamp DESC",
+                  std::string())),
+              findByTimeRangeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trading_signals.find_by_time_range",
+                  "SELECT * FROM trading_signals WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
+                  "ORDER BY timestamp",
+                  std::string(), trantor::Date(0).toFormattedString(false), trantor::Date(0).toFormattedString(false))),
+              findPendingSignalsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "trading_signals.find_pending",
+                  "SELECT ts.* FROM trading_signals ts "
+                  "LEFT JOIN orders o ON ts.id = o.signal_id "
+                  "WHERE ts.symbol = $1 AND o.id IS NULL "
+                  "ORDER BY ts.timestamp DESC",
+                  std::string())) {}
 
         TradingSignal TradingSignalMapper::insert(const TradingSignal& signal, Transaction& trans) {
-            const auto sql = 
-                "INSERT INTO trading_signals (symbol, signal_type, price, quantity, "
-                "strategy_name, confidence, parameters, timestamp) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7, $8) RETURNING *";
-                
-            auto result = trans.execSqlSync(
-                sql,
-                signal.getSymbol(),
-                signal.getSignalType(),
-                signal.getPrice(),
-                signal.getQuantity(),
-                signal.getStrategyName(),
-                signal.getConfidence(),
-                utils::JsonUtils::toJsonString(signal.getParameters()),
-                signal.getTimestamp().toFormattedString(false)
-            );
+            auto result = schema::execInsert(trans, signal);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert trading signal in transaction");
@@ -61,111 +47,32 @@ namespace models {
             return TradingSignal::fromDbRow(result[0]);
         }
 
-        TradingSignal TradingSignalMapper::findById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trading_signals WHERE id = $1",
-                id
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Trading signal not found");
-            }
-
-            return TradingSignal::fromDbRow(result[0]);
-        }
-
-        std::vector<TradingSignal> TradingSignalMapper::findAll() {
-            auto result = getDbClient()->execSqlSync("SELECT * FROM trading_signals");
-            return TradingSignal::fromDbResult(result);
-        }
-
         std::vector<TradingSignal> TradingSignalMapper::findAll(Transaction& trans) {
-            auto result = trans.execSqlSync("SELECT * FROM trading_signals");
-            return TradingSignal::fromDbResult(result);
-        }
-
-        std::vector<TradingSignal> TradingSignalMapper::findByCriteria(const std::string& whereClause) {
-            std::string sql = "SELECT * FROM trading_signals";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
+            auto result = database::StatementRegistry::execute(trans, findAllStatement_);
             return TradingSignal::fromDbResult(result);
         }
 
+        // 호출자가 만든 WHERE 절은 호출마다 SQL이 달라 등록하지 않음
         std::vector<TradingSignal> TradingSignalMapper::findByCriteria(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT * FROM trading_signals";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
+            if (whereClause.empty()) {
+                return findAll(trans);
             }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = trans.execSqlSync("SELECT * FROM trading_signals WHERE " + whereClause);
             return TradingSignal::fromDbResult(result);
         }
 
-        void TradingSignalMapper::update(const TradingSignal& signal) {
-            const auto sql =
-                "UPDATE trading_signals SET symbol = $1, signal_type = $2, price = $3, "
-                "quantity = $4, strategy_name = $5, confidence = $6, parameters = $7, "
-                "timestamp = $8 WHERE id = $9";
-
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                signal.getSymbol(),
-                signal.getSignalType(),
-                signal.getPrice(),
-                signal.getQuantity(),
-                signal.getStrategyName(),
-                signal.getConfidence(),
-                utils::JsonUtils::toJsonString(signal.getParameters()),
-                signal.getTimestamp().toFormattedString(false),
-                signal.getId()
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("Trading signal not found for update");
-            }
-        }
-
         void TradingSignalMapper::update(const TradingSignal& signal, Transaction& trans) {
-            const auto sql =
-                "UPDATE trading_signals SET symbol = $1, signal_type = $2, price = $3, "
-                "quantity = $4, strategy_name = $5, confidence = $6, parameters = $7, "
-                "timestamp = $8 WHERE id = $9";
-
-            auto result = trans.execSqlSync(
-                sql,
-                signal.getSymbol(),
-                signal.getSignalType(),
-                signal.getPrice(),
-                signal.getQuantity(),
-                signal.getStrategyName(),
-                signal.getConfidence(),
-                utils::JsonUtils::toJsonString(signal.getParameters()),
-                signal.getTimestamp().toFormattedString(false),
-                signal.getId()
-            );
+            auto result = schema::execUpdate(trans, signal);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("Trading signal not found for update in transaction");
             }
         }
 
-        void TradingSignalMapper::deleteById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "DELETE FROM trading_signals WHERE id = $1",
-                id
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("Trading signal not found for deletion");
-            }
-        }
-
         void TradingSignalMapper::deleteById(int64_t id, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "DELETE FROM trading_signals WHERE id = $1",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                deleteByIdStatement_,
                 id
             );
 
@@ -174,38 +81,17 @@ namespace models {
             }
         }
 
-        size_t TradingSignalMapper::count(const std::string& whereClause) {
-            std::string sql = "SELECT COUNT(*) FROM trading_signals";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
-            return result[0]["count"].as<size_t>();
-        }
-
         size_t TradingSignalMapper::count(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT COUNT(*) FROM trading_signals";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = whereClause.empty()
+                ? database::StatementRegistry::execute(trans, countStatement_)
+                : trans.execSqlSync("SELECT COUNT(*) FROM trading_signals WHERE " + whereClause);
             return result[0]["count"].as<size_t>();
         }
 
-        std::vector<TradingSignal> TradingSignalMapper::findWithPaging(size_t limit, size_t offset) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trading_signals ORDER BY id LIMIT $1 OFFSET $2",
-                limit,
-                offset
-            );
-            return TradingSignal::fromDbResult(result);
-        }
-
         std::vector<TradingSignal> TradingSignalMapper::findWithPaging(size_t limit, size_t offset, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trading_signals ORDER BY id LIMIT $1 OFFSET $2",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                pageStatement_,
                 limit,
                 offset
             );
@@ -213,32 +99,46 @@ namespace models {
         }
 
         std::vector<TradingSignal> TradingSignalMapper::findBySymbol(const std::string& symbol) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trading_signals WHERE symbol = $1 ORDER BY timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBySymbolStatement_,
                 symbol
             );
             return TradingSignal::fromDbResult(result);
         }
 
         std::vector<TradingSignal> TradingSignalMapper::findBySymbol(const std::string& symbol, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trading_signals WHERE symbol = $1 ORDER BY timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findBySymbolStatement_,
                 symbol
             );
             return TradingSignal::fromDbResult(result);
         }
 
+        std::vector<TradingSignal> TradingSignalMapper::findBySymbol(const std::string& symbol, size_t limit) {
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findBySymbolWithLimitStatement_,
+                symbol,
+                limit
+            );
+            return TradingSignal::fromDbResult(result);
+        }
+
         std::vector<TradingSignal> TradingSignalMapper::findByStrategyName(const std::string& strategyName) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trading_signals WHERE strategy_name = $1 ORDER BY timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByStrategyNameStatement_,
                 strategyName
             );
             return TradingSignal::fromDbResult(result);
         }
 
         std::vector<TradingSignal> TradingSignalMapper::findByStrategyName(const std::string& strategyName, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trading_signals WHERE strategy_name = $1 ORDER BY timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findByStrategyNameStatement_,
                 strategyName
             );
             return TradingSignal::fromDbResult(result);
@@ -249,9 +149,9 @@ namespace models {
             const trantor::Date& start,
             const trantor::Date& end
         ) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM trading_signals WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
-                "ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByTimeRangeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -265,9 +165,9 @@ namespace models {
             const trantor::Date& end,
             Transaction& trans
         ) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM trading_signals WHERE symbol = $1 AND timestamp BETWEEN $2 AND $3 "
-                "ORDER BY timestamp",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findByTimeRangeStatement_,
                 symbol,
                 start.toFormattedString(false),
                 end.toFormattedString(false)
@@ -275,23 +175,20 @@ namespace models {
             return TradingSignal::fromDbResult(result);
         }
 
+        // 주문 생성 여부 판단용이므로 primary에서 조회 (replica 지연 시 같은 신호로 중복 주문 위험)
         std::vector<TradingSignal> TradingSignalMapper::findPendingSignals(const std::string& symbol) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT ts.* FROM trading_signals ts "
-                "LEFT JOIN orders o ON ts.id = o.signal_id "
-                "WHERE ts.symbol = $1 AND o.id IS NULL "
-                "ORDER BY ts.timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                *database::DbRouter::primary(),
+                findPendingSignalsStatement_,
                 symbol
             );
             return TradingSignal::fromDbResult(result);
         }
 
         std::vector<TradingSignal> TradingSignalMapper::findPendingSignals(const std::string& symbol, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT ts.* FROM trading_signals ts "
-                "LEFT JOIN orders o ON ts.id = o.signal_id "
-                "WHERE ts.symbol = $1 AND o.id IS NULL "
-                "ORDER BY ts.timestamp DESC",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                findPendingSignalsStatement_,
                 symbol
             );
             return TradingSignal::fromDbResult(result);
@@ -9,40 +9,30 @@ namespace models {
             return instance;
         }
 
-        User UserMapper::insert(const User& user) {
-            const auto sql = 
-                "INSERT INTO users (email, username, password_hash, is_active, last_login_at) "
-                "VALUES ($1, $2, $3, $4, $5) RETURNING *";
-                
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                user.getEmail(),
-                user.getUsername(),
-                user.getPasswordHash(),
-                user.isActive(),
-                user.getLastLoginAt().toFormattedString(false)
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Failed to insert user");
-            }
-
-            return User::fromDbRow(result[0]);
-        }
+        // 갱신 warmup은 id 0이라 갱신 없음 (롤백되는 트랜잭션), 활성 사용자 전체 조회는 warmup 제외
+        UserMapper::UserMapper()
+            : findByEmailStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "users.find_by_email",
+                  "SELECT * FROM users WHERE email = $1",
+                  std::string())),
+              findByUsernameStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "users.find_by_username",
+                  "SELECT * FROM users WHERE username = $1",
+                  std::string())),
+              updateLastLoginStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "users.update_last_login",
+                  "UPDATE users SET last_login_at = $1 WHERE id = $2",
+                  trantor::Date(0).toFormattedString(false), int64_t{0})),
+              updatePasswordStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "users.update_password",
+                  "UPDATE users SET password_hash = $1 WHERE id = $2",
+                  std::string(), int64_t{0})),
+              findActiveUsersStatement_(database::StatementRegistry::getInstance().registerWithoutWarmup(
+                  "users.find_active",
+                  "SELECT * FROM users WHERE is_active = true ORDER BY id")) {}
 
         User UserMapper::insert(const User& user, Transaction& trans) {
-            const auto sql = 
-                "INSERT INTO users (email, username, password_hash, is_active, last_login_at) "
-                "VALUES ($1, $2, $3, $4, $5) RETURNING *";
-                
-            auto result = trans.execSqlSync(
-                sql,
-                user.getEmail(),
-                user.getUsername(),
-                user.getPasswordHash(),
-                user.isActive(),
-                user.getLastLoginAt().toFormattedString(false)
-            );
+            auto result = schema::execInsert(trans, user);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert user in transaction");
@@ -51,103 +41,32 @@ namespace models {
             return User::fromDbRow(result[0]);
         }
 
-        User UserMapper::findById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM users WHERE id = $1",
-                id
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("User not found");
-            }
-
-            return User::fromDbRow(result[0]);
-        }
-
-        std::vector<User> UserMapper::findAll() {
-            auto result = getDbClient()->execSqlSync("SELECT * FROM users");
-            return User::fromDbResult(result);
-        }
-
         std::vector<User> UserMapper::findAll(Transaction& trans) {
-            auto result = trans.execSqlSync("SELECT * FROM users");
-            return User::fromDbResult(result);
-        }
-
-        std::vector<User> UserMapper::findByCriteria(const std::string& whereClause) {
-            std::string sql = "SELECT * FROM users";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
+            auto result = database::StatementRegistry::execute(trans, findAllStatement_);
             return User::fromDbResult(result);
         }
 
+        // 호출자가 만든 WHERE 절은 호출마다 SQL이 달라 등록하지 않음
         std::vector<User> UserMapper::findByCriteria(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT * FROM users";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
+            if (whereClause.empty()) {
+                return findAll(trans);
             }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = trans.execSqlSync("SELECT * FROM users WHERE " + whereClause);
             return User::fromDbResult(result);
         }
 
-        void UserMapper::update(const User& user) {
-            const auto sql =
-                "UPDATE users SET email = $1, username = $2, password_hash = $3, "
-                "is_active = $4, last_login_at = $5 WHERE id = $6";
-
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                user.getEmail(),
-                user.getUsername(),
-                user.getPasswordHash(),
-                user.isActive(),
-                user.getLastLoginAt().toFormattedString(false),
-                user.getId()
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("User not found for update");
-            }
-        }
-
         void UserMapper::update(const User& user, Transaction& trans) {
-            const auto sql =
-                "UPDATE users SET email = $1, username = $2, password_hash = $3, "
-                "is_active = $4, last_login_at = $5 WHERE id = $6";
-
-            auto result = trans.execSqlSync(
-                sql,
-                user.getEmail(),
-                user.getUsername(),
-                user.getPasswordHash(),
-                user.isActive(),
-                user.getLastLoginAt().toFormattedString(false),
-                user.getId()
-            );
+            auto result = schema::execUpdate(trans, user);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("User not found for update in transaction");
             }
         }
 
-        void UserMapper::deleteById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "DELETE FROM users WHERE id = $1",
-                id
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("User not found for deletion");
-            }
-        }
-
         void UserMapper::deleteById(int64_t id, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "DELETE FROM users WHERE id = $1",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                deleteByIdStatement_,
                 id
             );
 
@@ -156,38 +75,17 @@ namespace models {
             }
         }
 
-        size_t UserMapper::count(const std::string& whereClause) {
-            std::string sql = "SELECT COUNT(*) FROM users";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
-            return result[0]["count"].as<size_t>();
-        }
-
         size_t UserMapper::count(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT COUNT(*) FROM users";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = whereClause.empty()
+                ? database::StatementRegistry::execute(trans, countStatement_)
+                : trans.execSqlSync("SELECT COUNT(*) FROM users WHERE " + whereClause);
             return result[0]["count"].as<size_t>();
         }
 
-        std::vector<User> UserMapper::findWithPaging(size_t limit, size_t offset) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM users ORDER BY id LIMIT $1 OFFSET $2",
-                limit,
-                offset
-            );
-            return User::fromDbResult(result);
-        }
-
         std::vector<User> UserMapper::findWithPaging(size_t limit, size_t offset, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM users ORDER BY id LIMIT $1 OFFSET $2",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                pageStatement_,
                 limit,
                 offset
             );
@@ -195,8 +93,9 @@ namespace models {
         }
 
         std::optional<User> UserMapper::findByEmail(const std::string& email) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM users WHERE email = $1",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByEmailStatement_,
                 email
             );
 
@@ -208,8 +107,9 @@ namespace models {
         }
 
         std::optional<User> UserMapper::findByUsername(const std::string& username) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM users WHERE username = $1",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByUsernameStatement_,
                 username
             );
 
@@ -221,8 +121,9 @@ namespace models {
         }
 
         void UserMapper::updateLastLoginTime(int64_t userId, const trantor::Date& loginTime) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE users SET last_login_at = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateLastLoginStatement_,
                 loginTime.toFormattedString(false),
                 userId
             );
@@ -233,8 +134,9 @@ namespace models {
         }
 
         void UserMapper::updatePassword(int64_t userId, const std::string& newPasswordHash) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE users SET password_hash = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updatePasswordStatement_,
                 newPasswordHash,
                 userId
             );
@@ -245,9 +147,7 @@ namespace models {
         }
 
         std::vector<User> UserMapper::findActiveUsers() {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM users WHERE is_active = true ORDER BY id"
-            );
+            auto result = database::StatementRegistry::execute(*getReadDbClient(), findActiveUsersStatement_);
             return User::fromDbResult(result);
         }
 
@@ -10,46 +10,42 @@ namespace models {
             return instance;
         }
 
-        UserSettings UserSettingsMapper::insert(const UserSettings& settings) {
-            const auto sql = 
-                "INSERT INTO user_settings (user_id, exchange_name, api_credentials, "
-                "strategy_params, watchlist, risk_params, auto_trade_enabled) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7) RETURNING *";
-                
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                settings.getUserId(),
-                settings.getExchangeName(),
-                utils::JsonUtils::toJsonString(settings.getApiCredentials()),
-                utils::JsonUtils::toJsonString(settings.getStrategyParams()),
-                utils::JsonUtils::toJsonString(settings.getWatchlist()),
-                utils::JsonUtils::toJsonString(settings.getRiskParams()),
-                settings.isAutoTradeEnabled()
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("Failed to insert user settings");
-            }
-
-            return UserSettings::fromDbRow(result[0]);
-        }
+        // 갱신 warmup은 id 0이라 갱신 없음 (롤백되는 트랜잭션), 자동 매매 설정 전체 조회는 warmup 제외
+        UserSettingsMapper::UserSettingsMapper()
+            : findByUserIdStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.find_by_user_id",
+                  "SELECT * FROM user_settings WHERE user_id = $1 ORDER BY exchange_name",
+                  int64_t{0})),
+              findByUserAndExchangeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.find_by_user_and_exchange",
+                  "SELECT * FROM user_settings WHERE user_id = $1 AND exchange_name = $2",
+                  int64_t{0}, std::string())),
+              findAutoTradeEnabledStatement_(database::StatementRegistry::getInstance().registerWithoutWarmup(
+                  "user_settings.find_auto_trade_enabled",
+                  "SELECT * FROM user_settings WHERE auto_trade_enabled = true ORDER BY user_id")),
+              updateAutoTradeStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.update_auto_trade",
+                  "UPDATE user_settings SET auto_trade_enabled = $1 WHERE id = $2",
+                  false, int64_t{0})),
+              updateApiCredentialsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.update_api_credentials",
+                  "UPDATE user_settings SET api_credentials = $1 WHERE id = $2",
+                  std::string("{}"), int64_t{0})),
+              updateStrategyParamsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.update_strategy_params",
+                  "UPDATE user_settings SET strategy_params = $1 WHERE id = $2",
+                  std::string("{}"), int64_t{0})),
+              updateWatchlistStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.update_watchlist",
+                  "UPDATE user_settings SET watchlist = $1 WHERE id = $2",
+                  std::string("[]"), int64_t{0})),
+              updateRiskParamsStatement_(database::StatementRegistry::getInstance().registerStatement(
+                  "user_settings.update_risk_params",
+                  "UPDATE user_settings SET risk_params = $1 WHERE id = $2",
+                  std::string("{}"), int64_t{0})) {}
 
         UserSettings UserSettingsMapper::insert(const UserSettings& settings, Transaction& trans) {
-            const auto sql = 
-                "INSERT INTO user_settings (user_id, exchange_name, api_credentials, "
-                "strategy_params, watchlist, risk_params, auto_trade_enabled) "
-                "VALUES ($1, $2, $3, $4, $5, $6, $7) RETURNING *";
-                
-            auto result = trans.execSqlSync(
-                sql,
-                settings.getUserId(),
-                settings.getExchangeName(),
-                utils::JsonUtils::toJsonString(settings.getApiCredentials()),
-                utils::JsonUtils::toJsonString(settings.getStrategyParams()),
-                utils::JsonUtils::toJsonString(settings.getWatchlist()),
-                utils::JsonUtils::toJsonString(settings.getRiskParams()),
-                settings.isAutoTradeEnabled()
-            );
+            auto result = schema::execInsert(trans, settings);
 
             if (result.empty()) {
                 throw std::runtime_error("Failed to insert user settings in transaction");
@@ -58,107 +54,32 @@ namespace models {
             return UserSettings::fromDbRow(result[0]);
         }
 
-        UserSettings UserSettingsMapper::findById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM user_settings WHERE id = $1",
-                id
-            );
-
-            if (result.empty()) {
-                throw std::runtime_error("User settings not found");
-            }
-
-            return UserSettings::fromDbRow(result[0]);
-        }
-
-        std::vector<UserSettings> UserSettingsMapper::findAll() {
-            auto result = getDbClient()->execSqlSync("SELECT * FROM user_settings");
-            return UserSettings::fromDbResult(result);
-        }
-
         std::vector<UserSettings> UserSettingsMapper::findAll(Transaction& trans) {
-            auto result = trans.execSqlSync("SELECT * FROM user_settings");
-            return UserSettings::fromDbResult(result);
-        }
-
-        std::vector<UserSettings> UserSettingsMapper::findByCriteria(const std::string& whereClause) {
-            std::string sql = "SELECT * FROM user_settings";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
+            auto result = database::StatementRegistry::execute(trans, findAllStatement_);
             return UserSettings::fromDbResult(result);
         }
 
+        // 호출자가 만든 WHERE 절은 호출마다 SQL이 달라 등록하지 않음
         std::vector<UserSettings> UserSettingsMapper::findByCriteria(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT * FROM user_settings";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
+            if (whereClause.empty()) {
+                return findAll(trans);
             }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = trans.execSqlSync("SELECT * FROM user_settings WHERE " + whereClause);
             return UserSettings::fromDbResult(result);
         }
 
-        void UserSettingsMapper::update(const UserSettings& settings) {
-            const auto sql =
-                "UPDATE user_settings SET exchange_name = $1, api_credentials = $2, "
-                "strategy_params = $3, watchlist = $4, risk_params = $5, "
-                "auto_trade_enabled = $6 WHERE id = $7";
-
-            auto result = getDbClient()->execSqlSync(
-                sql,
-                settings.getExchangeName(),
-                utils::JsonUtils::toJsonString(settings.getApiCredentials()),
-                utils::JsonUtils::toJsonString(settings.getStrategyParams()),
-                utils::JsonUtils::toJsonString(settings.getWatchlist()),
-                utils::JsonUtils::toJsonString(settings.getRiskParams()),
-                settings.isAutoTradeEnabled(),
-                settings.getId()
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("User settings not found for update");
-            }
-        }
-
         void UserSettingsMapper::update(const UserSettings& settings, Transaction& trans) {
-            const auto sql =
-                "UPDATE user_settings SET exchange_name = $1, api_credentials = $2, "
-                "strategy_params = $3, watchlist = $4, risk_params = $5, "
-                "auto_trade_enabled = $6 WHERE id = $7";
-
-            auto result = trans.execSqlSync(
-                sql,
-                settings.getExchangeName(),
-                utils::JsonUtils::toJsonString(settings.getApiCredentials()),
-                utils::JsonUtils::toJsonString(settings.getStrategyParams()),
-                utils::JsonUtils::toJsonString(settings.getWatchlist()),
-                utils::JsonUtils::toJsonString(settings.getRiskParams()),
-                settings.isAutoTradeEnabled(),
-                settings.getId()
-            );
+            auto result = schema::execUpdate(trans, settings);
 
             if (result.affectedRows() == 0) {
                 throw std::runtime_error("User settings not found for update in transaction");
             }
         }
 
-        void UserSettingsMapper::deleteById(int64_t id) {
-            auto result = getDbClient()->execSqlSync(
-                "DELETE FROM user_settings WHERE id = $1",
-                id
-            );
-
-            if (result.affectedRows() == 0) {
-                throw std::runtime_error("User settings not found for deletion");
-            }
-        }
-
         void UserSettingsMapper::deleteById(int64_t id, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "DELETE FROM user_settings WHERE id = $1",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                deleteByIdStatement_,
                 id
             );
 
@@ -167,38 +88,17 @@ namespace models {
             }
         }
 
-        size_t UserSettingsMapper::count(const std::string& whereClause) {
-            std::string sql = "SELECT COUNT(*) FROM user_settings";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = getDbClient()->execSqlSync(sql);
-            return result[0]["count"].as<size_t>();
-        }
-
         size_t UserSettingsMapper::count(const std::string& whereClause, Transaction& trans) {
-            std::string sql = "SELECT COUNT(*) FROM user_settings";
-            if (!whereClause.empty()) {
-                sql += " WHERE " + whereClause;
-            }
-            
-            auto result = trans.execSqlSync(sql);
+            auto result = whereClause.empty()
+                ? database::StatementRegistry::execute(trans, countStatement_)
+                : trans.execSqlSync("SELECT COUNT(*) FROM user_settings WHERE " + whereClause);
             return result[0]["count"].as<size_t>();
         }
 
-        std::vector<UserSettings> UserSettingsMapper::findWithPaging(size_t limit, size_t offset) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM user_settings ORDER BY id LIMIT $1 OFFSET $2",
-                limit,
-                offset
-            );
-            return UserSettings::fromDbResult(result);
-        }
-
         std::vector<UserSettings> UserSettingsMapper::findWithPaging(size_t limit, size_t offset, Transaction& trans) {
-            auto result = trans.execSqlSync(
-                "SELECT * FROM user_settings ORDER BY id LIMIT $1 OFFSET $2",
+            auto result = database::StatementRegistry::execute(
+                trans,
+                pageStatement_,
                 limit,
                 offset
             );
@@ -206,8 +106,9 @@ namespace models {
         }
 
         std::vector<UserSettings> UserSettingsMapper::findByUserId(int64_t userId) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM user_settings WHERE user_id = $1 ORDER BY exchange_name",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByUserIdStatement_,
                 userId
             );
             return UserSettings::fromDbResult(result);
@@ -217,8 +118,9 @@ namespace models {
             int64_t userId, 
             const std::string& exchangeName
         ) {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM user_settings WHERE user_id = $1 AND exchange_name = $2",
+            auto result = database::StatementRegistry::execute(
+                *getReadDbClient(),
+                findByUserAndExchangeStatement_,
                 userId,
                 exchangeName
             );
@@ -231,15 +133,14 @@ namespace models {
         }
 
         std::vector<UserSettings> UserSettingsMapper::findAutoTradeEnabled() {
-            auto result = getDbClient()->execSqlSync(
-                "SELECT * FROM user_settings WHERE auto_trade_enabled = true ORDER BY user_id"
-            );
+            auto result = database::StatementRegistry::execute(*getReadDbClient(), findAutoTradeEnabledStatement_);
             return UserSettings::fromDbResult(result);
         }
 
         void UserSettingsMapper::updateAutoTradeStatus(int64_t settingsId, bool enabled) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE user_settings SET auto_trade_enabled = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateAutoTradeStatement_,
                 enabled,
                 settingsId
             );
@@ -250,8 +151,9 @@ namespace models {
         }
 
         void UserSettingsMapper::updateApiCredentials(int64_t settingsId, const Json::Value& credentials) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE user_settings SET api_credentials = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateApiCredentialsStatement_,
                 utils::JsonUtils::toJsonString(credentials),
                 settingsId
             );
@@ -262,8 +164,9 @@ namespace models {
         }
 
         void UserSettingsMapper::updateStrategyParams(int64_t settingsId, const Json::Value& params) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE user_settings SET strategy_params = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateStrategyParamsStatement_,
                 utils::JsonUtils::toJsonString(params),
                 settingsId
             );
@@ -274,8 +177,9 @@ namespace models {
         }
 
         void UserSettingsMapper::updateWatchlist(int64_t settingsId, const Json::Value& watchlist) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE user_settings SET watchlist = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateWatchlistStatement_,
                 utils::JsonUtils::toJsonString(watchlist),
                 settingsId
             );
@@ -286,8 +190,9 @@ namespace models {
         }
 
         void UserSettingsMapper::updateRiskParams(int64_t settingsId, const Json::Value& riskParams) {
-            auto result = getDbClient()->execSqlSync(
-                "UPDATE user_settings SET risk_params = $1 WHERE id = $2",
+            auto result = database::StatementRegistry::execute(
+                *getDbClient(),
+                updateRiskParamsStatement_,
                 utils::JsonUtils::toJsonString(riskParams),
                 settingsId
             );
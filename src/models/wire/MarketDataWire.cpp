@@ -0,0 +1,44 @@
+#include "models/wire/MarketDataWire.h"
+#include <string>
+
+namespace models {
+    namespace wire {
+
+        size_t encodedSize(const MarketData& data) {
+            return WireWriter<MarketDataRecord>::FIXED_SIZE + data.getSymbol().size()
+                + data.getSource().size();
+        }
+
+        size_t encode(const MarketData& data, void* buffer, size_t capacity) {
+            const size_t required = WireWriter<MarketDataRecord>::FIXED_SIZE + data.getSymbol().size()
+                + data.getSource().size();
+            WireWriter<MarketDataRecord> writer(buffer, capacity, required);
+
+            MarketDataRecord record{};
+            record.id = data.getId();
+            record.price = data.getPrice();
+            record.volume = data.getVolume();
+            record.timestampMicros = data.getTimestamp().microSecondsSinceEpoch();
+            record.createdAtMicros = data.getCreatedAt().microSecondsSinceEpoch();
+            record.symbol = writer.append(data.getSymbol());
+            record.source = writer.append(data.getSource());
+
+            return writer.finish(MessageType::MarketData, record);
+        }
+
+        MarketDataView::MarketDataView(const void* data, size_t size)
+            : reader_(data, size, MessageType::MarketData, sizeof(MarketDataRecord)) {
+            reader_.validateString(reader_.load<StringRef>(offsetof(MarketDataRecord, symbol)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(MarketDataRecord, source)));
+        }
+
+        std::shared_ptr<MarketData> MarketDataView::toModel() const {
+            auto result = MarketData::create(std::string(symbol()), price(), volume(), std::string(source()));
+            result->setId(id());
+            result->setTimestamp(timestamp());
+            result->setCreatedAt(createdAt());
+            return result;
+        }
+
+    } // namespace wire
+} // namespace models
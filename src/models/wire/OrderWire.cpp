@@ -0,0 +1,76 @@
+#include "models/wire/OrderWire.h"
+#include <string>
+
+namespace models {
+    namespace wire {
+
+        size_t encodedSize(const Order& order) {
+            return WireWriter<OrderRecord>::FIXED_SIZE + order.getOrderId().size()
+                + order.getSymbol().size()
+                + order.getOrderType().size()
+                + order.getSide().size()
+                + order.getStatus().size()
+                + order.getErrorMessage().size();
+        }
+
+        size_t encode(const Order& order, void* buffer, size_t capacity) {
+            const size_t required = WireWriter<OrderRecord>::FIXED_SIZE + order.getOrderId().size()
+                + order.getSymbol().size()
+                + order.getOrderType().size()
+                + order.getSide().size()
+                + order.getStatus().size()
+                + order.getErrorMessage().size();
+            WireWriter<OrderRecord> writer(buffer, capacity, required);
+
+            OrderRecord record{};
+            record.id = order.getId();
+            record.signalId = order.getSignalId();
+            record.quantity = order.getQuantity();
+            record.price = order.getPrice();
+            record.filledQuantity = order.getFilledQuantity();
+            record.filledPrice = order.getFilledPrice();
+            record.timestampMicros = order.getTimestamp().microSecondsSinceEpoch();
+            record.updatedAtMicros = order.getUpdatedAt().microSecondsSinceEpoch();
+            record.createdAtMicros = order.getCreatedAt().microSecondsSinceEpoch();
+            record.orderId = writer.append(order.getOrderId());
+            record.symbol = writer.append(order.getSymbol());
+            record.orderType = writer.append(order.getOrderType());
+            record.side = writer.append(order.getSide());
+            record.status = writer.append(order.getStatus());
+            record.errorMessage = writer.append(order.getErrorMessage());
+
+            return writer.finish(MessageType::Order, record);
+        }
+
+        OrderView::OrderView(const void* data, size_t size)
+            : reader_(data, size, MessageType::Order, sizeof(OrderRecord)) {
+            reader_.validateString(reader_.load<StringRef>(offsetof(OrderRecord, orderId)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(OrderRecord, symbol)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(OrderRecord, orderType)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(OrderRecord, side)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(OrderRecord, status)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(OrderRecord, errorMessage)));
+        }
+
+        Order OrderView::toModel() const {
+            Order result;
+            result.setId(id());
+            result.setSignalId(signalId());
+            result.setQuantity(quantity());
+            result.setPrice(price());
+            result.setFilledQuantity(filledQuantity());
+            result.setFilledPrice(filledPrice());
+            result.setTimestamp(timestamp());
+            result.setUpdatedAt(updatedAt());
+            result.setCreatedAt(createdAt());
+            result.setOrderId(std::string(orderId()));
+            result.setSymbol(std::string(symbol()));
+            result.setOrderType(std::string(orderType()));
+            result.setSide(std::string(side()));
+            result.setStatus(std::string(status()));
+            result.setErrorMessage(std::string(errorMessage()));
+            return result;
+        }
+
+    } // namespace wire
+} // namespace models
@@ -0,0 +1,62 @@
+#include "models/wire/TradeWire.h"
+#include <string>
+
+namespace models {
+    namespace wire {
+
+        size_t encodedSize(const Trade& trade) {
+            return WireWriter<TradeRecord>::FIXED_SIZE + trade.getTradeId().size()
+                + trade.getSymbol().size()
+                + trade.getSide().size()
+                + trade.getCommissionAsset().size();
+        }
+
+        size_t encode(const Trade& trade, void* buffer, size_t capacity) {
+            const size_t required = WireWriter<TradeRecord>::FIXED_SIZE + trade.getTradeId().size()
+                + trade.getSymbol().size()
+                + trade.getSide().size()
+                + trade.getCommissionAsset().size();
+            WireWriter<TradeRecord> writer(buffer, capacity, required);
+
+            TradeRecord record{};
+            record.id = trade.getId();
+            record.orderId = trade.getOrderId();
+            record.quantity = trade.getQuantity();
+            record.price = trade.getPrice();
+            record.commission = trade.getCommission();
+            record.timestampMicros = trade.getTimestamp().microSecondsSinceEpoch();
+            record.createdAtMicros = trade.getCreatedAt().microSecondsSinceEpoch();
+            record.tradeId = writer.append(trade.getTradeId());
+            record.symbol = writer.append(trade.getSymbol());
+            record.side = writer.append(trade.getSide());
+            record.commissionAsset = writer.append(trade.getCommissionAsset());
+
+            return writer.finish(MessageType::Trade, record);
+        }
+
+        TradeView::TradeView(const void* data, size_t size)
+            : reader_(data, size, MessageType::Trade, sizeof(TradeRecord)) {
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradeRecord, tradeId)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradeRecord, symbol)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradeRecord, side)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradeRecord, commissionAsset)));
+        }
+
+        Trade TradeView::toModel() const {
+            Trade result;
+            result.setId(id());
+            result.setOrderId(orderId());
+            result.setQuantity(quantity());
+            result.setPrice(price());
+            result.setCommission(commission());
+            result.setTimestamp(timestamp());
+            result.setCreatedAt(createdAt());
+            result.setTradeId(std::string(tradeId()));
+            result.setSymbol(std::string(symbol()));
+            result.setSide(std::string(side()));
+            result.setCommissionAsset(std::string(commissionAsset()));
+            return result;
+        }
+
+    } // namespace wire
+} // namespace models
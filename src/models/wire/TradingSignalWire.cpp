@@ -0,0 +1,65 @@
+#include "models/wire/TradingSignalWire.h"
+#include "utils/JsonUtils.h"
+#include <string>
+
+namespace models {
+    namespace wire {
+
+        size_t encodedSize(const TradingSignal& signal) {
+            const std::string parameters = utils::JsonUtils::toJsonString(signal.getParameters());
+            return WireWriter<TradingSignalRecord>::FIXED_SIZE + signal.getSymbol().size()
+                + signal.getSignalType().size()
+                + signal.getStrategyName().size()
+                + parameters.size();
+        }
+
+        size_t encode(const TradingSignal& signal, void* buffer, size_t capacity) {
+            const std::string parameters = utils::JsonUtils::toJsonString(signal.getParameters());
+            const size_t required = WireWriter<TradingSignalRecord>::FIXED_SIZE + signal.getSymbol().size()
+                + signal.getSignalType().size()
+                + signal.getStrategyName().size()
+                + parameters.size();
+            WireWriter<TradingSignalRecord> writer(buffer, capacity, required);
+
+            TradingSignalRecord record{};
+            record.id = signal.getId();
+            record.price = signal.getPrice();
+            record.quantity = signal.getQuantity();
+            record.confidence = signal.getConfidence();
+            record.timestampMicros = signal.getTimestamp().microSecondsSinceEpoch();
+            record.createdAtMicros = signal.getCreatedAt().microSecondsSinceEpoch();
+            record.symbol = writer.append(signal.getSymbol());
+            record.signalType = writer.append(signal.getSignalType());
+            record.strategyName = writer.append(signal.getStrategyName());
+            record.parameters = writer.append(parameters);
+
+            return writer.finish(MessageType::TradingSignal, record);
+        }
+
+        TradingSignalView::TradingSignalView(const void* data, size_t size)
+            : reader_(data, size, MessageType::TradingSignal, sizeof(TradingSignalRecord)) {
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradingSignalRecord, symbol)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradingSignalRecord, signalType)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradingSignalRecord, strategyName)));
+            reader_.validateString(reader_.load<StringRef>(offsetof(TradingSignalRecord, parameters)));
+        }
+
+        TradingSignal TradingSignalView::toModel() const {
+            TradingSignal result;
+            result.setId(id());
+            result.setPrice(price());
+            result.setQuantity(quantity());
+            result.setConfidence(confidence());
+            result.setTimestamp(timestamp());
+            result.setCreatedAt(createdAt());
+            result.setSymbol(std::string(symbol()));
+            result.setSignalType(std::string(signalType()));
+            result.setStrategyName(std::string(strategyName()));
+            if (!parametersJson().empty()) {
+                result.setParameters(utils::JsonUtils::parseJson(std::string(parametersJson())));
+            }
+            return result;
+        }
+
+    } // namespace wire
+} // namespace models
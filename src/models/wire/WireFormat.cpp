@@ -0,0 +1,58 @@
+#include "models/wire/WireFormat.h"
+#include <string>
+
+namespace models {
+    namespace wire {
+
+        std::optional<MessageType> peekType(const void* data, size_t size) {
+            if (size < sizeof(WireHeader)) {
+                return std::nullopt;
+            }
+            WireHeader header;
+            std::memcpy(&header, data, sizeof(header));
+            if (header.magic != WIRE_MAGIC || header.totalSize > size) {
+                return std::nullopt;
+            }
+            return static_cast<MessageType>(header.type);
+        }
+
+        WireReader::WireReader(const void* data, size_t size, MessageType expected, size_t recordSize)
+            : data_(static_cast<const uint8_t*>(data)),
+              record_(data_ + sizeof(WireHeader)),
+              size_(size),
+              version_(0) {
+            if (size < sizeof(WireHeader)) {
+                throw std::invalid_argument("Wire message shorter than header");
+            }
+
+            WireHeader header;
+            std::memcpy(&header, data_, sizeof(header));
+            if (header.magic != WIRE_MAGIC) {
+                throw std::invalid_argument("Invalid wire message magic");
+            }
+            if (header.version == 0 || header.version > WIRE_VERSION) {
+                throw std::invalid_argument("Unsupported wire version: " + std::to_string(header.version));
+            }
+            if (header.type != static_cast<uint16_t>(expected)) {
+                throw std::invalid_argument("Unexpected wire message type: " + std::to_string(header.type));
+            }
+            // 더 새로운 writer는 레코드 뒤에 필드를 추가할 수 있으므로 최소 크기만 확인
+            if (header.recordSize < recordSize ||
+                header.totalSize > size ||
+                sizeof(WireHeader) + header.recordSize > header.totalSize) {
+                throw std::invalid_argument("Truncated or malformed wire message");
+            }
+
+            size_ = header.totalSize;
+            version_ = header.version;
+        }
+
+        void WireReader::validateString(StringRef ref) const {
+            const uint64_t end = static_cast<uint64_t>(ref.offset) + ref.length;
+            if (ref.offset < sizeof(WireHeader) || end > size_) {
+                throw std::invalid_argument("Wire string reference out of bounds");
+            }
+        }
+
+    } // namespace wire
+} // namespace models
@@ -0,0 +1,359 @@
+#include "repositories/CandleAggregator.h"
+#include "models/mappers/MarketDataMapper.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace repositories {
+
+    namespace {
+
+        constexpr std::chrono::milliseconds RETRY_BACKOFF{50};
+
+        int64_t nowMicros() {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+        }
+
+        int64_t toMicros(std::chrono::milliseconds duration) {
+            return std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        }
+
+        bool earlierOpen(const models::CandleBar& bar, int64_t openTimeMicros) {
+            return bar.openTimeMicros < openTimeMicros;
+        }
+
+    } // namespace
+
+    CandleAggregator& CandleAggregator::getInstance() {
+        // 매퍼 싱글톤을 먼저 생성해 종료 시 이 객체보다 늦게 파괴되도록 보장 (소멸자에서 flush)
+        models::mappers::MarketDataMapper::getInstance();
+        static CandleAggregator instance;
+        return instance;
+    }
+
+    CandleAggregator::~CandleAggregator() {
+        stop();
+    }
+
+    void CandleAggregator::start(const Options& options) {
+        if (options.flushInterval.count() <= 0 || options.maxFlushAttempts == 0) {
+            throw std::invalid_argument("Candle flush interval and flush attempts must be positive");
+        }
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (running_.load(std::memory_order_acquire)) {
+            throw std::logic_error("Candle aggregator is already running");
+        }
+
+        options_ = options;
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stopRequested_ = false;
+        }
+        running_.store(true, std::memory_order_release);
+        flusher_ = std::thread([this] { run(); });
+
+        TRADING_LOG_INFO("Candle aggregator started (interval={}ms, grace={}ms)",
+                         options_.flushInterval.count(), options_.closeGrace.count());
+    }
+
+    void CandleAggregator::stop() {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+        {
+            std::lock_guard<std::mutex> lock(stopMutex_);
+            stopRequested_ = true;
+        }
+        stopCv_.notify_one();
+        if (flusher_.joinable()) {
+            flusher_.join();
+        }
+
+        // 진행 중인 봉의 델타까지 모두 기록
+        flush(std::numeric_limits<int64_t>::max(), true);
+        running_.store(false, std::memory_order_release);
+
+        const auto stats = getStats();
+        TRADING_LOG_INFO("Candle aggregator stopped (written={}, failed={}, pending={})",
+                         stats.barsWritten, stats.failed, stats.pending);
+    }
+
+    void CandleAggregator::onTick(const models::MarketData& data) {
+        onTick(data.getSymbolId(), data.getTimestamp().microSecondsSinceEpoch(), data.getPrice(), data.getVolume());
+    }
+
+    void CandleAggregator::onTick(models::SymbolId symbolId, int64_t timestampMicros, double price, double volume) {
+        if (symbolId >= books_.size()) {
+            return;     // INVALID_ID
+        }
+        // market_bars 제약(low > 0, volume >= 0)을 어기는 틱은 배치 전체를 실패시키므로 집계하지 않음
+        if (!(price > 0.0) || !std::isfinite(price) || !(volume >= 0.0) || !std::isfinite(volume)) {
+            return;
+        }
+
+        auto& book = acquire(symbolId);
+        const int64_t now = nowMicros();
+        size_t created = 0;
+        {
+            std::lock_guard<std::mutex> lock(book.mutex);
+            for (size_t i = 0; i < RESOLUTION_COUNT; ++i) {
+                if (apply(book.series[i], symbolId, models::BAR_RESOLUTIONS[i], timestampMicros, price, volume, now)) {
+                    ++created;
+                }
+            }
+        }
+        ticks_.fetch_add(1, std::memory_order_relaxed);
+        if (created > 0) {
+            pending_.fetch_add(created, std::memory_order_relaxed);
+        }
+    }
+
+    bool CandleAggregator::apply(
+        Series& series,
+        models::SymbolId symbolId,
+        models::BarResolution resolution,
+        int64_t timestampMicros,
+        double price,
+        double volume,
+        int64_t nowMicros
+    ) {
+        const int64_t openTime = models::barOpenTime(resolution, timestampMicros);
+        auto& open = series.open;
+
+        if (!open) {
+            open = models::CandleBar::fromTick(symbolId, resolution, timestampMicros, price, volume);
+            if (series.coveredFrom == NOT_COVERED) {
+                // 첫 구간은 이 프로세스가 보기 전의 틱이 있을 수 있으므로 다음 구간부터 보유
+                series.coveredFrom = openTime + models::barDurationMicros(resolution);
+            }
+        } else if (openTime == open->openTimeMicros) {
+            open->apply(timestampMicros, price, volume);
+        } else if (openTime > open->openTimeMicros) {
+            insertClosed(series, series.closed.end(), *open);
+            open = models::CandleBar::fromTick(symbolId, resolution, timestampMicros, price, volume);
+        } else if (openTime >= series.coveredFrom) {
+            // 늦은 틱: 이미 마감된 봉에 반영하거나, 틱이 없던 구간이면 봉을 끼워 넣음
+            auto it = std::lower_bound(series.closed.begin(), series.closed.end(), openTime, earlierOpen);
+            if (it != series.closed.end() && it->openTimeMicros == openTime) {
+                it->apply(timestampMicros, price, volume);
+            } else {
+                insertClosed(series, it, models::CandleBar::fromTick(symbolId, resolution, timestampMicros, price, volume));
+            }
+        }
+        // coveredFrom보다 이른 틱은 메모리 봉에는 반영하지 않음 (조회 시 DB + 델타로 응답)
+
+        auto [delta, inserted] = series.deltas.try_emplace(
+            openTime, Delta{models::CandleBar::fromTick(symbolId, resolution, timestampMicros, price, volume), nowMicros});
+        if (!inserted) {
+            delta->second.bar.apply(timestampMicros, price, volume);
+        }
+        return inserted;
+    }
+
+    void CandleAggregator::insertClosed(
+        Series& series,
+        std::deque<models::CandleBar>::iterator position,
+        models::CandleBar bar
+    ) {
+        series.closed.insert(position, bar);
+        if (series.closed.size() > RECENT_BARS) {
+            const auto& evicted = series.closed.front();
+            series.coveredFrom = std::max(series.coveredFrom, evicted.closeTimeMicros());
+            series.closed.pop_front();
+        }
+    }
+
+    CandleAggregator::BarRange CandleAggregator::getBars(
+        models::SymbolId symbolId,
+        models::BarResolution resolution,
+        int64_t fromMicros,
+        int64_t toMicros
+    ) const {
+        BarRange result{{}, {}, NOT_COVERED};
+        const auto* book = find(symbolId);
+        if (!book || fromMicros >= toMicros) {
+            return result;
+        }
+
+        std::lock_guard<std::mutex> lock(book->mutex);
+        const auto& series = book->series[static_cast<size_t>(resolution)];
+        result.coveredFromMicros = series.coveredFrom;
+
+        const int64_t memoryFrom = std::max(fromMicros, series.coveredFrom);
+        if (memoryFrom < toMicros) {
+            auto it = std::lower_bound(series.closed.begin(), series.closed.end(), memoryFrom, earlierOpen);
+            for (; it != series.closed.end() && it->openTimeMicros < toMicros; ++it) {
+                result.bars.push_back(*it);
+            }
+            if (series.open && series.open->openTimeMicros >= memoryFrom && series.open->openTimeMicros < toMicros) {
+                result.bars.push_back(*series.open);
+            }
+        }
+
+        const int64_t storedTo = std::min(toMicros, series.coveredFrom);
+        for (auto it = series.deltas.lower_bound(fromMicros); it != series.deltas.end() && it->first < storedTo; ++it) {
+            result.unflushed.push_back(it->second.bar);
+        }
+        return result;
+    }
+
+    std::optional<models::CandleBar> CandleAggregator::openBar(
+        models::SymbolId symbolId,
+        models::BarResolution resolution
+    ) const {
+        const auto* book = find(symbolId);
+        if (!book) {
+            return std::nullopt;
+        }
+        std::lock_guard<std::mutex> lock(book->mutex);
+        return book->series[static_cast<size_t>(resolution)].open;
+    }
+
+    std::vector<models::CandleBar> CandleAggregator::takeReadyDeltas(int64_t nowMicros) {
+        const bool all = nowMicros == std::numeric_limits<int64_t>::max();
+        const int64_t grace = toMicros(options_.closeGrace);
+        const int64_t maxAge = toMicros(options_.maxDeltaAge);
+
+        std::vector<models::CandleBar> ready;
+        for (auto& slot : books_) {
+            auto* book = slot.load(std::memory_order_acquire);
+            if (!book) {
+                continue;
+            }
+            std::lock_guard<std::mutex> lock(book->mutex);
+            for (auto& series : book->series) {
+                for (auto it = series.deltas.begin(); it != series.deltas.end();) {
+                    const auto& delta = it->second;
+                    if (all || delta.bar.closeTimeMicros() + grace <= nowMicros ||
+                        delta.createdMicros + maxAge <= nowMicros) {
+                        ready.push_back(delta.bar);
+                        it = series.deltas.erase(it);
+                    } else {
+                        ++it;
+                    }
+                }
+            }
+        }
+        pending_.fetch_sub(ready.size(), std::memory_order_relaxed);
+        return ready;
+    }
+
+    void CandleAggregator::restoreDeltas(const std::vector<models::CandleBar>& deltas) {
+        const int64_t now = nowMicros();
+        size_t created = 0;
+        for (const auto& bar : deltas) {
+            if (bar.symbolId >= books_.size()) {
+                continue;
+            }
+            auto& book = acquire(bar.symbolId);
+            std::lock_guard<std::mutex> lock(book.mutex);
+            auto& series = book.series[static_cast<size_t>(bar.resolution)];
+            auto [it, inserted] = series.deltas.try_emplace(bar.openTimeMicros, Delta{bar, now});
+            if (inserted) {
+                ++created;
+                continue;
+            }
+            // 되돌린 델타가 먼저 도착한 틱이므로 기준으로 삼고 이후 델타를 합침
+            Delta restored{bar, now};
+            restored.bar.merge(it->second.bar);
+            it->second = restored;
+        }
+        pending_.fetch_add(created, std::memory_order_relaxed);
+    }
+
+    void CandleAggregator::discard(models::SymbolId symbolId) {
+        if (symbolId >= books_.size()) {
+            return;
+        }
+        auto* book = books_[symbolId].load(std::memory_order_acquire);
+        if (!book) {
+            return;
+        }
+        size_t dropped = 0;
+        {
+            std::lock_guard<std::mutex> lock(book->mutex);
+            for (auto& series : book->series) {
+                dropped += series.deltas.size();
+                series = Series{};
+            }
+        }
+        pending_.fetch_sub(dropped, std::memory_order_relaxed);
+    }
+
+    CandleAggregator::Stats CandleAggregator::getStats() const {
+        return Stats{
+            ticks_.load(std::memory_order_relaxed),
+            barsWritten_.load(std::memory_order_relaxed),
+            failed_.load(std::memory_order_relaxed),
+            flushes_.load(std::memory_order_relaxed),
+            pending_.load(std::memory_order_relaxed)
+        };
+    }
+
+    const CandleAggregator::Book* CandleAggregator::find(models::SymbolId symbolId) const {
+        if (symbolId >= books_.size()) {
+            return nullptr;
+        }
+        return books_[symbolId].load(std::memory_order_acquire);
+    }
+
+    CandleAggregator::Book& CandleAggregator::acquire(models::SymbolId symbolId) {
+        if (auto* book = books_[symbolId].load(std::memory_order_acquire)) {
+            return *book;
+        }
+        std::lock_guard<std::mutex> lock(allocationMutex_);
+        if (auto* book = books_[symbolId].load(std::memory_order_acquire)) {
+            return *book;
+        }
+        auto& book = storage_.emplace_back(std::make_unique<Book>());
+        books_[symbolId].store(book.get(), std::memory_order_release);
+        return *book;
+    }
+
+    void CandleAggregator::run() {
+        std::unique_lock<std::mutex> lock(stopMutex_);
+        while (!stopCv_.wait_for(lock, options_.flushInterval, [this] { return stopRequested_; })) {
+            lock.unlock();
+            flush(nowMicros(), false);
+            lock.lock();
+        }
+    }
+
+    void CandleAggregator::flush(int64_t now, bool final) {
+        std::lock_guard<std::mutex> flushLock(flushMutex_);
+        auto deltas = takeReadyDeltas(now);
+        if (deltas.empty()) {
+            return;
+        }
+
+        auto& mapper = models::mappers::MarketDataMapper::getInstance();
+        for (size_t attempt = 1; ; ++attempt) {
+            try {
+                mapper.upsertBars(deltas);
+                barsWritten_.fetch_add(deltas.size(), std::memory_order_relaxed);
+                flushes_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } catch (const std::exception& e) {
+                if (attempt >= options_.maxFlushAttempts) {
+                    if (final) {
+                        failed_.fetch_add(deltas.size(), std::memory_order_relaxed);
+                        TRADING_LOG_ERROR("Dropping {} candle deltas after {} failed flush attempts: {}",
+                                          deltas.size(), attempt, e.what());
+                    } else {
+                        // 다음 주기에 다시 기록 (그 사이 도착한 틱과 합쳐짐)
+                        restoreDeltas(deltas);
+                        TRADING_LOG_ERROR("Candle flush failed after {} attempts, {} deltas kept for retry: {}",
+                                          attempt, deltas.size(), e.what());
+                    }
+                    return;
+                }
+                TRADING_LOG_WARN("Candle flush attempt {} failed: {}", attempt, e.what());
+                std::this_thread::sleep_for(RETRY_BACKOFF * attempt);
+            }
+        }
+    }
+
+} // namespace repositories
@@ -0,0 +1,229 @@
+#include "repositories/DecryptedSettingsCache.h"
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+namespace repositories {
+
+    namespace {
+
+        constexpr const char* API_KEY_FIELD = "apiKey";
+        constexpr const char* SECRET_FIELD = "secret";
+
+        bool sameField(const Json::Value& a, const Json::Value& b, const char* field) {
+            const bool hasA = a.isObject() && a.isMember(field);
+            const bool hasB = b.isObject() && b.isMember(field);
+            return hasA == hasB && (!hasA || a[field] == b[field]);
+        }
+
+    } // namespace
+
+    DecryptedSettingsCache::DecryptedSettingsCache(std::chrono::seconds ttl, size_t maxEntries)
+        : ttl_(ttl), maxEntries_(std::max<size_t>(maxEntries, 1)) {}
+
+    uint64_t DecryptedSettingsCache::epoch() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return epoch_;
+    }
+
+    bool DecryptedSettingsCache::put(
+        const models::UserSettings& encrypted,
+        const std::optional<std::string>& apiKey,
+        const std::optional<std::string>& secret,
+        uint64_t keyGeneration,
+        uint64_t epoch
+    ) {
+        if (encrypted.getId() == 0) {
+            return false;
+        }
+
+        // 잠금 메모리 확보는 잠금 밖에서 (실패하면 캐시하지 않고 복호화 경로 유지)
+        Entry entry{encrypted, std::nullopt, std::nullopt, {}};
+        try {
+            if (apiKey) {
+                entry.apiKey.emplace(*apiKey);
+            }
+            if (secret) {
+                entry.secret.emplace(*secret);
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (epoch != epoch_ || keyGeneration < keyGeneration_) {
+            // 무효화 이후 또는 이전 키로 복호화한 늦은 쓰기: 새 세대의 항목을 지우지 않도록 버림
+            return false;
+        }
+        if (keyGeneration > keyGeneration_) {
+            // 키 교체: 이전 키로 만든 항목 전부 폐기
+            entries_.clear();
+            users_.clear();
+            keyGeneration_ = keyGeneration;
+        }
+
+        const auto now = Clock::now();
+        entries_.erase(encrypted.getId());
+        makeRoomLocked(now);
+        entry.expiresAt = now + ttl_;
+        entries_.insert_or_assign(encrypted.getId(), std::move(entry));
+        return true;
+    }
+
+    void DecryptedSettingsCache::putUser(
+        int64_t userId,
+        std::vector<int64_t> settingsIds,
+        uint64_t keyGeneration,
+        uint64_t epoch
+    ) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        if (epoch != epoch_ || keyGeneration != keyGeneration_) {
+            return;
+        }
+        users_.insert_or_assign(userId, UserEntry{std::move(settingsIds), Clock::now() + ttl_});
+    }
+
+    std::optional<models::UserSettings> DecryptedSettingsCache::find(int64_t id, uint64_t keyGeneration) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto* entry = findLiveLocked(id, keyGeneration, Clock::now());
+        if (!entry) {
+            return std::nullopt;
+        }
+        return materialize(*entry);
+    }
+
+    std::optional<std::vector<models::UserSettings>> DecryptedSettingsCache::findByUser(
+        int64_t userId,
+        uint64_t keyGeneration
+    ) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto now = Clock::now();
+        auto it = users_.find(userId);
+        if (it == users_.end() || it->second.expiresAt <= now || keyGeneration != keyGeneration_) {
+            return std::nullopt;
+        }
+
+        std::vector<models::UserSettings> result;
+        result.reserve(it->second.settingsIds.size());
+        for (int64_t id : it->second.settingsIds) {
+            const auto* entry = findLiveLocked(id, keyGeneration, now);
+            if (!entry) {
+                return std::nullopt;
+            }
+            result.push_back(materialize(*entry));
+        }
+        return result;
+    }
+
+    bool DecryptedSettingsCache::decryptFromCache(models::UserSettings& row, uint64_t keyGeneration) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto* entry = findLiveLocked(row.getId(), keyGeneration, Clock::now());
+        if (!entry) {
+            return false;
+        }
+        const auto& cached = entry->encrypted.getApiCredentials();
+        const auto& current = row.getApiCredentials();
+        if (!sameField(cached, current, API_KEY_FIELD) || !sameField(cached, current, SECRET_FIELD)) {
+            return false;
+        }
+
+        auto creds = current;
+        if (entry->apiKey) {
+            creds[API_KEY_FIELD] = std::string(entry->apiKey->view());
+        }
+        if (entry->secret) {
+            creds[SECRET_FIELD] = std::string(entry->secret->view());
+        }
+        row.setApiCredentials(creds);
+        return true;
+    }
+
+    bool DecryptedSettingsCache::visitCredentials(
+        int64_t id,
+        uint64_t keyGeneration,
+        const CredentialsVisitor& visitor
+    ) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto* entry = findLiveLocked(id, keyGeneration, Clock::now());
+        if (!entry) {
+            return false;
+        }
+        visitor(entry->apiKey ? entry->apiKey->view() : std::string_view{},
+                entry->secret ? entry->secret->view() : std::string_view{});
+        return true;
+    }
+
+    void DecryptedSettingsCache::invalidate(int64_t id) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ++epoch_;
+        auto it = entries_.find(id);
+        if (it == entries_.end()) {
+            return;
+        }
+        users_.erase(it->second.encrypted.getUserId());
+        entries_.erase(it);
+    }
+
+    void DecryptedSettingsCache::invalidateUser(int64_t userId) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ++epoch_;
+        users_.erase(userId);
+    }
+
+    void DecryptedSettingsCache::invalidateAll() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ++epoch_;
+        entries_.clear();
+        users_.clear();
+    }
+
+    size_t DecryptedSettingsCache::size() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return entries_.size();
+    }
+
+    const DecryptedSettingsCache::Entry* DecryptedSettingsCache::findLiveLocked(
+        int64_t id,
+        uint64_t keyGeneration,
+        Clock::time_point now
+    ) const {
+        if (keyGeneration != keyGeneration_) {
+            return nullptr;
+        }
+        auto it = entries_.find(id);
+        if (it == entries_.end() || it->second.expiresAt <= now) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    void DecryptedSettingsCache::makeRoomLocked(Clock::time_point now) {
+        if (entries_.size() < maxEntries_) {
+            return;
+        }
+        // 만료 항목부터 정리하고, 그래도 가득 차 있으면 만료가 가장 이른 항목 축출
+        std::erase_if(entries_, [now](const auto& item) { return item.second.expiresAt <= now; });
+        std::erase_if(users_, [now](const auto& item) { return item.second.expiresAt <= now; });
+        if (entries_.size() < maxEntries_) {
+            return;
+        }
+        auto oldest = std::min_element(entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+            return a.second.expiresAt < b.second.expiresAt;
+        });
+        entries_.erase(oldest);
+    }
+
+    models::UserSettings DecryptedSettingsCache::materialize(const Entry& entry) {
+        models::UserSettings settings = entry.encrypted;
+        auto creds = settings.getApiCredentials();
+        if (entry.apiKey) {
+            creds[API_KEY_FIELD] = std::string(entry.apiKey->view());
+        }
+        if (entry.secret) {
+            creds[SECRET_FIELD] = std::string(entry.secret->view());
+        }
+        settings.setApiCredentials(creds);
+        return settings;
+    }
+
+} // namespace repositories
@@ -0,0 +1,282 @@
+#include "repositories/MarketDataCache.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace repositories {
+
+    namespace {
+
+        constexpr auto RELAXED = std::memory_order_relaxed;
+
+    } // namespace
+
+    MarketDataCache& MarketDataCache::getInstance() {
+        static MarketDataCache instance;
+        return instance;
+    }
+
+    void MarketDataCache::beginWrite(Slot& slot) {
+        uint64_t sequence = slot.sequence.load(RELAXED);
+        for (;;) {
+            if ((sequence & 1) == 0 &&
+                slot.sequence.compare_exchange_weak(sequence, sequence + 1, std::memory_order_acquire, RELAXED)) {
+                break;
+            }
+            if (sequence & 1) {
+                std::this_thread::yield();
+                sequence = slot.sequence.load(RELAXED);
+            }
+        }
+        // 이후의 필드 쓰기가 홀수 시퀀스보다 먼저 보이지 않도록
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void MarketDataCache::endWrite(Slot& slot) {
+        slot.sequence.fetch_add(1, std::memory_order_release);
+    }
+
+    template <typename Read>
+    bool MarketDataCache::readConsistent(const Slot& slot, Read&& read) {
+        for (size_t attempt = 0; attempt < common::MarketDataCacheConfig::MAX_READ_RETRIES; ++attempt) {
+            const uint64_t before = slot.sequence.load(std::memory_order_acquire);
+            if (before & 1) {
+                continue;
+            }
+            read();
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (slot.sequence.load(RELAXED) == before) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void MarketDataCache::append(Slot& slot, const Tick& tick) {
+        const uint64_t appended = slot.appended.load(RELAXED);
+        auto& cell = slot.ring[appended % CAPACITY];
+
+        int64_t covered = slot.coveredSince.load(RELAXED);
+        if (appended >= CAPACITY) {
+            // 밀려나는 틱 이후부터만 빠짐없이 보유
+            covered = std::max(covered == NOT_COVERED ? FULLY_COVERED : covered,
+                               cell.timestampMicros.load(RELAXED) + 1);
+        } else if (covered == NOT_COVERED) {
+            // 이력 없이 수신만 한 슬롯: 첫 틱 이후만 보유
+            covered = tick.timestampMicros;
+        }
+        slot.coveredSince.store(covered, RELAXED);
+
+        cell.timestampMicros.store(tick.timestampMicros, RELAXED);
+        cell.price.store(tick.price, RELAXED);
+        cell.volume.store(tick.volume, RELAXED);
+        slot.appended.store(appended + 1, RELAXED);
+    }
+
+    void MarketDataCache::storeLatest(Slot& slot, const Tick& tick, std::string_view source) {
+        if (slot.hasLatest.load(RELAXED) && tick.timestampMicros < slot.latestTimestamp.load(RELAXED)) {
+            return;     // 늦게 도착한 과거 틱
+        }
+        slot.latestId.store(tick.id, RELAXED);
+        slot.latestPrice.store(tick.price, RELAXED);
+        slot.latestVolume.store(tick.volume, RELAXED);
+        slot.latestTimestamp.store(tick.timestampMicros, RELAXED);
+
+        std::array<uint64_t, SOURCE_WORDS> words{};
+        std::memcpy(words.data(), source.data(), std::min(source.size(), MAX_SOURCE_LENGTH));
+        for (size_t i = 0; i < SOURCE_WORDS; ++i) {
+            slot.latestSource[i].store(words[i], RELAXED);
+        }
+        slot.hasLatest.store(true, RELAXED);
+    }
+
+    const MarketDataCache::Slot* MarketDataCache::find(models::SymbolId symbolId) const {
+        if (symbolId >= slots_.size()) {
+            return nullptr;
+        }
+        return slots_[symbolId].load(std::memory_order_acquire);
+    }
+
+    MarketDataCache::Slot& MarketDataCache::acquire(models::SymbolId symbolId) {
+        if (auto* slot = slots_[symbolId].load(std::memory_order_acquire)) {
+            return *slot;
+        }
+        std::lock_guard<std::mutex> lock(allocationMutex_);
+        if (auto* slot = slots_[symbolId].load(std::memory_order_acquire)) {
+            return *slot;
+        }
+        auto& slot = storage_.emplace_back(std::make_unique<Slot>());
+        slots_[symbolId].store(slot.get(), std::memory_order_release);
+        return *slot;
+    }
+
+    void MarketDataCache::update(const models::MarketData& data) {
+        update(data.getSymbolId(),
+               Tick{data.getId(), data.getPrice(), data.getVolume(), data.getTimestamp().microSecondsSinceEpoch()},
+               data.getSource());
+    }
+
+    void MarketDataCache::update(models::SymbolId symbolId, const Tick& tick, std::string_view source) {
+        if (symbolId >= slots_.size()) {
+            return;     // INVALID_ID
+        }
+        auto& slot = acquire(symbolId);
+        beginWrite(slot);
+        storeLatest(slot, tick, source);
+        append(slot, tick);
+        endWrite(slot);
+    }
+
+    void MarketDataCache::warm(
+        models::SymbolId symbolId,
+        const std::vector<Tick>& ascending,
+        std::string_view latestSource,
+        bool completeHistory
+    ) {
+        if (symbolId >= slots_.size()) {
+            return;
+        }
+        auto& slot = acquire(symbolId);
+        const size_t skip = ascending.size() > CAPACITY ? ascending.size() - CAPACITY : 0;
+        const int64_t lastLoaded = ascending.empty() ? FULLY_COVERED : ascending.back().timestampMicros;
+
+        beginWrite(slot);
+
+        // DB 조회 이후 수신된 틱 보존
+        std::vector<Tick> newer;
+        const uint64_t appended = slot.appended.load(RELAXED);
+        const uint64_t held = std::min<uint64_t>(appended, CAPACITY);
+        for (uint64_t i = appended - held; i < appended; ++i) {
+            const auto& cell = slot.ring[i % CAPACITY];
+            const int64_t timestamp = cell.timestampMicros.load(RELAXED);
+            if (timestamp > lastLoaded) {
+                newer.push_back(Tick{0, cell.price.load(RELAXED), cell.volume.load(RELAXED), timestamp});
+            }
+        }
+
+        slot.appended.store(0, RELAXED);
+        if (completeHistory && skip == 0) {
+            slot.coveredSince.store(FULLY_COVERED, RELAXED);
+        } else if (ascending.size() > skip) {
+            // 같은 timestamp의 다른 행이 DB에 더 있을 수 있으므로 가장 이른 틱 다음부터 보장
+            slot.coveredSince.store(ascending[skip].timestampMicros + 1, RELAXED);
+        } else {
+            slot.coveredSince.store(NOT_COVERED, RELAXED);
+        }
+        for (size_t i = skip; i < ascending.size(); ++i) {
+            append(slot, ascending[i]);
+        }
+        for (const auto& tick : newer) {
+            append(slot, tick);
+        }
+        if (!ascending.empty()) {
+            storeLatest(slot, ascending.back(), latestSource);
+        }
+
+        endWrite(slot);
+    }
+
+    void MarketDataCache::invalidate(models::SymbolId symbolId) {
+        auto* slot = symbolId < slots_.size() ? slots_[symbolId].load(std::memory_order_acquire) : nullptr;
+        if (!slot) {
+            return;
+        }
+        beginWrite(*slot);
+        slot->hasLatest.store(false, RELAXED);
+        slot->appended.store(0, RELAXED);
+        slot->coveredSince.store(NOT_COVERED, RELAXED);
+        endWrite(*slot);
+    }
+
+    std::optional<double> MarketDataCache::latestPrice(models::SymbolId symbolId) const {
+        const auto* slot = find(symbolId);
+        if (!slot) {
+            return std::nullopt;
+        }
+        bool hasLatest = false;
+        double price = 0.0;
+        const bool consistent = readConsistent(*slot, [&] {
+            hasLatest = slot->hasLatest.load(RELAXED);
+            price = slot->latestPrice.load(RELAXED);
+        });
+        if (!consistent || !hasLatest) {
+            return std::nullopt;
+        }
+        return price;
+    }
+
+    std::optional<MarketDataCache::Quote> MarketDataCache::latestQuote(models::SymbolId symbolId) const {
+        const auto* slot = find(symbolId);
+        if (!slot) {
+            return std::nullopt;
+        }
+        bool hasLatest = false;
+        Tick tick{};
+        std::array<uint64_t, SOURCE_WORDS> words{};
+        const bool consistent = readConsistent(*slot, [&] {
+            hasLatest = slot->hasLatest.load(RELAXED);
+            tick.id = slot->latestId.load(RELAXED);
+            tick.price = slot->latestPrice.load(RELAXED);
+            tick.volume = slot->latestVolume.load(RELAXED);
+            tick.timestampMicros = slot->latestTimestamp.load(RELAXED);
+            for (size_t i = 0; i < SOURCE_WORDS; ++i) {
+                words[i] = slot->latestSource[i].load(RELAXED);
+            }
+        });
+        if (!consistent || !hasLatest) {
+            return std::nullopt;
+        }
+
+        char source[MAX_SOURCE_LENGTH + 1];
+        std::memcpy(source, words.data(), MAX_SOURCE_LENGTH);
+        source[MAX_SOURCE_LENGTH] = '\0';
+        return Quote{tick, std::string(source)};
+    }
+
+    std::optional<MarketDataCache::WindowSummary> MarketDataCache::summarizeSince(
+        models::SymbolId symbolId,
+        int64_t sinceMicros
+    ) const {
+        const auto* slot = find(symbolId);
+        if (!slot) {
+            return std::nullopt;
+        }
+
+        bool covered = false;
+        WindowSummary summary{};
+        const bool consistent = readConsistent(*slot, [&] {
+            covered = slot->coveredSince.load(RELAXED) <= sinceMicros;
+            summary = WindowSummary{};
+            if (!covered) {
+                return;
+            }
+            int64_t firstTimestamp = std::numeric_limits<int64_t>::max();
+            int64_t lastTimestamp = std::numeric_limits<int64_t>::min();
+            const uint64_t appended = slot->appended.load(RELAXED);
+            const uint64_t held = std::min<uint64_t>(appended, CAPACITY);
+            // 도착 순서로 순회. timestamp가 같으면 먼저 온 틱이 첫 틱, 나중에 온 틱이 마지막 틱
+            for (uint64_t i = appended - held; i < appended; ++i) {
+                const auto& cell = slot->ring[i % CAPACITY];
+                const int64_t timestamp = cell.timestampMicros.load(RELAXED);
+                if (timestamp < sinceMicros) {
+                    continue;
+                }
+                const double price = cell.price.load(RELAXED);
+                ++summary.count;
+                if (timestamp < firstTimestamp) {
+                    firstTimestamp = timestamp;
+                    summary.firstPrice = price;
+                }
+                if (timestamp >= lastTimestamp) {
+                    lastTimestamp = timestamp;
+                    summary.lastPrice = price;
+                }
+            }
+        });
+        if (!consistent || !covered) {
+            return std::nullopt;
+        }
+        return summary;
+    }
+
+} // namespace repositories
@@ -1,10 +1,52 @@
 #include "repositories/MarketDataRepository.h"
+#include "database/BinaryCopyWriter.h"
+#include "repositories/MarketDataWriteBehind.h"
+#include "utils/Logger.h"
 #include <stdexcept>
 #include <sstream>
+#include <algorithm>
 #include <cmath>
+#include <limits>
+#include <unordered_set>
 
 namespace repositories {
 
+    namespace {
+
+        // market_data.price/volume 은 DECIMAL(20,8)
+        constexpr int MARKET_DATA_SCALE = 8;
+
+        const char* const COPY_MARKET_DATA_SQL =
+            "COPY market_data (symbol, price, volume, timestamp, source) FROM STDIN (FORMAT binary)";
+
+        const char* const CREATE_STAGING_SQL =
+            "CREATE TEMP TABLE IF NOT EXISTS market_data_staging ("
+            "id BIGINT, symbol VARCHAR(20), price DECIMAL(20,8), volume DECIMAL(20,8), "
+            "timestamp TIMESTAMPTZ, source VARCHAR(50)) ON COMMIT DELETE ROWS";
+
+        const char* const COPY_STAGING_SQL =
+            "COPY market_data_staging (id, symbol, price, volume, timestamp, source) FROM STDIN (FORMAT binary)";
+
+        // 새 timestamp로 행이 다른 파티션으로 옮겨갈 수 있어 m.timestamp 조건을 걸 수 없음: 모든 파티션의 PK 확인
+        const char* const MERGE_UPDATE_SQL =
+            "UPDATE market_data m SET symbol = s.symbol, price = s.price, volume = s.volume, "
+            "timestamp = s.timestamp, source = s.source "
+            "FROM market_data_staging s WHERE s.id IS NOT NULL AND m.id = s.id";
+
+        const char* const MERGE_INSERT_SQL =
+            "INSERT INTO market_data (symbol, price, volume, timestamp, source) "
+            "SELECT symbol, price, volume, timestamp, source FROM market_data_staging WHERE id IS NULL";
+
+        void writeMarketDataFields(database::BinaryCopyWriter& copy, const models::MarketData& data) {
+            copy.addText(data.getSymbol());
+            copy.addNumeric(data.getPrice(), MARKET_DATA_SCALE);
+            copy.addNumeric(data.getVolume(), MARKET_DATA_SCALE);
+            copy.addTimestampMicros(data.getTimestamp().microSecondsSinceEpoch());
+            copy.addText(data.getSource());
+        }
+
+    } // namespace
+
     MarketDataRepository& MarketDataRepository::getInstance() {
         static MarketDataRepository instance;
         return instance;
@@ -13,21 +55,34 @@ namespace repositories {
     models::MarketData MarketDataRepository::save(const models::MarketData& marketData) {
         // id가 0이면 새 레코드 삽입, 아니면 업데이트
         if (marketData.getId() == 0) {
-            return mapper_.insert(marketData);
+            auto saved = mapper_.insert(marketData);
+            cache_.update(saved);
+            candles_.onTick(saved);
+            return saved;
         } else {
             mapper_.update(marketData);
+            // 기존 행 수정은 링의 과거 틱과 어긋날 수 있으므로 슬롯을 비움
+            cache_.invalidate(marketData.getSymbolId());
             return marketData;
         }
     }
 
     std::optional<models::MarketData> MarketDataRepository::findById(int64_t id) const {
         try {
-            return std::make_optional(mapper_.findById(id));
+            return byId_.load(id);
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
     }
 
+    std::vector<models::MarketData> MarketDataRepository::findByIds(std::span<const int64_t> ids) const {
+        const auto unique = uniqueIds(ids);
+        if (unique.empty()) {
+            return {};
+        }
+        return orderByIds(unique, loadByIds(unique));
+    }
+
     bool MarketDataRepository::deleteById(int64_t id) {
         try {
             mapper_.deleteById(id);
@@ -39,7 +94,7 @@ namespace repositories {
 
     BaseRepository<models::MarketData>::PaginationResult 
     MarketDataRepository::findAll(size_t page, size_t pageSize) const {
-        auto totalCount = mapper_.count();
+        auto totalCount = mapper_.approximateCount();
         auto items = mapper_.findWithPaging(pageSize, page * pageSize);
 
         PaginationResult result;
@@ -52,6 +107,51 @@ namespace repositories {
         return result;
     }
 
+    BaseRepository<models::MarketData>::KeysetPage
+    MarketDataRepository::findPage(const std::string& continuationToken, size_t pageSize) const {
+        const auto cursor = decodePageRequest(continuationToken, pageSize);
+        const auto rows = cursor
+            ? mapper_.findPageAfter(cursor->timestampMicros, cursor->id, pageSize + 1)
+            : mapper_.findFirstPage(pageSize + 1);
+
+        std::vector<models::MarketData> items;
+        items.reserve(rows.size());
+        for (const auto& row : rows) {
+            items.push_back(*row);
+        }
+        return makeKeysetPage(std::move(items), pageSize, mapper_.approximateCount());
+    }
+
+    drogon::Task<models::MarketData> MarketDataRepository::saveAsync(models::MarketData marketData) {
+        const bool inserting = marketData.getId() == 0;
+        auto saved = co_await saveVia(mapper_, std::move(marketData));
+        if (inserting) {
+            cache_.update(saved);
+            candles_.onTick(saved);
+        } else {
+            cache_.invalidate(saved.getSymbolId());
+        }
+        co_return saved;
+    }
+
+    drogon::Task<std::optional<models::MarketData>> MarketDataRepository::findByIdAsync(int64_t id) const {
+        return findByIdVia(mapper_, id);
+    }
+
+    drogon::Task<bool> MarketDataRepository::deleteByIdAsync(int64_t id) {
+        return deleteByIdVia(mapper_, id);
+    }
+
+    drogon::Task<BaseRepository<models::MarketData>::PaginationResult>
+    MarketDataRepository::findAllAsync(size_t page, size_t pageSize) const {
+        return findAllVia(mapper_, page, pageSize);
+    }
+
+    drogon::Task<BaseRepository<models::MarketData>::KeysetPage>
+    MarketDataRepository::findPageAsync(std::string continuationToken, size_t pageSize) const {
+        return findPageVia(mapper_, std::move(continuationToken), pageSize);
+    }
+
     std::vector<models::MarketData> MarketDataRepository::findByTimeRange(
         const trantor::Date& start,
         const trantor::Date& end
@@ -62,8 +162,26 @@ namespace repositories {
     }
 
     std::optional<models::MarketData> MarketDataRepository::findLatestBySymbol(const std::string& symbol) const {
+        if (const auto symbolId = models::SymbolRegistry::getInstance().find(symbol)) {
+            if (const auto quote = cache_.latestQuote(*symbolId)) {
+                models::MarketData latest;
+                latest.setId(quote->tick.id);
+                latest.setSymbol(symbol);
+                latest.setPrice(quote->tick.price);
+                latest.setVolume(quote->tick.volume);
+                latest.setTimestamp(trantor::Date(quote->tick.timestampMicros));
+                latest.setSource(quote->source);
+                return latest;
+            }
+        }
+        return loadLatestBySymbol(symbol);
+    }
+
+    std::optional<models::MarketData> MarketDataRepository::loadLatestBySymbol(const std::string& symbol) const {
         try {
-            return std::make_optional(mapper_.findLatestBySymbol(symbol));
+            auto latest = mapper_.findLatestBySymbol(symbol);
+            cache_.update(*latest);
+            return std::make_optional(*latest);
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
@@ -84,8 +202,31 @@ namespace repositories {
         return mapper_.findBySymbolAndTimeRange(symbol, start, end);
     }
 
+    size_t MarketDataRepository::forEachInRange(
+        const std::string& symbol,
+        const trantor::Date& start,
+        const trantor::Date& end,
+        const RowVisitor& visitor,
+        size_t fetchSize
+    ) const {
+        return mapper_.forEachInRange(symbol, start, end, visitor, fetchSize);
+    }
+
+    models::MarketDataBatch MarketDataRepository::findBatchBySymbolAndTimeRange(
+        const std::string& symbol,
+        const trantor::Date& start,
+        const trantor::Date& end
+    ) const {
+        return mapper_.findBatchBySymbolAndTimeRange(symbol, start, end);
+    }
+
     double MarketDataRepository::getLatestPrice(const std::string& symbol) const {
-        auto latestData = findLatestBySymbol(symbol);
+        if (const auto symbolId = models::SymbolRegistry::getInstance().find(symbol)) {
+            if (const auto price = cache_.latestPrice(*symbolId)) {
+                return *price;
+            }
+        }
+        auto latestData = loadLatestBySymbol(symbol);
         if (!latestData) {
             throw std::runtime_error("No price data available for symbol: " + symbol);
         }
@@ -100,15 +241,23 @@ namespace repositories {
         auto now = trantor::Date::now();
         auto windowStart = now.after(-static_cast<double>(timeWindowMinutes) * 60);
 
-        auto recentData = findBySymbolAndTimeRange(symbol, windowStart, now);
-        if (recentData.size() < 2) {
-            return false;  // 데이터 부족
+        if (const auto symbolId = models::SymbolRegistry::getInstance().find(symbol)) {
+            if (const auto summary = cache_.summarizeSince(*symbolId, windowStart.microSecondsSinceEpoch())) {
+                if (summary->count < 2 || summary->firstPrice == 0.0) {
+                    return false;  // 데이터 부족
+                }
+                const double cachedChange =
+                    std::fabs((summary->lastPrice - summary->firstPrice) / summary->firstPrice * 100.0);
+                return cachedChange >= threshold;
+            }
         }
 
-        double latestPrice = recentData.front().getPrice();
-        double oldestPrice = recentData.back().getPrice();
+        auto window = findBatchBySymbolAndTimeRange(symbol, windowStart, now);
+        if (window.size() < 2) {
+            return false;  // 데이터 부족
+        }
 
-        double priceChange = std::fabs((latestPrice - oldestPrice) / oldestPrice) * 100.0;
+        double priceChange = std::fabs(window.priceChangePercent());
         return priceChange >= threshold;
     }
 
@@ -119,31 +268,224 @@ namespace repositories {
         return mapper_.getActiveSymbols(since, minDataPoints);
     }
 
-    void MarketDataRepository::saveBatch(const std::vector<models::MarketData>& marketDataList) {
-        this->executeInTransaction([this, &marketDataList](const TransactionPtr& transPtr) {
-            for (const auto& data : marketDataList) {
-                if (data.getId() == 0) {
-                    mapper_.insert(data, *transPtr);
+    std::vector<models::CandleBar> MarketDataRepository::findBars(
+        const std::string& symbol,
+        models::BarResolution resolution,
+        const trantor::Date& start,
+        const trantor::Date& end
+    ) const {
+        const int64_t fromMicros = start.microSecondsSinceEpoch();
+        const int64_t toMicros = end.microSecondsSinceEpoch();
+        if (fromMicros >= toMicros) {
+            return {};
+        }
+
+        const auto symbolId = models::SymbolRegistry::getInstance().find(symbol);
+        auto range = symbolId ? candles_.getBars(*symbolId, resolution, fromMicros, toMicros)
+                              : CandleAggregator::BarRange{{}, {}, std::numeric_limits<int64_t>::max()};
+
+        std::vector<models::CandleBar> bars;
+        if (fromMicros < range.coveredFromMicros) {
+            bars = mapper_.findBars(symbol, resolution, fromMicros, std::min(toMicros, range.coveredFromMicros));
+            // 아직 기록되지 않은 델타를 같은 구간의 DB 봉에 합침 (둘 다 open_time 오름차순)
+            std::vector<models::CandleBar> merged;
+            merged.reserve(bars.size() + range.unflushed.size());
+            auto stored = bars.begin();
+            for (const auto& delta : range.unflushed) {
+                while (stored != bars.end() && stored->openTimeMicros < delta.openTimeMicros) {
+                    merged.push_back(*stored++);
+                }
+                if (stored != bars.end() && stored->openTimeMicros == delta.openTimeMicros) {
+                    merged.push_back(*stored++);
+                    merged.back().merge(delta);
                 } else {
-                    mapper_.update(data, *transPtr);
+                    merged.push_back(delta);
                 }
             }
-        });
+            merged.insert(merged.end(), stored, bars.end());
+            bars = std::move(merged);
+        }
+        bars.insert(bars.end(), range.bars.begin(), range.bars.end());
+        return bars;
+    }
+
+    void MarketDataRepository::saveBatch(const std::vector<models::MarketData>& marketDataList) {
+        if (marketDataList.empty()) {
+            return;
+        }
+        auto& writer = MarketDataWriteBehind::getInstance();
+        const bool allNew = std::all_of(marketDataList.begin(), marketDataList.end(),
+            [](const models::MarketData& data) { return data.getId() == 0; });
+        if (!allNew || !writer.isRunning()) {
+            if (allNew) {
+                copyBatch(marketDataList);
+            } else {
+                upsertBatch(marketDataList);
+            }
+            return;
+        }
+
+        // 기록은 flush 스레드가 배치로 처리하므로 최신 시세와 봉은 여기서 바로 반영
+        std::vector<models::MarketData> closed;
+        for (const auto& data : marketDataList) {
+            switch (writer.enqueue(std::make_shared<models::MarketData>(data))) {
+                case MarketDataWriteBehind::EnqueueResult::Queued:
+                    cache_.update(data);
+                    candles_.onTick(data);
+                    break;
+                case MarketDataWriteBehind::EnqueueResult::Dropped:
+                    break;                      // DropNewest 정책으로 버림 (Block은 종료 시 Closed)
+                case MarketDataWriteBehind::EnqueueResult::Closed:
+                    closed.push_back(data);     // 도중에 종료됨: 큐에 넣지 못한 행은 직접 기록
+                    break;
+            }
+        }
+        if (!closed.empty()) {
+            copyBatch(closed);
+        }
+    }
+
+    void MarketDataRepository::persistBatch(const std::vector<models::MarketData>& marketDataList) {
+        if (marketDataList.empty()) {
+            return;
+        }
+        const bool hasExisting = std::any_of(marketDataList.begin(), marketDataList.end(),
+            [](const models::MarketData& data) { return data.getId() != 0; });
+        if (hasExisting) {
+            upsertRows(marketDataList);
+        } else {
+            copyRows(marketDataList);
+        }
+    }
+
+    size_t MarketDataRepository::copyBatch(const std::vector<models::MarketData>& marketDataList) {
+        const size_t copied = copyRows(marketDataList);
+        publishCommitted(marketDataList);
+        return copied;
+    }
+
+    size_t MarketDataRepository::upsertBatch(const std::vector<models::MarketData>& marketDataList) {
+        const size_t merged = upsertRows(marketDataList);
+        publishCommitted(marketDataList);
+        return merged;
+    }
+
+    void MarketDataRepository::publishCommitted(const std::vector<models::MarketData>& marketDataList) {
+        // 기존 행을 고친 심볼은 링의 과거 틱과 어긋날 수 있으므로 비우고 (save와 같음), 그 심볼의 신규 행도 넣지 않음
+        // 봉은 신규 틱만 집계 (기존 행 수정은 이미 집계된 틱이므로 다시 더하지 않음)
+        std::unordered_set<models::SymbolId> modified;
+        for (const auto& data : marketDataList) {
+            if (data.getId() != 0) {
+                modified.insert(data.getSymbolId());
+            }
+        }
+        for (const auto& data : marketDataList) {
+            if (data.getId() != 0) {
+                continue;
+            }
+            if (!modified.contains(data.getSymbolId())) {
+                cache_.update(data);
+            }
+            candles_.onTick(data);
+        }
+        for (const auto symbolId : modified) {
+            cache_.invalidate(symbolId);
+        }
+    }
+
+    size_t MarketDataRepository::copyRows(const std::vector<models::MarketData>& marketDataList) {
+        if (marketDataList.empty()) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(copyMutex_);
+        database::BinaryCopyWriter copy(copyConnection(), COPY_MARKET_DATA_SQL);
+        for (const auto& data : marketDataList) {
+            copy.beginRow(5);
+            writeMarketDataFields(copy, data);
+        }
+        return copy.finish();
+    }
+
+    size_t MarketDataRepository::upsertRows(const std::vector<models::MarketData>& marketDataList) {
+        if (marketDataList.empty()) {
+            return 0;
+        }
+
+        std::lock_guard<std::mutex> lock(copyMutex_);
+        auto& connection = copyConnection();
+        connection.exec("BEGIN");
+        try {
+            connection.exec(CREATE_STAGING_SQL);
+            {
+                database::BinaryCopyWriter copy(connection, COPY_STAGING_SQL);
+                for (const auto& data : marketDataList) {
+                    copy.beginRow(6);
+                    if (data.getId() != 0) {
+                        copy.addInt64(data.getId());
+                    } else {
+                        copy.addNull();
+                    }
+                    writeMarketDataFields(copy, data);
+                }
+                copy.finish();
+            }
+            connection.exec(MERGE_UPDATE_SQL);
+            connection.exec(MERGE_INSERT_SQL);
+            connection.exec("COMMIT");
+        } catch (const std::exception& e) {
+            TRADING_LOG_ERROR("Market data upsert batch failed: {}", e.what());
+            try {
+                connection.exec("ROLLBACK");
+            } catch (const std::exception&) {
+                // 연결이 끊긴 경우 서버가 이미 롤백함
+            }
+            throw;
+        }
+        return marketDataList.size();
+    }
+
+    std::vector<models::MarketData> MarketDataRepository::loadByIds(const std::vector<int64_t>& ids) const {
+        std::vector<models::MarketData> rows;
+        for (const auto& data : mapper_.findByIds(ids)) {
+            rows.push_back(*data);
+        }
+        return rows;
+    }
+
+    database::PgConnection& MarketDataRepository::copyConnection() {
+        if (copyConnection_ && copyConnection_->ensureConnected()) {
+            return *copyConnection_;
+        }
+        copyConnection_ = std::make_unique<database::PgConnection>(
+            database::PgConnection::connectionStringFromConfig());
+        return *copyConnection_;
     }
 
     void MarketDataRepository::invalidateCache(const std::string& symbol) {
-        // TODO: 캐시 무효화 로직 구현
+        if (const auto symbolId = models::SymbolRegistry::getInstance().find(symbol)) {
+            cache_.invalidate(*symbolId);
+        }
     }
 
     void MarketDataRepository::warmupCache(const std::string& symbol) {
-        // TODO: 캐시 프리로딩 로직 구현
-    }
+        const auto symbolId = models::SymbolRegistry::getInstance().intern(symbol);
+        if (symbolId == models::SymbolRegistry::INVALID_ID) {
+            return;
+        }
 
-    std::string MarketDataRepository::createCacheKey(
-        const std::string& symbol,
-        const std::string& suffix
-    ) const {
-        return "market_data:" + symbol + (suffix.empty() ? "" : ":" + suffix);
+        // timestamp 내림차순으로 읽어 오름차순으로 뒤집음
+        const auto rows = mapper_.findBySymbolWithLimit(symbol, MarketDataCache::CAPACITY);
+        std::vector<MarketDataCache::Tick> ticks;
+        ticks.reserve(rows.size());
+        for (auto it = rows.rbegin(); it != rows.rend(); ++it) {
+            const auto& row = **it;
+            ticks.push_back(MarketDataCache::Tick{
+                row.getId(), row.getPrice(), row.getVolume(), row.getTimestamp().microSecondsSinceEpoch()});
+        }
+        const std::string_view latestSource = rows.empty() ? std::string_view() : rows.front()->getSource();
+        // 상한보다 적게 읽혔으면 심볼의 전체 이력
+        cache_.warm(symbolId, ticks, latestSource, rows.size() < MarketDataCache::CAPACITY);
     }
 
 } // namespace repositories
@@ -0,0 +1,268 @@
+#include "repositories/MarketDataWriteBehind.h"
+#include "memory/GarbageCollector.h"
+#include "utils/Logger.h"
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+namespace repositories {
+
+    namespace {
+
+        constexpr std::chrono::milliseconds RETRY_BACKOFF{50};
+
+    } // namespace
+
+    MarketDataWriteBehind& MarketDataWriteBehind::getInstance() {
+        // sink가 가리키는 저장소는 호출자가 먼저 생성해 이 객체보다 늦게 파괴되도록 보장 (소멸자에서 flush)
+        static MarketDataWriteBehind instance;
+        return instance;
+    }
+
+    MarketDataWriteBehind::~MarketDataWriteBehind() {
+        stop();
+    }
+
+    void MarketDataWriteBehind::start(const Options& options) {
+        if (options.capacity == 0 || options.batchSize == 0 || options.maxFlushAttempts == 0) {
+            throw std::invalid_argument("Write-behind capacity, batch size and flush attempts must be positive");
+        }
+        if (!options.sink) {
+            throw std::invalid_argument("Write-behind sink is required");
+        }
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (running_.load(std::memory_order_acquire)) {
+            throw std::logic_error("Market data write-behind is already running");
+        }
+
+        // 생산자가 running_을 관찰하기 전에 옵션을 확정
+        options_ = options;
+        stopping_.store(false, std::memory_order_release);
+        flusher_ = std::thread([this] { run(); });
+        running_.store(true, std::memory_order_release);
+
+        TRADING_LOG_INFO("Market data write-behind started (capacity={}, batch={}, interval={}ms)",
+                         options_.capacity, options_.batchSize, options_.flushInterval.count());
+    }
+
+    void MarketDataWriteBehind::stop() {
+        std::lock_guard<std::mutex> lifecycle(lifecycleMutex_);
+        if (!running_.load(std::memory_order_acquire)) {
+            return;
+        }
+        stopping_.store(true, std::memory_order_release);
+
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            flushRequested_ = true;
+        }
+        wakeCv_.notify_one();
+        {
+            std::lock_guard<std::mutex> lock(spaceMutex_);
+        }
+        spaceCv_.notify_all();
+
+        if (flusher_.joinable()) {
+            flusher_.join();
+        }
+        running_.store(false, std::memory_order_release);
+
+        const auto stats = getStats();
+        TRADING_LOG_INFO("Market data write-behind stopped (written={}, dropped={}, failed={})",
+                         stats.written, stats.dropped, stats.failed);
+    }
+
+    MarketDataWriteBehind::EnqueueResult MarketDataWriteBehind::enqueue(std::shared_ptr<models::MarketData> data) {
+        // libcds 큐는 HP GC에 연결된 스레드에서만 사용 가능. 생산자 스레드 종료 시 분리
+        // 다른 범위의 ThreadGuard가 먼저 분리했을 수 있으므로 매번 확인 (연결돼 있으면 즉시 반환)
+        thread_local memory::GarbageCollector::ThreadGuard gcGuard;
+        memory::GarbageCollector::attach_thread();
+
+        activeProducers_.fetch_add(1, std::memory_order_acq_rel);
+        struct ProducerGuard {
+            std::atomic<size_t>& count;
+            ~ProducerGuard() { count.fetch_sub(1, std::memory_order_acq_rel); }
+        } guard{activeProducers_};
+
+        if (!running_.load(std::memory_order_acquire) || stopping_.load(std::memory_order_acquire)) {
+            return EnqueueResult::Closed;
+        }
+
+        // 용량 확인과 증가를 한 번의 CAS로 수행해 동시 생산자가 함께 용량을 넘기지 않도록 함
+        // push 전에 세어 두어야 flush/DropOldest의 감소가 아직 세지 않은 원소를 빼지 않음
+        auto& queue = models::MarketData::update_queue();
+        size_t pending = tryReserve();
+        while (pending == 0) {
+            switch (options_.policy) {
+                case OverflowPolicy::DropNewest:
+                    dropped_.fetch_add(1, std::memory_order_relaxed);
+                    return EnqueueResult::Dropped;
+                case OverflowPolicy::DropOldest:
+                    if (queue.pop()) {
+                        pending_.fetch_sub(1, std::memory_order_acq_rel);
+                        dropped_.fetch_add(1, std::memory_order_relaxed);
+                    } else {
+                        // 자리를 예약한 생산자가 아직 넣지 않음
+                        std::this_thread::yield();
+                    }
+                    break;
+                case OverflowPolicy::Block:
+                    if (!waitForSpace()) {
+                        // 대기 중 종료: 버리지 않고 호출자가 직접 기록
+                        return EnqueueResult::Closed;
+                    }
+                    break;
+            }
+            pending = tryReserve();
+        }
+
+        queue.push(std::move(data));
+        enqueued_.fetch_add(1, std::memory_order_relaxed);
+
+        // 배치 임계값을 넘는 순간에만 깨움. 놓친 알림은 다음 FLUSH_INTERVAL에 처리됨
+        // 대기 중인 생산자가 있으면 바로 flush: 세었지만 아직 넣지 않은 틱은 앞선 flush가 꺼내지 못함
+        if (blockedProducers_.load(std::memory_order_acquire) > 0) {
+            requestFlush();
+        } else if (pending == options_.batchSize) {
+            wakeCv_.notify_one();
+        }
+        return EnqueueResult::Queued;
+    }
+
+    void MarketDataWriteBehind::requestFlush() {
+        {
+            std::lock_guard<std::mutex> lock(wakeMutex_);
+            flushRequested_ = true;
+        }
+        wakeCv_.notify_one();
+    }
+
+    MarketDataWriteBehind::Stats MarketDataWriteBehind::getStats() const {
+        return Stats{
+            enqueued_.load(std::memory_order_relaxed),
+            written_.load(std::memory_order_relaxed),
+            dropped_.load(std::memory_order_relaxed),
+            failed_.load(std::memory_order_relaxed),
+            flushes_.load(std::memory_order_relaxed),
+            pending_.load(std::memory_order_relaxed)
+        };
+    }
+
+    size_t MarketDataWriteBehind::tryReserve() {
+        size_t pending = pending_.load(std::memory_order_acquire);
+        while (pending < options_.capacity) {
+            if (pending_.compare_exchange_weak(pending, pending + 1,
+                                               std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return pending + 1;
+            }
+        }
+        return 0;
+    }
+
+    bool MarketDataWriteBehind::waitForSpace() {
+        blockedProducers_.fetch_add(1, std::memory_order_acq_rel);
+        {
+            std::unique_lock<std::mutex> lock(spaceMutex_);
+            while (pending_.load(std::memory_order_acquire) >= options_.capacity &&
+                   !stopping_.load(std::memory_order_acquire)) {
+                // 다른 생산자가 빈 자리를 먼저 차지했을 수 있으므로 깰 때마다 다시 flush 요청
+                requestFlush();
+                spaceCv_.wait(lock);
+            }
+        }
+        blockedProducers_.fetch_sub(1, std::memory_order_acq_rel);
+
+        return !stopping_.load(std::memory_order_acquire);
+    }
+
+    void MarketDataWriteBehind::run() {
+        memory::GarbageCollector::ThreadGuard gcGuard;
+
+        std::vector<std::shared_ptr<models::MarketData>> batch;
+        batch.reserve(options_.batchSize);
+
+        while (!stopping_.load(std::memory_order_acquire)) {
+            {
+                std::unique_lock<std::mutex> lock(wakeMutex_);
+                wakeCv_.wait_for(lock, options_.flushInterval, [this] {
+                    return flushRequested_ ||
+                           stopping_.load(std::memory_order_acquire) ||
+                           pending_.load(std::memory_order_acquire) >= options_.batchSize;
+                });
+                flushRequested_ = false;
+            }
+
+            // 깨어난 시점에 쌓인 틱을 배치 단위로 모두 기록
+            size_t remaining = pending_.load(std::memory_order_acquire);
+            while (remaining > 0) {
+                drain(batch, std::min(remaining, options_.batchSize));
+                if (batch.empty()) {
+                    break;
+                }
+                remaining -= std::min(remaining, batch.size());
+                writeBatch(batch);
+                batch.clear();
+            }
+        }
+
+        // 종료: enqueue 중인 생산자가 모두 빠져나간 뒤 남은 틱을 전부 기록
+        while (activeProducers_.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+        for (;;) {
+            drain(batch, options_.batchSize);
+            if (batch.empty()) {
+                break;
+            }
+            writeBatch(batch);
+            batch.clear();
+        }
+    }
+
+    void MarketDataWriteBehind::drain(std::vector<std::shared_ptr<models::MarketData>>& batch, size_t maxItems) {
+        const size_t count = models::MarketData::update_queue().pop_batch(std::back_inserter(batch), maxItems);
+        if (count == 0) {
+            return;
+        }
+        pending_.fetch_sub(count, std::memory_order_acq_rel);
+
+        if (blockedProducers_.load(std::memory_order_acquire) > 0) {
+            {
+                std::lock_guard<std::mutex> lock(spaceMutex_);
+            }
+            spaceCv_.notify_all();
+        }
+    }
+
+    void MarketDataWriteBehind::writeBatch(const std::vector<std::shared_ptr<models::MarketData>>& batch) {
+        std::vector<models::MarketData> rows;
+        rows.reserve(batch.size());
+        for (const auto& data : batch) {
+            if (data) {
+                rows.push_back(*data);
+            }
+        }
+        if (rows.empty()) {
+            return;
+        }
+
+        for (size_t attempt = 1; ; ++attempt) {
+            try {
+                options_.sink(rows);
+                written_.fetch_add(rows.size(), std::memory_order_relaxed);
+                flushes_.fetch_add(1, std::memory_order_relaxed);
+                return;
+            } catch (const std::exception& e) {
+                if (attempt >= options_.maxFlushAttempts) {
+                    failed_.fetch_add(rows.size(), std::memory_order_relaxed);
+                    TRADING_LOG_ERROR("Dropping {} market data rows after {} failed flush attempts: {}",
+                                      rows.size(), attempt, e.what());
+                    return;
+                }
+                TRADING_LOG_WARN("Market data flush attempt {} failed: {}", attempt, e.what());
+                std::this_thread::sleep_for(RETRY_BACKOFF * attempt);
+            }
+        }
+    }
+
+} // namespace repositories
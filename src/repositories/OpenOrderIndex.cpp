@@ -0,0 +1,189 @@
+#include "repositories/OpenOrderIndex.h"
+#include <algorithm>
+#include <limits>
+#include <mutex>
+
+namespace repositories {
+
+    bool OpenOrderIndex::isOpenStatus(std::string_view status) {
+        return std::find(OPEN_STATUSES.begin(), OPEN_STATUSES.end(), status) != OPEN_STATUSES.end();
+    }
+
+    void OpenOrderIndex::rebuild(const std::vector<models::Order>& openOrders) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        orders_.clear();
+        byOrderId_.clear();
+        bySymbol_.clear();
+        byStatus_.clear();
+        for (const auto& order : openOrders) {
+            if (order.getId() != 0 && isOpenStatus(order.getStatus())) {
+                insertLocked(order);
+            }
+        }
+        ready_ = true;
+    }
+
+    bool OpenOrderIndex::isReady() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return ready_;
+    }
+
+    void OpenOrderIndex::upsert(const models::Order& order) {
+        if (order.getId() == 0) {
+            return;
+        }
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        eraseLocked(order.getId());
+        if (isOpenStatus(order.getStatus())) {
+            insertLocked(order);
+        }
+    }
+
+    bool OpenOrderIndex::applyStatus(int64_t id, const std::string& status, double filledQuantity, double filledPrice) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        auto it = orders_.find(id);
+        if (it == orders_.end()) {
+            return !isOpenStatus(status);
+        }
+        if (!isOpenStatus(status)) {
+            eraseLocked(id);
+            return true;
+        }
+
+        auto& order = it->second;
+        if (order.getStatus() != status) {
+            auto& previous = byStatus_[order.getStatus()];
+            previous.erase(id);
+            if (previous.empty()) {
+                byStatus_.erase(order.getStatus());
+            }
+            byStatus_[status].insert(id);
+            order.setStatus(status);
+        }
+        order.setFilledQuantity(filledQuantity);
+        order.setFilledPrice(filledPrice);
+        return true;
+    }
+
+    void OpenOrderIndex::erase(int64_t id) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        eraseLocked(id);
+    }
+
+    std::optional<models::Order> OpenOrderIndex::findById(int64_t id) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = orders_.find(id);
+        if (it == orders_.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    std::optional<models::Order> OpenOrderIndex::findByOrderId(const std::string& orderId) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = byOrderId_.find(orderId);
+        if (it == byOrderId_.end()) {
+            return std::nullopt;
+        }
+        return orders_.at(it->second);
+    }
+
+    std::vector<models::Order> OpenOrderIndex::findOpen(const std::string& symbol) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        if (symbol.empty()) {
+            std::vector<models::Order> result;
+            result.reserve(orders_.size());
+            for (const auto& [id, order] : orders_) {
+                result.push_back(order);
+            }
+            std::sort(result.begin(), result.end(), [](const models::Order& a, const models::Order& b) {
+                return a.getTimestamp() > b.getTimestamp();
+            });
+            return result;
+        }
+
+        const auto symbolId = models::SymbolRegistry::getInstance().find(symbol);
+        if (!symbolId) {
+            return {};
+        }
+        auto it = bySymbol_.find(*symbolId);
+        if (it == bySymbol_.end()) {
+            return {};
+        }
+        return collectLocked(it->second, std::numeric_limits<size_t>::max());
+    }
+
+    std::vector<models::Order> OpenOrderIndex::findByStatus(const std::string& status, size_t limit) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = byStatus_.find(status);
+        if (it == byStatus_.end()) {
+            return {};
+        }
+        return collectLocked(it->second, limit);
+    }
+
+    size_t OpenOrderIndex::size() const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        return orders_.size();
+    }
+
+    void OpenOrderIndex::insertLocked(const models::Order& order) {
+        const int64_t id = order.getId();
+        orders_.insert_or_assign(id, order);
+        byOrderId_[order.getOrderId()] = id;
+        bySymbol_[order.getSymbolId()].insert(id);
+        byStatus_[order.getStatus()].insert(id);
+    }
+
+    void OpenOrderIndex::eraseLocked(int64_t id) {
+        auto it = orders_.find(id);
+        if (it == orders_.end()) {
+            return;
+        }
+        const auto& order = it->second;
+
+        auto orderIdIt = byOrderId_.find(order.getOrderId());
+        if (orderIdIt != byOrderId_.end() && orderIdIt->second == id) {
+            byOrderId_.erase(orderIdIt);
+        }
+        if (auto symbolIt = bySymbol_.find(order.getSymbolId()); symbolIt != bySymbol_.end()) {
+            symbolIt->second.erase(id);
+            if (symbolIt->second.empty()) {
+                bySymbol_.erase(symbolIt);
+            }
+        }
+        if (auto statusIt = byStatus_.find(order.getStatus()); statusIt != byStatus_.end()) {
+            statusIt->second.erase(id);
+            if (statusIt->second.empty()) {
+                byStatus_.erase(statusIt);
+            }
+        }
+        orders_.erase(it);
+    }
+
+    std::vector<models::Order> OpenOrderIndex::collectLocked(const std::unordered_set<int64_t>& ids, size_t limit) const {
+        std::vector<const models::Order*> matches;
+        matches.reserve(ids.size());
+        for (int64_t id : ids) {
+            matches.push_back(&orders_.at(id));
+        }
+        const auto newestFirst = [](const models::Order* a, const models::Order* b) {
+            return a->getTimestamp() > b->getTimestamp();
+        };
+        if (limit < matches.size()) {
+            std::partial_sort(matches.begin(), matches.begin() + static_cast<std::ptrdiff_t>(limit),
+                              matches.end(), newestFirst);
+            matches.resize(limit);
+        } else {
+            std::sort(matches.begin(), matches.end(), newestFirst);
+        }
+
+        std::vector<models::Order> result;
+        result.reserve(matches.size());
+        for (const auto* order : matches) {
+            result.push_back(*order);
+        }
+        return result;
+    }
+
+} // namespace repositories
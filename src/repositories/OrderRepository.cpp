@@ -1,4 +1,5 @@
 #include "repositories/OrderRepository.h"
+#include "utils/Logger.h"
 #include <stdexcept>
 #include <sstream>
 #include <cmath>
@@ -13,24 +14,50 @@ namespace repositories {
     models::Order OrderRepository::save(const models::Order& order) {
         // id가 0이면 새 레코드 삽입, 아니면 업데이트
         if (order.getId() == 0) {
-            return mapper_.insert(order);
+            auto saved = mapper_.insert(order);
+            openOrders_.upsert(saved);
+            return saved;
         } else {
             mapper_.update(order);
+            openOrders_.upsert(order);
             return order;
         }
     }
 
     std::optional<models::Order> OrderRepository::findById(int64_t id) const {
+        if (auto open = openOrders_.findById(id)) {
+            return open;
+        }
         try {
-            return std::make_optional(mapper_.findById(id));
+            return byId_.load(id);
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
     }
 
+    std::vector<models::Order> OrderRepository::findByIds(std::span<const int64_t> ids) const {
+        // 미체결 주문은 인덱스에서, 나머지만 DB에서
+        const auto unique = uniqueIds(ids);
+        std::vector<models::Order> rows;
+        std::vector<int64_t> missing;
+        for (int64_t id : unique) {
+            if (auto open = openOrders_.findById(id)) {
+                rows.push_back(std::move(*open));
+            } else {
+                missing.push_back(id);
+            }
+        }
+        if (!missing.empty()) {
+            auto loaded = mapper_.findByIds(missing);
+            rows.insert(rows.end(), std::make_move_iterator(loaded.begin()), std::make_move_iterator(loaded.end()));
+        }
+        return orderByIds(unique, std::move(rows));
+    }
+
     bool OrderRepository::deleteById(int64_t id) {
         try {
             mapper_.deleteById(id);
+            openOrders_.erase(id);
             return true;
         } catch (const std::runtime_error&) {
             return false;
@@ -39,7 +66,7 @@ namespace repositories {
 
     BaseRepository<models::Order>::PaginationResult 
     OrderRepository::findAll(size_t page, size_t pageSize) const {
-        auto totalCount = mapper_.count();
+        auto totalCount = mapper_.approximateCount();
         auto items = mapper_.findWithPaging(pageSize, page * pageSize);
 
         PaginationResult result;
@@ -52,6 +79,47 @@ namespace repositories {
         return result;
     }
 
+    BaseRepository<models::Order>::KeysetPage
+    OrderRepository::findPage(const std::string& continuationToken, size_t pageSize) const {
+        return drogon::sync_wait(findPageAsync(continuationToken, pageSize));
+    }
+
+    drogon::Task<models::Order> OrderRepository::saveAsync(models::Order order) {
+        auto saved = co_await saveVia(mapper_, std::move(order));
+        openOrders_.upsert(saved);
+        co_return saved;
+    }
+
+    drogon::Task<models::Order> OrderRepository::saveGrouped(models::Order order) {
+        return saveGroupedVia(mapper_, std::move(order),
+                              [this](const models::Order& saved) { openOrders_.upsert(saved); });
+    }
+
+    drogon::Task<std::optional<models::Order>> OrderRepository::findByIdAsync(int64_t id) const {
+        if (auto open = openOrders_.findById(id)) {
+            co_return open;
+        }
+        co_return co_await findByIdVia(mapper_, id);
+    }
+
+    drogon::Task<bool> OrderRepository::deleteByIdAsync(int64_t id) {
+        const bool deleted = co_await deleteByIdVia(mapper_, id);
+        if (deleted) {
+            openOrders_.erase(id);
+        }
+        co_return deleted;
+    }
+
+    drogon::Task<BaseRepository<models::Order>::PaginationResult>
+    OrderRepository::findAllAsync(size_t page, size_t pageSize) const {
+        return findAllVia(mapper_, page, pageSize);
+    }
+
+    drogon::Task<BaseRepository<models::Order>::KeysetPage>
+    OrderRepository::findPageAsync(std::string continuationToken, size_t pageSize) const {
+        return findPageVia(mapper_, std::move(continuationToken), pageSize);
+    }
+
     std::vector<models::Order> OrderRepository::findByTimeRange(
         const trantor::Date& start,
         const trantor::Date& end
@@ -63,21 +131,14 @@ namespace repositories {
 
     // Order 전용 메서드
     std::vector<models::Order> OrderRepository::findBySymbol(const std::string& symbol, size_t limit) const {
-        // mapper에 limit 지원이 없다면 findBySymbol 후 상위 limit만 slicing
-        // 여기서는 mapper에 limit 기능이 없으므로 전체를 받고 상위 limit만 잘라냄
-        auto result = mapper_.findBySymbol(symbol);
-        if (result.size() > limit) {
-            result.resize(limit);
-        }
-        return result;
+        return mapper_.findBySymbol(symbol, limit);
     }
 
     std::vector<models::Order> OrderRepository::findByStatus(const std::string& status, size_t limit) const {
-        auto result = mapper_.findByStatus(status);
-        if (result.size() > limit) {
-            result.resize(limit);
+        if (OpenOrderIndex::isOpenStatus(status) && openOrders_.isReady()) {
+            return openOrders_.findByStatus(status, limit);
         }
-        return result;
+        return mapper_.findByStatus(status, limit);
     }
 
     std::vector<models::Order> OrderRepository::findBySignalId(int64_t signalId) const {
@@ -85,7 +146,22 @@ namespace repositories {
     }
 
     std::vector<models::Order> OrderRepository::findPendingOrders(const std::string& symbol) const {
-        return mapper_.findPendingOrders(symbol);
+        if (!openOrders_.isReady()) {
+            return mapper_.findPendingOrders(symbol);
+        }
+        auto open = openOrders_.findOpen(symbol);
+        std::erase_if(open, [](const models::Order& order) { return order.getStatus() != "PENDING"; });
+        return open;
+    }
+
+    std::optional<models::Order> OrderRepository::findOpenByOrderId(const std::string& orderId) const {
+        return openOrders_.findByOrderId(orderId);
+    }
+
+    void OrderRepository::rebuildOpenOrderIndex() {
+        // OPEN_STATUSES가 PENDING뿐이므로 미체결 주문 = PENDING 주문 (primary에서 조회)
+        openOrders_.rebuild(mapper_.findPendingOrders());
+        TRADING_LOG_INFO("Open order index rebuilt with {} orders", openOrders_.size());
     }
 
     std::vector<models::Order> OrderRepository::findBySymbolAndTimeRange(
@@ -96,21 +172,79 @@ namespace repositories {
         return mapper_.findByTimeRange(symbol, start, end);
     }
 
+    size_t OrderRepository::forEachInRange(
+        const std::string& symbol,
+        const trantor::Date& start,
+        const trantor::Date& end,
+        const RowVisitor& visitor,
+        size_t fetchSize
+    ) const {
+        return mapper_.forEachInRange(symbol, start, end, visitor, fetchSize);
+    }
+
     void OrderRepository::updateOrderStatus(int64_t id, const std::string& status, double filledQuantity, double filledPrice) {
+        // 인덱스 반영 시 방금 갱신한 행을 replica가 아닌 primary에서 읽도록 고정
+        database::DbRouter::ReadYourWritesScope scope;
         mapper_.updateOrderStatus(id, status, filledQuantity, filledPrice);
+        applyStatusToIndex(id, status, filledQuantity, filledPrice);
+    }
+
+    size_t OrderRepository::updateOrderStatusBatch(const std::vector<models::mappers::OrderStatusUpdate>& updates) {
+        if (updates.empty()) {
+            return 0;
+        }
+        database::DbRouter::ReadYourWritesScope scope;
+        const size_t affected = mapper_.updateOrderStatusBatch(updates);
+        for (const auto& update : updates) {
+            applyStatusToIndex(update.id, update.status, update.filledQuantity, update.filledPrice);
+        }
+        return affected;
+    }
+
+    void OrderRepository::applyStatusToIndex(int64_t id, const std::string& status, double filledQuantity, double filledPrice) {
+        if (openOrders_.applyStatus(id, status, filledQuantity, filledPrice)) {
+            return;
+        }
+        try {
+            openOrders_.upsert(mapper_.findById(id));
+        } catch (const std::runtime_error&) {
+            // 배치에 없는 id가 섞인 경우: DB에도 없으므로 반영할 것 없음
+        }
     }
 
     // Batch 작업 예: 한 번에 여러 Order를 Insert/Update
     void OrderRepository::saveBatch(const std::vector<models::Order>& orderList) {
-        this->executeInTransaction([this, &orderList](const TransactionPtr& transPtr) {
-            for (const auto& order : orderList) {
-                if (order.getId() == 0) {
-                    mapper_.insert(order, *transPtr);
-                } else {
-                    mapper_.update(order, *transPtr);
+        // 신규/기존 행을 나눠 각각 다건 문장으로 처리 (행마다 왕복하지 않음)
+        std::vector<models::Order> inserts;
+        std::vector<models::Order> updates;
+        for (const auto& order : orderList) {
+            (order.getId() == 0 ? inserts : updates).push_back(order);
+        }
+
+        // 다건 INSERT는 id를 돌려주지 않으므로 order_id로 다시 읽어 커밋 후 인덱스에 반영
+        // (order_id 중복은 order_ids 트리거가 INSERT에서 거부하므로 번호당 한 행)
+        auto committed = std::make_shared<std::vector<models::Order>>();
+        this->executeInTransaction(
+            [this, committed, inserts = std::move(inserts), updates = std::move(updates)](const TransactionPtr& transPtr) {
+                if (!inserts.empty()) {
+                    mapper_.insertBatch(inserts, *transPtr);
+                    std::vector<std::string> orderIds;
+                    orderIds.reserve(inserts.size());
+                    for (const auto& order : inserts) {
+                        orderIds.push_back(order.getOrderId());
+                    }
+                    *committed = mapper_.findByOrderIds(orderIds, *transPtr);
                 }
-            }
-        });
+                if (!updates.empty()) {
+                    mapper_.updateBatch(updates, *transPtr);
+                    committed->insert(committed->end(), updates.begin(), updates.end());
+                }
+            },
+            [this, committed] {
+                for (const auto& order : *committed) {
+                    openOrders_.upsert(order);
+                }
+            });
     }
 
 } // namespace repositories
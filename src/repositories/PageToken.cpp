@@ -0,0 +1,103 @@
+#include "repositories/PageToken.h"
+#include <array>
+#include <stdexcept>
+
+namespace repositories {
+
+    namespace {
+
+        constexpr uint8_t TOKEN_VERSION = 1;
+        constexpr size_t TOKEN_BYTES = 1 + 8 + 8;
+        constexpr size_t TOKEN_LENGTH = (TOKEN_BYTES * 4 + 2) / 3;   // 패딩 없는 base64 길이
+
+        constexpr char ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+        int decodeChar(char c) {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '-') return 62;
+            if (c == '_') return 63;
+            return -1;
+        }
+
+        void put64(uint8_t* out, uint64_t value) {
+            for (int i = 7; i >= 0; --i) {
+                out[i] = static_cast<uint8_t>(value);
+                value >>= 8;
+            }
+        }
+
+        uint64_t get64(const uint8_t* in) {
+            uint64_t value = 0;
+            for (int i = 0; i < 8; ++i) {
+                value = (value << 8) | in[i];
+            }
+            return value;
+        }
+
+    } // namespace
+
+    std::string PageToken::encode(const PageCursor& cursor) {
+        std::array<uint8_t, TOKEN_BYTES> bytes{};
+        bytes[0] = TOKEN_VERSION;
+        put64(bytes.data() + 1, static_cast<uint64_t>(cursor.timestampMicros));
+        put64(bytes.data() + 9, static_cast<uint64_t>(cursor.id));
+
+        std::string token;
+        token.reserve(TOKEN_LENGTH);
+        uint32_t buffer = 0;
+        int bits = 0;
+        for (uint8_t byte : bytes) {
+            buffer = (buffer << 8) | byte;
+            bits += 8;
+            while (bits >= 6) {
+                bits -= 6;
+                token += ALPHABET[(buffer >> bits) & 0x3F];
+            }
+        }
+        if (bits > 0) {
+            token += ALPHABET[(buffer << (6 - bits)) & 0x3F];
+        }
+        return token;
+    }
+
+    std::optional<PageCursor> PageToken::decode(std::string_view token) {
+        if (token.empty()) {
+            return std::nullopt;
+        }
+        if (token.size() != TOKEN_LENGTH) {
+            throw std::invalid_argument("Malformed page token");
+        }
+
+        std::array<uint8_t, TOKEN_BYTES> bytes{};
+        size_t length = 0;
+        uint32_t buffer = 0;
+        int bits = 0;
+        for (char c : token) {
+            const int value = decodeChar(c);
+            if (value < 0) {
+                throw std::invalid_argument("Malformed page token");
+            }
+            buffer = (buffer << 6) | static_cast<uint32_t>(value);
+            bits += 6;
+            if (bits >= 8) {
+                bits -= 8;
+                bytes[length++] = static_cast<uint8_t>(buffer >> bits);
+            }
+        }
+        // 남은 비트는 인코딩 시 0으로 채운 패딩이어야 함
+        if ((buffer & ((1u << bits) - 1)) != 0 || bytes[0] != TOKEN_VERSION) {
+            throw std::invalid_argument("Malformed page token");
+        }
+
+        PageCursor cursor;
+        cursor.timestampMicros = static_cast<int64_t>(get64(bytes.data() + 1));
+        cursor.id = static_cast<int64_t>(get64(bytes.data() + 9));
+        if (cursor.id <= 0) {
+            throw std::invalid_argument("Malformed page token");
+        }
+        return cursor;
+    }
+
+} // namespace repositories
@@ -0,0 +1,213 @@
+#include "repositories/TradeAggregateIndex.h"
+#include <algorithm>
+#include <mutex>
+
+namespace repositories {
+
+    namespace {
+
+        int64_t floorBucket(int64_t timestampMicros) {
+            int64_t bucket = timestampMicros / TradeAggregateIndex::BUCKET_MICROS;
+            if (timestampMicros % TradeAggregateIndex::BUCKET_MICROS < 0) {
+                --bucket;
+            }
+            return bucket;
+        }
+
+        int64_t ceilToBucket(int64_t timestampMicros) {
+            const int64_t start = TradeAggregateIndex::bucketStart(timestampMicros);
+            return start == timestampMicros ? start : start + TradeAggregateIndex::BUCKET_MICROS;
+        }
+
+        size_t lowBit(size_t i) {
+            return i & (~i + 1);
+        }
+
+    } // namespace
+
+    int64_t TradeAggregateIndex::bucketStart(int64_t timestampMicros) {
+        return floorBucket(timestampMicros) * BUCKET_MICROS;
+    }
+
+    TradeAggregateIndex::WriteGuard::WriteGuard(TradeAggregateIndex& index, std::vector<models::SymbolId> symbolIds)
+        : index_(index), symbolIds_(std::move(symbolIds)) {
+        std::sort(symbolIds_.begin(), symbolIds_.end());
+        symbolIds_.erase(std::unique(symbolIds_.begin(), symbolIds_.end()), symbolIds_.end());
+        index_.beginWrite(symbolIds_);
+    }
+
+    TradeAggregateIndex::WriteGuard::~WriteGuard() {
+        index_.endWrite(symbolIds_);
+    }
+
+    TradeAggregateIndex::LoadToken TradeAggregateIndex::beginLoad(models::SymbolId symbolId) {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto it = versions_.find(symbolId);
+        return LoadToken{epoch_, it == versions_.end() ? 0 : it->second};
+    }
+
+    bool TradeAggregateIndex::finishLoad(
+        models::SymbolId symbolId,
+        const LoadToken& token,
+        int64_t fromMicros,
+        const std::vector<std::pair<int64_t, models::TradeAggregate>>& buckets
+    ) {
+        Series series;
+        series.fromBucket = floorBucket(fromMicros);
+        for (const auto& [start, sums] : buckets) {
+            const int64_t index = floorBucket(start) - series.fromBucket;
+            if (index < 0 || index >= static_cast<int64_t>(SPAN_BUCKETS)) {
+                continue;
+            }
+            if (static_cast<size_t>(index) >= series.buckets.size()) {
+                series.buckets.resize(static_cast<size_t>(index) + 1);
+            }
+            series.buckets[static_cast<size_t>(index)] += sums;
+        }
+        grow(series, series.buckets.size());
+
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        const auto version = versions_.find(symbolId);
+        if (token.epoch != epoch_ || (version == versions_.end() ? 0 : version->second) != token.version) {
+            return false;   // 로드 중 쓰기가 겹침: 스냅샷에 포함됐는지 알 수 없음
+        }
+        if (const auto writers = writers_.find(symbolId); writers != writers_.end() && writers->second > 0) {
+            return false;   // 로드 전에 시작된 쓰기가 아직 반영되지 않음
+        }
+        series_[symbolId] = std::move(series);
+        return true;
+    }
+
+    std::optional<models::TimeRange> TradeAggregateIndex::coverage(models::SymbolId symbolId) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto it = series_.find(symbolId);
+        if (it == series_.end()) {
+            return std::nullopt;
+        }
+        const int64_t from = it->second.fromBucket * BUCKET_MICROS;
+        return models::TimeRange{from, from + SPAN_MICROS};
+    }
+
+    std::optional<TradeAggregateIndex::Lookup> TradeAggregateIndex::lookup(
+        models::SymbolId symbolId,
+        int64_t fromMicros,
+        int64_t toMicros
+    ) const {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        const auto it = series_.find(symbolId);
+        if (it == series_.end()) {
+            return std::nullopt;
+        }
+        const auto& series = it->second;
+
+        Lookup result{{}, {models::TimeRange{fromMicros, toMicros}, models::TimeRange{}}};
+        if (fromMicros >= toMicros) {
+            result.residual[0] = models::TimeRange{};
+            return result;
+        }
+
+        const int64_t coverFrom = series.fromBucket * BUCKET_MICROS;
+        const int64_t alignedFrom = std::max(coverFrom, ceilToBucket(fromMicros));
+        const int64_t alignedTo = std::min(coverFrom + SPAN_MICROS, bucketStart(toMicros));
+        if (alignedFrom >= alignedTo) {
+            return result;  // 온전한 버킷이 없음: 전부 원본 행으로
+        }
+
+        const auto first = static_cast<size_t>(alignedFrom / BUCKET_MICROS - series.fromBucket);
+        const auto last = static_cast<size_t>(alignedTo / BUCKET_MICROS - series.fromBucket);
+        result.indexed = prefix(series, last);
+        result.indexed -= prefix(series, first);
+        if (result.indexed.count == 0) {
+            result.indexed = models::TradeAggregate{};     // 뺄셈 반올림 오차 제거
+        }
+        result.residual = {models::TimeRange{fromMicros, alignedFrom}, models::TimeRange{alignedTo, toMicros}};
+        return result;
+    }
+
+    void TradeAggregateIndex::add(const models::Trade& trade) {
+        add(trade.getSymbolId(), trade.getTimestamp().microSecondsSinceEpoch(), trade.getQuantity(), trade.getPrice());
+    }
+
+    void TradeAggregateIndex::add(models::SymbolId symbolId, int64_t timestampMicros, double quantity, double price) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        touchLocked(symbolId);
+        const auto it = series_.find(symbolId);
+        if (it == series_.end()) {
+            return;
+        }
+        auto& series = it->second;
+        const int64_t index = floorBucket(timestampMicros) - series.fromBucket;
+        if (index < 0 || index >= static_cast<int64_t>(SPAN_BUCKETS)) {
+            return;
+        }
+        addAt(series, static_cast<size_t>(index), models::TradeAggregate{quantity, quantity * price, 1});
+    }
+
+    void TradeAggregateIndex::invalidate(models::SymbolId symbolId) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        touchLocked(symbolId);
+        series_.erase(symbolId);
+    }
+
+    void TradeAggregateIndex::invalidateAll() {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        ++epoch_;
+        series_.clear();
+    }
+
+    void TradeAggregateIndex::touchLocked(models::SymbolId symbolId) {
+        ++versions_[symbolId];
+    }
+
+    void TradeAggregateIndex::beginWrite(const std::vector<models::SymbolId>& symbolIds) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (auto symbolId : symbolIds) {
+            touchLocked(symbolId);
+            ++writers_[symbolId];
+        }
+    }
+
+    void TradeAggregateIndex::endWrite(const std::vector<models::SymbolId>& symbolIds) {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (auto symbolId : symbolIds) {
+            // 구간 안에서 시작한 로드도 거부되도록 닫을 때도 버전 증가
+            touchLocked(symbolId);
+            if (--writers_[symbolId] == 0) {
+                writers_.erase(symbolId);
+            }
+        }
+    }
+
+    void TradeAggregateIndex::grow(Series& series, size_t size) {
+        series.buckets.resize(size);
+        // O(n) 재구성: 각 노드를 자신을 포함하는 다음 노드로 누적
+        series.tree.assign(size + 1, models::TradeAggregate{});
+        for (size_t i = 1; i <= size; ++i) {
+            series.tree[i] += series.buckets[i - 1];
+            const size_t parent = i + lowBit(i);
+            if (parent <= size) {
+                series.tree[parent] += series.tree[i];
+            }
+        }
+    }
+
+    void TradeAggregateIndex::addAt(Series& series, size_t index, const models::TradeAggregate& delta) {
+        if (index >= series.buckets.size()) {
+            // 새 체결은 주로 끝에 붙으므로 두 배씩 늘림 (재구성 비용 분할 상환)
+            grow(series, std::min(SPAN_BUCKETS, std::max(index + 1, series.buckets.size() * 2)));
+        }
+        series.buckets[index] += delta;
+        for (size_t i = index + 1; i < series.tree.size(); i += lowBit(i)) {
+            series.tree[i] += delta;
+        }
+    }
+
+    models::TradeAggregate TradeAggregateIndex::prefix(const Series& series, size_t count) {
+        models::TradeAggregate sum;
+        for (size_t i = std::min(count, series.buckets.size()); i > 0; i -= lowBit(i)) {
+            sum += series.tree[i];
+        }
+        return sum;
+    }
+
+} // namespace repositories
@@ -1,6 +1,9 @@
 #include "repositories/TradeRepository.h"
+#include "utils/Logger.h"
 #include <stdexcept>
+#include <chrono>
 #include <cmath>
+#include <unordered_set>
 
 namespace repositories {
 
@@ -10,25 +13,36 @@ namespace repositories {
     }
 
     models::Trade TradeRepository::save(const models::Trade& trade) {
+        TradeAggregateIndex::WriteGuard write(aggregates_, {trade.getSymbolId()});
         if (trade.getId() == 0) {
-            return mapper_.insert(trade);
+            auto saved = mapper_.insert(trade);
+            aggregates_.add(saved);
+            return saved;
         } else {
             mapper_.update(trade);
+            // 이전 수량/가격/시각을 모르므로 다음 집계 조회에서 다시 로드
+            aggregates_.invalidate(trade.getSymbolId());
             return trade;
         }
     }
 
     std::optional<models::Trade> TradeRepository::findById(int64_t id) const {
         try {
-            return std::make_optional(mapper_.findById(id));
+            return byId_.load(id);
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
     }
 
+    std::vector<models::Trade> TradeRepository::findByIds(std::span<const int64_t> ids) const {
+        return findByIdsVia(mapper_, ids);
+    }
+
     bool TradeRepository::deleteById(int64_t id) {
         try {
             mapper_.deleteById(id);
+            // 삭제된 체결의 심볼을 모르므로 전체 무효화 (체결 삭제는 드묾)
+            aggregates_.invalidateAll();
             return true;
         } catch (const std::runtime_error&) {
             return false;
@@ -37,7 +51,7 @@ namespace repositories {
 
     BaseRepository<models::Trade>::PaginationResult
     TradeRepository::findAll(size_t page, size_t pageSize) const {
-        auto totalCount = mapper_.count();
+        auto totalCount = mapper_.approximateCount();
         auto items = mapper_.findWithPaging(pageSize, page * pageSize);
 
         PaginationResult result;
@@ -50,6 +64,59 @@ namespace repositories {
         return result;
     }
 
+    BaseRepository<models::Trade>::KeysetPage
+    TradeRepository::findPage(const std::string& continuationToken, size_t pageSize) const {
+        return drogon::sync_wait(findPageAsync(continuationToken, pageSize));
+    }
+
+    drogon::Task<models::Trade> TradeRepository::saveAsync(models::Trade trade) {
+        const bool inserting = trade.getId() == 0;
+        TradeAggregateIndex::WriteGuard write(aggregates_, {trade.getSymbolId()});
+        auto saved = co_await saveVia(mapper_, std::move(trade));
+        if (inserting) {
+            aggregates_.add(saved);
+        } else {
+            aggregates_.invalidate(saved.getSymbolId());
+        }
+        co_return saved;
+    }
+
+    drogon::Task<models::Trade> TradeRepository::saveGrouped(models::Trade trade) {
+        const bool inserting = trade.getId() == 0;
+        // 반영 훅이 끝나거나 op가 실패해 훅이 버려질 때 쓰기 구간을 닫음
+        auto write = std::make_shared<TradeAggregateIndex::WriteGuard>(
+            aggregates_, std::vector<models::SymbolId>{trade.getSymbolId()});
+        return saveGroupedVia(mapper_, std::move(trade), [this, inserting, write](const models::Trade& saved) {
+            if (inserting) {
+                aggregates_.add(saved);
+            } else {
+                aggregates_.invalidate(saved.getSymbolId());
+            }
+        });
+    }
+
+    drogon::Task<std::optional<models::Trade>> TradeRepository::findByIdAsync(int64_t id) const {
+        return findByIdVia(mapper_, id);
+    }
+
+    drogon::Task<bool> TradeRepository::deleteByIdAsync(int64_t id) {
+        const bool deleted = co_await deleteByIdVia(mapper_, id);
+        if (deleted) {
+            aggregates_.invalidateAll();
+        }
+        co_return deleted;
+    }
+
+    drogon::Task<BaseRepository<models::Trade>::PaginationResult>
+    TradeRepository::findAllAsync(size_t page, size_t pageSize) const {
+        return findAllVia(mapper_, page, pageSize);
+    }
+
+    drogon::Task<BaseRepository<models::Trade>::KeysetPage>
+    TradeRepository::findPageAsync(std::string continuationToken, size_t pageSize) const {
+        return findPageVia(mapper_, std::move(continuationToken), pageSize);
+    }
+
     std::vector<models::Trade> TradeRepository::findByTimeRange(
         const trantor::Date& start,
         const trantor::Date& end
@@ -64,24 +131,14 @@ namespace repositories {
         const std::string& symbol,
         size_t limit
     ) const {
-        // findBySymbolWithLimit 가 없으므로 limit 적용하려면 결과를 잘라야 함.
-        // 여기서는 일단 TradeMapper의 findBySymbol 사용 후 상위 limit개만 반환.
-        auto trades = mapper_.findBySymbol(symbol);
-        if (trades.size() > limit) {
-            trades.resize(limit);
-        }
-        return trades;
+        return mapper_.findBySymbol(symbol, limit);
     }
 
     std::vector<models::Trade> TradeRepository::findByOrderId(
         int64_t orderId,
         size_t limit
     ) const {
-        auto trades = mapper_.findByOrderId(orderId);
-        if (trades.size() > limit) {
-            trades.resize(limit);
-        }
-        return trades;
+        return mapper_.findByOrderId(orderId, limit);
     }
 
     std::vector<models::Trade> TradeRepository::findBySymbolAndTimeRange(
@@ -92,12 +149,66 @@ namespace repositories {
         return mapper_.findByTimeRange(symbol, start, end);
     }
 
+    size_t TradeRepository::forEachInRange(
+        const std::string& symbol,
+        const trantor::Date& start,
+        const trantor::Date& end,
+        const RowVisitor& visitor,
+        size_t fetchSize
+    ) const {
+        return mapper_.forEachInRange(symbol, start, end, visitor, fetchSize);
+    }
+
+    models::TradeAggregate TradeRepository::getSymbolAggregate(
+        const std::string& symbol,
+        const trantor::Date& start,
+        const trantor::Date& end
+    ) const {
+        const models::TimeRange range{start.microSecondsSinceEpoch(), end.microSecondsSinceEpoch()};
+        if (range.empty()) {
+            return models::TradeAggregate{};
+        }
+        // 조회 입력으로 레지스트리를 늘리지 않음 (intern 금지)
+        // 등록되지 않은 심볼은 인덱스 없이 DB에서 바로 집계: 재시작 전에 저장된 체결이 있을 수 있음
+        const auto found = models::SymbolRegistry::getInstance().find(symbol);
+        if (!found) {
+            return mapper_.aggregateRanges(symbol, range, models::TimeRange{});
+        }
+        const auto symbolId = *found;
+
+        // 인덱스 구간 끝이 가까워지면 현재 시각 기준으로 다시 로드
+        const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+        constexpr int64_t refreshMargin =
+            static_cast<int64_t>(common::TradeAggregateConfig::REFRESH_MARGIN_HOURS) * 60 * 60 * 1000000;
+        const auto coverage = aggregates_.coverage(symbolId);
+        if (!coverage || coverage->toMicros <= now + refreshMargin) {
+            if (coverage) {
+                aggregates_.invalidate(symbolId);
+            }
+            if (!loadAggregates(symbolId, symbol)) {
+                return mapper_.aggregateRanges(symbol, range, models::TimeRange{});
+            }
+        }
+
+        const auto lookup = aggregates_.lookup(symbolId, range.fromMicros, range.toMicros);
+        if (!lookup) {
+            // 로드 직후 쓰기로 무효화됨
+            return mapper_.aggregateRanges(symbol, range, models::TimeRange{});
+        }
+        auto aggregate = lookup->indexed;
+        if (!lookup->residual[0].empty() || !lookup->residual[1].empty()) {
+            aggregate += mapper_.aggregateRanges(symbol, lookup->residual[0], lookup->residual[1]);
+        }
+        return aggregate;
+    }
+
     double TradeRepository::getSymbolTotalVolume(
         const std::string& symbol,
         const trantor::Date& start,
         const trantor::Date& end
     ) const {
-        return mapper_.getSymbolTotalVolume(symbol, start, end);
+        return getSymbolAggregate(symbol, start, end).volume;
     }
 
     double TradeRepository::getSymbolAveragePrice(
@@ -105,17 +216,62 @@ namespace repositories {
         const trantor::Date& start,
         const trantor::Date& end
     ) const {
-        return mapper_.getSymbolAveragePrice(symbol, start, end);
+        return getSymbolAggregate(symbol, start, end).vwap();
+    }
+
+    bool TradeRepository::loadAggregates(models::SymbolId symbolId, const std::string& symbol) const {
+        for (size_t attempt = 1; attempt <= common::TradeAggregateConfig::MAX_LOAD_ATTEMPTS; ++attempt) {
+            const int64_t now = std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::system_clock::now().time_since_epoch()).count();
+            const int64_t from = TradeAggregateIndex::bucketStart(now - TradeAggregateIndex::HISTORY_MICROS);
+
+            const auto token = aggregates_.beginLoad(symbolId);
+            const auto buckets = mapper_.aggregateBuckets(
+                symbol, from, from + TradeAggregateIndex::SPAN_MICROS, TradeAggregateIndex::BUCKET_MICROS);
+            if (aggregates_.finishLoad(symbolId, token, from, buckets)) {
+                return true;
+            }
+        }
+        TRADING_LOG_WARN("Trade aggregate index for {} not loaded: concurrent writes during {} attempts",
+                         symbol, common::TradeAggregateConfig::MAX_LOAD_ATTEMPTS);
+        return false;
     }
 
     void TradeRepository::saveBatch(const std::vector<models::Trade>& tradeList) {
-        this->executeInTransaction([this, &tradeList](const TransactionPtr& transPtr) {
-            for (const auto& trade : tradeList) {
-                if (trade.getId() == 0) {
-                    mapper_.insert(trade, *transPtr);
-                } else {
-                    mapper_.update(trade, *transPtr);
-                }
+        // 신규/기존 행을 나눠 각각 다건 문장으로 처리 (행마다 왕복하지 않음)
+        std::vector<models::Trade> inserts;
+        std::vector<models::Trade> updates;
+        for (const auto& trade : tradeList) {
+            (trade.getId() == 0 ? inserts : updates).push_back(trade);
+        }
+
+        // 집계 인덱스는 COMMIT이 성공한 뒤에만 반영 (수정된 체결의 심볼은 다시 로드)
+        std::vector<models::Trade> inserted = inserts;
+        std::unordered_set<models::SymbolId> updatedSymbols;
+        for (const auto& trade : updates) {
+            updatedSymbols.insert(trade.getSymbolId());
+        }
+        // 쓰기 구간은 반영이 끝나거나 트랜잭션이 실패해 콜백이 버려질 때 닫힘
+        std::vector<models::SymbolId> written;
+        written.reserve(tradeList.size());
+        for (const auto& trade : tradeList) {
+            written.push_back(trade.getSymbolId());
+        }
+        auto write = std::make_shared<TradeAggregateIndex::WriteGuard>(aggregates_, std::move(written));
+
+        this->executeInTransaction([this, inserts = std::move(inserts), updates = std::move(updates)](const TransactionPtr& transPtr) {
+            if (!inserts.empty()) {
+                mapper_.insertBatch(inserts, *transPtr);
+            }
+            if (!updates.empty()) {
+                mapper_.updateBatch(updates, *transPtr);
+            }
+        }, [this, inserted = std::move(inserted), updatedSymbols = std::move(updatedSymbols), write] {
+            for (const auto& trade : inserted) {
+                aggregates_.add(trade);
+            }
+            for (auto symbolId : updatedSymbols) {
+                aggregates_.invalidate(symbolId);
             }
         });
     }
@@ -20,12 +20,16 @@ namespace repositories {
 
     std::optional<models::TradingSignal> TradingSignalRepository::findById(int64_t id) const {
         try {
-            return std::make_optional(mapper_.findById(id));
+            return byId_.load(id);
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
     }
 
+    std::vector<models::TradingSignal> TradingSignalRepository::findByIds(std::span<const int64_t> ids) const {
+        return findByIdsVia(mapper_, ids);
+    }
+
     bool TradingSignalRepository::deleteById(int64_t id) {
         try {
             mapper_.deleteById(id);
@@ -37,7 +41,7 @@ namespace repositories {
 
     BaseRepository<models::TradingSignal>::PaginationResult
     TradingSignalRepository::findAll(size_t page, size_t pageSize) const {
-        auto totalCount = mapper_.count();
+        auto totalCount = mapper_.approximateCount();
         auto items = mapper_.findWithPaging(pageSize, page * pageSize);
 
         PaginationResult result;
@@ -50,6 +54,37 @@ namespace repositories {
         return result;
     }
 
+    BaseRepository<models::TradingSignal>::KeysetPage
+    TradingSignalRepository::findPage(const std::string& continuationToken, size_t pageSize) const {
+        return drogon::sync_wait(findPageAsync(continuationToken, pageSize));
+    }
+
+    drogon::Task<models::TradingSignal> TradingSignalRepository::saveAsync(models::TradingSignal signal) {
+        return saveVia(mapper_, std::move(signal));
+    }
+
+    drogon::Task<models::TradingSignal> TradingSignalRepository::saveGrouped(models::TradingSignal signal) {
+        return saveGroupedVia(mapper_, std::move(signal));
+    }
+
+    drogon::Task<std::optional<models::TradingSignal>> TradingSignalRepository::findByIdAsync(int64_t id) const {
+        return findByIdVia(mapper_, id);
+    }
+
+    drogon::Task<bool> TradingSignalRepository::deleteByIdAsync(int64_t id) {
+        return deleteByIdVia(mapper_, id);
+    }
+
+    drogon::Task<BaseRepository<models::TradingSignal>::PaginationResult>
+    TradingSignalRepository::findAllAsync(size_t page, size_t pageSize) const {
+        return findAllVia(mapper_, page, pageSize);
+    }
+
+    drogon::Task<BaseRepository<models::TradingSignal>::KeysetPage>
+    TradingSignalRepository::findPageAsync(std::string continuationToken, size_t pageSize) const {
+        return findPageVia(mapper_, std::move(continuationToken), pageSize);
+    }
+
     std::vector<models::TradingSignal> TradingSignalRepository::findByTimeRange(
         const trantor::Date& start,
         const trantor::Date& end
@@ -63,12 +98,7 @@ namespace repositories {
         const std::string& symbol,
         size_t limit
     ) const {
-        // findBySymbol 메서드 호출 후 limit 적용
-        auto signals = mapper_.findBySymbol(symbol);
-        if (signals.size() > limit) {
-            signals.resize(limit);
-        }
-        return signals;
+        return mapper_.findBySymbol(symbol, limit);
     }
 
     std::vector<models::TradingSignal> TradingSignalRepository::findByStrategyName(
@@ -94,14 +124,30 @@ namespace repositories {
         return mapper_.findByTimeRange(symbol, start, end);
     }
 
+    size_t TradingSignalRepository::forEachInRange(
+        const std::string& symbol,
+        const trantor::Date& start,
+        const trantor::Date& end,
+        const RowVisitor& visitor,
+        size_t fetchSize
+    ) const {
+        return mapper_.forEachInRange(symbol, start, end, visitor, fetchSize);
+    }
+
     void TradingSignalRepository::saveBatch(const std::vector<models::TradingSignal>& signalList) {
-        this->executeInTransaction([this, &signalList](const TransactionPtr& transPtr) {
-            for (const auto& signal : signalList) {
-                if (signal.getId() == 0) {
-                    mapper_.insert(signal, *transPtr);
-                } else {
-                    mapper_.update(signal, *transPtr);
-                }
+        // 신규/기존 행을 나눠 각각 다건 문장으로 처리 (행마다 왕복하지 않음)
+        std::vector<models::TradingSignal> inserts;
+        std::vector<models::TradingSignal> updates;
+        for (const auto& signal : signalList) {
+            (signal.getId() == 0 ? inserts : updates).push_back(signal);
+        }
+
+        this->executeInTransaction([this, inserts = std::move(inserts), updates = std::move(updates)](const TransactionPtr& transPtr) {
+            if (!inserts.empty()) {
+                mapper_.insertBatch(inserts, *transPtr);
+            }
+            if (!updates.empty()) {
+                mapper_.updateBatch(updates, *transPtr);
             }
         });
     }
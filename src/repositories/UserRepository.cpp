@@ -20,12 +20,16 @@ namespace repositories {
 
     std::optional<models::User> UserRepository::findById(int64_t id) const {
         try {
-            return std::make_optional(mapper_.findById(id));
+            return byId_.load(id);
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
     }
 
+    std::vector<models::User> UserRepository::findByIds(std::span<const int64_t> ids) const {
+        return findByIdsVia(mapper_, ids);
+    }
+
     bool UserRepository::deleteById(int64_t id) {
         try {
             mapper_.deleteById(id);
@@ -37,7 +41,7 @@ namespace repositories {
 
     BaseRepository<models::User>::PaginationResult 
     UserRepository::findAll(size_t page, size_t pageSize) const {
-        auto totalCount = mapper_.count();
+        auto totalCount = mapper_.approximateCount();
         auto items = mapper_.findWithPaging(pageSize, page * pageSize);
 
         PaginationResult result;
@@ -50,6 +54,33 @@ namespace repositories {
         return result;
     }
 
+    BaseRepository<models::User>::KeysetPage
+    UserRepository::findPage(const std::string& continuationToken, size_t pageSize) const {
+        return drogon::sync_wait(findPageAsync(continuationToken, pageSize));
+    }
+
+    drogon::Task<models::User> UserRepository::saveAsync(models::User user) {
+        return saveVia(mapper_, std::move(user));
+    }
+
+    drogon::Task<std::optional<models::User>> UserRepository::findByIdAsync(int64_t id) const {
+        return findByIdVia(mapper_, id);
+    }
+
+    drogon::Task<bool> UserRepository::deleteByIdAsync(int64_t id) {
+        return deleteByIdVia(mapper_, id);
+    }
+
+    drogon::Task<BaseRepository<models::User>::PaginationResult>
+    UserRepository::findAllAsync(size_t page, size_t pageSize) const {
+        return findAllVia(mapper_, page, pageSize);
+    }
+
+    drogon::Task<BaseRepository<models::User>::KeysetPage>
+    UserRepository::findPageAsync(std::string continuationToken, size_t pageSize) const {
+        return findPageVia(mapper_, std::move(continuationToken), pageSize);
+    }
+
     std::vector<models::User> UserRepository::findByTimeRange(
         const trantor::Date& start,
         const trantor::Date& end
@@ -86,13 +117,19 @@ namespace repositories {
     }
 
     void UserRepository::saveBatch(const std::vector<models::User>& userList) {
-        this->executeInTransaction([this, &userList](const TransactionPtr& transPtr) {
-            for (const auto& user : userList) {
-                if (user.getId() == 0) {
-                    mapper_.insert(user, *transPtr);
-                } else {
-                    mapper_.update(user, *transPtr);
-                }
+        // 신규/기존 행을 나눠 각각 다건 문장으로 처리 (행마다 왕복하지 않음)
+        std::vector<models::User> inserts;
+        std::vector<models::User> updates;
+        for (const auto& user : userList) {
+            (user.getId() == 0 ? inserts : updates).push_back(user);
+        }
+
+        this->executeInTransaction([this, inserts = std::move(inserts), updates = std::move(updates)](const TransactionPtr& transPtr) {
+            if (!inserts.empty()) {
+                mapper_.insertBatch(inserts, *transPtr);
+            }
+            if (!updates.empty()) {
+                mapper_.updateBatch(updates, *transPtr);
             }
         });
     }
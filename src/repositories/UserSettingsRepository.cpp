@@ -1,8 +1,10 @@
 #include "repositories/UserSettingsRepository.h"
 #include "secure/EncryptionManager.h"
 #include "secure/SensitiveDataHandler.h"
+#include "models/TradingParamsStore.h"
 #include <stdexcept>
 #include <cmath>
+#include <optional>
 
 namespace repositories {
 
@@ -12,86 +14,134 @@ namespace repositories {
     }
 
     models::UserSettings UserSettingsRepository::save(const models::UserSettings& settings) {
-        // 만약 settings에 credentials 필드(Json) 있고, apiKey/secret이 들어있다면 암호화
-        Json::Value creds = settings.getApiCredentials(); // 가정: UserSettings 모델에 getCredentials() 존재
-        if (creds.isMember("apiKey") || creds.isMember("secret")) {
-            auto& enc = EncryptionManager::getInstance();
-            if (creds.isMember("apiKey")) {
-                std::string plainKey = creds["apiKey"].asString();
-                creds["apiKey"] = enc.encrypt(plainKey);
-            }
-            if (creds.isMember("secret")) {
-                std::string plainSecret = creds["secret"].asString();
-                creds["secret"] = enc.encrypt(plainSecret);
-            }
-            // 암호화된 credentials를 다시 settings에 반영
-            models::UserSettings modified = settings;
-            modified.setApiCredentials(creds);
-            if (modified.getId() == 0) {
-                return mapper_.insert(modified);
-            } else {
-                mapper_.update(modified);
-                return modified;
-            }
+        // credentials에 apiKey/secret이 있으면 암호화한 사본을 저장
+        models::UserSettings modified = settings;
+        encryptCredentials(modified);
+        if (modified.getId() == 0) {
+            auto saved = mapper_.insert(modified);
+            models::TradingParamsStore::getInstance().publish(saved);
+            cache_.invalidateUser(saved.getUserId());
+            return saved;
         } else {
+            mapper_.update(modified);
+            models::TradingParamsStore::getInstance().publish(modified);
+            cache_.invalidate(modified.getId());
+            cache_.invalidateUser(modified.getUserId());
+            return modified;
+        }
+    }
+
+    drogon::Task<models::UserSettings> UserSettingsRepository::saveAsync(models::UserSettings settings) {
+        encryptCredentials(settings);
+        const bool inserting = settings.getId() == 0;
+        auto saved = co_await saveVia(mapper_, std::move(settings));
+        models::TradingParamsStore::getInstance().publish(saved);
+        if (!inserting) {
+            cache_.invalidate(saved.getId());
+        }
+        cache_.invalidateUser(saved.getUserId());
+        co_return saved;
+    }
+
+    void UserSettingsRepository::encryptCredentials(models::UserSettings& settings) {
+        Json::Value creds = settings.getApiCredentials();
+        if (!creds.isMember("apiKey") && !creds.isMember("secret")) {
             // 민감정보 없으면 그대로
-            if (settings.getId() == 0) {
-                return mapper_.insert(settings);
-            } else {
-                mapper_.update(settings);
-                return settings;
-            }
+            return;
         }
+        auto& enc = EncryptionManager::getInstance();
+        if (creds.isMember("apiKey")) {
+            creds["apiKey"] = enc.encrypt(creds["apiKey"].asString());
+        }
+        if (creds.isMember("secret")) {
+            creds["secret"] = enc.encrypt(creds["secret"].asString());
+        }
+        settings.setApiCredentials(creds);
     }
 
     std::optional<models::UserSettings> UserSettingsRepository::findById(int64_t id) const {
+        if (auto cached = cache_.find(id, EncryptionManager::getInstance().getKeyGeneration())) {
+            return cached;
+        }
+        const uint64_t epoch = cache_.epoch();
         try {
-            auto result = std::make_optional(mapper_.findById(id));
+            auto result = mapper_.findById(id);
+            models::TradingParamsStore::getInstance().publish(result);
             // 조회 후 credentials 복호화
-            if (result && result->getApiCredentials().isObject()) {
-                auto creds = result->getApiCredentials();
-                auto& enc = EncryptionManager::getInstance();
-                if (creds.isMember("apiKey")) {
-                    creds["apiKey"] = enc.decrypt(creds["apiKey"].asString());
-                }
-                if (creds.isMember("secret")) {
-                    creds["secret"] = enc.decrypt(creds["secret"].asString());
-                }
-                models::UserSettings modified = *result;
-                modified.setApiCredentials(creds);
-                return modified;
-            }
+            decryptCredentials(result, epoch);
             return result;
         } catch (const std::runtime_error&) {
             return std::nullopt;
         }
     }
 
+    drogon::Task<std::optional<models::UserSettings>> UserSettingsRepository::findByIdAsync(int64_t id) const {
+        if (auto cached = cache_.find(id, EncryptionManager::getInstance().getKeyGeneration())) {
+            co_return cached;
+        }
+        const uint64_t epoch = cache_.epoch();
+        auto result = co_await findByIdVia(mapper_, id);
+        if (result) {
+            models::TradingParamsStore::getInstance().publish(*result);
+            decryptCredentials(*result, epoch);
+        }
+        co_return result;
+    }
+
+    void UserSettingsRepository::decryptCredentials(models::UserSettings& settings, uint64_t epoch) const {
+        auto& enc = EncryptionManager::getInstance();
+        const uint64_t generation = enc.getKeyGeneration();
+        if (cache_.decryptFromCache(settings, generation)) {
+            return;
+        }
+
+        const models::UserSettings encrypted = settings;
+        std::optional<std::string> apiKey;
+        std::optional<std::string> secret;
+        if (settings.getApiCredentials().isObject()) {
+            auto creds = settings.getApiCredentials();
+            if (creds.isMember("apiKey")) {
+                apiKey = enc.decrypt(creds["apiKey"].asString());
+                creds["apiKey"] = *apiKey;
+            }
+            if (creds.isMember("secret")) {
+                secret = enc.decrypt(creds["secret"].asString());
+                creds["secret"] = *secret;
+            }
+            settings.setApiCredentials(creds);
+        }
+        cache_.put(encrypted, apiKey, secret, generation, epoch);
+    }
+
     bool UserSettingsRepository::deleteById(int64_t id) {
         try {
             mapper_.deleteById(id);
+            models::TradingParamsStore::getInstance().remove(id);
+            cache_.invalidate(id);
             return true;
         } catch (const std::runtime_error&) {
             return false;
         }
     }
 
+    drogon::Task<bool> UserSettingsRepository::deleteByIdAsync(int64_t id) {
+        const bool deleted = co_await deleteByIdVia(mapper_, id);
+        if (deleted) {
+            models::TradingParamsStore::getInstance().remove(id);
+            cache_.invalidate(id);
+        }
+        co_return deleted;
+    }
+
     BaseRepository<models::UserSettings>::PaginationResult 
     UserSettingsRepository::findAll(size_t page, size_t pageSize) const {
-        auto totalCount = mapper_.count();
+        const uint64_t epoch = cache_.epoch();
+        auto totalCount = mapper_.approximateCount();
         auto items = mapper_.findWithPaging(pageSize, page * pageSize);
 
         // items 내 각 UserSettings에 대해 credentials 복호화
-        auto& enc = EncryptionManager::getInstance();
         for (auto &st : items) {
-            auto creds = st.getApiCredentials();
-            if (creds.isMember("apiKey")) {
-                creds["apiKey"] = enc.decrypt(creds["apiKey"].asString());
-            }
-            if (creds.isMember("secret")) {
-                creds["secret"] = enc.decrypt(creds["secret"].asString());
-            }
-            st.setApiCredentials(creds);
+            decryptCredentials(st, epoch);
         }
 
         PaginationResult result;
@@ -104,6 +154,31 @@ namespace repositories {
         return result;
     }
 
+    drogon::Task<BaseRepository<models::UserSettings>::PaginationResult>
+    UserSettingsRepository::findAllAsync(size_t page, size_t pageSize) const {
+        const uint64_t epoch = cache_.epoch();
+        auto result = co_await findAllVia(mapper_, page, pageSize);
+        for (auto& settings : result.items) {
+            decryptCredentials(settings, epoch);
+        }
+        co_return result;
+    }
+
+    BaseRepository<models::UserSettings>::KeysetPage
+    UserSettingsRepository::findPage(const std::string& continuationToken, size_t pageSize) const {
+        return drogon::sync_wait(findPageAsync(continuationToken, pageSize));
+    }
+
+    drogon::Task<BaseRepository<models::UserSettings>::KeysetPage>
+    UserSettingsRepository::findPageAsync(std::string continuationToken, size_t pageSize) const {
+        const uint64_t epoch = cache_.epoch();
+        auto page = co_await findPageVia(mapper_, std::move(continuationToken), pageSize);
+        for (auto& settings : page.items) {
+            decryptCredentials(settings, epoch);
+        }
+        co_return page;
+    }
+
     std::vector<models::UserSettings> UserSettingsRepository::findByTimeRange(
         const trantor::Date& start,
         const trantor::Date& end
@@ -112,18 +187,20 @@ namespace repositories {
     }
 
     std::vector<models::UserSettings> UserSettingsRepository::findByUserId(int64_t userId) const {
+        const uint64_t generation = EncryptionManager::getInstance().getKeyGeneration();
+        if (auto cached = cache_.findByUser(userId, generation)) {
+            return std::move(*cached);
+        }
+
+        const uint64_t epoch = cache_.epoch();
         auto items = mapper_.findByUserId(userId);
-        auto& enc = EncryptionManager::getInstance();
+        std::vector<int64_t> ids;
+        ids.reserve(items.size());
         for (auto &st : items) {
-            auto creds = st.getApiCredentials();
-            if (creds.isMember("apiKey")) {
-                creds["apiKey"] = enc.decrypt(creds["apiKey"].asString());
-            }
-            if (creds.isMember("secret")) {
-                creds["secret"] = enc.decrypt(creds["secret"].asString());
-            }
-            st.setApiCredentials(creds);
+            decryptCredentials(st, epoch);
+            ids.push_back(st.getId());
         }
+        cache_.putUser(userId, std::move(ids), generation, epoch);
         return items;
     }
 
@@ -131,41 +208,39 @@ namespace repositories {
         int64_t userId, 
         const std::string& exchangeName
     ) const {
+        // 사용자 설정 목록이 캐시에 온전히 있으면 그 안에서 찾음 (없다는 결과도 유효)
+        if (auto cached = cache_.findByUser(userId, EncryptionManager::getInstance().getKeyGeneration())) {
+            for (auto& settings : *cached) {
+                if (settings.getExchangeName() == exchangeName) {
+                    return std::move(settings);
+                }
+            }
+            return std::nullopt;
+        }
+
+        const uint64_t epoch = cache_.epoch();
         auto result = mapper_.findByUserAndExchange(userId, exchangeName);
         if (result) {
-            auto creds = result->getApiCredentials();
-            auto& enc = EncryptionManager::getInstance();
-            if (creds.isMember("apiKey")) {
-                creds["apiKey"] = enc.decrypt(creds["apiKey"].asString());
-            }
-            if (creds.isMember("secret")) {
-                creds["secret"] = enc.decrypt(creds["secret"].asString());
-            }
-            models::UserSettings modified = *result;
-            modified.setApiCredentials(creds);
-            return modified;
+            decryptCredentials(*result, epoch);
         }
-        return std::nullopt;
+        return result;
     }
 
     std::vector<models::UserSettings> UserSettingsRepository::findAutoTradeEnabled() const {
+        const uint64_t epoch = cache_.epoch();
         auto items = mapper_.findAutoTradeEnabled();
-        auto& enc = EncryptionManager::getInstance();
+        auto& store = models::TradingParamsStore::getInstance();
         for (auto &st : items) {
-            auto creds = st.getApiCredentials();
-            if (creds.isMember("apiKey")) {
-                creds["apiKey"] = enc.decrypt(creds["apiKey"].asString());
-            }
-            if (creds.isMember("secret")) {
-                creds["secret"] = enc.decrypt(creds["secret"].asString());
-            }
-            st.setApiCredentials(creds);
+            store.publish(st);
+            decryptCredentials(st, epoch);
         }
         return items;
     }
 
     void UserSettingsRepository::updateAutoTradeStatus(int64_t settingsId, bool enabled) {
         mapper_.updateAutoTradeStatus(settingsId, enabled);
+        models::TradingParamsStore::getInstance().updateAutoTrade(settingsId, enabled);
+        cache_.invalidate(settingsId);
     }
 
     void UserSettingsRepository::updateApiCredentials(int64_t settingsId, const Json::Value& credentials) {
@@ -178,38 +253,108 @@ namespace repositories {
             encCreds["secret"] = enc.encrypt(encCreds["secret"].asString());
         }
         mapper_.updateApiCredentials(settingsId, encCreds);
+        cache_.invalidate(settingsId);
     }
 
     void UserSettingsRepository::updateStrategyParams(int64_t settingsId, const Json::Value& params) {
+        // DB에 쓰기 전에 검증 (형식 오류 시 std::invalid_argument)
+        auto parsed = models::StrategyParams::fromJson(params);
         mapper_.updateStrategyParams(settingsId, params);
+        models::TradingParamsStore::getInstance().updateStrategy(settingsId, parsed);
+        cache_.invalidate(settingsId);
     }
 
     void UserSettingsRepository::updateWatchlist(int64_t settingsId, const Json::Value& watchlist) {
+        auto parsed = models::Watchlist::fromJson(watchlist);
         mapper_.updateWatchlist(settingsId, watchlist);
+        models::TradingParamsStore::getInstance().updateWatchlist(settingsId, parsed);
+        cache_.invalidate(settingsId);
     }
 
     void UserSettingsRepository::updateRiskParams(int64_t settingsId, const Json::Value& riskParams) {
+        auto parsed = models::RiskParams::fromJson(riskParams);
         mapper_.updateRiskParams(settingsId, riskParams);
+        models::TradingParamsStore::getInstance().updateRisk(settingsId, parsed);
+        cache_.invalidate(settingsId);
+    }
+
+    models::TradingParamsStore::Snapshot UserSettingsRepository::getTradingParams(int64_t settingsId) const {
+        auto& store = models::TradingParamsStore::getInstance();
+        if (auto snapshot = store.get(settingsId)) {
+            return snapshot;
+        }
+        // 아직 게시되지 않았으면 한 번 로드 (findById가 게시)
+        findById(settingsId);
+        return store.get(settingsId);
+    }
+
+    bool UserSettingsRepository::withApiCredentials(
+        int64_t settingsId,
+        const DecryptedSettingsCache::CredentialsVisitor& visitor
+    ) const {
+        auto& enc = EncryptionManager::getInstance();
+        if (cache_.visitCredentials(settingsId, enc.getKeyGeneration(), visitor)) {
+            return true;
+        }
+        auto loaded = findById(settingsId);
+        if (!loaded) {
+            return false;
+        }
+        if (cache_.visitCredentials(settingsId, enc.getKeyGeneration(), visitor)) {
+            return true;
+        }
+        // 캐시에 넣지 못한 경우 (잠금 메모리 고갈 등) 조회 결과로 전달
+        const auto& creds = loaded->getApiCredentials();
+        const std::string apiKey = creds.isObject() ? creds.get("apiKey", "").asString() : std::string();
+        const std::string secret = creds.isObject() ? creds.get("secret", "").asString() : std::string();
+        visitor(apiKey, secret);
+        return true;
+    }
+
+    void UserSettingsRepository::invalidateDecryptedCache() {
+        cache_.invalidateAll();
     }
 
     void UserSettingsRepository::saveBatch(const std::vector<models::UserSettings>& settingsList) {
-        this->executeInTransaction([this, &settingsList](const TransactionPtr& transPtr) {
-            auto& enc = EncryptionManager::getInstance();
-            for (auto settings : settingsList) {
-                auto creds = settings.getApiCredentials();
-                if (creds.isMember("apiKey")) {
-                    creds["apiKey"] = enc.encrypt(creds["apiKey"].asString());
-                }
-                if (creds.isMember("secret")) {
-                    creds["secret"] = enc.encrypt(creds["secret"].asString());
-                }
-                settings.setApiCredentials(creds);
+        // 암호화 후 신규/기존 행을 나눠 각각 다건 문장으로 처리
+        std::vector<models::UserSettings> inserts;
+        std::vector<models::UserSettings> updates;
+        auto& enc = EncryptionManager::getInstance();
+        for (auto settings : settingsList) {
+            auto creds = settings.getApiCredentials();
+            if (creds.isMember("apiKey")) {
+                creds["apiKey"] = enc.encrypt(creds["apiKey"].asString());
+            }
+            if (creds.isMember("secret")) {
+                creds["secret"] = enc.encrypt(creds["secret"].asString());
+            }
+            settings.setApiCredentials(creds);
+            (settings.getId() == 0 ? inserts : updates).push_back(std::move(settings));
+        }
 
-                if (settings.getId() == 0) {
-                    mapper_.insert(settings, *transPtr);
-                } else {
-                    mapper_.update(settings, *transPtr);
-                }
+        // 커밋 후 바뀐 행과 행이 추가된 사용자의 복호화 캐시 무효화
+        std::vector<int64_t> updatedIds;
+        std::vector<int64_t> touchedUsers;
+        for (const auto& settings : updates) {
+            updatedIds.push_back(settings.getId());
+        }
+        for (const auto& settings : inserts) {
+            touchedUsers.push_back(settings.getUserId());
+        }
+
+        this->executeInTransaction([this, inserts = std::move(inserts), updates = std::move(updates)](const TransactionPtr& transPtr) {
+            if (!inserts.empty()) {
+                mapper_.insertBatch(inserts, *transPtr);
+            }
+            if (!updates.empty()) {
+                mapper_.updateBatch(updates, *transPtr);
+            }
+        }, [this, updatedIds = std::move(updatedIds), touchedUsers = std::move(touchedUsers)] {
+            for (int64_t id : updatedIds) {
+                cache_.invalidate(id);
+            }
+            for (int64_t userId : touchedUsers) {
+                cache_.invalidateUser(userId);
             }
         });
     }
@@ -1,6 +1,9 @@
 #include "secure/CryptoAuditor.h"
+#include "database/PipelineExecutor.h"
 #include "utils/Logger.h"
 #include "utils/JsonUtils.h"
+#include "utils/JsonWriter.h"
+#include <optional>
 #include <sstream>
 
 void CryptoAuditor::logCryptoOperation(
@@ -14,15 +17,15 @@ void CryptoAuditor::logCryptoOperation(
         auto dbClient = drogon::app().getDbClient();
         auto now = std::chrono::system_clock::now();
 
-        // 작업 메타데이터 준비
-        Json::Value metadata;
-        metadata["timestamp"] = static_cast<Json::Int64>(
-            std::chrono::system_clock::to_time_t(now)
-        );
-        metadata["operation"] = operation;
-        metadata["success"] = success;
-        metadata["source_ip"] = sourceIp;
-        metadata["user_id"] = userId;
+        // 작업 메타데이터 준비 (DOM 없이 바로 직렬화)
+        auto& metadata = utils::JsonWriter::threadLocal();
+        metadata.beginObject()
+            .field("timestamp", static_cast<int64_t>(std::chrono::system_clock::to_time_t(now)))
+            .field("operation", operation)
+            .field("success", success)
+            .field("source_ip", sourceIp)
+            .field("user_id", userId)
+            .endObject();
 
         // 데이터베이스에 로그 저장
         dbClient->execSqlSync(
@@ -34,7 +37,7 @@ void CryptoAuditor::logCryptoOperation(
             success,
             userId,
             sourceIp,
-            utils::JsonUtils::toJsonString(metadata)
+            metadata.str()
         );
 
         TRADING_LOG_INFO(
@@ -104,9 +107,50 @@ void CryptoAuditor::detectSuspiciousActivity(
     const std::string& userId,
     const std::string& sourceIp
 ) {
+    // 화이트리스트를 확인하지 못하면 알 수 없는 IP로 간주 (fail-closed)
+    bool ipVerified = false;
     try {
+        // 서로 독립적인 세 조회를 한 번의 왕복으로 실행
+        // 문장마다 따로 실행하므로 한 조회가 실패해도 나머지 검사는 그대로 수행
+        database::Pipeline pipeline;
+        const size_t recentOperations = pipeline.add(
+            "SELECT COUNT(*) FROM crypto_audit_logs "
+            "WHERE user_id = $1 AND operation = $2 "
+            "AND created_at > CURRENT_TIMESTAMP - INTERVAL '1 minute'",
+            userId,
+            operation
+        );
+        const size_t knownAddresses = pipeline.add(
+            "SELECT COUNT(*) FROM ip_whitelist "
+            "WHERE user_id = $1 AND ip_address = $2 AND is_active = true",
+            userId,
+            sourceIp
+        );
+        const size_t recentFailures = pipeline.add(
+            "SELECT COUNT(*) FROM crypto_audit_logs "
+            "WHERE user_id = $1 AND success = false "
+            "AND created_at > CURRENT_TIMESTAMP - INTERVAL '1 hour'",
+            userId
+        );
+        const auto results = database::PipelineExecutor::getInstance().executeIndependent(pipeline);
+
+        // 조회 하나의 COUNT(*). 실패하면 기록하고 std::nullopt
+        const auto readCount = [&results](size_t index, const char* check) -> std::optional<int64_t> {
+            const auto& result = results[index];
+            try {
+                if (!result.succeeded()) {
+                    throw std::runtime_error(result.errorMessage());
+                }
+                return result.readInt64(0, 0);
+            } catch (const std::exception& e) {
+                TRADING_LOG_ERROR("Failed to check {}: {}", check, e.what());
+                return std::nullopt;
+            }
+        };
+
         // 비정상적인 작업 빈도 확인
-        if (isRateLimitExceeded(userId, operation)) {
+        if (const auto count = readCount(recentOperations, "rate limit");
+            count && *count > static_cast<int64_t>(MAX_OPERATIONS_PER_MINUTE)) {
             Json::Value alertData;
             alertData["type"] = "rate_limit_exceeded";
             alertData["user_id"] = userId;
@@ -114,81 +158,31 @@ void CryptoAuditor::detectSuspiciousActivity(
             notifySecurityTeam(alertData);
         }
 
-        // 알 수 없는 IP 주소 확인
-        if (!isKnownIpAddress(userId, sourceIp)) {
-            Json::Value alertData;
-            alertData["type"] = "unknown_ip_address";
-            alertData["user_id"] = userId;
-            alertData["source_ip"] = sourceIp;
-            notifySecurityTeam(alertData);
+        // 알 수 없는 IP 주소 확인 (아래 공통 처리)
+        if (const auto count = readCount(knownAddresses, "known IP address")) {
+            ipVerified = *count > 0;
         }
 
         // 최근 실패 횟수 확인
-        auto dbClient = drogon::app().getDbClient();
-        auto result = dbClient->execSqlSync(
-            "SELECT COUNT(*) as failure_count FROM crypto_audit_logs "
-            "WHERE user_id = $1 AND success = false "
-            "AND created_at > CURRENT_TIMESTAMP - INTERVAL '1 hour'",
-            userId
-        );
-
-        if (!result.empty() && 
-            result[0]["failure_count"].as<int>() >= SUSPICIOUS_FAILURE_THRESHOLD) {
-            
+        if (const auto failureCount = readCount(recentFailures, "recent failures");
+            failureCount && *failureCount >= static_cast<int64_t>(SUSPICIOUS_FAILURE_THRESHOLD)) {
             Json::Value alertData;
             alertData["type"] = "multiple_failures";
             alertData["user_id"] = userId;
-            alertData["failure_count"] = result[0]["failure_count"].as<int>();
+            alertData["failure_count"] = static_cast<Json::Int64>(*failureCount);
             notifySecurityTeam(alertData);
         }
 
     } catch (const std::exception& e) {
         TRADING_LOG_ERROR("Failed to detect suspicious activity: {}", e.what());
     }
-}
 
-bool CryptoAuditor::isRateLimitExceeded(
-    const std::string& userId, 
-    const std::string& operation
-) {
-    try {
-        auto dbClient = drogon::app().getDbClient();
-        auto result = dbClient->execSqlSync(
-            "SELECT COUNT(*) as op_count FROM crypto_audit_logs "
-            "WHERE user_id = $1 AND operation = $2 "
-            "AND created_at > CURRENT_TIMESTAMP - INTERVAL '1 minute'",
-            userId,
-            operation
-        );
-
-        return !result.empty() && 
-               result[0]["op_count"].as<int>() > MAX_OPERATIONS_PER_MINUTE;
-
-    } catch (const std::exception& e) {
-        TRADING_LOG_ERROR("Failed to check rate limit: {}", e.what());
-        return false;  // 에러 시 기본적으로 false 반환
-    }
-}
-
-bool CryptoAuditor::isKnownIpAddress(
-    const std::string& userId, 
-    const std::string& sourceIp
-) {
-    try {
-        auto dbClient = drogon::app().getDbClient();
-        auto result = dbClient->execSqlSync(
-            "SELECT COUNT(*) as known_count FROM ip_whitelist "
-            "WHERE user_id = $1 AND ip_address = $2 AND is_active = true",
-            userId,
-            sourceIp
-        );
-
-        return !result.empty() && 
-               result[0]["known_count"].as<int>() > 0;
-
-    } catch (const std::exception& e) {
-        TRADING_LOG_ERROR("Failed to check known IP address: {}", e.what());
-        return false;  // 에러 시 기본적으로 신뢰하지 않는 것으로 간주
+    if (!ipVerified) {
+        Json::Value alertData;
+        alertData["type"] = "unknown_ip_address";
+        alertData["user_id"] = userId;
+        alertData["source_ip"] = sourceIp;
+        notifySecurityTeam(alertData);
     }
 }
 
@@ -266,6 +266,7 @@ void EncryptionManager::rotateKey() {
     key_ = newKey;
     keyId_ = keyGenerator.generateCryptographicKey();
     keyCreationTime_ = std::time(nullptr);
+    keyGeneration_.fetch_add(1, std::memory_order_release);
 }
 
 std::string EncryptionManager::generateNewKey() {
@@ -613,6 +614,7 @@ void EncryptionManager::importEncryptedKey(const std::string& encryptedKey, cons
         if (key_.length() != KEY_LEN) {
             throw std::runtime_error("Invalid key length after import");
         }
+        keyGeneration_.fetch_add(1, std::memory_order_release);
 
     } catch (const std::exception& e) {
         throw std::runtime_error(std::string("Key import failed: ") + e.what());
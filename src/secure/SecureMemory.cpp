@@ -0,0 +1,102 @@
+#include "secure/SecureMemory.h"
+#include "utils/Logger.h"
+#include <openssl/crypto.h>
+#include <sys/mman.h>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+LockedMemoryPool::LockedMemoryPool()
+    : bytes_(SLOT_SIZE * SLOT_COUNT) {
+    void* mapped = mmap(nullptr, bytes_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED) {
+        throw std::runtime_error("Failed to map secure memory pool");
+    }
+    base_ = static_cast<char*>(mapped);
+
+#ifdef MADV_DONTDUMP
+    madvise(base_, bytes_, MADV_DONTDUMP);
+#endif
+    locked_ = mlock(base_, bytes_) == 0;
+    if (!locked_) {
+        TRADING_LOG_WARN("Secure memory pool could not be locked ({}); plaintext may be swapped", std::strerror(errno));
+    }
+
+    freeSlots_.reserve(SLOT_COUNT);
+    for (size_t i = SLOT_COUNT; i > 0; --i) {
+        freeSlots_.push_back(base_ + (i - 1) * SLOT_SIZE);
+    }
+}
+
+LockedMemoryPool::~LockedMemoryPool() {
+    OPENSSL_cleanse(base_, bytes_);
+    if (locked_) {
+        munlock(base_, bytes_);
+    }
+    munmap(base_, bytes_);
+}
+
+char* LockedMemoryPool::allocate() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (freeSlots_.empty()) {
+        return nullptr;
+    }
+    char* slot = freeSlots_.back();
+    freeSlots_.pop_back();
+    return slot;
+}
+
+void LockedMemoryPool::deallocate(char* slot) {
+    if (!slot) {
+        return;
+    }
+    OPENSSL_cleanse(slot, SLOT_SIZE);
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeSlots_.push_back(slot);
+}
+
+size_t LockedMemoryPool::available() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return freeSlots_.size();
+}
+
+SecureString::SecureString(std::string_view plaintext) {
+    if (plaintext.size() > MAX_LENGTH) {
+        throw std::invalid_argument("Secure string exceeds slot size");
+    }
+    if (plaintext.empty()) {
+        return;
+    }
+    data_ = LockedMemoryPool::getInstance().allocate();
+    if (!data_) {
+        throw std::runtime_error("Secure memory pool exhausted");
+    }
+    std::memcpy(data_, plaintext.data(), plaintext.size());
+    length_ = plaintext.size();
+}
+
+SecureString::~SecureString() {
+    release();
+}
+
+SecureString::SecureString(SecureString&& other) noexcept
+    : data_(std::exchange(other.data_, nullptr)),
+      length_(std::exchange(other.length_, 0)) {}
+
+SecureString& SecureString::operator=(SecureString&& other) noexcept {
+    if (this != &other) {
+        release();
+        data_ = std::exchange(other.data_, nullptr);
+        length_ = std::exchange(other.length_, 0);
+    }
+    return *this;
+}
+
+void SecureString::release() noexcept {
+    if (data_) {
+        LockedMemoryPool::getInstance().deallocate(data_);
+        data_ = nullptr;
+        length_ = 0;
+    }
+}
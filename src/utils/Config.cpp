@@ -1,4 +1,5 @@
 #include "utils/Config.h"
+#include "common/Config.h"
 #include <fstream>
 #include <iostream>
 #include <cstdlib>
@@ -27,6 +28,8 @@ namespace utils {
         dbName = getEnvVar("DB_NAME", "trading_db");
         dbUser = getEnvVar("DB_USER", "trading_user");
         dbPassword = getEnvVar("DB_PASSWORD", "");
+        dbReplicaHost = getEnvVar("DB_REPLICA_HOST", "");
+        dbReplicaPort = std::stoi(getEnvVar("DB_REPLICA_PORT", "5432"));
 
         // Security configuration
         enableSsl = getEnvVar("ENABLE_SSL", "false") == "true";
@@ -128,6 +131,15 @@ namespace utils {
             dbClients[0]["dbname"] = dbName;
             dbClients[0]["user"] = dbUser;
             dbClients[0]["passwd"] = dbPassword;
+
+            // replica는 primary 설정을 복사하고 호스트/포트만 교체 (계정/DB 이름은 동일)
+            if (!dbReplicaHost.empty()) {
+                Json::Value replica = dbClients[0];
+                replica["name"] = common::ReplicaConfig::CLIENT_NAME;
+                replica["host"] = dbReplicaHost;
+                replica["port"] = dbReplicaPort;
+                dbClients.append(replica);
+            }
         }
 
         // SSL 설정
@@ -0,0 +1,288 @@
+#include "utils/JsonWriter.h"
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace utils {
+
+    namespace {
+
+        constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+        // 이스케이프가 필요한 문자: ", \, 제어 문자
+        inline bool needsEscape(unsigned char c) {
+            return c < 0x20 || c == '"' || c == '\\';
+        }
+
+        inline void appendTwoDigits(char* out, unsigned value) {
+            out[0] = static_cast<char>('0' + value / 10);
+            out[1] = static_cast<char>('0' + value % 10);
+        }
+
+    } // namespace
+
+    JsonWriter::JsonWriter(size_t initialCapacity) {
+        buffer_.reserve(initialCapacity);
+    }
+
+    JsonWriter& JsonWriter::threadLocal() {
+        thread_local JsonWriter writer;
+        writer.clear();
+        return writer;
+    }
+
+    void JsonWriter::clear() {
+        buffer_.clear();
+        depth_ = 0;
+        expectingValue_ = false;
+    }
+
+    std::string JsonWriter::release() {
+        if (depth_ != 0) {
+            throw std::logic_error("JsonWriter: unterminated object or array");
+        }
+        std::string out = std::move(buffer_);
+        buffer_ = std::string();
+        clear();
+        return out;
+    }
+
+    void JsonWriter::beforeValue() {
+        if (expectingValue_) {
+            expectingValue_ = false;
+            return;
+        }
+        if (depth_ == 0) {
+            if (!buffer_.empty()) {
+                throw std::logic_error("JsonWriter: multiple root values");
+            }
+            return;
+        }
+        Frame& frame = stack_[depth_ - 1];
+        if (frame.scope == Scope::Object) {
+            throw std::logic_error("JsonWriter: value in object without key");
+        }
+        if (frame.hasElements) {
+            buffer_.push_back(',');
+        }
+        frame.hasElements = true;
+    }
+
+    JsonWriter& JsonWriter::beginObject() {
+        beforeValue();
+        if (depth_ == MAX_DEPTH) {
+            throw std::logic_error("JsonWriter: maximum nesting depth exceeded");
+        }
+        stack_[depth_++] = Frame{Scope::Object, false};
+        buffer_.push_back('{');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::endObject() {
+        if (depth_ == 0 || stack_[depth_ - 1].scope != Scope::Object || expectingValue_) {
+            throw std::logic_error("JsonWriter: unbalanced endObject");
+        }
+        --depth_;
+        buffer_.push_back('}');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::beginArray() {
+        beforeValue();
+        if (depth_ == MAX_DEPTH) {
+            throw std::logic_error("JsonWriter: maximum nesting depth exceeded");
+        }
+        stack_[depth_++] = Frame{Scope::Array, false};
+        buffer_.push_back('[');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::endArray() {
+        if (depth_ == 0 || stack_[depth_ - 1].scope != Scope::Array) {
+            throw std::logic_error("JsonWriter: unbalanced endArray");
+        }
+        --depth_;
+        buffer_.push_back(']');
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::key(std::string_view name) {
+        if (depth_ == 0 || stack_[depth_ - 1].scope != Scope::Object || expectingValue_) {
+            throw std::logic_error("JsonWriter: key outside of object");
+        }
+        Frame& frame = stack_[depth_ - 1];
+        if (frame.hasElements) {
+            buffer_.push_back(',');
+        }
+        frame.hasElements = true;
+        writeEscaped(name);
+        buffer_.push_back(':');
+        expectingValue_ = true;
+        return *this;
+    }
+
+    void JsonWriter::writeEscaped(std::string_view text) {
+        buffer_.push_back('"');
+        size_t runStart = 0;
+        for (size_t i = 0; i < text.size(); ++i) {
+            unsigned char c = static_cast<unsigned char>(text[i]);
+            if (!needsEscape(c)) {
+                continue;
+            }
+            // 이스케이프 없는 구간은 한 번에 복사
+            buffer_.append(text.data() + runStart, i - runStart);
+            runStart = i + 1;
+            switch (c) {
+                case '"':  buffer_.append("\\\"", 2); break;
+                case '\\': buffer_.append("\\\\", 2); break;
+                case '\n': buffer_.append("\\n", 2); break;
+                case '\r': buffer_.append("\\r", 2); break;
+                case '\t': buffer_.append("\\t", 2); break;
+                case '\b': buffer_.append("\\b", 2); break;
+                case '\f': buffer_.append("\\f", 2); break;
+                default: {
+                    char escaped[6] = {'\\', 'u', '0', '0', HEX_DIGITS[c >> 4], HEX_DIGITS[c & 0x0F]};
+                    buffer_.append(escaped, sizeof(escaped));
+                    break;
+                }
+            }
+        }
+        buffer_.append(text.data() + runStart, text.size() - runStart);
+        buffer_.push_back('"');
+    }
+
+    JsonWriter& JsonWriter::value(std::string_view text) {
+        beforeValue();
+        writeEscaped(text);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(bool flag) {
+        beforeValue();
+        if (flag) {
+            buffer_.append("true", 4);
+        } else {
+            buffer_.append("false", 5);
+        }
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(int64_t number) {
+        beforeValue();
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), number);
+        buffer_.append(digits, result.ptr);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(uint64_t number) {
+        beforeValue();
+        char digits[24];
+        auto result = std::to_chars(digits, digits + sizeof(digits), number);
+        buffer_.append(digits, result.ptr);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(double number) {
+        beforeValue();
+        if (!std::isfinite(number)) {
+            buffer_.append("null", 4);
+            return *this;
+        }
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), number);
+        buffer_.append(digits, result.ptr);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::nullValue() {
+        beforeValue();
+        buffer_.append("null", 4);
+        return *this;
+    }
+
+    JsonWriter& JsonWriter::value(const Json::Value& json) {
+        switch (json.type()) {
+            case Json::nullValue:
+                return nullValue();
+            case Json::intValue:
+                return value(static_cast<int64_t>(json.asInt64()));
+            case Json::uintValue:
+                return value(static_cast<uint64_t>(json.asUInt64()));
+            case Json::realValue:
+                return value(json.asDouble());
+            case Json::booleanValue:
+                return value(json.asBool());
+            case Json::stringValue: {
+                const char* begin = nullptr;
+                const char* end = nullptr;
+                json.getString(&begin, &end);
+                return value(std::string_view(begin, static_cast<size_t>(end - begin)));
+            }
+            case Json::arrayValue:
+                beginArray();
+                for (const auto& element : json) {
+                    value(element);
+                }
+                return endArray();
+            case Json::objectValue:
+                beginObject();
+                for (auto it = json.begin(); it != json.end(); ++it) {
+                    key(it.name());
+                    value(*it);
+                }
+                return endObject();
+        }
+        return nullValue();
+    }
+
+    JsonWriter& JsonWriter::timestamp(const trantor::Date& date) {
+        beforeValue();
+
+        int64_t micros = date.microSecondsSinceEpoch();
+        int64_t seconds = micros / 1000000;
+        if (micros % 1000000 < 0) {
+            --seconds;
+        }
+        int64_t days = seconds / 86400;
+        int64_t secondOfDay = seconds % 86400;
+        if (secondOfDay < 0) {
+            secondOfDay += 86400;
+            --days;
+        }
+
+        // 1970-01-01 기준 일수 -> 그레고리력 (H. Hinnant civil_from_days)
+        days += 719468;
+        const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+        const unsigned dayOfEra = static_cast<unsigned>(days - era * 146097);
+        const unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+        const unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+        const unsigned mp = (5 * dayOfYear + 2) / 153;
+        const unsigned day = dayOfYear - (153 * mp + 2) / 5 + 1;
+        const unsigned month = mp < 10 ? mp + 3 : mp - 9;
+        const int64_t year = static_cast<int64_t>(yearOfEra) + era * 400 + (month <= 2 ? 1 : 0);
+
+        if (year < 0 || year > 9999) {
+            writeEscaped(date.toFormattedString(false));
+            return *this;
+        }
+
+        // "YYYYMMDD HH:MM:SS"
+        char out[19];
+        out[0] = '"';
+        appendTwoDigits(out + 1, static_cast<unsigned>(year / 100));
+        appendTwoDigits(out + 3, static_cast<unsigned>(year % 100));
+        appendTwoDigits(out + 5, month);
+        appendTwoDigits(out + 7, day);
+        out[9] = ' ';
+        appendTwoDigits(out + 10, static_cast<unsigned>(secondOfDay / 3600));
+        out[12] = ':';
+        appendTwoDigits(out + 13, static_cast<unsigned>(secondOfDay / 60 % 60));
+        out[15] = ':';
+        appendTwoDigits(out + 16, static_cast<unsigned>(secondOfDay % 60));
+        out[18] = '"';
+        buffer_.append(out, sizeof(out));
+        return *this;
+    }
+
+} // namespace utils
@@ -0,0 +1,143 @@
+#include "utils/TimestampParser.h"
+#include <cstring>
+#include <string>
+
+namespace utils {
+
+    namespace {
+
+        constexpr size_t SECOND_PREFIX_LENGTH = 19;   // "YYYY-MM-DD HH:MM:SS"
+
+        struct SecondCache {
+            char key[SECOND_PREFIX_LENGTH];
+            int64_t epochSeconds;
+            bool valid;
+        };
+
+        thread_local SecondCache secondCache{{}, 0, false};
+
+        inline bool isDigit(char c) {
+            return c >= '0' && c <= '9';
+        }
+
+        inline bool readDigits(const char* p, size_t count, int& out) {
+            int value = 0;
+            for (size_t i = 0; i < count; ++i) {
+                if (!isDigit(p[i])) {
+                    return false;
+                }
+                value = value * 10 + (p[i] - '0');
+            }
+            out = value;
+            return true;
+        }
+
+        // 1970-01-01 기준 일수 (H. Hinnant days_from_civil)
+        int64_t daysFromCivil(int64_t year, unsigned month, unsigned day) {
+            year -= month <= 2 ? 1 : 0;
+            const int64_t era = (year >= 0 ? year : year - 399) / 400;
+            const unsigned yearOfEra = static_cast<unsigned>(year - era * 400);
+            const unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+            const unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+            return era * 146097 + static_cast<int64_t>(dayOfEra) - 719468;
+        }
+
+        std::optional<int64_t> parseSecondPrefix(const char* p) {
+            int year, month, day, hour, minute, second;
+            if (!readDigits(p, 4, year) || p[4] != '-' ||
+                !readDigits(p + 5, 2, month) || p[7] != '-' ||
+                !readDigits(p + 8, 2, day) || (p[10] != ' ' && p[10] != 'T') ||
+                !readDigits(p + 11, 2, hour) || p[13] != ':' ||
+                !readDigits(p + 14, 2, minute) || p[16] != ':' ||
+                !readDigits(p + 17, 2, second)) {
+                return std::nullopt;
+            }
+            if (month < 1 || month > 12 || day < 1 || day > 31 ||
+                hour > 23 || minute > 59 || second > 60) {
+                return std::nullopt;
+            }
+            return daysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) * 86400 +
+                   hour * 3600 + minute * 60 + second;
+        }
+
+    } // namespace
+
+    std::optional<int64_t> TimestampParser::parseMicros(std::string_view text) {
+        if (text.size() < SECOND_PREFIX_LENGTH) {
+            return std::nullopt;
+        }
+
+        // 1. 초 단위 부분 (캐시 우선)
+        int64_t epochSeconds;
+        if (secondCache.valid && std::memcmp(secondCache.key, text.data(), SECOND_PREFIX_LENGTH) == 0) {
+            epochSeconds = secondCache.epochSeconds;
+        } else {
+            auto parsed = parseSecondPrefix(text.data());
+            if (!parsed) {
+                return std::nullopt;
+            }
+            epochSeconds = *parsed;
+            std::memcpy(secondCache.key, text.data(), SECOND_PREFIX_LENGTH);
+            secondCache.epochSeconds = epochSeconds;
+            secondCache.valid = true;
+        }
+
+        size_t pos = SECOND_PREFIX_LENGTH;
+
+        // 2. 소수 초 (최대 6자리, 초과 자릿수는 버림)
+        int64_t micros = 0;
+        if (pos < text.size() && text[pos] == '.') {
+            ++pos;
+            int digits = 0;
+            while (pos < text.size() && isDigit(text[pos])) {
+                if (digits < 6) {
+                    micros = micros * 10 + (text[pos] - '0');
+                    ++digits;
+                }
+                ++pos;
+            }
+            if (digits == 0) {
+                return std::nullopt;
+            }
+            for (; digits < 6; ++digits) {
+                micros *= 10;
+            }
+        }
+
+        // 3. 오프셋
+        int64_t offsetSeconds = 0;
+        if (pos < text.size()) {
+            const char sign = text[pos];
+            if (sign == 'Z') {
+                ++pos;
+            } else if (sign == '+' || sign == '-') {
+                int hours = 0;
+                int minutes = 0;
+                if (pos + 3 > text.size() || !readDigits(text.data() + pos + 1, 2, hours)) {
+                    return std::nullopt;
+                }
+                pos += 3;
+                if (pos < text.size() && text[pos] == ':') {
+                    ++pos;
+                }
+                if (pos + 2 <= text.size() && readDigits(text.data() + pos, 2, minutes)) {
+                    pos += 2;
+                }
+                offsetSeconds = (hours * 3600 + minutes * 60) * (sign == '-' ? -1 : 1);
+            }
+        }
+        if (pos != text.size()) {
+            return std::nullopt;
+        }
+
+        return (epochSeconds - offsetSeconds) * 1000000 + micros;
+    }
+
+    trantor::Date TimestampParser::parse(std::string_view text) {
+        if (auto micros = parseMicros(text)) {
+            return trantor::Date(*micros);
+        }
+        return trantor::Date::fromDbString(std::string(text));
+    }
+
+} // namespace utils
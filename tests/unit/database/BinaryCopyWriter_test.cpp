@@ -0,0 +1,90 @@
+#include <catch2/catch.hpp>
+#include "database/BinaryCopyWriter.h"
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+using database::BinaryCopyWriter;
+
+namespace {
+
+    std::vector<uint8_t> encode(std::string_view decimal) {
+        std::vector<uint8_t> out;
+        BinaryCopyWriter::encodeNumeric(decimal, out);
+        return out;
+    }
+
+    // numeric_send 출력: ndigits, weight, sign, dscale 뒤에 base-10000 자릿수 (모두 빅 엔디언 int16)
+    std::vector<uint8_t> numeric(int16_t weight, uint16_t sign, uint16_t dscale, std::vector<uint16_t> digits) {
+        std::vector<uint8_t> out;
+        const auto put = [&out](uint16_t value) {
+            out.push_back(static_cast<uint8_t>(value >> 8));
+            out.push_back(static_cast<uint8_t>(value));
+        };
+        put(static_cast<uint16_t>(digits.size()));
+        put(static_cast<uint16_t>(weight));
+        put(sign);
+        put(dscale);
+        for (uint16_t digit : digits) {
+            put(digit);
+        }
+        return out;
+    }
+
+    constexpr uint16_t POS = 0x0000;
+    constexpr uint16_t NEG = 0x4000;
+
+} // namespace
+
+TEST_CASE("BinaryCopyWriter encodes zero without digits", "[BinaryCopyWriter]") {
+    // PostgreSQL은 0을 자릿수 없이 weight 0, 양수로 보냄 (음수 0도 양수로 정규화)
+    REQUIRE(encode("0") == numeric(0, POS, 0, {}));
+    REQUIRE(encode("0.000") == numeric(0, POS, 3, {}));
+    REQUIRE(encode("-0.00") == numeric(0, POS, 2, {}));
+    REQUIRE(encode("0000") == numeric(0, POS, 0, {}));
+}
+
+TEST_CASE("BinaryCopyWriter encodes signed integers", "[BinaryCopyWriter]") {
+    REQUIRE(encode("1") == numeric(0, POS, 0, {1}));
+    REQUIRE(encode("9999") == numeric(0, POS, 0, {9999}));
+    REQUIRE(encode("-42") == numeric(0, NEG, 0, {42}));
+
+    // 끝의 0 그룹은 제거하고 weight로 표현
+    REQUIRE(encode("10000") == numeric(1, POS, 0, {1}));
+    REQUIRE(encode("-20000") == numeric(1, NEG, 0, {2}));
+    REQUIRE(encode("12340000") == numeric(1, POS, 0, {1234}));
+}
+
+TEST_CASE("BinaryCopyWriter encodes fractional scales", "[BinaryCopyWriter]") {
+    // 1. 정수부와 소수부가 모두 있는 값. dscale은 입력의 소수 자릿수
+    REQUIRE(encode("-12.5") == numeric(0, NEG, 1, {12, 5000}));
+    REQUIRE(encode("50000.25") == numeric(1, POS, 2, {5, 0, 2500}));
+    REQUIRE(encode("1.00000001") == numeric(0, POS, 8, {1, 0, 1}));
+
+    // 2. 소수부만 있는 값은 앞쪽 0 그룹만큼 weight가 음수
+    REQUIRE(encode("0.0001") == numeric(-1, POS, 4, {1}));
+    REQUIRE(encode("0.5") == numeric(-1, POS, 1, {5000}));
+    REQUIRE(encode("-0.00001234") == numeric(-2, NEG, 8, {1234}));
+
+    // 3. 뒤쪽 0은 자릿수에서 빠지지만 dscale에는 남음
+    REQUIRE(encode("10000.0000") == numeric(1, POS, 4, {1}));
+    REQUIRE(encode("3.1400") == numeric(0, POS, 4, {3, 1400}));
+}
+
+TEST_CASE("BinaryCopyWriter encodes values wider than four digit groups", "[BinaryCopyWriter]") {
+    REQUIRE(encode("123456789012345678.9") ==
+        numeric(4, POS, 1, {12, 3456, 7890, 1234, 5678, 9000}));
+    REQUIRE(encode("-99999999999999999999.12345678") ==
+        numeric(4, NEG, 8, {9999, 9999, 9999, 9999, 9999, 1234, 5678}));
+
+    // 중간의 0 그룹은 유지
+    REQUIRE(encode("1000000000000.0001") == numeric(3, POS, 4, {1, 0, 0, 0, 1}));
+}
+
+TEST_CASE("BinaryCopyWriter appends to the output buffer", "[BinaryCopyWriter]") {
+    std::vector<uint8_t> out{0xAA};
+    BinaryCopyWriter::encodeNumeric("7", out);
+    REQUIRE(out.size() == 1 + 10);
+    REQUIRE(out.front() == 0xAA);
+    REQUIRE(out.back() == 7);
+}
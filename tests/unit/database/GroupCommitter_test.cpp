@@ -0,0 +1,236 @@
+#include <catch2/catch.hpp>
+#include "database/GroupCommitter.h"
+#include "utils/Logger.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <filesystem>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+    // op가 값을 기록하는 가짜 트랜잭션
+    struct FakeTransaction {
+        std::vector<int> writes;
+    };
+
+    using Committer = database::BasicGroupCommitter<FakeTransaction>;
+
+    // 커밋된 트랜잭션마다 기록된 값 목록을 보관. failCommit이면 COMMIT 실패
+    struct FakeDatabase {
+        std::mutex mutex;
+        std::vector<std::vector<int>> commits;
+        size_t attempts = 0;
+        bool failCommit = false;
+
+        Committer::TransactionRunner runner() {
+            return [this](const std::function<void(FakeTransaction&)>& body) {
+                FakeTransaction transaction;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    ++attempts;
+                }
+                body(transaction);      // 예외면 기록 없이 전파 (롤백)
+                std::lock_guard<std::mutex> lock(mutex);
+                if (failCommit) {
+                    return false;
+                }
+                commits.push_back(std::move(transaction.writes));
+                return true;
+            };
+        }
+    };
+
+    // 완료 콜백 결과 수집 (committer 스레드에서 호출됨)
+    struct Completions {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::vector<int> committed;
+        std::vector<std::string> failed;
+
+        void submit(Committer& committer, int value) {
+            committer.submit(
+                [value](FakeTransaction& transaction) {
+                    if (value < 0) {
+                        throw std::invalid_argument("negative " + std::to_string(value));
+                    }
+                    transaction.writes.push_back(value);
+                    return value;
+                },
+                [this](int result) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    committed.push_back(result);
+                    changed.notify_all();
+                },
+                [this](std::exception_ptr error) {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    try {
+                        std::rethrow_exception(error);
+                    } catch (const std::exception& e) {
+                        failed.push_back(e.what());
+                    }
+                    changed.notify_all();
+                });
+        }
+
+        bool waitFor(size_t count) {
+            std::unique_lock<std::mutex> lock(mutex);
+            return changed.wait_for(lock, std::chrono::seconds(10),
+                                    [&] { return committed.size() + failed.size() >= count; });
+        }
+    };
+
+    Committer::Options options(std::chrono::microseconds maxLatency, size_t maxBatch) {
+        // start/stop이 로그를 남기므로 테스트 전용 경로로 한 번 초기화
+        static const bool initialized = [] {
+            utils::Logger::init((std::filesystem::temp_directory_path() / "trading_system_tests").string());
+            return true;
+        }();
+        (void)initialized;
+
+        Committer::Options result;
+        result.maxLatency = maxLatency;
+        result.maxBatch = maxBatch;
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("GroupCommitter groups writes that arrive within the latency window", "[GroupCommitter]") {
+    FakeDatabase database;
+    Completions completions;
+    Committer committer(database.runner());
+    committer.start(options(std::chrono::milliseconds(300), 100));
+
+    for (int value = 1; value <= 3; ++value) {
+        completions.submit(committer, value);
+    }
+    REQUIRE(completions.waitFor(3));
+    committer.stop();
+
+    REQUIRE(database.commits == std::vector<std::vector<int>>{{1, 2, 3}});
+    REQUIRE(completions.committed == std::vector<int>{1, 2, 3});
+    const auto stats = committer.getStats();
+    REQUIRE(stats.submitted == 3);
+    REQUIRE(stats.committed == 3);
+    REQUIRE(stats.batches == 1);
+}
+
+TEST_CASE("GroupCommitter commits as soon as a batch fills", "[GroupCommitter]") {
+    FakeDatabase database;
+    Completions completions;
+    Committer committer(database.runner());
+    // 지연 상한이 길어도 maxBatch개가 모이면 바로 커밋
+    committer.start(options(std::chrono::seconds(30), 2));
+
+    for (int value = 1; value <= 4; ++value) {
+        completions.submit(committer, value);
+    }
+    REQUIRE(completions.waitFor(4));
+    committer.stop();
+
+    REQUIRE(database.commits == std::vector<std::vector<int>>{{1, 2}, {3, 4}});
+    REQUIRE(committer.getStats().batches == 2);
+}
+
+TEST_CASE("GroupCommitter fails only the throwing op and reruns its neighbours", "[GroupCommitter]") {
+    FakeDatabase database;
+    Completions completions;
+    Committer committer(database.runner());
+    committer.start(options(std::chrono::seconds(30), 4));
+
+    for (int value : {1, -2, 3, -4}) {
+        completions.submit(committer, value);
+    }
+    REQUIRE(completions.waitFor(4));
+    committer.stop();
+
+    // 실패한 op마다 롤백 후 나머지를 새 트랜잭션에서 다시 실행
+    REQUIRE(database.attempts == 3);
+    REQUIRE(database.commits == std::vector<std::vector<int>>{{1, 3}});
+    REQUIRE(completions.committed == std::vector<int>{1, 3});
+    REQUIRE(completions.failed == std::vector<std::string>{"negative -2", "negative -4"});
+    const auto stats = committer.getStats();
+    REQUIRE(stats.committed == 2);
+    REQUIRE(stats.failed == 2);
+    REQUIRE(stats.reruns == 3 + 2);
+    REQUIRE(stats.batches == 1);
+}
+
+TEST_CASE("GroupCommitter fails every op when COMMIT fails", "[GroupCommitter]") {
+    FakeDatabase database;
+    database.failCommit = true;
+    Completions completions;
+    Committer committer(database.runner());
+    committer.start(options(std::chrono::seconds(30), 2));
+
+    completions.submit(committer, 1);
+    completions.submit(committer, 2);
+    REQUIRE(completions.waitFor(2));
+    committer.stop();
+
+    REQUIRE(completions.committed.empty());
+    REQUIRE(completions.failed.size() == 2);
+    REQUIRE(committer.getStats().failed == 2);
+}
+
+TEST_CASE("GroupCommitter drains queued writes on stop", "[GroupCommitter]") {
+    FakeDatabase database;
+    Completions completions;
+    Committer committer(database.runner());
+    committer.start(options(std::chrono::seconds(30), 100));
+
+    for (int value = 1; value <= 5; ++value) {
+        completions.submit(committer, value);
+    }
+    // 지연 상한 전이지만 stop이 대기 중인 op를 모두 커밋
+    committer.stop();
+    REQUIRE_FALSE(committer.isRunning());
+    REQUIRE(completions.committed == std::vector<int>{1, 2, 3, 4, 5});
+    REQUIRE(database.commits == std::vector<std::vector<int>>{{1, 2, 3, 4, 5}});
+
+    // 정지 후에는 호출 스레드에서 단독 트랜잭션으로 처리하고 반환 전에 완료
+    completions.submit(committer, 6);
+    REQUIRE(completions.committed.back() == 6);
+    REQUIRE(database.commits.back() == std::vector<int>{6});
+}
+
+TEST_CASE("GroupCommitter completes coroutine submissions after commit", "[GroupCommitter]") {
+    FakeDatabase database;
+    Committer committer(database.runner());
+    committer.start(options(std::chrono::milliseconds(1), 10));
+
+    // 1. 훅은 결과가 전달되기 전에 호출
+    std::atomic<int> hooked{0};
+    const int saved = drogon::sync_wait(committer.submitCoro(
+        [](FakeTransaction& transaction) {
+            transaction.writes.push_back(7);
+            return 7;
+        },
+        [&hooked](const int& result) { hooked = result; }));
+    REQUIRE(saved == 7);
+    REQUIRE(hooked == 7);
+
+    // 2. op 예외는 co_await에서 다시 던짐
+    REQUIRE_THROWS_AS(drogon::sync_wait(committer.submitCoro([](FakeTransaction&) -> int {
+        throw std::invalid_argument("rejected");
+    })), std::invalid_argument);
+
+    committer.stop();
+    REQUIRE(database.commits == std::vector<std::vector<int>>{{7}});
+}
+
+TEST_CASE("GroupCommitter validates options", "[GroupCommitter]") {
+    FakeDatabase database;
+    Committer committer(database.runner());
+    REQUIRE_THROWS_AS(committer.start(options(std::chrono::milliseconds(1), 0)), std::invalid_argument);
+    REQUIRE_THROWS_AS(committer.start(options(std::chrono::microseconds(-1), 1)), std::invalid_argument);
+
+    committer.start(options(std::chrono::milliseconds(1), 1));
+    REQUIRE_THROWS_AS(committer.start(options(std::chrono::milliseconds(1), 1)), std::logic_error);
+    committer.stop();
+}
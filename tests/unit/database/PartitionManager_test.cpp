@@ -0,0 +1,61 @@
+#include <catch2/catch.hpp>
+#include "database/PartitionManager.h"
+#include <string>
+#include <vector>
+
+using database::PartitionManager;
+using namespace std::chrono;
+
+namespace {
+
+    sys_days date(int y, unsigned m, unsigned d) {
+        return sys_days{year{y} / month{m} / day{d}};
+    }
+
+} // namespace
+
+TEST_CASE("PartitionManager partition naming", "[PartitionManager]") {
+    const PartitionManager::Policy daily{"market_data", PartitionManager::Granularity::DAILY, 2, 3};
+    const PartitionManager::Policy monthly{"orders", PartitionManager::Granularity::MONTHLY, 1, 0};
+
+    // 1. 마이그레이션과 같은 이름 규칙
+    REQUIRE(PartitionManager::partitionName(daily, date(2026, 3, 5)) == "market_data_p20260305");
+    REQUIRE(PartitionManager::partitionName(monthly, date(2026, 3, 1)) == "orders_p202603");
+
+    // 2. 이름 해석: 규칙 밖 이름은 무시
+    REQUIRE(PartitionManager::parsePartitionStart(daily, "market_data_p20260305") == date(2026, 3, 5));
+    REQUIRE(PartitionManager::parsePartitionStart(monthly, "orders_p202612") == date(2026, 12, 1));
+    REQUIRE_FALSE(PartitionManager::parsePartitionStart(daily, "market_data_default").has_value());
+    REQUIRE_FALSE(PartitionManager::parsePartitionStart(daily, "market_data_p20260230").has_value());
+    REQUIRE_FALSE(PartitionManager::parsePartitionStart(monthly, "trades_p202603").has_value());
+
+    // 3. 월 경계 넘김
+    REQUIRE(PartitionManager::periodStart(PartitionManager::Granularity::MONTHLY, date(2026, 12, 31)) == date(2026, 12, 1));
+    REQUIRE(PartitionManager::advance(PartitionManager::Granularity::MONTHLY, date(2026, 12, 1), 1) == date(2027, 1, 1));
+    REQUIRE(PartitionManager::advance(PartitionManager::Granularity::DAILY, date(2026, 3, 1), -1) == date(2026, 2, 28));
+}
+
+TEST_CASE("PartitionManager plans creation and detachment", "[PartitionManager]") {
+    const PartitionManager::Policy daily{"market_data", PartitionManager::Granularity::DAILY, 2, 3};
+    const std::vector<std::string> existing{
+        "market_data_p20260301", "market_data_p20260302", "market_data_p20260303",
+        "market_data_p20260304", "market_data_p20260305", "market_data_legacy"
+    };
+
+    // 오늘 3/5: 3/5~3/7 보장, 3/3~3/5 보존
+    const auto plan = PartitionManager::plan(daily, date(2026, 3, 5), existing);
+    REQUIRE(plan.create.size() == 2);
+    REQUIRE(plan.create[0].name == "market_data_p20260306");
+    REQUIRE(plan.create[0].from == date(2026, 3, 6));
+    REQUIRE(plan.create[0].to == date(2026, 3, 7));
+    REQUIRE(plan.create[1].name == "market_data_p20260307");
+    REQUIRE(plan.detach == std::vector<std::string>{"market_data_p20260301", "market_data_p20260302"});
+
+    // 보존 0이면 분리하지 않음
+    const PartitionManager::Policy keepAll{"orders", PartitionManager::Granularity::MONTHLY, 1, 0};
+    const auto keep = PartitionManager::plan(keepAll, date(2026, 12, 15), {"orders_p202001"});
+    REQUIRE(keep.detach.empty());
+    REQUIRE(keep.create.size() == 2);
+    REQUIRE(keep.create[1].name == "orders_p202701");
+    REQUIRE(keep.create[1].to == date(2027, 2, 1));
+}
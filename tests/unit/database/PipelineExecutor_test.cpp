@@ -0,0 +1,124 @@
+#include <catch2/catch.hpp>
+#include "database/PipelineExecutor.h"
+#include <cmath>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using database::Pipeline;
+using database::PipelineResult;
+
+namespace {
+
+    // 서버 없이 텍스트 형식 결과 구성 (std::nullopt는 NULL)
+    PipelineResult makeResult(
+        ExecStatusType status,
+        const std::vector<std::string>& columns,
+        const std::vector<std::vector<std::optional<std::string>>>& rows
+    ) {
+        PGresult* result = PQmakeEmptyPGresult(nullptr, status);
+        std::vector<PGresAttDesc> attributes(columns.size());
+        for (size_t i = 0; i < columns.size(); ++i) {
+            attributes[i].name = const_cast<char*>(columns[i].c_str());
+            attributes[i].format = 0;
+            attributes[i].typid = 25;   // text
+            attributes[i].typlen = -1;
+            attributes[i].atttypmod = -1;
+        }
+        REQUIRE(PQsetResultAttrs(result, static_cast<int>(attributes.size()), attributes.data()) == 1);
+        for (size_t row = 0; row < rows.size(); ++row) {
+            for (size_t column = 0; column < rows[row].size(); ++column) {
+                const auto& value = rows[row][column];
+                REQUIRE(PQsetvalue(result, static_cast<int>(row), static_cast<int>(column),
+                                   value ? const_cast<char*>(value->c_str()) : nullptr,
+                                   value ? static_cast<int>(value->size()) : -1) == 1);
+            }
+        }
+        return PipelineResult(result);
+    }
+
+    PipelineResult singleValue(std::optional<std::string> value) {
+        return makeResult(PGRES_TUPLES_OK, {"value"}, {{std::move(value)}});
+    }
+
+} // namespace
+
+TEST_CASE("Pipeline converts parameters to text", "[PipelineExecutor]") {
+    // 1. 정수/불리언/문자열
+    REQUIRE(Pipeline::toParam(42) == std::optional<std::string>("42"));
+    REQUIRE(Pipeline::toParam(int64_t{-9007199254740993}) == std::optional<std::string>("-9007199254740993"));
+    REQUIRE(Pipeline::toParam(true) == std::optional<std::string>("t"));
+    REQUIRE(Pipeline::toParam(false) == std::optional<std::string>("f"));
+    REQUIRE(Pipeline::toParam(std::string("user-1")) == std::optional<std::string>("user-1"));
+    REQUIRE(Pipeline::toParam("10.0.0.1") == std::optional<std::string>("10.0.0.1"));
+    REQUIRE(Pipeline::toParam(std::string_view("BTC")) == std::optional<std::string>("BTC"));
+
+    // 2. 부동소수점은 왕복 가능한 최단 표현
+    REQUIRE(Pipeline::toParam(0.1) == std::optional<std::string>("0.1"));
+    REQUIRE(Pipeline::toParam(1e21) == std::optional<std::string>("1e+21"));
+
+    // 3. NULL
+    REQUIRE_FALSE(Pipeline::toParam(std::nullopt).has_value());
+    REQUIRE_FALSE(Pipeline::toParam(std::optional<int>{}).has_value());
+    REQUIRE(Pipeline::toParam(std::optional<int>{7}) == std::optional<std::string>("7"));
+
+    // 4. add는 문장 순서대로 인덱스 반환
+    Pipeline pipeline;
+    REQUIRE(pipeline.empty());
+    REQUIRE(pipeline.add("SELECT $1", 1) == 0);
+    REQUIRE(pipeline.add("SELECT $1, $2", std::nullopt, "x") == 1);
+    REQUIRE(pipeline.size() == 2);
+}
+
+TEST_CASE("PipelineResult reads integers", "[PipelineExecutor]") {
+    REQUIRE(singleValue("0").readInt64(0, 0) == 0);
+    REQUIRE(singleValue("-42").readInt64(0, 0) == -42);
+    REQUIRE(singleValue("9223372036854775807").readInt64(0, 0) == INT64_MAX);
+
+    // 해석할 수 없는 값, 범위 초과, NULL은 예외
+    REQUIRE_THROWS_AS(singleValue("12abc").readInt64(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(singleValue("1.5").readInt64(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(singleValue("").readInt64(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(singleValue("9223372036854775808").readInt64(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(singleValue(std::nullopt).readInt64(0, 0), std::runtime_error);
+}
+
+TEST_CASE("PipelineResult reads doubles", "[PipelineExecutor]") {
+    REQUIRE(singleValue("1.25").readDouble(0, 0) == 1.25);
+    REQUIRE(singleValue("-3").readDouble(0, 0) == -3.0);
+    REQUIRE(singleValue("1e-7").readDouble(0, 0) == 1e-7);
+
+    // PostgreSQL의 특수 값
+    REQUIRE(std::isnan(singleValue("NaN").readDouble(0, 0)));
+    REQUIRE(singleValue("Infinity").readDouble(0, 0) == HUGE_VAL);
+    REQUIRE(singleValue("-Infinity").readDouble(0, 0) == -HUGE_VAL);
+
+    REQUIRE_THROWS_AS(singleValue("1.5x").readDouble(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(singleValue("").readDouble(0, 0), std::runtime_error);
+    REQUIRE_THROWS_AS(singleValue(std::nullopt).readDouble(0, 0), std::runtime_error);
+}
+
+TEST_CASE("PipelineResult exposes rows, columns and status", "[PipelineExecutor]") {
+    const auto result = makeResult(PGRES_TUPLES_OK, {"id", "active"}, {
+        {std::string("1"), std::string("t")},
+        {std::string("2"), std::nullopt},
+    });
+    REQUIRE(result.succeeded());
+    REQUIRE(result.rows() == 2);
+    REQUIRE(result.columns() == 2);
+    REQUIRE(result.column("active") == 1);
+    REQUIRE_THROWS_AS(result.column("missing"), std::out_of_range);
+    REQUIRE(result.readBool(0, 1));
+    REQUIRE(result.isNull(1, 1));
+    REQUIRE_FALSE(result.isNull(1, 0));
+    REQUIRE(result.value(1, 0) == "2");
+
+    // 실패/중단된 문장
+    REQUIRE_FALSE(makeResult(PGRES_FATAL_ERROR, {}, {}).succeeded());
+#ifdef LIBPQ_HAS_PIPELINING
+    const auto aborted = makeResult(PGRES_PIPELINE_ABORTED, {}, {});
+    REQUIRE_FALSE(aborted.succeeded());
+    REQUIRE_FALSE(aborted.errorMessage().empty());
+#endif
+}
@@ -0,0 +1,91 @@
+#include <catch2/catch.hpp>
+#include "database/StatementRegistry.h"
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+using database::StatementRegistry;
+
+namespace {
+
+    // 받은 SQL과 파라미터를 기록하는 가짜 실행기. fail이면 실행 오류
+    // 실제 DbClient처럼 준비 여부를 묻지 않고 SQL 문자열로 바로 실행
+    struct FakeClient {
+        std::vector<std::tuple<std::string, int64_t>> executed;
+        bool fail = false;
+
+        drogon::orm::Result execSqlSync(const std::string& sql, int64_t id) {
+            if (fail) {
+                throw std::runtime_error("connection lost");
+            }
+            executed.emplace_back(sql, id);
+            return drogon::orm::Result(nullptr);
+        }
+
+        drogon::Task<drogon::orm::Result> execSqlCoro(const std::string& sql, int64_t id) {
+            co_return execSqlSync(sql, id);
+        }
+    };
+
+    // 싱글턴이므로 테스트마다 다른 이름 사용
+    StatementRegistry::Statement& registerLookup(const std::string& name) {
+        return StatementRegistry::getInstance().registerStatement(
+            name, "SELECT * FROM statement_registry_test WHERE id = $1", int64_t{0});
+    }
+
+} // namespace
+
+TEST_CASE("StatementRegistry returns the existing statement for a duplicate name", "[StatementRegistry]") {
+    auto& registry = StatementRegistry::getInstance();
+    auto& first = registerLookup("statement_registry_test.duplicate");
+
+    // 1. 같은 이름, 같은 SQL은 같은 객체 (매퍼가 여러 번 생성되어도 통계가 합쳐짐)
+    auto& again = registerLookup("statement_registry_test.duplicate");
+    REQUIRE(&again == &first);
+
+    // 2. 같은 이름에 다른 SQL은 거부하고 기존 문장은 그대로 유지
+    REQUIRE_THROWS_AS(registry.registerStatement("statement_registry_test.duplicate",
+                                                 "SELECT 1 WHERE $1 = 0", int64_t{0}),
+                      std::logic_error);
+    REQUIRE(first.sql == "SELECT * FROM statement_registry_test WHERE id = $1");
+
+    size_t matches = 0;
+    for (const auto& stats : registry.getStats()) {
+        matches += stats.name == "statement_registry_test.duplicate" ? 1 : 0;
+    }
+    REQUIRE(matches == 1);
+}
+
+TEST_CASE("StatementRegistry executes statements that were never warmed up", "[StatementRegistry]") {
+    auto& statement = registerLookup("statement_registry_test.unprepared");
+    FakeClient client;
+
+    // 1. warmup 없이도 등록된 SQL로 실행하고 호출 수 기록
+    StatementRegistry::execute(client, statement, int64_t{7});
+    REQUIRE(client.executed == std::vector<std::tuple<std::string, int64_t>>{{statement.sql, 7}});
+    REQUIRE(statement.calls == 1);
+    REQUIRE(statement.errors == 0);
+
+    // 2. 실행 오류는 호출자에게 전달하고 오류 수만 증가
+    client.fail = true;
+    REQUIRE_THROWS_AS(StatementRegistry::execute(client, statement, int64_t{8}), std::runtime_error);
+    REQUIRE(statement.calls == 1);
+    REQUIRE(statement.errors == 1);
+}
+
+TEST_CASE("StatementRegistry coroutine execution records the same stats", "[StatementRegistry]") {
+    auto& statement = registerLookup("statement_registry_test.coroutine");
+    auto client = std::make_shared<FakeClient>();
+
+    drogon::sync_wait(StatementRegistry::executeCoro(client, statement, int64_t{3}));
+    REQUIRE(client->executed == std::vector<std::tuple<std::string, int64_t>>{{statement.sql, 3}});
+    REQUIRE(statement.calls == 1);
+
+    client->fail = true;
+    REQUIRE_THROWS_AS(drogon::sync_wait(StatementRegistry::executeCoro(client, statement, int64_t{4})),
+                      std::runtime_error);
+    REQUIRE(statement.calls == 1);
+    REQUIRE(statement.errors == 1);
+}
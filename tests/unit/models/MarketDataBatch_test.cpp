@@ -0,0 +1,59 @@
+#include <catch2/catch.hpp>
+#include "models/MarketDataBatch.h"
+#include "models/MarketDataKernels.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+    // 모든 SIMD 레벨에서 같은 결과가 나오는지 확인하기 위한 헬퍼
+    std::vector<models::kernels::SimdLevel> allLevels() {
+        return {
+            models::kernels::SimdLevel::Scalar,
+            models::kernels::SimdLevel::SSE2,
+            models::kernels::SimdLevel::AVX2
+        };
+    }
+}
+
+TEST_CASE("MarketDataBatch window analytics", "[MarketDataBatch]") {
+    models::MarketDataBatch batch;
+
+    // 1. 빈 배치
+    REQUIRE(batch.empty());
+    REQUIRE(batch.vwap() == 0.0);
+    REQUIRE(batch.returns().empty());
+    REQUIRE_FALSE(batch.findFirstPriceOutside(0.0, 1.0).has_value());
+
+    // 2. 벡터 폭으로 나누어 떨어지지 않는 길이로 꼬리 처리 확인
+    constexpr size_t kRows = 37;
+    for (size_t i = 0; i < kRows; ++i) {
+        batch.append(100.0 + static_cast<double>(i), 1.0 + static_cast<double>(i % 3), static_cast<int64_t>(i));
+    }
+
+    double expectedNotional = 0.0;
+    double expectedVolume = 0.0;
+    for (size_t i = 0; i < kRows; ++i) {
+        expectedNotional += batch.prices()[i] * batch.volumes()[i];
+        expectedVolume += batch.volumes()[i];
+    }
+
+    for (auto level : allLevels()) {
+        models::kernels::setSimdLevel(level);
+
+        REQUIRE(batch.totalVolume() == Approx(expectedVolume));
+        REQUIRE(batch.vwap() == Approx(expectedNotional / expectedVolume));
+
+        auto range = batch.priceRange();
+        REQUIRE(range.min == 100.0);
+        REQUIRE(range.max == 136.0);
+
+        auto returns = batch.returns();
+        REQUIRE(returns.size() == kRows - 1);
+        REQUIRE(returns.back() == Approx(136.0 / 135.0 - 1.0));
+
+        REQUIRE(batch.countPricesAbove(130.0) == 6);
+        REQUIRE(batch.findFirstPriceOutside(90.0, 133.5) == 34u);
+        REQUIRE_FALSE(batch.findFirstPriceOutside(0.0, 1000.0).has_value());
+        REQUIRE(batch.priceChangePercent() == Approx(36.0));
+    }
+}
@@ -0,0 +1,93 @@
+#include <catch2/catch.hpp>
+#include "models/ModelRegistry.h"
+#include <drogon/drogon.h>
+#include <string>
+#include <vector>
+
+// MarketDataMapper_test와 같이 설정된 DB에 연결해 실행 (테이블은 사용하지 않음)
+
+TEST_CASE("ModelRegistry loadOne round-trips a row by column name", "[ModelRegistry]") {
+    auto client = drogon::app().getDbClient();
+
+    models::Order order;
+    order.setId(41);
+    order.setOrderId("REGISTRY-1");
+    order.setSymbol("REGISTRY/BTC");
+    order.setOrderType("LIMIT");
+    order.setSide("SELL");
+    order.setQuantity(0.25);
+    order.setPrice(61000.5);
+    order.setStatus("FILLED");
+    order.setSignalId(9);
+    order.setFilledQuantity(0.25);
+
+    // 컬럼 순서를 섞고 모델에 없는 컬럼을 섞어도 이름으로 매칭, 빠진 컬럼은 기본값 유지
+    auto result = client->execSqlSync(
+        "SELECT $1::text AS side, $2::bigint AS id, 'ignored' AS unknown_column, $3::text AS order_id, "
+        "$4::text AS symbol, $5::text AS order_type, $6::numeric AS quantity, $7::numeric AS price, "
+        "$8::text AS status, $9::bigint AS signal_id, $10::numeric AS filled_quantity, "
+        "NULL::text AS error_message",
+        order.getSide(), order.getId(), order.getOrderId(), order.getSymbol(), order.getOrderType(),
+        order.getQuantity(), order.getPrice(), order.getStatus(), order.getSignalId(),
+        order.getFilledQuantity());
+    REQUIRE(result.size() == 1);
+
+    const auto loaded = models::ModelRegistry::loadOne<models::Order>(result[0]);
+    REQUIRE(loaded.getId() == order.getId());
+    REQUIRE(loaded.getOrderId() == order.getOrderId());
+    REQUIRE(loaded.getSymbol() == order.getSymbol());
+    REQUIRE(loaded.getOrderType() == order.getOrderType());
+    REQUIRE(loaded.getSide() == order.getSide());
+    REQUIRE(loaded.getQuantity() == Approx(order.getQuantity()));
+    REQUIRE(loaded.getPrice() == Approx(order.getPrice()));
+    REQUIRE(loaded.getStatus() == order.getStatus());
+    REQUIRE(loaded.getSignalId() == order.getSignalId());
+    REQUIRE(loaded.getFilledQuantity() == Approx(order.getFilledQuantity()));
+    REQUIRE(loaded.getFilledPrice() == 0.0);         // 결과셋에 없음
+    REQUIRE(loaded.getErrorMessage().empty());       // NULL
+}
+
+TEST_CASE("ModelRegistry loadAll decodes every row in order", "[ModelRegistry]") {
+    auto client = drogon::app().getDbClient();
+
+    // 1. 값 타입 모델: 행 순서대로 연속 벡터에 디코딩
+    auto users = client->execSqlSync(
+        "SELECT * FROM (VALUES (1::bigint, 'a@registry.test', 'alice', true), "
+        "(2::bigint, 'b@registry.test', 'bob', false), "
+        "(3::bigint, 'c@registry.test', 'carol', true)) AS u(id, email, username, is_active) ORDER BY id");
+    const auto loaded = models::ModelRegistry::loadAll<models::User>(users);
+    REQUIRE(loaded.size() == 3);
+    REQUIRE(loaded[0].getEmail() == "a@registry.test");
+    REQUIRE(loaded[1].getUsername() == "bob");
+    REQUIRE_FALSE(loaded[1].isActive());
+    REQUIRE(loaded[2].getId() == 3);
+    REQUIRE(loaded[2].getPasswordHash().empty());
+
+    // 2. loadInto는 기존 원소 뒤에 추가
+    std::vector<models::User> page(loaded.begin(), loaded.begin() + 1);
+    models::ModelRegistry::loadInto<models::User>(users, page);
+    REQUIRE(page.size() == 4);
+    REQUIRE(page[0].getId() == 1);
+    REQUIRE(page[3].getId() == 3);
+
+    // 3. 풀 할당 모델: 행마다 별도 객체
+    auto prices = client->execSqlSync(
+        "SELECT * FROM (VALUES (10::bigint, 'REGISTRY/ETH', 3000.5::numeric, 2::numeric, 'test'), "
+        "(11::bigint, 'REGISTRY/ETH', 3001.0::numeric, 1.5::numeric, 'test')) "
+        "AS m(id, symbol, price, volume, source) ORDER BY id");
+    const auto ticks = models::ModelRegistry::loadAll<models::MarketData>(prices);
+    REQUIRE(ticks.size() == 2);
+    REQUIRE(ticks[0] != ticks[1]);
+    REQUIRE(ticks[0]->getId() == 10);
+    REQUIRE(ticks[0]->getSymbol() == "REGISTRY/ETH");
+    REQUIRE(ticks[1]->getPrice() == Approx(3001.0));
+    REQUIRE(ticks[1]->getVolume() == Approx(1.5));
+}
+
+TEST_CASE("ModelRegistry loadAll returns nothing for an empty result", "[ModelRegistry]") {
+    auto client = drogon::app().getDbClient();
+    auto empty = client->execSqlSync("SELECT 1::bigint AS id, 'x' AS email WHERE false");
+    REQUIRE(models::ModelRegistry::loadAll<models::User>(empty).empty());
+    REQUIRE(models::ModelRegistry::loadAll<models::MarketData>(empty).empty());
+    REQUIRE(models::ModelRegistry::name<models::UserSettings>() == "user_settings");
+}
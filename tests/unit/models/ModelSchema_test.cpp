@@ -0,0 +1,50 @@
+#include <catch2/catch.hpp>
+#include "models/Order.h"
+#include "models/User.h"
+#include "models/ModelSchema.h"
+#include <string>
+
+TEST_CASE("ModelSchema statement builders", "[ModelSchema]") {
+    using namespace models;
+
+    // 1. INSERT는 INSERT 플래그 컬럼만 순서대로 바인딩
+    REQUIRE(schema::insertSql<User>() ==
+        "INSERT INTO users (email, username, password_hash, is_active, last_login_at) "
+        "VALUES ($1, $2, $3, $4, $5) RETURNING *");
+
+    // 2. UPDATE는 SET 컬럼 뒤에 키가 마지막 파라미터, NOW_ON_UPDATE 컬럼은 CURRENT_TIMESTAMP
+    REQUIRE(schema::updateSql<Order>() ==
+        "UPDATE orders SET order_id = $1, symbol = $2, order_type = $3, side = $4, "
+        "quantity = $5, price = $6, status = $7, signal_id = $8, filled_quantity = $9, "
+        "filled_price = $10, error_message = $11, timestamp = $12, "
+        "updated_at = CURRENT_TIMESTAMP WHERE id = $13");
+
+    // 3. 파라미터 tuple 크기와 키 위치
+    Order order;
+    order.setId(7);
+    order.setSymbol("SCHEMA/BTC");
+    auto params = schema::updateParams(order);
+    STATIC_REQUIRE(std::tuple_size_v<decltype(params)> == 13);
+    REQUIRE(std::get<1>(params) == "SCHEMA/BTC");
+    REQUIRE(std::get<12>(params) == 7);
+}
+
+TEST_CASE("ModelSchema JSON serialization", "[ModelSchema]") {
+    models::User user;
+    user.setId(3);
+    user.setEmail("a@b.c");
+    user.setUsername("alice");
+    user.setPasswordHash("secret");
+
+    // JSON 플래그가 없는 password_hash는 두 경로 모두에서 제외
+    auto json = user.toJson();
+    REQUIRE(json["id"].asInt64() == 3);
+    REQUIRE(json["username"].asString() == "alice");
+    REQUIRE_FALSE(json.isMember("password_hash"));
+
+    auto streamed = utils::JsonUtils::parseJson(user.toJsonString());
+    REQUIRE(streamed.getMemberNames() == json.getMemberNames());
+    REQUIRE(streamed["id"] == json["id"]);
+    REQUIRE(streamed["email"] == json["email"]);
+    REQUIRE(streamed["is_active"] == json["is_active"]);
+}
@@ -0,0 +1,137 @@
+#include <catch2/catch.hpp>
+#include "models/SchemaBatch.h"
+#include "models/Order.h"
+#include "models/User.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace models;
+
+TEST_CASE("SchemaBatch bigint array literal", "[SchemaBatch]") {
+    // 1. 빈 배열
+    REQUIRE(schema::bigintArray(std::vector<int64_t>{}) == "{}");
+
+    // 2. 입력 순서 유지, 음수와 int64 경계값
+    REQUIRE(schema::bigintArray(std::vector<int64_t>{7}) == "{7}");
+    REQUIRE(schema::bigintArray(std::vector<int64_t>{1, -2, 3}) == "{1,-2,3}");
+    REQUIRE(schema::bigintArray(std::vector<int64_t>{INT64_MIN, 0, INT64_MAX}) ==
+        "{-9223372036854775808,0,9223372036854775807}");
+}
+
+namespace {
+
+    // execSqlSync 호출마다 SQL과 배열 파라미터를 기록하는 가짜 실행기
+    struct RecordingExecutor {
+        struct Result {
+            size_t rows;
+            size_t affectedRows() const { return rows; }
+        };
+
+        struct Call {
+            std::string sql;
+            std::vector<std::string> params;
+        };
+        std::vector<Call> calls;
+
+        template <typename... Params>
+        Result execSqlSync(const std::string& sql, const Params&... params) {
+            calls.push_back(Call{sql, {params...}});
+            // 첫 배열의 원소 수를 영향받은 행 수로 보고
+            const std::string& first = calls.back().params.front();
+            size_t rows = first == "{}" ? 0 : 1;
+            for (char c : first) {
+                rows += c == ',' ? 1 : 0;
+            }
+            return Result{rows};
+        }
+    };
+
+    std::vector<User> makeUsers(size_t count, size_t passwordBytes = 1) {
+        std::vector<User> users(count);
+        for (size_t i = 0; i < count; ++i) {
+            users[i].setId(static_cast<int64_t>(i + 1));
+            users[i].setEmail("u" + std::to_string(i + 1));
+            users[i].setUsername("n");
+            users[i].setPasswordHash(std::string(passwordBytes, 'p'));
+        }
+        return users;
+    }
+
+} // namespace
+
+TEST_CASE("SchemaBatch statement text", "[SchemaBatch]") {
+    // 1. INSERT: INSERT 플래그 컬럼마다 배열 파라미터 하나, $1부터 순서대로
+    REQUIRE(schema::batchInsertSql<User>() ==
+        "INSERT INTO users (\"email\", \"username\", \"password_hash\", \"is_active\", \"last_login_at\") "
+        "SELECT * FROM unnest($1::text[], $2::text[], $3::text[], $4::boolean[], $5::timestamptz[])");
+
+    // 2. UPDATE: SET 컬럼 다음 키가 마지막 파라미터, NOW_ON_UPDATE 컬럼은 배열 없이 CURRENT_TIMESTAMP
+    REQUIRE(schema::batchUpdateSql<User>() ==
+        "UPDATE users AS t SET \"email\" = u.\"email\", \"username\" = u.\"username\", "
+        "\"password_hash\" = u.\"password_hash\", \"is_active\" = u.\"is_active\", "
+        "\"last_login_at\" = u.\"last_login_at\" "
+        "FROM unnest($1::text[], $2::text[], $3::text[], $4::boolean[], $5::timestamptz[], $6::bigint[]) "
+        "AS u(\"email\", \"username\", \"password_hash\", \"is_active\", \"last_login_at\", \"id\") "
+        "WHERE t.\"id\" = u.\"id\"");
+
+    const std::string& orderUpdate = schema::batchUpdateSql<Order>();
+    REQUIRE(orderUpdate.find("\"updated_at\" = CURRENT_TIMESTAMP FROM unnest(") != std::string::npos);
+    REQUIRE(orderUpdate.find("$12::timestamptz[], $13::bigint[]) AS u(") != std::string::npos);
+    REQUIRE(orderUpdate.find("$14") == std::string::npos);
+
+    // 3. 캐시된 같은 문자열을 반환
+    REQUIRE(&schema::batchInsertSql<User>() == &schema::batchInsertSql<User>());
+}
+
+TEST_CASE("SchemaBatch splits rows across statements", "[SchemaBatch]") {
+    constexpr size_t MAX_ROWS = common::BatchConfig::MAX_ROWS_PER_STATEMENT;
+    auto& statement = schema::batchInsertStatement<User>();
+    const uint64_t callsBefore = statement.calls;
+
+    // 1. 빈 입력은 실행하지 않음
+    RecordingExecutor empty;
+    REQUIRE(schema::execBatchInsert(empty, std::vector<User>{}) == 0);
+    REQUIRE(empty.calls.empty());
+
+    // 2. 정확히 상한만큼이면 한 번, 빈 꼬리 문장 없음
+    RecordingExecutor exact;
+    REQUIRE(schema::execBatchInsert(exact, makeUsers(MAX_ROWS)) == MAX_ROWS);
+    REQUIRE(exact.calls.size() == 1);
+
+    // 3. 상한 + 1행: 두 문장 모두 같은 SQL과 $1..$5 파라미터 5개, 두 번째 배열은 새로 시작
+    RecordingExecutor split;
+    REQUIRE(schema::execBatchInsert(split, makeUsers(MAX_ROWS + 1)) == MAX_ROWS + 1);
+    REQUIRE(split.calls.size() == 2);
+    for (const auto& call : split.calls) {
+        REQUIRE(call.sql == schema::batchInsertSql<User>());
+        REQUIRE(call.params.size() == 5);
+    }
+    REQUIRE(split.calls[0].params[0].rfind("{\"u1\",\"u2\",", 0) == 0);
+    REQUIRE(split.calls[0].params[0].substr(split.calls[0].params[0].size() - 9) == ",\"u5000\"}");
+    REQUIRE(split.calls[1].params[0] == "{\"u5001\"}");
+    REQUIRE(split.calls[1].params[2] == "{\"p\"}");
+    REQUIRE(split.calls[1].params[3] == "{t}");
+
+    // 4. 모든 청크가 등록된 "users.batch_insert" 문장으로 실행되어 호출 수에 집계
+    REQUIRE(statement.name == "users.batch_insert");
+    REQUIRE(statement.calls == callsBefore + 3);
+}
+
+TEST_CASE("SchemaBatch keeps update keys aligned across statements", "[SchemaBatch]") {
+    // 배열 크기 상한: 1MiB 해시 8개면 8MiB를 넘어 다음 행은 새 문장으로
+    const auto users = makeUsers(9, 1024 * 1024);
+    RecordingExecutor executor;
+    REQUIRE(schema::execBatchUpdate(executor, users) == 9);
+    REQUIRE(executor.calls.size() == 2);
+
+    // 키는 매 문장의 마지막 파라미터($6)이고 같은 문장의 값 배열과 행 순서가 같음
+    for (const auto& call : executor.calls) {
+        REQUIRE(call.sql == schema::batchUpdateSql<User>());
+        REQUIRE(call.params.size() == 6);
+    }
+    REQUIRE(executor.calls[0].params[0] == "{\"u1\",\"u2\",\"u3\",\"u4\",\"u5\",\"u6\",\"u7\",\"u8\"}");
+    REQUIRE(executor.calls[0].params[5] == "{1,2,3,4,5,6,7,8}");
+    REQUIRE(executor.calls[1].params[0] == "{\"u9\"}");
+    REQUIRE(executor.calls[1].params[5] == "{9}");
+}
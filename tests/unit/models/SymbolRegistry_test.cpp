@@ -0,0 +1,102 @@
+#include <catch2/catch.hpp>
+#include "models/SymbolRegistry.h"
+#include "models/MarketData.h"
+#include "models/Order.h"
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+TEST_CASE("SymbolRegistry interning", "[SymbolRegistry]") {
+    auto& registry = models::SymbolRegistry::getInstance();
+
+    // 1. 같은 심볼은 항상 같은 id
+    auto btc = registry.intern("REG/BTC");
+    auto eth = registry.intern("REG/ETH");
+    REQUIRE(btc != eth);
+    REQUIRE(registry.intern("REG/BTC") == btc);
+    REQUIRE(registry.name(btc) == "REG/BTC");
+
+    // 2. id는 조밀하게 발급되어 배열 인덱스로 사용 가능
+    REQUIRE(btc < registry.size());
+    REQUIRE(eth < registry.size());
+
+    // 3. find는 등록하지 않음
+    auto sizeBefore = registry.size();
+    REQUIRE_FALSE(registry.find("REG/UNKNOWN").has_value());
+    REQUIRE(registry.size() == sizeBefore);
+    REQUIRE(registry.find("REG/ETH") == eth);
+
+    // 4. 잘못된 입력 처리
+    REQUIRE(registry.intern("") == models::SymbolRegistry::INVALID_ID);
+    REQUIRE_THROWS_AS(registry.intern(std::string(64, 'X')), std::invalid_argument);
+    REQUIRE_THROWS_AS(registry.name(models::SymbolRegistry::INVALID_ID), std::out_of_range);
+}
+
+TEST_CASE("SymbolRegistry validates at the boundary and never throws from setters", "[SymbolRegistry]") {
+    using models::SymbolRegistry;
+    auto& registry = SymbolRegistry::getInstance();
+    const std::string longest(SymbolRegistry::MAX_SYMBOL_LENGTH, 'V');
+    const std::string tooLong(SymbolRegistry::MAX_SYMBOL_LENGTH + 1, 'V');
+
+    // 1. 경계 검증: 빈 문자열과 길이 초과만 거부
+    REQUIRE_NOTHROW(SymbolRegistry::validate(longest));
+    REQUIRE_THROWS_AS(SymbolRegistry::validate(""), std::invalid_argument);
+    REQUIRE_THROWS_AS(SymbolRegistry::validate(tooLong), std::invalid_argument);
+
+    // 2. tryIntern은 intern과 같은 id, 등록할 수 없으면 INVALID_ID
+    REQUIRE(registry.tryIntern(longest) == registry.intern(longest));
+    REQUIRE(registry.tryIntern("") == SymbolRegistry::INVALID_ID);
+    REQUIRE(registry.tryIntern(tooLong) == SymbolRegistry::INVALID_ID);
+
+    // 3. 모델 setter는 최대 길이 심볼을 자르지 않고, 검증을 거치지 않은 긴 심볼에도 예외 없음
+    models::MarketData data;
+    data.setSymbol(longest);
+    REQUIRE(data.getSymbol() == longest);
+    REQUIRE(data.getSymbolId() == registry.intern(longest));
+    REQUIRE(models::MarketData(data).getSymbol() == longest);
+
+    REQUIRE_NOTHROW(data.setSymbol(tooLong));
+    REQUIRE(data.getSymbolId() == SymbolRegistry::INVALID_ID);
+
+    models::Order order;
+    REQUIRE_NOTHROW(order.setSymbol(tooLong));
+    REQUIRE(order.getSymbolId() == SymbolRegistry::INVALID_ID);
+
+    // 4. JSON 입력은 경계에서 거부
+    Json::Value json;
+    json["symbol"] = tooLong;
+    json["order_type"] = "MARKET";
+    json["side"] = "BUY";
+    json["quantity"] = 1.0;
+    REQUIRE_THROWS_AS(models::Order().fromJson(json), std::invalid_argument);
+    REQUIRE_THROWS_AS(models::MarketData::create(tooLong, 1.0, 1.0, "test"), std::invalid_argument);
+}
+
+TEST_CASE("SymbolRegistry concurrent intern", "[SymbolRegistry]") {
+    auto& registry = models::SymbolRegistry::getInstance();
+    constexpr int kThreads = 4;
+    constexpr int kSymbols = 64;
+
+    std::vector<std::vector<models::SymbolId>> ids(kThreads);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kThreads; ++t) {
+        threads.emplace_back([&ids, t]() {
+            auto& reg = models::SymbolRegistry::getInstance();
+            for (int i = 0; i < kSymbols; ++i) {
+                ids[t].push_back(reg.intern("CONC/" + std::to_string(i)));
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // 모든 스레드가 같은 심볼에 대해 같은 id를 받아야 함
+    for (int t = 1; t < kThreads; ++t) {
+        REQUIRE(ids[t] == ids[0]);
+    }
+    for (int i = 0; i < kSymbols; ++i) {
+        REQUIRE(registry.name(ids[0][i]) == "CONC/" + std::to_string(i));
+    }
+}
@@ -0,0 +1,88 @@
+#include <catch2/catch.hpp>
+#include "models/TradingParams.h"
+#include "utils/JsonUtils.h"
+#include <stdexcept>
+#include <string>
+
+using namespace models;
+
+namespace {
+
+    Json::Value parse(const std::string& text) {
+        return utils::JsonUtils::parseJson(text);
+    }
+
+} // namespace
+
+TEST_CASE("TradingParams missing values fall back to defaults", "[TradingParams]") {
+    // 1. NULL 컬럼은 빈 설정
+    const auto strategy = StrategyParams::fromJson(Json::Value());
+    REQUIRE(strategy.strategyType.empty());
+    REQUIRE(strategy.maPeriod == 0);
+    REQUIRE(strategy.extra.empty());
+    REQUIRE(strategy.numeric("threshold", 1.5) == 1.5);
+
+    const auto risk = RiskParams::fromJson(Json::Value());
+    REQUIRE(risk.allowsPosition(1e12));
+    REQUIRE(risk.stopLossPrice(100.0, true) == 0.0);
+    REQUIRE(risk.takeProfitPrice(100.0, false) == 0.0);
+
+    REQUIRE(Watchlist::fromJson(Json::Value()).empty());
+
+    // 2. 빠진 키와 null 값은 0 (제한 없음)
+    const auto partial = RiskParams::fromJson(parse(R"({"stop_loss_pct": 2, "take_profit_pct": null})"));
+    REQUIRE(partial.maxPositionSize == 0.0);
+    REQUIRE(partial.stopLossPct == 2.0);
+    REQUIRE(partial.takeProfitPct == 0.0);
+    REQUIRE(partial.stopLossPrice(100.0, true) == Approx(98.0));
+    REQUIRE(partial.stopLossPrice(100.0, false) == Approx(102.0));
+
+    const auto periods = StrategyParams::fromJson(parse(R"({"strategy_type": "ma", "rsi_period": null})"));
+    REQUIRE(periods.strategyType == "ma");
+    REQUIRE(periods.maPeriod == 0);
+    REQUIRE(periods.rsiPeriod == 0);
+}
+
+TEST_CASE("TradingParams keeps extra numeric strategy values sorted", "[TradingParams]") {
+    const auto strategy = StrategyParams::fromJson(parse(
+        R"({"strategy_type": "rsi", "ma_period": 20, "zeta": 3, "alpha": 0.5, "label": "x", "nested": {}})"));
+    REQUIRE(strategy.maPeriod == 20);
+    REQUIRE(strategy.extra == std::vector<std::pair<std::string, double>>{{"alpha", 0.5}, {"zeta", 3.0}});
+    REQUIRE(strategy.numeric("alpha", 0.0) == 0.5);
+    REQUIRE(strategy.numeric("label", -1.0) == -1.0);   // 숫자가 아닌 값은 무시
+}
+
+TEST_CASE("TradingParams rejects invalid values", "[TradingParams]") {
+    // 1. 전략: 객체가 아님, 문자열이 아닌 타입, 정수가 아니거나 범위를 벗어난 기간
+    REQUIRE_THROWS_AS(StrategyParams::fromJson(parse("[1, 2]")), std::invalid_argument);
+    REQUIRE_THROWS_AS(StrategyParams::fromJson(parse(R"({"strategy_type": 5})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(StrategyParams::fromJson(parse(R"({"ma_period": 2.5})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(StrategyParams::fromJson(parse(R"({"ma_period": "20"})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(StrategyParams::fromJson(parse(R"({"rsi_period": -1})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(StrategyParams::fromJson(parse(R"({"rsi_period": 100001})")), std::invalid_argument);
+
+    // 2. 리스크: 숫자가 아님, 음수, 100% 이상 손절
+    REQUIRE_THROWS_AS(RiskParams::fromJson(parse(R"("tight")")), std::invalid_argument);
+    REQUIRE_THROWS_AS(RiskParams::fromJson(parse(R"({"max_position_size": "10"})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(RiskParams::fromJson(parse(R"({"take_profit_pct": -5})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(RiskParams::fromJson(parse(R"({"stop_loss_pct": 100})")), std::invalid_argument);
+
+    // 3. 관심 종목: 배열이 아님, 빈 문자열, 문자열이 아닌 항목, 길이 초과
+    REQUIRE_THROWS_AS(Watchlist::fromJson(parse(R"({"BTC/USDT": true})")), std::invalid_argument);
+    REQUIRE_THROWS_AS(Watchlist::fromJson(parse(R"(["BTC/USDT", ""])")), std::invalid_argument);
+    REQUIRE_THROWS_AS(Watchlist::fromJson(parse(R"(["BTC/USDT", 7])")), std::invalid_argument);
+    const std::string tooLong(SymbolRegistry::MAX_SYMBOL_LENGTH + 1, 'X');
+    REQUIRE_THROWS_AS(Watchlist::fromJson(parse("[\"" + tooLong + "\"]")), std::invalid_argument);
+}
+
+TEST_CASE("TradingParams watchlist resolves symbols once", "[TradingParams]") {
+    const auto watchlist = Watchlist::fromJson(parse(R"(["PARAMS/ETH", "PARAMS/BTC", "PARAMS/ETH"])"));
+    auto& registry = SymbolRegistry::getInstance();
+
+    // 원본 목록은 유지하고 id는 정렬 후 중복 제거
+    REQUIRE(watchlist.symbols == std::vector<std::string>{"PARAMS/ETH", "PARAMS/BTC", "PARAMS/ETH"});
+    REQUIRE(watchlist.symbolIds.size() == 2);
+    REQUIRE(watchlist.contains(registry.intern("PARAMS/BTC")));
+    REQUIRE(watchlist.contains(registry.intern("PARAMS/ETH")));
+    REQUIRE_FALSE(watchlist.contains(registry.intern("PARAMS/XRP")));
+}
@@ -0,0 +1,62 @@
+#include <catch2/catch.hpp>
+#include "models/wire/OrderWire.h"
+#include "models/wire/MarketDataWire.h"
+#include <cstring>
+#include <vector>
+
+using namespace models;
+
+TEST_CASE("Order wire round-trip is lossless", "[WireFormat]") {
+    Order order;
+    order.setId(42);
+    order.setSignalId(7);
+    order.setOrderId("ord-1");
+    order.setSymbol("BTCUSDT");
+    order.setOrderType("LIMIT");
+    order.setSide("BUY");
+    order.setQuantity(0.1 + 0.2);
+    order.setPrice(43210.123456789);
+    order.setStatus("NEW");
+
+    std::vector<uint8_t> buffer(wire::encodedSize(order));
+    const size_t written = wire::encode(order, buffer.data(), buffer.size());
+    REQUIRE(written == buffer.size());
+    REQUIRE(wire::peekType(buffer.data(), buffer.size()) == wire::MessageType::Order);
+
+    // 1. 뷰는 버퍼에서 바로 읽음 (double 비트 단위 일치)
+    wire::OrderView view(buffer.data(), buffer.size());
+    REQUIRE(view.id() == 42);
+    REQUIRE(view.signalId() == 7);
+    REQUIRE(view.symbol() == "BTCUSDT");
+    REQUIRE(view.errorMessage().empty());
+    const double quantity = view.quantity();
+    const double expected = 0.1 + 0.2;
+    REQUIRE(std::memcmp(&quantity, &expected, sizeof(double)) == 0);
+
+    // 2. 모델 복원
+    Order decoded = view.toModel();
+    REQUIRE(decoded.getOrderId() == "ord-1");
+    REQUIRE(decoded.getPrice() == order.getPrice());
+    REQUIRE(decoded.getStatus() == "NEW");
+}
+
+TEST_CASE("Wire decoding rejects malformed buffers", "[WireFormat]") {
+    auto data = MarketData::create("ETHUSDT", 2500.5, 12.0, "binance");
+
+    std::vector<uint8_t> buffer(wire::encodedSize(*data));
+    wire::encode(*data, buffer.data(), buffer.size());
+    REQUIRE(wire::MarketDataView(buffer.data(), buffer.size()).source() == "binance");
+
+    // 1. 작은 버퍼에 인코딩
+    std::vector<uint8_t> small(buffer.size() - 1);
+    REQUIRE_THROWS_AS(wire::encode(*data, small.data(), small.size()), std::length_error);
+
+    // 2. 잘린 메시지, 다른 타입
+    REQUIRE_THROWS_AS(wire::MarketDataView(buffer.data(), buffer.size() - 1), std::invalid_argument);
+    REQUIRE_THROWS_AS(wire::OrderView(buffer.data(), buffer.size()), std::invalid_argument);
+
+    // 3. 범위를 벗어난 문자열 참조
+    wire::StringRef bad{static_cast<uint32_t>(buffer.size()), 4};
+    std::memcpy(buffer.data() + sizeof(wire::WireHeader) + offsetof(wire::MarketDataRecord, symbol), &bad, sizeof(bad));
+    REQUIRE_THROWS_AS(wire::MarketDataView(buffer.data(), buffer.size()), std::invalid_argument);
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch.hpp>
+#include "repositories/BaseRepository.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace {
+
+    struct Row {
+        int64_t id;
+        std::string name;
+        int64_t getId() const { return id; }
+    };
+
+    // 보호된 배치 조회 보조 함수만 노출
+    struct TestRepository : repositories::BaseRepository<Row> {
+        using BaseRepository::uniqueIds;
+        using BaseRepository::orderByIds;
+    };
+
+    std::vector<int64_t> idsOf(const std::vector<Row>& rows) {
+        std::vector<int64_t> ids;
+        for (const auto& row : rows) {
+            ids.push_back(row.id);
+        }
+        return ids;
+    }
+
+} // namespace
+
+TEST_CASE("BaseRepository uniqueIds keeps first occurrences", "[BaseRepository]") {
+    REQUIRE(TestRepository::uniqueIds(std::vector<int64_t>{}).empty());
+    REQUIRE(TestRepository::uniqueIds(std::vector<int64_t>{5, 3, 5, 1, 3, 3}) == std::vector<int64_t>{5, 3, 1});
+    REQUIRE(TestRepository::uniqueIds(std::vector<int64_t>{-1, 0, -1}) == std::vector<int64_t>{-1, 0});
+}
+
+TEST_CASE("BaseRepository orderByIds restores request order", "[BaseRepository]") {
+    // 1. DB 순서와 무관하게 ids 순서, 없는 id는 생략
+    const auto ordered = TestRepository::orderByIds({3, 9, 1, 2},
+        {Row{1, "a"}, Row{2, "b"}, Row{3, "c"}});
+    REQUIRE(idsOf(ordered) == std::vector<int64_t>{3, 1, 2});
+    REQUIRE(ordered[0].name == "c");
+
+    // 2. ids에 없는 행은 버림
+    REQUIRE(idsOf(TestRepository::orderByIds({2}, {Row{1, "a"}, Row{2, "b"}})) == std::vector<int64_t>{2});
+    REQUIRE(TestRepository::orderByIds({}, {Row{1, "a"}}).empty());
+}
@@ -0,0 +1,145 @@
+#include <catch2/catch.hpp>
+#include "repositories/CandleAggregator.h"
+#include "models/SymbolRegistry.h"
+#include <cmath>
+#include <limits>
+
+using repositories::CandleAggregator;
+using models::BarResolution;
+
+namespace {
+
+    constexpr int64_t SECOND = 1000000;
+    constexpr int64_t MINUTE = 60 * SECOND;
+    constexpr int64_t T0 = 1699920000LL * SECOND;       // UTC 자정 (일 봉 경계)
+
+} // namespace
+
+TEST_CASE("CandleAggregator builds bars incrementally", "[CandleAggregator]") {
+    auto& aggregator = CandleAggregator::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CANDLE-BUILD");
+
+    // 진행 중인 구간 안의 순서 뒤바뀐 틱: open/close는 timestamp 기준
+    aggregator.onTick(id, T0 + SECOND / 2, 100.0, 1.0);
+    aggregator.onTick(id, T0 + 30 * SECOND, 105.0, 2.0);
+    aggregator.onTick(id, T0 + 10 * SECOND, 95.0, 1.0);
+    aggregator.onTick(id, T0 + MINUTE + SECOND, 110.0, 1.0);
+
+    // 1. 첫 구간은 메모리 보유 범위 밖 (프로세스 시작 전 틱이 있을 수 있음) -> 미기록 델타로 제공
+    const auto range = aggregator.getBars(id, BarResolution::M1, T0, T0 + 2 * MINUTE);
+    REQUIRE(range.coveredFromMicros == T0 + MINUTE);
+    REQUIRE(range.bars.size() == 1);
+    REQUIRE(range.bars[0].openTimeMicros == T0 + MINUTE);
+    REQUIRE(range.bars[0].close == Approx(110.0));
+    REQUIRE(range.unflushed.size() == 1);
+    const auto& first = range.unflushed[0];
+    REQUIRE(first.open == Approx(100.0));
+    REQUIRE(first.high == Approx(105.0));
+    REQUIRE(first.low == Approx(95.0));
+    REQUIRE(first.close == Approx(105.0));
+    REQUIRE(first.volume == Approx(4.0));
+    REQUIRE(first.tickCount == 3);
+
+    // 2. 일 봉은 모든 틱을 포함
+    const auto daily = aggregator.openBar(id, BarResolution::D1);
+    REQUIRE(daily.has_value());
+    REQUIRE(daily->openTimeMicros == T0);
+    REQUIRE(daily->tickCount == 4);
+    REQUIRE(daily->open == Approx(100.0));
+    REQUIRE(daily->close == Approx(110.0));
+
+    // 3. 제약을 어기는 틱과 등록되지 않은 id는 무시
+    aggregator.onTick(id, T0 + MINUTE + 2 * SECOND, 0.0, 1.0);
+    aggregator.onTick(id, T0 + MINUTE + 2 * SECOND, std::nan(""), 1.0);
+    aggregator.onTick(models::SymbolRegistry::INVALID_ID, T0, 1.0, 1.0);
+    REQUIRE(aggregator.openBar(id, BarResolution::D1)->tickCount == 4);
+
+    aggregator.discard(id);
+    REQUIRE_FALSE(aggregator.openBar(id, BarResolution::M1).has_value());
+}
+
+TEST_CASE("CandleAggregator folds late ticks", "[CandleAggregator]") {
+    auto& aggregator = CandleAggregator::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CANDLE-LATE");
+
+    aggregator.onTick(id, T0 + 5 * SECOND, 10.0, 1.0);
+    aggregator.onTick(id, T0 + MINUTE + 5 * SECOND, 11.0, 1.0);
+    aggregator.onTick(id, T0 + 3 * MINUTE + 5 * SECOND, 13.0, 1.0);
+
+    // 마감된 봉에 반영, 틱이 없던 구간에는 봉을 끼워 넣음, 보유 범위 밖은 델타에만 반영
+    aggregator.onTick(id, T0 + MINUTE + 10 * SECOND, 9.0, 1.0);
+    aggregator.onTick(id, T0 + 2 * MINUTE + 10 * SECOND, 12.0, 1.0);
+    aggregator.onTick(id, T0 + 10 * SECOND, 8.0, 1.0);
+
+    const auto range = aggregator.getBars(id, BarResolution::M1, T0, T0 + 4 * MINUTE);
+    REQUIRE(range.bars.size() == 3);
+    REQUIRE(range.bars[0].openTimeMicros == T0 + MINUTE);
+    REQUIRE(range.bars[0].tickCount == 2);
+    REQUIRE(range.bars[0].open == Approx(11.0));
+    REQUIRE(range.bars[0].close == Approx(9.0));
+    REQUIRE(range.bars[0].low == Approx(9.0));
+    REQUIRE(range.bars[1].openTimeMicros == T0 + 2 * MINUTE);
+    REQUIRE(range.bars[2].openTimeMicros == T0 + 3 * MINUTE);
+    REQUIRE(range.unflushed.size() == 1);
+    REQUIRE(range.unflushed[0].tickCount == 2);
+    REQUIRE(range.unflushed[0].close == Approx(8.0));
+
+    aggregator.discard(id);
+}
+
+TEST_CASE("CandleAggregator evicts old bars and raises coverage", "[CandleAggregator]") {
+    auto& aggregator = CandleAggregator::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CANDLE-EVICT");
+
+    const int64_t ticks = CandleAggregator::RECENT_BARS + 88;
+    for (int64_t i = 0; i < ticks; ++i) {
+        aggregator.onTick(id, T0 + i * SECOND, 100.0 + static_cast<double>(i), 1.0);
+    }
+
+    // 마감 봉 RECENT_BARS개 + 진행 중인 봉 1개
+    const auto range = aggregator.getBars(id, BarResolution::S1, T0, T0 + ticks * SECOND);
+    const int64_t firstKept = ticks - 1 - static_cast<int64_t>(CandleAggregator::RECENT_BARS);
+    REQUIRE(range.coveredFromMicros == T0 + firstKept * SECOND);
+    REQUIRE(range.bars.size() == CandleAggregator::RECENT_BARS + 1);
+    REQUIRE(range.bars.front().openTimeMicros == T0 + firstKept * SECOND);
+    REQUIRE(range.bars.back().openTimeMicros == T0 + (ticks - 1) * SECOND);
+
+    // 보유 범위 앞부분 조회는 미기록 델타로 채움
+    REQUIRE(range.unflushed.size() == static_cast<size_t>(firstKept));
+
+    aggregator.discard(id);
+}
+
+TEST_CASE("CandleAggregator hands out closed deltas", "[CandleAggregator]") {
+    auto& aggregator = CandleAggregator::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CANDLE-FLUSH");
+
+    aggregator.onTick(id, T0 + SECOND, 100.0, 1.0);
+    aggregator.onTick(id, T0 + 2 * SECOND, 101.0, 1.0);
+    aggregator.onTick(id, T0 + 10 * MINUTE, 102.0, 1.0);
+    const size_t pendingBefore = aggregator.getStats().pending;
+
+    // 1. 구간 종료 + grace가 지난 1s/1m/5m 델타만 (1h/1d와 10분 시점 틱의 1s/1m/5m 봉은 아직 진행 중)
+    const auto ready = aggregator.takeReadyDeltas(T0 + 10 * MINUTE);
+    REQUIRE(ready.size() == 4);     // 1s x2, 1m x1, 5m x1
+    for (const auto& bar : ready) {
+        REQUIRE(bar.closeTimeMicros() <= T0 + 10 * MINUTE);
+    }
+    REQUIRE(aggregator.getStats().pending == pendingBefore - ready.size());
+
+    // 2. 기록 실패 시 되돌리면 이후 틱과 합쳐짐
+    aggregator.restoreDeltas(ready);
+    aggregator.onTick(id, T0 + 30 * SECOND, 99.0, 3.0);
+    const auto range = aggregator.getBars(id, BarResolution::M1, T0, T0 + MINUTE);
+    REQUIRE(range.unflushed.size() == 1);
+    REQUIRE(range.unflushed[0].tickCount == 3);
+    REQUIRE(range.unflushed[0].volume == Approx(5.0));
+    REQUIRE(range.unflushed[0].close == Approx(99.0));
+
+    // 3. 종료 시에는 전부
+    const auto all = aggregator.takeReadyDeltas(std::numeric_limits<int64_t>::max());
+    REQUIRE(all.size() == 10);      // 1s x4, 1m x2, 5m x2, 1h x1, 1d x1
+    REQUIRE(aggregator.getStats().pending == 0);
+
+    aggregator.discard(id);
+}
@@ -0,0 +1,110 @@
+#include <catch2/catch.hpp>
+#include "repositories/DecryptedSettingsCache.h"
+#include <string>
+
+using repositories::DecryptedSettingsCache;
+
+namespace {
+
+    models::UserSettings makeSettings(int64_t id, int64_t userId, const std::string& exchange, const std::string& cipher) {
+        models::UserSettings settings;
+        settings.setId(id);
+        settings.setUserId(userId);
+        settings.setExchangeName(exchange);
+        Json::Value creds;
+        creds["apiKey"] = "enc-key-" + cipher;
+        creds["secret"] = "enc-secret-" + cipher;
+        settings.setApiCredentials(creds);
+        return settings;
+    }
+
+} // namespace
+
+TEST_CASE("DecryptedSettingsCache serves plaintext by id and user", "[DecryptedSettingsCache]") {
+    DecryptedSettingsCache cache(std::chrono::seconds(60), 8);
+    const auto epoch = cache.epoch();
+    REQUIRE(cache.put(makeSettings(1, 10, "binance", "a"), std::string("key-a"), std::string("secret-a"), 0, epoch));
+    REQUIRE(cache.put(makeSettings(2, 10, "upbit", "b"), std::string("key-b"), std::string("secret-b"), 0, epoch));
+    cache.putUser(10, {1, 2}, 0, epoch);
+
+    // 1. id 조회는 평문 자격증명
+    const auto found = cache.find(1, 0);
+    REQUIRE(found.has_value());
+    REQUIRE(found->getApiCredentials()["apiKey"].asString() == "key-a");
+    REQUIRE(found->getApiCredentials()["secret"].asString() == "secret-a");
+
+    // 2. 사용자 목록 조회
+    const auto byUser = cache.findByUser(10, 0);
+    REQUIRE(byUser.has_value());
+    REQUIRE(byUser->size() == 2);
+
+    // 3. 암호문이 같을 때만 이미 읽은 행을 평문으로 치환
+    auto row = makeSettings(2, 10, "upbit", "b");
+    REQUIRE(cache.decryptFromCache(row, 0));
+    REQUIRE(row.getApiCredentials()["apiKey"].asString() == "key-b");
+    auto changed = makeSettings(2, 10, "upbit", "rotated");
+    REQUIRE_FALSE(cache.decryptFromCache(changed, 0));
+
+    // 4. 잠금 메모리에서 바로 전달
+    std::string seen;
+    REQUIRE(cache.visitCredentials(1, 0, [&](std::string_view apiKey, std::string_view secret) {
+        seen = std::string(apiKey) + ":" + std::string(secret);
+    }));
+    REQUIRE(seen == "key-a:secret-a");
+}
+
+TEST_CASE("DecryptedSettingsCache invalidation and expiry", "[DecryptedSettingsCache]") {
+    DecryptedSettingsCache cache(std::chrono::seconds(60), 2);
+    auto epoch = cache.epoch();
+    cache.put(makeSettings(1, 10, "binance", "a"), std::string("key-a"), std::string("secret-a"), 0, epoch);
+    cache.putUser(10, {1}, 0, epoch);
+
+    // 1. 무효화하면 항목과 사용자 목록이 함께 빠지고, 무효화 전에 읽은 epoch로는 다시 채우지 않음
+    cache.invalidate(1);
+    REQUIRE_FALSE(cache.find(1, 0).has_value());
+    REQUIRE_FALSE(cache.findByUser(10, 0).has_value());
+    REQUIRE_FALSE(cache.put(makeSettings(1, 10, "binance", "a"), std::string("key-a"), std::string("secret-a"), 0, epoch));
+
+    // 2. 키 세대가 바뀌면 미스, 새 세대로 저장하면 이전 항목 폐기
+    epoch = cache.epoch();
+    cache.put(makeSettings(1, 10, "binance", "a"), std::string("key-a"), std::string("secret-a"), 0, epoch);
+    REQUIRE_FALSE(cache.find(1, 1).has_value());
+    cache.put(makeSettings(2, 10, "upbit", "b"), std::string("key-b"), std::string("secret-b"), 1, epoch);
+    REQUIRE(cache.size() == 1);
+    REQUIRE_FALSE(cache.find(1, 0).has_value());
+
+    // 이전 세대 키로 복호화한 늦은 쓰기는 버리고 새 세대 항목을 유지
+    REQUIRE_FALSE(cache.put(makeSettings(1, 10, "binance", "a"), std::string("key-a"), std::string("secret-a"), 0, epoch));
+    REQUIRE(cache.find(2, 1).has_value());
+    REQUIRE_FALSE(cache.find(1, 0).has_value());
+
+    // 3. 상한을 넘으면 가장 먼저 만료될 항목 축출
+    cache.put(makeSettings(3, 11, "upbit", "c"), std::string("key-c"), std::nullopt, 1, epoch);
+    cache.put(makeSettings(4, 12, "upbit", "d"), std::string("key-d"), std::nullopt, 1, epoch);
+    REQUIRE(cache.size() == 2);
+    REQUIRE_FALSE(cache.find(2, 1).has_value());
+    REQUIRE(cache.find(4, 1).has_value());
+
+    // 4. 길이 초과 평문은 캐시하지 않음
+    const std::string oversized(SecureString::MAX_LENGTH + 1, 'x');
+    REQUIRE_FALSE(cache.put(makeSettings(5, 13, "upbit", "e"), oversized, std::nullopt, 1, epoch));
+
+    // 5. TTL 0이면 즉시 만료
+    DecryptedSettingsCache expired(std::chrono::seconds(0), 2);
+    expired.put(makeSettings(1, 10, "binance", "a"), std::string("key-a"), std::nullopt, 0, expired.epoch());
+    REQUIRE_FALSE(expired.find(1, 0).has_value());
+}
+
+TEST_CASE("SecureString returns its slot to the locked pool", "[DecryptedSettingsCache]") {
+    auto& pool = LockedMemoryPool::getInstance();
+    const auto before = pool.available();
+    {
+        SecureString first("credential");
+        SecureString moved(std::move(first));
+        REQUIRE(first.empty());
+        REQUIRE(moved.view() == "credential");
+        REQUIRE(pool.available() == before - 1);
+    }
+    REQUIRE(pool.available() == before);
+    REQUIRE_THROWS_AS(SecureString(std::string(SecureString::MAX_LENGTH + 1, 'x')), std::invalid_argument);
+}
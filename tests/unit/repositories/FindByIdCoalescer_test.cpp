@@ -0,0 +1,222 @@
+#include <catch2/catch.hpp>
+#include "repositories/FindByIdCoalescer.h"
+#include <trantor/net/EventLoop.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using repositories::FindByIdCoalescer;
+
+namespace {
+
+    struct Row {
+        int64_t id;
+        int64_t getId() const { return id; }
+    };
+
+    // 짝수 id만 존재. 호출마다 받은 id 목록 기록
+    // 첫 호출은 release()까지 멈춰 "진행 중인 조회"를 만듦 (gated가 true일 때)
+    struct GatedLoader {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::vector<std::vector<int64_t>> calls;
+        bool gated = true;
+
+        std::vector<Row> operator()(const std::vector<int64_t>& ids) {
+            std::unique_lock<std::mutex> lock(mutex);
+            calls.push_back(ids);
+            changed.notify_all();
+            if (calls.size() == 1) {
+                changed.wait(lock, [this] { return !gated; });
+            }
+            std::vector<Row> rows;
+            for (int64_t id : ids) {
+                if (id % 2 == 0) {
+                    rows.push_back(Row{id});
+                }
+            }
+            return rows;
+        }
+
+        void release() {
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                gated = false;
+            }
+            changed.notify_all();
+        }
+
+        bool waitForCalls(size_t count) {
+            std::unique_lock<std::mutex> lock(mutex);
+            return changed.wait_for(lock, std::chrono::seconds(10), [&] { return calls.size() >= count; });
+        }
+
+        size_t callCount() {
+            std::lock_guard<std::mutex> lock(mutex);
+            return calls.size();
+        }
+    };
+
+    template <typename Loader>
+    typename FindByIdCoalescer<Row>::Loader ref(Loader& loader) {
+        return [&loader](const std::vector<int64_t>& ids) { return loader(ids); };
+    }
+
+    // 진행 중인 첫 조회(id 1)를 시작하고 loader가 받을 때까지 대기
+    std::thread startBlockingLoad(FindByIdCoalescer<Row>& coalescer, GatedLoader& loader) {
+        std::thread first([&coalescer] { coalescer.load(1); });
+        REQUIRE(loader.waitForCalls(1));
+        return first;
+    }
+
+    void waitForRequests(const FindByIdCoalescer<Row>& coalescer, uint64_t count) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (coalescer.getStats().requests < count && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        REQUIRE(coalescer.getStats().requests >= count);
+    }
+
+} // namespace
+
+TEST_CASE("FindByIdCoalescer loads a single id", "[FindByIdCoalescer]") {
+    GatedLoader loader;
+    loader.gated = false;
+    FindByIdCoalescer<Row> coalescer(ref(loader), std::chrono::microseconds(0));
+
+    REQUIRE(coalescer.load(2)->id == 2);
+    REQUIRE_FALSE(coalescer.load(3).has_value());
+    REQUIRE(loader.callCount() == 2);
+    REQUIRE(coalescer.getStats().queries == 2);
+    REQUIRE(coalescer.getStats().bypassed == 0);
+}
+
+TEST_CASE("FindByIdCoalescer does not wait when nothing is in flight", "[FindByIdCoalescer]") {
+    GatedLoader loader;
+    loader.gated = false;
+    // 구간이 길어도 진행 중인 조회가 없으면 바로 조회
+    FindByIdCoalescer<Row> coalescer(ref(loader), std::chrono::seconds(30));
+
+    const auto start = std::chrono::steady_clock::now();
+    REQUIRE(coalescer.load(4)->id == 4);
+    REQUIRE(coalescer.load(6)->id == 6);
+    REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(10));
+    REQUIRE(loader.callCount() == 2);
+}
+
+TEST_CASE("FindByIdCoalescer merges loads that arrive during an in-flight query", "[FindByIdCoalescer]") {
+    GatedLoader loader;
+    FindByIdCoalescer<Row> coalescer(ref(loader), std::chrono::seconds(30));
+    auto first = startBlockingLoad(coalescer, loader);
+
+    // 1. 진행 중인 조회가 끝날 때까지 들어온 요청은 다음 한 번의 조회로 처리, 같은 id는 한 번만
+    const std::vector<int64_t> requested{4, 2, 4, 7, 2, 8};
+    std::vector<std::optional<Row>> results(requested.size());
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < requested.size(); ++i) {
+        threads.emplace_back([&, i] { results[i] = coalescer.load(requested[i]); });
+    }
+    waitForRequests(coalescer, 1 + requested.size());
+    REQUIRE(loader.callCount() == 1);
+
+    loader.release();
+    first.join();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    REQUIRE(loader.calls.size() == 2);
+    auto merged = loader.calls[1];     // 스레드 도착 순서는 정해지지 않음
+    std::sort(merged.begin(), merged.end());
+    REQUIRE(merged == std::vector<int64_t>{2, 4, 7, 8});
+    for (size_t i = 0; i < requested.size(); ++i) {
+        REQUIRE(results[i].has_value() == (requested[i] % 2 == 0));
+        if (results[i]) {
+            REQUIRE(results[i]->id == requested[i]);
+        }
+    }
+    const auto stats = coalescer.getStats();
+    REQUIRE(stats.requests == 7);
+    REQUIRE(stats.deduplicated == 2);
+
+    // 2. 끝난 배치의 결과는 보관하지 않음
+    REQUIRE(coalescer.load(4)->id == 4);
+    REQUIRE(loader.callCount() == 3);
+}
+
+TEST_CASE("FindByIdCoalescer queries as soon as the batch is full", "[FindByIdCoalescer]") {
+    GatedLoader loader;
+    // 진행 중인 조회가 있고 구간이 길어도 maxBatch개가 모이면 바로 조회
+    FindByIdCoalescer<Row> coalescer(ref(loader), std::chrono::seconds(30), 2);
+    auto first = startBlockingLoad(coalescer, loader);
+
+    std::thread second([&] { coalescer.load(2); });
+    std::thread third([&] { coalescer.load(6); });
+    REQUIRE(loader.waitForCalls(2));
+    second.join();
+    third.join();
+    REQUIRE(loader.calls[1].size() == 2);
+
+    loader.release();
+    first.join();
+}
+
+TEST_CASE("FindByIdCoalescer does not hold event loop threads", "[FindByIdCoalescer]") {
+    GatedLoader loader;
+    FindByIdCoalescer<Row> coalescer(ref(loader), std::chrono::seconds(30));
+    auto first = startBlockingLoad(coalescer, loader);
+
+    // 진행 중인 조회가 있어도 루프 스레드는 배치에 합류하지 않고 바로 조회
+    std::optional<Row> result;
+    std::thread onLoop([&] {
+        trantor::EventLoop loop;
+        result = coalescer.load(2);
+    });
+    onLoop.join();
+    REQUIRE(result->id == 2);
+    REQUIRE(loader.calls[1] == std::vector<int64_t>{2});
+    REQUIRE(coalescer.getStats().bypassed == 1);
+
+    loader.release();
+    first.join();
+}
+
+TEST_CASE("FindByIdCoalescer passes loader failures to every caller", "[FindByIdCoalescer]") {
+    GatedLoader gate;
+    std::atomic<int> failures{0};
+    FindByIdCoalescer<Row> coalescer(
+        [&gate](const std::vector<int64_t>& ids) -> std::vector<Row> {
+            gate(ids);
+            throw std::runtime_error("db down");
+        },
+        std::chrono::seconds(30));
+
+    std::vector<std::thread> threads;
+    const auto load = [&](int64_t id) {
+        try {
+            coalescer.load(id);
+        } catch (const std::runtime_error&) {
+            ++failures;
+        }
+    };
+    threads.emplace_back(load, 1);
+    REQUIRE(gate.waitForCalls(1));
+    for (int64_t id = 2; id <= 3; ++id) {
+        threads.emplace_back(load, id);
+    }
+    waitForRequests(coalescer, 3);
+    gate.release();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    REQUIRE(failures == 3);
+    REQUIRE(coalescer.getStats().queries == 2);
+
+    REQUIRE_THROWS_AS(FindByIdCoalescer<Row>(ref(gate), std::chrono::microseconds(0), 0),
+                      std::invalid_argument);
+}
@@ -0,0 +1,105 @@
+#include <catch2/catch.hpp>
+#include "repositories/MarketDataCache.h"
+#include "models/SymbolRegistry.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using repositories::MarketDataCache;
+
+namespace {
+
+    MarketDataCache::Tick tick(int64_t timestampMicros, double price) {
+        return MarketDataCache::Tick{0, price, 1.0, timestampMicros};
+    }
+
+} // namespace
+
+TEST_CASE("MarketDataCache latest quote", "[MarketDataCache]") {
+    auto& cache = MarketDataCache::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CACHE-LATEST");
+
+    // 1. 빈 슬롯은 미스
+    REQUIRE_FALSE(cache.latestPrice(id).has_value());
+    REQUIRE_FALSE(cache.latestQuote(id).has_value());
+
+    // 2. 최신 timestamp의 틱이 최신 시세
+    cache.update(id, tick(2000, 101.0), "binance");
+    cache.update(id, tick(1000, 99.0), "late");
+    REQUIRE(cache.latestPrice(id) == Approx(101.0));
+    const auto quote = cache.latestQuote(id);
+    REQUIRE(quote.has_value());
+    REQUIRE(quote->tick.timestampMicros == 2000);
+    REQUIRE(quote->source == "binance");
+
+    // 3. 무효화 후 미스
+    cache.invalidate(id);
+    REQUIRE_FALSE(cache.latestPrice(id).has_value());
+
+    // 4. 등록되지 않은 id
+    REQUIRE_FALSE(cache.latestPrice(models::SymbolRegistry::INVALID_ID).has_value());
+}
+
+TEST_CASE("MarketDataCache window coverage", "[MarketDataCache]") {
+    auto& cache = MarketDataCache::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CACHE-WINDOW");
+
+    // 1. 수신만 한 슬롯은 첫 틱 이후 구간만 응답
+    cache.update(id, tick(1000, 100.0), "feed");
+    cache.update(id, tick(2000, 110.0), "feed");
+    REQUIRE_FALSE(cache.summarizeSince(id, 500).has_value());
+    auto summary = cache.summarizeSince(id, 1000);
+    REQUIRE(summary.has_value());
+    REQUIRE(summary->count == 2);
+    REQUIRE(summary->firstPrice == Approx(100.0));
+    REQUIRE(summary->lastPrice == Approx(110.0));
+
+    // 2. 전체 이력으로 warm하면 이전 구간도 응답, 이후 수신분은 보존
+    cache.update(id, tick(3000, 120.0), "feed");
+    cache.warm(id, {tick(100, 50.0), tick(2000, 110.0)}, "db", true);
+    summary = cache.summarizeSince(id, 0);
+    REQUIRE(summary.has_value());
+    REQUIRE(summary->count == 3);
+    REQUIRE(summary->firstPrice == Approx(50.0));
+    REQUIRE(summary->lastPrice == Approx(120.0));
+    REQUIRE(cache.latestPrice(id) == Approx(120.0));
+
+    // 3. 링이 넘치면 밀려난 틱 이전 구간은 미스
+    for (size_t i = 0; i < MarketDataCache::CAPACITY; ++i) {
+        cache.update(id, tick(10000 + static_cast<int64_t>(i), 200.0 + static_cast<double>(i)), "feed");
+    }
+    REQUIRE_FALSE(cache.summarizeSince(id, 0).has_value());
+    summary = cache.summarizeSince(id, 10000);
+    REQUIRE(summary.has_value());
+    REQUIRE(summary->count == MarketDataCache::CAPACITY);
+    REQUIRE(summary->lastPrice == Approx(200.0 + static_cast<double>(MarketDataCache::CAPACITY - 1)));
+}
+
+TEST_CASE("MarketDataCache concurrent readers see whole ticks", "[MarketDataCache]") {
+    auto& cache = MarketDataCache::getInstance();
+    const auto id = models::SymbolRegistry::getInstance().intern("CACHE-RACE");
+    cache.update(id, MarketDataCache::Tick{1, 1.0, 1.0, 1}, "feed");
+
+    // 가격과 수량을 같은 값으로 기록하므로 찢어진 읽기는 불일치로 드러남
+    std::atomic<bool> done{false};
+    std::atomic<size_t> torn{0};
+    std::thread reader([&] {
+        while (!done.load()) {
+            if (const auto quote = cache.latestQuote(id)) {
+                if (quote->tick.price != quote->tick.volume ||
+                    quote->tick.price != static_cast<double>(quote->tick.timestampMicros)) {
+                    torn.fetch_add(1);
+                }
+            }
+        }
+    });
+    for (int64_t i = 2; i < 20000; ++i) {
+        const double value = static_cast<double>(i);
+        cache.update(id, MarketDataCache::Tick{i, value, value, i}, "feed");
+    }
+    done.store(true);
+    reader.join();
+
+    REQUIRE(torn.load() == 0);
+    REQUIRE(cache.latestPrice(id) == Approx(19999.0));
+}
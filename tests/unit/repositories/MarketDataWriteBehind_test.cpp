@@ -0,0 +1,263 @@
+#include <catch2/catch.hpp>
+#include "repositories/MarketDataWriteBehind.h"
+#include "utils/Logger.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using repositories::MarketDataWriteBehind;
+
+namespace {
+
+    using Result = MarketDataWriteBehind::EnqueueResult;
+
+    // start/stop이 로그를 남기므로 테스트 전용 경로로 한 번 초기화
+    MarketDataWriteBehind& writerWithLogger() {
+        static const bool initialized = [] {
+            utils::Logger::init((std::filesystem::temp_directory_path() / "trading_system_tests").string());
+            return true;
+        }();
+        (void)initialized;
+        return MarketDataWriteBehind::getInstance();
+    }
+
+    // sink가 받은 배치를 가격 목록으로 기록
+    struct RecordingSink {
+        std::mutex mutex;
+        std::condition_variable written;
+        std::vector<std::vector<double>> batches;
+
+        MarketDataWriteBehind::Sink sink() {
+            return [this](const std::vector<models::MarketData>& rows) {
+                std::vector<double> prices;
+                for (const auto& row : rows) {
+                    prices.push_back(row.getPrice());
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    batches.push_back(std::move(prices));
+                }
+                written.notify_all();
+            };
+        }
+
+        std::vector<double> all() {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::vector<double> prices;
+            for (const auto& batch : batches) {
+                prices.insert(prices.end(), batch.begin(), batch.end());
+            }
+            return prices;
+        }
+    };
+
+    std::shared_ptr<models::MarketData> tick(double price) {
+        auto data = std::make_shared<models::MarketData>();
+        data->setPrice(price);
+        data->setVolume(1.0);
+        return data;
+    }
+
+    MarketDataWriteBehind::Options options(RecordingSink& recorder, size_t capacity, size_t batchSize) {
+        MarketDataWriteBehind::Options result;
+        result.capacity = capacity;
+        result.batchSize = batchSize;
+        result.flushInterval = std::chrono::minutes(10);   // 주기 flush는 테스트 중에 일어나지 않음
+        result.sink = recorder.sink();
+        return result;
+    }
+
+} // namespace
+
+TEST_CASE("MarketDataWriteBehind flushes as soon as a batch fills", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+    RecordingSink recorder;
+    writer.start(options(recorder, 100, 3));
+
+    REQUIRE(writer.enqueue(tick(1.0)) == Result::Queued);
+    REQUIRE(writer.enqueue(tick(2.0)) == Result::Queued);
+    REQUIRE(writer.enqueue(tick(3.0)) == Result::Queued);
+    {
+        std::unique_lock<std::mutex> lock(recorder.mutex);
+        REQUIRE(recorder.written.wait_for(lock, std::chrono::seconds(10),
+                                          [&] { return !recorder.batches.empty(); }));
+        REQUIRE(recorder.batches[0] == std::vector<double>{1.0, 2.0, 3.0});
+    }
+
+    // 배치에 못 미친 틱은 stop에서 기록
+    REQUIRE(writer.enqueue(tick(4.0)) == Result::Queued);
+    writer.stop();
+    REQUIRE(recorder.all() == std::vector<double>{1.0, 2.0, 3.0, 4.0});
+    REQUIRE(writer.getStats().pending == 0);
+}
+
+TEST_CASE("MarketDataWriteBehind DropOldest keeps the newest ticks", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+    RecordingSink recorder;
+    auto writerOptions = options(recorder, 2, 100);
+    writerOptions.policy = MarketDataWriteBehind::OverflowPolicy::DropOldest;
+    writer.start(writerOptions);
+    const auto before = writer.getStats();
+
+    for (double price = 1.0; price <= 5.0; price += 1.0) {
+        REQUIRE(writer.enqueue(tick(price)) == Result::Queued);
+    }
+    const auto stats = writer.getStats();
+    REQUIRE(stats.pending == 2);
+    REQUIRE(stats.dropped - before.dropped == 3);
+    REQUIRE(stats.enqueued - before.enqueued == 5);
+
+    writer.stop();
+    REQUIRE(recorder.all() == std::vector<double>{4.0, 5.0});
+    REQUIRE(writer.getStats().pending == 0);
+    REQUIRE(writer.getStats().written - before.written == 2);
+}
+
+TEST_CASE("MarketDataWriteBehind DropNewest rejects ticks over capacity", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+    RecordingSink recorder;
+    auto writerOptions = options(recorder, 2, 100);
+    writerOptions.policy = MarketDataWriteBehind::OverflowPolicy::DropNewest;
+    writer.start(writerOptions);
+    const auto before = writer.getStats();
+
+    REQUIRE(writer.enqueue(tick(1.0)) == Result::Queued);
+    REQUIRE(writer.enqueue(tick(2.0)) == Result::Queued);
+    REQUIRE(writer.enqueue(tick(3.0)) == Result::Dropped);
+    REQUIRE(writer.getStats().dropped - before.dropped == 1);
+
+    writer.stop();
+    REQUIRE(recorder.all() == std::vector<double>{1.0, 2.0});
+}
+
+TEST_CASE("MarketDataWriteBehind Block waits for the flusher instead of dropping", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+    RecordingSink recorder;
+    auto writerOptions = options(recorder, 1, 100);
+    writerOptions.policy = MarketDataWriteBehind::OverflowPolicy::Block;
+    writer.start(writerOptions);
+    const auto before = writer.getStats();
+
+    // 여러 생산자가 용량 1인 큐를 공유: 초과분은 flush를 기다렸다가 들어감
+    std::atomic<int> rejected{0};
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < 4; ++producer) {
+        producers.emplace_back([&writer, &rejected, producer] {
+            for (int i = 0; i < 25; ++i) {
+                if (writer.enqueue(tick(producer * 100.0 + i)) != Result::Queued) {
+                    ++rejected;
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    writer.stop();
+
+    REQUIRE(rejected == 0);
+
+    const auto stats = writer.getStats();
+    REQUIRE(recorder.all().size() == 100);
+    REQUIRE(stats.dropped == before.dropped);
+    REQUIRE(stats.written - before.written == 100);
+    REQUIRE(stats.pending == 0);
+}
+
+TEST_CASE("MarketDataWriteBehind never queues past capacity under concurrent producers", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+    RecordingSink recorder;
+    auto writerOptions = options(recorder, 8, 100);     // 배치/주기 flush 없음: 큐는 stop까지 비지 않음
+    writerOptions.policy = MarketDataWriteBehind::OverflowPolicy::DropNewest;
+    writer.start(writerOptions);
+    const auto before = writer.getStats();
+
+    std::atomic<int> queued{0};
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < 8; ++producer) {
+        producers.emplace_back([&writer, &queued, producer] {
+            for (int i = 0; i < 50; ++i) {
+                if (writer.enqueue(tick(producer * 100.0 + i)) == Result::Queued) {
+                    ++queued;
+                }
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    REQUIRE(queued == 8);
+    REQUIRE(writer.getStats().pending == 8);
+    REQUIRE(writer.getStats().dropped - before.dropped == 8 * 50 - 8);
+
+    writer.stop();
+    REQUIRE(recorder.all().size() == 8);
+}
+
+TEST_CASE("MarketDataWriteBehind Block returns Closed to a producer waiting at stop", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+
+    // 첫 배치를 기록하는 동안 sink를 막아 큐가 다시 비지 않게 함
+    std::mutex gateMutex;
+    std::condition_variable gateCv;
+    bool entered = false;
+    bool released = false;
+    RecordingSink recorder;
+    auto writerOptions = options(recorder, 1, 100);
+    writerOptions.policy = MarketDataWriteBehind::OverflowPolicy::Block;
+    writerOptions.sink = [&, record = recorder.sink()](const std::vector<models::MarketData>& rows) {
+        {
+            std::unique_lock<std::mutex> lock(gateMutex);
+            entered = true;
+            gateCv.notify_all();
+            gateCv.wait(lock, [&] { return released; });
+        }
+        record(rows);
+    };
+    writer.start(writerOptions);
+    const auto before = writer.getStats();
+
+    // 1. 첫 틱은 바로 들어가고, 두 번째 틱은 flush가 첫 틱을 꺼낸 뒤 들어감 (flush 스레드는 sink에서 대기)
+    REQUIRE(writer.enqueue(tick(1.0)) == Result::Queued);
+    REQUIRE(writer.enqueue(tick(2.0)) == Result::Queued);
+    {
+        std::unique_lock<std::mutex> lock(gateMutex);
+        REQUIRE(gateCv.wait_for(lock, std::chrono::seconds(10), [&] { return entered; }));
+    }
+
+    // 2. 세 번째 생산자는 자리를 기다리다 종료를 만나면 버려지지 않고 Closed
+    Result waited = Result::Queued;
+    std::thread producer([&] { waited = writer.enqueue(tick(3.0)); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    std::thread stopper([&writer] { writer.stop(); });
+    producer.join();
+    REQUIRE(waited == Result::Closed);
+
+    {
+        std::lock_guard<std::mutex> lock(gateMutex);
+        released = true;
+    }
+    gateCv.notify_all();
+    stopper.join();
+
+    REQUIRE(recorder.all() == std::vector<double>{1.0, 2.0});
+    REQUIRE(writer.getStats().dropped == before.dropped);
+    REQUIRE(writer.getStats().pending == 0);
+}
+
+TEST_CASE("MarketDataWriteBehind rejects work while stopped", "[MarketDataWriteBehind]") {
+    auto& writer = writerWithLogger();
+    REQUIRE_FALSE(writer.isRunning());
+    REQUIRE(writer.enqueue(tick(1.0)) == Result::Closed);
+
+    // sink 없이 시작할 수 없음
+    REQUIRE_THROWS_AS(writer.start(MarketDataWriteBehind::Options{}), std::invalid_argument);
+    REQUIRE_FALSE(writer.isRunning());
+}
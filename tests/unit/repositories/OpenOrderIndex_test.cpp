@@ -0,0 +1,69 @@
+#include <catch2/catch.hpp>
+#include "repositories/OpenOrderIndex.h"
+#include <string>
+
+using repositories::OpenOrderIndex;
+
+namespace {
+
+    models::Order makeOrder(int64_t id, const std::string& symbol, const std::string& status, int64_t timestampMicros) {
+        models::Order order;
+        order.setId(id);
+        order.setOrderId("EX-" + std::to_string(id));
+        order.setSymbol(symbol);
+        order.setStatus(status);
+        order.setTimestamp(trantor::Date(timestampMicros));
+        return order;
+    }
+
+} // namespace
+
+TEST_CASE("OpenOrderIndex keeps only open orders", "[OpenOrderIndex]") {
+    OpenOrderIndex index;
+    REQUIRE_FALSE(index.isReady());
+
+    index.rebuild({makeOrder(1, "BTCUSDT", "PENDING", 100),
+                   makeOrder(2, "ETHUSDT", "PENDING", 300),
+                   makeOrder(3, "BTCUSDT", "FILLED", 200)});
+    REQUIRE(index.isReady());
+    REQUIRE(index.size() == 2);
+
+    // 1. 키별 조회
+    REQUIRE(index.findById(1).has_value());
+    REQUIRE_FALSE(index.findById(3).has_value());
+    REQUIRE(index.findByOrderId("EX-2")->getId() == 2);
+    REQUIRE(index.findOpen("BTCUSDT").size() == 1);
+    REQUIRE(index.findOpen("UNKNOWN").empty());
+
+    // 2. timestamp 내림차순 + limit
+    index.upsert(makeOrder(4, "BTCUSDT", "PENDING", 400));
+    const auto pending = index.findByStatus("PENDING", 2);
+    REQUIRE(pending.size() == 2);
+    REQUIRE(pending[0].getId() == 4);
+    REQUIRE(pending[1].getId() == 2);
+    REQUIRE(index.findOpen().size() == 3);
+
+    // 3. 종결 상태로 저장하면 제거
+    index.upsert(makeOrder(4, "BTCUSDT", "CANCELLED", 400));
+    REQUIRE_FALSE(index.findById(4).has_value());
+    REQUIRE_FALSE(index.findByOrderId("EX-4").has_value());
+    REQUIRE(index.findOpen("BTCUSDT").size() == 1);
+}
+
+TEST_CASE("OpenOrderIndex applies status updates", "[OpenOrderIndex]") {
+    OpenOrderIndex index;
+    index.rebuild({makeOrder(1, "BTCUSDT", "PENDING", 100)});
+
+    // 1. 미체결 유지 시 체결 수량 갱신
+    REQUIRE(index.applyStatus(1, "PENDING", 0.5, 101.0));
+    REQUIRE(index.findById(1)->getFilledQuantity() == Approx(0.5));
+
+    // 2. 체결 완료 시 제거
+    REQUIRE(index.applyStatus(1, "FILLED", 1.0, 101.0));
+    REQUIRE(index.size() == 0);
+    REQUIRE(index.findByStatus("PENDING", 10).empty());
+
+    // 3. 인덱스에 없는 주문: 종결 상태면 처리 완료, 미체결 상태면 호출자가 행을 읽어야 함
+    REQUIRE(index.applyStatus(99, "CANCELLED", 0.0, 0.0));
+    REQUIRE_FALSE(index.applyStatus(99, "PENDING", 0.0, 0.0));
+}
@@ -0,0 +1,47 @@
+#include <catch2/catch.hpp>
+#include "repositories/PageToken.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+using repositories::PageCursor;
+using repositories::PageToken;
+
+TEST_CASE("PageToken round trip", "[PageToken]") {
+    // 1. 빈 토큰은 첫 페이지
+    REQUIRE_FALSE(PageToken::decode("").has_value());
+
+    // 2. 인코딩/디코딩 왕복 (음수 시각 포함)
+    for (const auto& cursor : {PageCursor{1700000000123456, 42},
+                               PageCursor{-1, 1},
+                               PageCursor{0, INT64_MAX}}) {
+        const auto token = PageToken::encode(cursor);
+        REQUIRE(token.size() == 23);
+        REQUIRE(token.find_first_not_of(
+            "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_") == std::string::npos);
+
+        const auto decoded = PageToken::decode(token);
+        REQUIRE(decoded.has_value());
+        REQUIRE(decoded->timestampMicros == cursor.timestampMicros);
+        REQUIRE(decoded->id == cursor.id);
+    }
+}
+
+TEST_CASE("PageToken rejects malformed tokens", "[PageToken]") {
+    const auto token = PageToken::encode(PageCursor{1700000000123456, 42});
+
+    // 길이/문자 오류
+    REQUIRE_THROWS_AS(PageToken::decode(token.substr(1)), std::invalid_argument);
+    REQUIRE_THROWS_AS(PageToken::decode(token + "A"), std::invalid_argument);
+    auto badChar = token;
+    badChar[5] = '+';
+    REQUIRE_THROWS_AS(PageToken::decode(badChar), std::invalid_argument);
+
+    // 버전 바이트 변조
+    auto badVersion = token;
+    badVersion[0] = 'B';
+    REQUIRE_THROWS_AS(PageToken::decode(badVersion), std::invalid_argument);
+
+    // id는 양수여야 함
+    REQUIRE_THROWS_AS(PageToken::decode(PageToken::encode(PageCursor{1, 0})), std::invalid_argument);
+}
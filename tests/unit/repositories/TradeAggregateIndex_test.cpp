@@ -0,0 +1,131 @@
+#include <catch2/catch.hpp>
+#include "repositories/TradeAggregateIndex.h"
+#include <optional>
+#include <vector>
+
+using repositories::TradeAggregateIndex;
+
+namespace {
+
+    constexpr int64_t BUCKET = TradeAggregateIndex::BUCKET_MICROS;
+    constexpr int64_t BASE = 1699920000LL * 1000000;    // 버킷 경계
+    constexpr models::SymbolId SYMBOL = 7;
+
+    void load(TradeAggregateIndex& index) {
+        const auto token = index.beginLoad(SYMBOL);
+        // 로드 스냅샷: 버킷 0에 2건, 버킷 3에 1건
+        REQUIRE(index.finishLoad(SYMBOL, token, BASE, {
+            {BASE, models::TradeAggregate{3.0, 300.0, 2}},
+            {BASE + 3 * BUCKET, models::TradeAggregate{1.0, 110.0, 1}},
+        }));
+    }
+
+} // namespace
+
+TEST_CASE("TradeAggregateIndex answers aligned ranges from prefix sums", "[TradeAggregateIndex]") {
+    TradeAggregateIndex index;
+    REQUIRE_FALSE(index.lookup(SYMBOL, BASE, BASE + BUCKET).has_value());
+    load(index);
+
+    // 1. 버킷 경계에 맞는 구간은 보정 없음
+    auto lookup = index.lookup(SYMBOL, BASE, BASE + 4 * BUCKET);
+    REQUIRE(lookup.has_value());
+    REQUIRE(lookup->indexed.count == 3);
+    REQUIRE(lookup->indexed.volume == Approx(4.0));
+    REQUIRE(lookup->indexed.vwap() == Approx(102.5));
+    REQUIRE(lookup->residual[0].empty());
+    REQUIRE(lookup->residual[1].empty());
+
+    // 2. 새 체결 반영 (끝을 넘어가면 트리 확장)
+    index.add(SYMBOL, BASE + 100 * BUCKET + 5, 2.0, 50.0);
+    index.add(SYMBOL, BASE + BUCKET, 1.0, 90.0);
+    lookup = index.lookup(SYMBOL, BASE + BUCKET, BASE + 101 * BUCKET);
+    REQUIRE(lookup->indexed.count == 3);
+    REQUIRE(lookup->indexed.notional == Approx(90.0 + 110.0 + 100.0));
+
+    // 3. 체결이 없는 구간은 정확히 0
+    lookup = index.lookup(SYMBOL, BASE + 4 * BUCKET, BASE + 100 * BUCKET);
+    REQUIRE(lookup->indexed.count == 0);
+    REQUIRE(lookup->indexed.volume == 0.0);
+}
+
+TEST_CASE("TradeAggregateIndex returns residual edges", "[TradeAggregateIndex]") {
+    TradeAggregateIndex index;
+    load(index);
+
+    // 1. 경계 밖 자투리는 원본 행으로
+    auto lookup = index.lookup(SYMBOL, BASE + 10, BASE + 3 * BUCKET + 20);
+    REQUIRE(lookup->indexed.count == 0);        // 온전한 버킷 1, 2
+    REQUIRE(lookup->residual[0].fromMicros == BASE + 10);
+    REQUIRE(lookup->residual[0].toMicros == BASE + BUCKET);
+    REQUIRE(lookup->residual[1].fromMicros == BASE + 3 * BUCKET);
+    REQUIRE(lookup->residual[1].toMicros == BASE + 3 * BUCKET + 20);
+
+    // 2. 온전한 버킷이 없으면 전체가 residual
+    lookup = index.lookup(SYMBOL, BASE + 10, BASE + 20);
+    REQUIRE(lookup->residual[0].fromMicros == BASE + 10);
+    REQUIRE(lookup->residual[0].toMicros == BASE + 20);
+    REQUIRE(lookup->residual[1].empty());
+
+    // 3. 인덱스 구간 앞부분도 residual
+    lookup = index.lookup(SYMBOL, BASE - 5 * BUCKET, BASE + BUCKET);
+    REQUIRE(lookup->indexed.count == 2);
+    REQUIRE(lookup->residual[0].fromMicros == BASE - 5 * BUCKET);
+    REQUIRE(lookup->residual[0].toMicros == BASE);
+
+    // 4. 구간 밖 체결은 무시
+    index.add(SYMBOL, BASE - 1, 1.0, 1.0);
+    index.add(SYMBOL, BASE + TradeAggregateIndex::SPAN_MICROS, 1.0, 1.0);
+    lookup = index.lookup(SYMBOL, BASE, BASE + TradeAggregateIndex::SPAN_MICROS);
+    REQUIRE(lookup->indexed.count == 3);
+}
+
+TEST_CASE("TradeAggregateIndex rejects loads raced by writes", "[TradeAggregateIndex]") {
+    TradeAggregateIndex index;
+
+    // 1. 로드 중 체결이 들어오면 스냅샷에 포함됐는지 알 수 없으므로 설치하지 않음
+    auto token = index.beginLoad(SYMBOL);
+    index.add(SYMBOL, BASE, 1.0, 100.0);
+    REQUIRE_FALSE(index.finishLoad(SYMBOL, token, BASE, {}));
+    REQUIRE_FALSE(index.coverage(SYMBOL).has_value());
+
+    // 2. 전체 무효화도 마찬가지
+    token = index.beginLoad(SYMBOL);
+    index.invalidateAll();
+    REQUIRE_FALSE(index.finishLoad(SYMBOL, token, BASE, {}));
+
+    // 3. 무효화 후에는 미스
+    load(index);
+    REQUIRE(index.coverage(SYMBOL)->fromMicros == BASE);
+    REQUIRE(index.coverage(SYMBOL)->toMicros == BASE + TradeAggregateIndex::SPAN_MICROS);
+    index.invalidate(SYMBOL);
+    REQUIRE_FALSE(index.lookup(SYMBOL, BASE, BASE + BUCKET).has_value());
+}
+
+TEST_CASE("TradeAggregateIndex rejects loads overlapping in-flight writes", "[TradeAggregateIndex]") {
+    TradeAggregateIndex index;
+
+    // 1. 쓰기가 커밋됐지만 아직 add되지 않은 사이에 시작/종료한 로드는 설치하지 않음
+    {
+        TradeAggregateIndex::WriteGuard write(index, {SYMBOL, SYMBOL});
+        const auto token = index.beginLoad(SYMBOL);
+        REQUIRE_FALSE(index.finishLoad(SYMBOL, token, BASE, {{BASE, models::TradeAggregate{1.0, 100.0, 1}}}));
+        index.add(SYMBOL, BASE, 1.0, 100.0);
+    }
+    REQUIRE_FALSE(index.coverage(SYMBOL).has_value());
+
+    // 2. 쓰기 구간 안에서 시작해 구간이 닫힌 뒤 끝난 로드도 거부
+    std::optional<TradeAggregateIndex::LoadToken> token;
+    {
+        TradeAggregateIndex::WriteGuard write(index, {SYMBOL});
+        token = index.beginLoad(SYMBOL);
+    }
+    REQUIRE_FALSE(index.finishLoad(SYMBOL, *token, BASE, {}));
+
+    // 3. 다른 심볼의 쓰기는 영향 없음
+    {
+        TradeAggregateIndex::WriteGuard write(index, {SYMBOL + 1});
+        load(index);
+    }
+    REQUIRE(index.coverage(SYMBOL).has_value());
+}
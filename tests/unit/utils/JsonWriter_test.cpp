@@ -0,0 +1,54 @@
+#include <catch2/catch.hpp>
+#include "utils/JsonWriter.h"
+#include "utils/JsonUtils.h"
+#include <limits>
+#include <string>
+
+TEST_CASE("JsonWriter streaming output", "[JsonWriter]") {
+    utils::JsonWriter writer;
+
+    // 1. 중첩 구조와 구분자
+    writer.beginObject()
+        .field("id", static_cast<int64_t>(42))
+        .field("name", "BTC/USDT")
+        .field("price", 0.1)
+        .field("active", true)
+        .key("tags").beginArray().value("a").value("b").endArray()
+        .key("empty").beginObject().endObject()
+        .endObject();
+    REQUIRE(writer.str() ==
+        R"({"id":42,"name":"BTC/USDT","price":0.1,"active":true,"tags":["a","b"],"empty":{}})");
+
+    // 2. 이스케이프와 비유한 실수
+    writer.clear();
+    writer.beginArray()
+        .value("quote\" back\\ nl\n ctl\x01")
+        .value(std::numeric_limits<double>::quiet_NaN())
+        .nullValue()
+        .endArray();
+    REQUIRE(writer.str() == R"(["quote\" back\\ nl\n ctl\u0001",null,null])");
+
+    // 3. trantor::Date::toFormattedString(false)와 같은 타임스탬프 형식 (UTC)
+    writer.clear();
+    writer.timestamp(trantor::Date(1700000000123456LL));
+    REQUIRE(writer.str() == "\"20231114 22:13:20\"");
+
+    // 4. 구조 오류 감지
+    writer.clear();
+    writer.beginObject();
+    REQUIRE_THROWS_AS(writer.value(1), std::logic_error);
+    REQUIRE_THROWS_AS(writer.endArray(), std::logic_error);
+    REQUIRE_THROWS_AS(writer.release(), std::logic_error);
+}
+
+TEST_CASE("JsonWriter matches Json::Value round trip", "[JsonWriter]") {
+    Json::Value params;
+    params["ma_period"] = 20;
+    params["ratio"] = 1.5;
+    params["symbols"].append("BTC/USDT");
+    params["symbols"].append("ETH/USDT");
+    params["enabled"] = false;
+
+    auto parsed = utils::JsonUtils::parseJson(utils::JsonUtils::toJsonString(params));
+    REQUIRE(parsed == params);
+}
@@ -0,0 +1,31 @@
+#include <catch2/catch.hpp>
+#include "utils/TimestampParser.h"
+
+TEST_CASE("TimestampParser parses Postgres timestamps", "[TimestampParser]") {
+    using utils::TimestampParser;
+
+    // 2023-11-14 22:13:20 UTC = 1700000000
+    constexpr int64_t kBase = 1700000000LL * 1000000;
+
+    // 1. 오프셋 없음은 UTC, 소수 초는 마이크로초로 정규화
+    REQUIRE(TimestampParser::parseMicros("2023-11-14 22:13:20") == kBase);
+    REQUIRE(TimestampParser::parseMicros("2023-11-14 22:13:20.5") == kBase + 500000);
+    REQUIRE(TimestampParser::parseMicros("2023-11-14 22:13:20.123456") == kBase + 123456);
+    REQUIRE(TimestampParser::parseMicros("2023-11-14T22:13:20.1234567Z") == kBase + 123456);
+
+    // 2. timestamptz 오프셋 (같은 초 접두사 -> 캐시 경로)
+    REQUIRE(TimestampParser::parseMicros("2023-11-14 22:13:20+00") == kBase);
+    REQUIRE(TimestampParser::parseMicros("2023-11-14 22:13:20+09") == kBase - 9LL * 3600 * 1000000);
+    REQUIRE(TimestampParser::parseMicros("2023-11-14 22:13:20.000001-05:30") ==
+            kBase + (5LL * 3600 + 30 * 60) * 1000000 + 1);
+
+    // 3. 윤년과 epoch 이전
+    REQUIRE(TimestampParser::parseMicros("2024-02-29 00:00:00") == 1709164800LL * 1000000);
+    REQUIRE(TimestampParser::parseMicros("1969-12-31 23:59:59") == -1000000);
+
+    // 4. 형식 오류
+    REQUIRE_FALSE(TimestampParser::parseMicros("").has_value());
+    REQUIRE_FALSE(TimestampParser::parseMicros("2023-13-14 22:13:20").has_value());
+    REQUIRE_FALSE(TimestampParser::parseMicros("2023-11-14 22:13:20.").has_value());
+    REQUIRE_FALSE(TimestampParser::parseMicros("2023-11-14 22:13:20 junk").has_value());
+}